@@ -0,0 +1,373 @@
+/**
+ * @file adjacencia.c
+ * @brief Implementação da matriz de adjacências em bits dos grafos pequenos e densos.
+ *
+ * @author Rogério Picas
+ * @date 18-10-2026
+ * @version 1.0
+ */
+#define _CRT_SECURE_NO_WARNINGS
+#include <stdio.h>
+#include <stdlib.h>
+#include "adjacencia.h"
+
+#pragma region Funções Auxiliares
+
+/**
+ * @brief Devolve a palavra com apenas o bit da posição indicada a 1.
+ */
+static uint64_t bit(int posicao) {
+	return (uint64_t)1 << posicao;
+}
+
+/**
+ * @brief Devolve a posição do bit menos significativo a 1 de uma palavra não nula.
+ */
+static int primeiroBit(uint64_t palavra) {
+#if defined(__GNUC__) || defined(__clang__)
+	return __builtin_ctzll(palavra);
+#else
+	int posicao = 0;
+	while (!((palavra >> posicao) & 1)) posicao++;
+	return posicao;
+#endif
+}
+
+/**
+ * @brief Conta os bits a 1 de uma palavra.
+ */
+static int contarBits(uint64_t palavra) {
+#if defined(__GNUC__) || defined(__clang__)
+	return __builtin_popcountll(palavra);
+#else
+	int num = 0;
+	for (; palavra; palavra &= palavra - 1) num++;
+	return num;
+#endif
+}
+
+/**
+ * @brief Procura em largura sobre os bits: cada nível é o OR das linhas da fronteira.
+ *
+ * @param[in] linhas - linhas da matriz.
+ * @param[in] origem - posição de origem.
+ * @param[in] bloqueadas - posições que não podem ser atravessadas (a origem pode estar incluída).
+ *
+ * @return conjunto das posições alcançadas, incluindo a origem.
+ */
+static uint64_t alcancaveisBits(const uint64_t* linhas, int origem, uint64_t bloqueadas) {
+	uint64_t visitadas = bit(origem);
+	uint64_t fronteira = visitadas;
+	while (fronteira) {
+		uint64_t proxima = 0;
+		while (fronteira) {
+			proxima |= linhas[primeiroBit(fronteira)];
+			fronteira &= fronteira - 1;
+		}
+		fronteira = proxima & ~visitadas & ~bloqueadas;
+		visitadas |= fronteira;
+	}
+	return visitadas;
+}
+
+/**
+ * @brief Conta os caminhos simples de uma posição até ao destino sem passar pelas posições já visitadas.
+ *
+ * Antes de descer, verifica com uma procura em largura sobre os bits se o destino ainda é
+ * alcançável sem atravessar o caminho atual; os ramos sem saída são cortados logo.
+ *
+ * @param[in] linhas - linhas da matriz.
+ * @param[in] atual - posição atual.
+ * @param[in] destino - posição de destino.
+ * @param[in] visitadas - posições do caminho atual.
+ *
+ * @return número de caminhos.
+ */
+static int contarCaminhosBits(const uint64_t* linhas, int atual, int destino, uint64_t visitadas) {
+	if (atual == destino) return 1;
+
+	visitadas |= bit(atual);
+	if (!(alcancaveisBits(linhas, atual, visitadas) & bit(destino))) return 0;
+
+	int total = 0;
+	uint64_t candidatas = linhas[atual] & ~visitadas;
+	while (candidatas) {
+		total += contarCaminhosBits(linhas, primeiroBit(candidatas), destino, visitadas);
+		candidatas &= candidatas - 1;
+	}
+	return total;
+}
+
+#pragma endregion
+
+#pragma region Funções da Matriz de Adjacências
+
+/**
+ * @brief Cria ou descarta a matriz de adjacências do grafo.
+ *
+ * Um grafo com até MATRIZ_MAX_VERTICES vértices passa a ter matriz quando o grau médio chega a
+ * MATRIZ_GRAU_ATIVAR e perde-a quando excede esse número de vértices ou o grau médio desce
+ * abaixo de MATRIZ_GRAU_DESATIVAR. Sem matriz, o grau médio é calculado somando os graus
+ * (só nos grafos pequenos, no máximo MATRIZ_MAX_VERTICES parcelas).
+ *
+ * @param[in,out] grafo - apontador para o grafo.
+ *
+ * @return @c true se o grafo ficar com matriz de adjacências, @c false caso contrário.
+ */
+bool adaptarMatrizAdjacencia(GRAFO* grafo) {
+	if (grafo == NULL) return false;
+
+	if (grafo->matriz)
+	{
+		if (grafo->numVertices > MATRIZ_MAX_VERTICES ||
+			2LL * grafo->matriz->numLigacoes < (long long)grafo->numVertices * MATRIZ_GRAU_DESATIVAR)
+		{
+			descartarMatrizAdjacencia(grafo);
+		}
+	}
+	else if (grafo->numVertices > 0 && grafo->numVertices <= MATRIZ_MAX_VERTICES)
+	{
+		long long graus = 0;
+		for (VERTICE* v = grafo->vertices; v != NULL; v = v->prox) {
+			graus += v->grau;
+		}
+		if (graus >= (long long)grafo->numVertices * MATRIZ_GRAU_ATIVAR)
+		{
+			construirMatrizAdjacencia(grafo);
+		}
+	}
+	return grafo->matriz != NULL;
+}
+
+/**
+ * @brief Constrói a matriz de adjacências a partir das listas do grafo.
+ *
+ * Os vértices recebem as posições pela ordem da lista. Cada ligação aparece duas vezes nas
+ * listas (uma aresta em cada sentido) e só é contada na lista do vértice de menor posição;
+ * as ligações de um vértice a si próprio têm as duas arestas na mesma lista.
+ *
+ * @param[in,out] grafo - apontador para o grafo.
+ *
+ * @return @c 0 se a construção for bem-sucedida,
+ *         @c 1 se o grafo for nulo ou tiver mais de MATRIZ_MAX_VERTICES vértices,
+ *         @c 2 se a alocação falhar.
+ */
+int construirMatrizAdjacencia(GRAFO* grafo) {
+	if (grafo == NULL || grafo->numVertices > MATRIZ_MAX_VERTICES) return 1;
+
+	descartarMatrizAdjacencia(grafo);
+	MATRIZ_ADJACENCIA* matriz = (MATRIZ_ADJACENCIA*)calloc(1, sizeof(MATRIZ_ADJACENCIA));
+	if (matriz == NULL) return 2;
+
+	int posicao = 0;
+	for (VERTICE* v = grafo->vertices; v != NULL; v = v->prox) {
+		v->posicaoMatriz = (signed char)posicao;
+		matriz->ocupadas |= bit(posicao);
+		posicao++;
+	}
+
+	for (VERTICE* v = grafo->vertices; v != NULL; v = v->prox) {
+		int i = v->posicaoMatriz;
+		int arestasProprias = 0;
+		for (ARESTA* adj = v->adjacentes; adj != NULL; adj = adj->prox) {
+			int j = adj->destino->posicaoMatriz;
+			if (j == i)
+			{
+				arestasProprias++;
+				continue;
+			}
+			if (j < i) continue;
+
+			matriz->numLigacoes++;
+			if (matriz->linhas[i] & bit(j))
+			{
+				matriz->repetidas++;
+			}
+			else
+			{
+				matriz->linhas[i] |= bit(j);
+				matriz->linhas[j] |= bit(i);
+			}
+		}
+		if (arestasProprias > 0)
+		{
+			matriz->numLigacoes += arestasProprias / 2;
+			matriz->repetidas += arestasProprias / 2 - 1;
+			matriz->linhas[i] |= bit(i);
+		}
+	}
+
+	grafo->matriz = matriz;
+	return 0;
+}
+
+/**
+ * @brief Descarta a matriz de adjacências e retira as posições aos vértices.
+ *
+ * @param[in,out] grafo - apontador para o grafo.
+ */
+void descartarMatrizAdjacencia(GRAFO* grafo) {
+	if (grafo == NULL || grafo->matriz == NULL) return;
+
+	for (VERTICE* v = grafo->vertices; v != NULL; v = v->prox) {
+		v->posicaoMatriz = -1;
+	}
+	free(grafo->matriz);
+	grafo->matriz = NULL;
+}
+
+/**
+ * @brief Dá ao vértice a primeira posição livre da matriz.
+ *
+ * Se todas as posições estiverem ocupadas, o grafo deixa de ser pequeno e a matriz é descartada.
+ *
+ * @param[in,out] grafo - apontador para o grafo.
+ * @param[in,out] vertice - apontador para o vértice acabado de inserir.
+ */
+void inserirVerticeMatriz(GRAFO* grafo, VERTICE* vertice) {
+	if (grafo == NULL || grafo->matriz == NULL || vertice == NULL) return;
+
+	MATRIZ_ADJACENCIA* matriz = grafo->matriz;
+	if (matriz->ocupadas == ~(uint64_t)0)
+	{
+		descartarMatrizAdjacencia(grafo);
+		return;
+	}
+	int posicao = primeiroBit(~matriz->ocupadas);
+	matriz->ocupadas |= bit(posicao);
+	matriz->linhas[posicao] = 0;
+	vertice->posicaoMatriz = (signed char)posicao;
+}
+
+/**
+ * @brief Liberta a posição do vértice na matriz.
+ *
+ * @param[in,out] grafo - apontador para o grafo.
+ * @param[in,out] vertice - apontador para o vértice (as suas ligações já foram removidas).
+ */
+void removerVerticeMatriz(GRAFO* grafo, VERTICE* vertice) {
+	if (grafo == NULL || grafo->matriz == NULL || vertice == NULL || vertice->posicaoMatriz < 0) return;
+
+	MATRIZ_ADJACENCIA* matriz = grafo->matriz;
+	matriz->ocupadas &= ~bit(vertice->posicaoMatriz);
+	matriz->linhas[vertice->posicaoMatriz] = 0;
+	vertice->posicaoMatriz = -1;
+}
+
+/**
+ * @brief Marca na matriz a ligação entre dois vértices.
+ *
+ * Se o par já estava ligado, a ligação só é contada como repetida.
+ *
+ * @param[in,out] grafo - apontador para o grafo.
+ * @param[in] a - apontador para um dos vértices.
+ * @param[in] b - apontador para o outro vértice.
+ */
+void ligarMatriz(GRAFO* grafo, VERTICE* a, VERTICE* b) {
+	if (grafo == NULL || grafo->matriz == NULL || a == NULL || b == NULL) return;
+	if (a->posicaoMatriz < 0 || b->posicaoMatriz < 0)
+	{
+		descartarMatrizAdjacencia(grafo);
+		return;
+	}
+
+	MATRIZ_ADJACENCIA* matriz = grafo->matriz;
+	matriz->numLigacoes++;
+	if (matriz->linhas[a->posicaoMatriz] & bit(b->posicaoMatriz))
+	{
+		matriz->repetidas++;
+	}
+	else
+	{
+		matriz->linhas[a->posicaoMatriz] |= bit(b->posicaoMatriz);
+		matriz->linhas[b->posicaoMatriz] |= bit(a->posicaoMatriz);
+	}
+}
+
+/**
+ * @brief Desmarca na matriz a ligação entre dois vértices.
+ *
+ * O bit só é apagado se não restar outra aresta entre os dois vértices nas listas
+ * (percorre apenas a lista de adjacências de @p a).
+ *
+ * @param[in,out] grafo - apontador para o grafo.
+ * @param[in] a - apontador para um dos vértices.
+ * @param[in] b - apontador para o outro vértice.
+ */
+void desligarMatriz(GRAFO* grafo, VERTICE* a, VERTICE* b) {
+	if (grafo == NULL || grafo->matriz == NULL || a == NULL || b == NULL) return;
+	if (a->posicaoMatriz < 0 || b->posicaoMatriz < 0) return;
+
+	MATRIZ_ADJACENCIA* matriz = grafo->matriz;
+	matriz->numLigacoes--;
+	for (ARESTA* adj = a->adjacentes; adj != NULL; adj = adj->prox) {
+		if (adj->destino == b)
+		{
+			matriz->repetidas--;
+			return;
+		}
+	}
+	matriz->linhas[a->posicaoMatriz] &= ~bit(b->posicaoMatriz);
+	matriz->linhas[b->posicaoMatriz] &= ~bit(a->posicaoMatriz);
+}
+
+/**
+ * @brief Verifica se dois vértices estão ligados, lendo um bit da matriz.
+ *
+ * @param[in] matriz - apontador para a matriz.
+ * @param[in] a - apontador para um dos vértices.
+ * @param[in] b - apontador para o outro vértice.
+ *
+ * @return @c true se existir uma ligação entre os dois vértices, @c false caso contrário ou se algum apontador for nulo.
+ */
+bool ligadosMatriz(const MATRIZ_ADJACENCIA* matriz, const VERTICE* a, const VERTICE* b) {
+	if (matriz == NULL || a == NULL || b == NULL) return false;
+	if (a->posicaoMatriz < 0 || b->posicaoMatriz < 0) return false;
+
+	return (matriz->linhas[a->posicaoMatriz] >> b->posicaoMatriz) & 1;
+}
+
+/**
+ * @brief Calcula as posições alcançáveis a partir de um vértice.
+ *
+ * @param[in] matriz - apontador para a matriz.
+ * @param[in] origem - apontador para o vértice de origem.
+ *
+ * @return conjunto (bits) das posições alcançadas, incluindo a origem (0 se algum apontador for nulo).
+ */
+uint64_t alcancaveisMatriz(const MATRIZ_ADJACENCIA* matriz, const VERTICE* origem) {
+	if (matriz == NULL || origem == NULL || origem->posicaoMatriz < 0) return 0;
+
+	return alcancaveisBits(matriz->linhas, origem->posicaoMatriz, 0);
+}
+
+/**
+ * @brief Conta os vértices alcançáveis a partir de um vértice (popcount do conjunto alcançado).
+ *
+ * @param[in] matriz - apontador para a matriz.
+ * @param[in] origem - apontador para o vértice de origem.
+ *
+ * @return número de vértices alcançados, incluindo a origem (0 se algum apontador for nulo).
+ */
+int contarAlcancaveisMatriz(const MATRIZ_ADJACENCIA* matriz, const VERTICE* origem) {
+	return contarBits(alcancaveisMatriz(matriz, origem));
+}
+
+/**
+ * @brief Conta os caminhos simples entre dois vértices, com os vizinhos por visitar de cada passo
+ *        obtidos com um AND entre a linha do vértice e o complemento do caminho atual.
+ *
+ * @param[in] matriz - apontador para a matriz.
+ * @param[in] origem - apontador para o vértice de origem.
+ * @param[in] destino - apontador para o vértice de destino.
+ *
+ * @return número de caminhos (0 se algum apontador for nulo).
+ */
+int contarCaminhosMatriz(const MATRIZ_ADJACENCIA* matriz, const VERTICE* origem, const VERTICE* destino) {
+	if (matriz == NULL || origem == NULL || destino == NULL) return 0;
+	if (origem->posicaoMatriz < 0 || destino->posicaoMatriz < 0) return 0;
+
+	return contarCaminhosBits(matriz->linhas, origem->posicaoMatriz, destino->posicaoMatriz, 0);
+}
+
+#pragma endregion
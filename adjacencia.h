@@ -0,0 +1,150 @@
+#pragma once
+
+/**
+ * @file adjacencia.h
+ * @brief Matriz de adjacências em bits (uma palavra de 64 bits por vértice) para os grafos pequenos
+ *        e densos, usada pelas consultas de ligação, pela BFT e pela contagem de caminhos
+ *
+ * As listas de adjacências continuam a ser a representação principal do grafo: a matriz é uma
+ * cópia mantida a par a cada inserção e remoção, criada quando o grafo passa a ser pequeno e denso
+ * e descartada quando deixa de o ser. Com ela, testar uma ligação é ler um bit, expandir a
+ * fronteira da BFT é um OR das linhas dos vértices da fronteira e a contagem de caminhos escolhe
+ * os vizinhos por visitar com um AND.
+ *
+ * @author Rogério Picas
+ * @date 18-10-2026
+ * @version 1.0
+ *
+ */
+#include <stdint.h>
+#include "funcoes.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+ /** @def MATRIZ_MAX_VERTICES
+  *  @brief Número máximo de vértices de um grafo com matriz de adjacências (bits de uma palavra).
+  */
+#define MATRIZ_MAX_VERTICES 64
+
+ /** @def MATRIZ_GRAU_ATIVAR
+  *  @brief Grau médio a partir do qual um grafo pequeno passa a ter matriz de adjacências.
+  */
+#define MATRIZ_GRAU_ATIVAR 2
+
+ /** @def MATRIZ_GRAU_DESATIVAR
+  *  @brief Grau médio abaixo do qual a matriz é descartada (menor do que MATRIZ_GRAU_ATIVAR, para
+  *         que o grafo não esteja sempre a ganhar e a perder a matriz perto do limite).
+  */
+#define MATRIZ_GRAU_DESATIVAR 1
+
+#pragma region Estruturas
+
+/**
+ * @struct MatrizAdjacencia
+ * @brief Matriz de adjacências de um grafo com até MATRIZ_MAX_VERTICES vértices.
+ *
+ * Cada vértice ocupa uma posição (campo @c posicaoMatriz do vértice); o bit j da linha i está
+ * a 1 se existir pelo menos uma aresta entre os vértices das posições i e j.
+ */
+typedef struct MatrizAdjacencia {
+    uint64_t linhas[MATRIZ_MAX_VERTICES]; /**< Linha de bits de cada posição */
+    uint64_t ocupadas;                    /**< Posições atribuídas a vértices */
+    int numLigacoes;                      /**< Número de ligações do grafo (incluindo as repetidas) */
+    int repetidas;                        /**< Ligações a mais entre pares já ligados (a matriz só guarda uma) */
+} MATRIZ_ADJACENCIA;
+
+#pragma endregion
+
+#pragma region Funções da Matriz de Adjacências
+
+/**
+ * @brief Cria ou descarta a matriz do grafo, conforme o número de vértices e o grau médio.
+ * @param grafo Apontador para o grafo.
+ * @return true se, no fim, o grafo tiver matriz de adjacências.
+ */
+bool adaptarMatrizAdjacencia(GRAFO* grafo);
+
+/**
+ * @brief Constrói a matriz de adjacências do grafo a partir das listas (substitui a que existir).
+ * @param grafo Apontador para o grafo.
+ * @return 0 se a operação for bem-sucedida, 1 se o grafo for nulo ou tiver demasiados vértices e 2 em caso de falha de alocação.
+ */
+int construirMatrizAdjacencia(GRAFO* grafo);
+
+/**
+ * @brief Descarta a matriz de adjacências do grafo (os vértices ficam sem posição).
+ * @param grafo Apontador para o grafo.
+ */
+void descartarMatrizAdjacencia(GRAFO* grafo);
+
+/**
+ * @brief Atribui uma posição da matriz a um vértice acabado de inserir (descarta a matriz se estiver cheia).
+ * @param grafo Apontador para o grafo.
+ * @param vertice Apontador para o vértice.
+ */
+void inserirVerticeMatriz(GRAFO* grafo, VERTICE* vertice);
+
+/**
+ * @brief Liberta a posição da matriz de um vértice que vai ser removido (já sem arestas).
+ * @param grafo Apontador para o grafo.
+ * @param vertice Apontador para o vértice.
+ */
+void removerVerticeMatriz(GRAFO* grafo, VERTICE* vertice);
+
+/**
+ * @brief Regista na matriz uma ligação acabada de criar nas listas.
+ * @param grafo Apontador para o grafo.
+ * @param a Apontador para um dos vértices.
+ * @param b Apontador para o outro vértice.
+ */
+void ligarMatriz(GRAFO* grafo, VERTICE* a, VERTICE* b);
+
+/**
+ * @brief Regista na matriz uma ligação acabada de remover das listas.
+ * @param grafo Apontador para o grafo.
+ * @param a Apontador para um dos vértices.
+ * @param b Apontador para o outro vértice.
+ */
+void desligarMatriz(GRAFO* grafo, VERTICE* a, VERTICE* b);
+
+/**
+ * @brief Verifica na matriz se dois vértices estão ligados.
+ * @param matriz Apontador para a matriz.
+ * @param a Apontador para um dos vértices.
+ * @param b Apontador para o outro vértice.
+ * @return true se existir uma ligação entre os dois vértices.
+ */
+bool ligadosMatriz(const MATRIZ_ADJACENCIA* matriz, const VERTICE* a, const VERTICE* b);
+
+/**
+ * @brief Calcula as posições alcançáveis a partir de um vértice (procura em largura sobre os bits).
+ * @param matriz Apontador para a matriz.
+ * @param origem Apontador para o vértice de origem.
+ * @return Conjunto (bits) das posições alcançadas, incluindo a origem.
+ */
+uint64_t alcancaveisMatriz(const MATRIZ_ADJACENCIA* matriz, const VERTICE* origem);
+
+/**
+ * @brief Conta os vértices alcançáveis a partir de um vértice, sobre a matriz.
+ * @param matriz Apontador para a matriz.
+ * @param origem Apontador para o vértice de origem.
+ * @return Número de vértices alcançados, incluindo a origem.
+ */
+int contarAlcancaveisMatriz(const MATRIZ_ADJACENCIA* matriz, const VERTICE* origem);
+
+/**
+ * @brief Conta os caminhos simples entre dois vértices, sobre a matriz.
+ * @param matriz Apontador para a matriz (sem ligações repetidas).
+ * @param origem Apontador para o vértice de origem.
+ * @param destino Apontador para o vértice de destino.
+ * @return Número de caminhos, como o countPaths sobre as listas.
+ */
+int contarCaminhosMatriz(const MATRIZ_ADJACENCIA* matriz, const VERTICE* origem, const VERTICE* destino);
+
+#pragma endregion
+
+#ifdef __cplusplus
+}
+#endif
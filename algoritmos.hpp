@@ -0,0 +1,418 @@
+#pragma once
+
+/**
+ * @file algoritmos.hpp
+ * @brief Algoritmos genéricos sobre grafos (BFS, DFS, componentes, caminhos mais curtos e contagem
+ *        de caminhos), em C++ e apenas em cabeçalho, instanciados para as listas ligadas do GRAFO
+ *        e para uma cópia contígua das adjacências (CSR)
+ *
+ * Cada algoritmo é um template sobre o armazenamento do grafo e sobre o visitante, pelo que o
+ * compilador gera um ciclo próprio para cada combinação e o visitante (normalmente uma lambda)
+ * é expandido no ciclo, sem chamadas indiretas.
+ *
+ * Um armazenamento @c G tem de fornecer:
+ *   - @c G::No: identificador leve de um vértice (comparável com ==);
+ *   - @c G::NENHUM: valor de @c No que não corresponde a nenhum vértice;
+ *   - @c numVertices(): número de vértices;
+ *   - @c indice(No): posição do vértice, entre 0 e numVertices() - 1;
+ *   - @c vertice(i): vértice na posição i;
+ *   - @c vizinhos(No): intervalo (begin/end) com os vizinhos do vértice, pela ordem das arestas;
+ *   - @c antena(No): dados da antena do vértice.
+ *
+ * @author Rogério Picas
+ * @date 18-10-2026
+ * @version 1.0
+ *
+ */
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <queue>
+#include <utility>
+#include <vector>
+#include "funcoes.h"
+
+namespace pa {
+
+#pragma region Armazenamentos
+
+/**
+ * @class GrafoLigado
+ * @brief Vista sobre um GRAFO que percorre diretamente as listas ligadas de vértices e arestas.
+ *
+ * Ao ser criada, numera os vértices (campo @c indice); deixa de ser válida se forem inseridos
+ * ou removidos vértices, ou se outra vista numerar o mesmo grafo.
+ */
+class GrafoLigado {
+public:
+    using No = VERTICE*;
+    static constexpr No NENHUM = nullptr;
+
+    /** @brief Iterador sobre a lista de adjacências, que devolve o vértice destino de cada aresta. */
+    class IteradorVizinhos {
+    public:
+        explicit IteradorVizinhos(const ARESTA* aresta) : aresta_(aresta) {}
+        No operator*() const { return aresta_->destino; }
+        IteradorVizinhos& operator++() { aresta_ = aresta_->prox; return *this; }
+        bool operator==(const IteradorVizinhos& outro) const { return aresta_ == outro.aresta_; }
+        bool operator!=(const IteradorVizinhos& outro) const { return aresta_ != outro.aresta_; }
+    private:
+        const ARESTA* aresta_;
+    };
+
+    /** @brief Intervalo com os vizinhos de um vértice. */
+    struct Vizinhos {
+        const ARESTA* primeira;
+        IteradorVizinhos begin() const { return IteradorVizinhos(primeira); }
+        IteradorVizinhos end() const { return IteradorVizinhos(nullptr); }
+    };
+
+    /**
+     * @brief Cria a vista e numera os vértices do grafo pela ordem da lista.
+     * @param grafo Apontador para o grafo (pode ser NULL, ficando a vista vazia).
+     */
+    explicit GrafoLigado(GRAFO* grafo) : grafo_(grafo) {
+        if (grafo == nullptr) return;
+        vertices_.reserve(static_cast<std::size_t>(grafo->numVertices));
+        for (VERTICE* v = grafo->vertices; v != nullptr; v = v->prox) {
+            v->indice = static_cast<int>(vertices_.size());
+            vertices_.push_back(v);
+        }
+    }
+
+    std::size_t numVertices() const { return vertices_.size(); }
+    std::size_t indice(No v) const { return static_cast<std::size_t>(v->indice); }
+    No vertice(std::size_t i) const { return vertices_[i]; }
+    Vizinhos vizinhos(No v) const { return Vizinhos{ v->adjacentes }; }
+    const ANTENAS& antena(No v) const { return v->antena; }
+
+    /**
+     * @brief Procura o vértice da posição (x, y).
+     * @return O vértice, ou NENHUM se não existir.
+     */
+    No procurar(int x, int y) const { return grafo_ ? encontrarVertice(grafo_, x, y) : NENHUM; }
+
+private:
+    GRAFO* grafo_;
+    std::vector<VERTICE*> vertices_;
+};
+
+/**
+ * @class GrafoContiguo
+ * @brief Cópia das adjacências de um GRAFO em arrays contíguos (CSR): os vizinhos do vértice i
+ *        são destinos[inicio[i]] ... destinos[inicio[i + 1] - 1].
+ *
+ * A cópia é independente do GRAFO original (que pode mudar depois, sem afetar a cópia) e os
+ * vértices ficam pela ordem da lista do grafo, com as arestas pela ordem das listas de adjacências.
+ */
+class GrafoContiguo {
+public:
+    using No = int;
+    static constexpr No NENHUM = -1;
+
+    /** @brief Intervalo com os vizinhos de um vértice. */
+    struct Vizinhos {
+        const int* inicio;
+        const int* fim;
+        const int* begin() const { return inicio; }
+        const int* end() const { return fim; }
+    };
+
+    /**
+     * @brief Copia os vértices e as arestas do grafo.
+     * @param grafo Apontador para o grafo (pode ser NULL, ficando a cópia vazia).
+     */
+    explicit GrafoContiguo(GRAFO* grafo) {
+        GrafoLigado ligado(grafo);
+        const std::size_t n = ligado.numVertices();
+        inicio_.reserve(n + 1);
+        antenas_.reserve(n);
+        posicoes_.reserve(n);
+        inicio_.push_back(0);
+        for (std::size_t i = 0; i < n; i++) {
+            VERTICE* v = ligado.vertice(i);
+            for (VERTICE* w : ligado.vizinhos(v)) {
+                destinos_.push_back(w->indice);
+            }
+            inicio_.push_back(static_cast<int>(destinos_.size()));
+            antenas_.push_back(v->antena);
+            posicoes_.emplace_back(celula(v->antena.x, v->antena.y), static_cast<int>(i));
+        }
+        std::sort(posicoes_.begin(), posicoes_.end());
+    }
+
+    std::size_t numVertices() const { return antenas_.size(); }
+    std::size_t numArestas() const { return destinos_.size(); }
+    std::size_t indice(No v) const { return static_cast<std::size_t>(v); }
+    No vertice(std::size_t i) const { return static_cast<No>(i); }
+    Vizinhos vizinhos(No v) const {
+        const int* base = destinos_.data();
+        return Vizinhos{ base + inicio_[v], base + inicio_[v + 1] };
+    }
+    const ANTENAS& antena(No v) const { return antenas_[v]; }
+
+    /**
+     * @brief Procura o vértice da posição (x, y) (pesquisa binária).
+     * @return O vértice, ou NENHUM se não existir.
+     */
+    No procurar(int x, int y) const {
+        const long long alvo = celula(x, y);
+        auto it = std::lower_bound(posicoes_.begin(), posicoes_.end(), std::make_pair(alvo, 0));
+        return (it != posicoes_.end() && it->first == alvo) ? it->second : NENHUM;
+    }
+
+private:
+    static long long celula(int x, int y) { return static_cast<long long>(x) * MAX_DIM + y; }
+
+    std::vector<int> inicio_;                          // numVertices + 1 posições
+    std::vector<int> destinos_;                        // um destino por aresta
+    std::vector<ANTENAS> antenas_;                     // antena de cada vértice
+    std::vector<std::pair<long long, int>> posicoes_;  // (célula, vértice), ordenado pela célula
+};
+
+#pragma endregion
+
+#pragma region Algoritmos
+
+/**
+ * @brief Procura em largura a partir de um vértice.
+ * @param g Armazenamento do grafo.
+ * @param origem Vértice inicial.
+ * @param visitar Chamado como visitar(No, int distancia) para cada vértice alcançado, por ordem de visita.
+ * @return Número de vértices alcançados (incluindo a origem).
+ */
+template <class G, class Visitante>
+std::size_t bfs(const G& g, typename G::No origem, Visitante&& visitar) {
+    using No = typename G::No;
+    if (origem == G::NENHUM) return 0;
+
+    std::vector<char> visitado(g.numVertices(), 0);
+    std::vector<No> fila;
+    fila.reserve(g.numVertices());
+    visitado[g.indice(origem)] = 1;
+    fila.push_back(origem);
+
+    // A fila é um array: cada nível ocupa as posições entre o fim do nível anterior e o seu fim
+    std::size_t i = 0;
+    int distancia = 0;
+    while (i < fila.size()) {
+        const std::size_t fimNivel = fila.size();
+        for (; i < fimNivel; i++) {
+            const No v = fila[i];
+            visitar(v, distancia);
+            for (No w : g.vizinhos(v)) {
+                char& marca = visitado[g.indice(w)];
+                if (!marca) {
+                    marca = 1;
+                    fila.push_back(w);
+                }
+            }
+        }
+        distancia++;
+    }
+    return fila.size();
+}
+
+/**
+ * @brief Procura em profundidade a partir de um vértice, com uma pilha explícita (como o DFS da biblioteca).
+ * @param g Armazenamento do grafo.
+ * @param origem Vértice inicial.
+ * @param visitar Chamado como visitar(No, int profundidade) quando cada vértice é descoberto (a origem com profundidade 0).
+ * @return Número de vértices alcançados (incluindo a origem).
+ */
+template <class G, class Visitante>
+std::size_t dfs(const G& g, typename G::No origem, Visitante&& visitar) {
+    using No = typename G::No;
+    using Iterador = decltype(g.vizinhos(origem).begin());
+    struct Quadro {
+        Iterador atual;
+        Iterador fim;
+    };
+    if (origem == G::NENHUM) return 0;
+
+    std::vector<char> visitado(g.numVertices(), 0);
+    std::vector<Quadro> pilha;
+    visitado[g.indice(origem)] = 1;
+    visitar(origem, 0);
+    auto vizinhos = g.vizinhos(origem);
+    pilha.push_back(Quadro{ vizinhos.begin(), vizinhos.end() });
+
+    std::size_t total = 1;
+    while (!pilha.empty()) {
+        Quadro& topo = pilha.back();
+        if (topo.atual == topo.fim) {
+            pilha.pop_back();
+            continue;
+        }
+        const No w = *topo.atual;
+        ++topo.atual;
+
+        char& marca = visitado[g.indice(w)];
+        if (!marca) {
+            marca = 1;
+            total++;
+            visitar(w, static_cast<int>(pilha.size()));
+            auto vw = g.vizinhos(w);
+            pilha.push_back(Quadro{ vw.begin(), vw.end() });
+        }
+    }
+    return total;
+}
+
+/**
+ * @brief Calcula as componentes ligadas do grafo.
+ * @param g Armazenamento do grafo.
+ * @param componente Vetor onde é escrita a componente (0, 1, ...) de cada vértice, pelo índice do vértice.
+ * @return Número de componentes.
+ */
+template <class G>
+int componentes(const G& g, std::vector<int>& componente) {
+    using No = typename G::No;
+    const std::size_t n = g.numVertices();
+    componente.assign(n, -1);
+
+    std::vector<No> fila;
+    fila.reserve(n);
+    int num = 0;
+    for (std::size_t s = 0; s < n; s++) {
+        if (componente[s] >= 0) continue;
+
+        fila.clear();
+        fila.push_back(g.vertice(s));
+        componente[s] = num;
+        for (std::size_t i = 0; i < fila.size(); i++) {
+            for (No w : g.vizinhos(fila[i])) {
+                int& c = componente[g.indice(w)];
+                if (c < 0) {
+                    c = num;
+                    fila.push_back(w);
+                }
+            }
+        }
+        num++;
+    }
+    return num;
+}
+
+/**
+ * @brief Calcula o número mínimo de ligações entre a origem e cada vértice.
+ * @param g Armazenamento do grafo.
+ * @param origem Vértice inicial.
+ * @param distancia Vetor onde é escrita a distância de cada vértice (-1 se não for alcançável).
+ * @return Número de vértices alcançados.
+ */
+template <class G>
+std::size_t distanciasSaltos(const G& g, typename G::No origem, std::vector<int>& distancia) {
+    distancia.assign(g.numVertices(), -1);
+    return bfs(g, origem, [&](typename G::No v, int d) { distancia[g.indice(v)] = d; });
+}
+
+/**
+ * @brief Caminhos mais curtos a partir da origem (Dijkstra, com uma fila de prioridade binária).
+ * @param g Armazenamento do grafo.
+ * @param origem Vértice inicial.
+ * @param peso Chamado como peso(No a, No b) para o custo (não negativo) da ligação de a para b.
+ * @param distancia Vetor onde é escrito o custo mínimo até cada vértice (infinito se não for alcançável).
+ * @param anterior Se não for nulo, recebe o índice do vértice anterior no caminho mínimo (-1 na origem e nos não alcançáveis).
+ */
+template <class G, class Peso>
+void caminhosMaisCurtos(const G& g, typename G::No origem, Peso&& peso,
+                        std::vector<double>& distancia, std::vector<int>* anterior = nullptr) {
+    using No = typename G::No;
+    using Entrada = std::pair<double, std::size_t>;
+    const double infinito = std::numeric_limits<double>::infinity();
+
+    distancia.assign(g.numVertices(), infinito);
+    if (anterior) anterior->assign(g.numVertices(), -1);
+    if (origem == G::NENHUM) return;
+
+    std::priority_queue<Entrada, std::vector<Entrada>, std::greater<Entrada>> fila;
+    distancia[g.indice(origem)] = 0.0;
+    fila.push(Entrada(0.0, g.indice(origem)));
+
+    while (!fila.empty()) {
+        const Entrada topo = fila.top();
+        fila.pop();
+        if (topo.first > distancia[topo.second]) continue;  // entrada desatualizada
+
+        const No v = g.vertice(topo.second);
+        for (No w : g.vizinhos(v)) {
+            const std::size_t j = g.indice(w);
+            const double d = topo.first + peso(v, w);
+            if (d < distancia[j]) {
+                distancia[j] = d;
+                if (anterior) (*anterior)[j] = static_cast<int>(topo.second);
+                fila.push(Entrada(d, j));
+            }
+        }
+    }
+}
+
+/**
+ * @brief Devolve uma função de peso com a distância euclidiana entre as antenas de cada ligação.
+ * @param g Armazenamento do grafo.
+ */
+template <class G>
+auto distanciaEuclidiana(const G& g) {
+    return [&g](typename G::No a, typename G::No b) {
+        const ANTENAS& antenaA = g.antena(a);
+        const ANTENAS& antenaB = g.antena(b);
+        const double dx = static_cast<double>(antenaA.x - antenaB.x);
+        const double dy = static_cast<double>(antenaA.y - antenaB.y);
+        return std::sqrt(dx * dx + dy * dy);
+    };
+}
+
+/**
+ * @brief Conta os caminhos simples entre dois vértices (como countPaths, mas com uma pilha explícita).
+ * @param g Armazenamento do grafo.
+ * @param origem Vértice inicial.
+ * @param destino Vértice final.
+ * @return Número de caminhos sem vértices repetidos (exponencial no pior caso).
+ */
+template <class G>
+unsigned long long contarCaminhos(const G& g, typename G::No origem, typename G::No destino) {
+    using No = typename G::No;
+    using Iterador = decltype(g.vizinhos(origem).begin());
+    struct Quadro {
+        No no;
+        Iterador atual;
+        Iterador fim;
+    };
+    if (origem == G::NENHUM || destino == G::NENHUM) return 0;
+    if (origem == destino) return 1;
+
+    std::vector<char> noCaminho(g.numVertices(), 0);
+    std::vector<Quadro> pilha;
+    noCaminho[g.indice(origem)] = 1;
+    auto vizinhos = g.vizinhos(origem);
+    pilha.push_back(Quadro{ origem, vizinhos.begin(), vizinhos.end() });
+
+    unsigned long long total = 0;
+    while (!pilha.empty()) {
+        Quadro& topo = pilha.back();
+        if (topo.atual == topo.fim) {
+            noCaminho[g.indice(topo.no)] = 0;
+            pilha.pop_back();
+            continue;
+        }
+        const No w = *topo.atual;
+        ++topo.atual;
+
+        if (w == destino) {
+            total++;
+        }
+        else if (!noCaminho[g.indice(w)]) {
+            noCaminho[g.indice(w)] = 1;
+            auto vw = g.vizinhos(w);
+            pilha.push_back(Quadro{ w, vw.begin(), vw.end() });
+        }
+    }
+    return total;
+}
+
+#pragma endregion
+
+} // namespace pa
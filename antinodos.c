@@ -0,0 +1,370 @@
+/**
+ * @file antinodos.c
+ * @brief Implementação da contagem de antinodos (posições com efeito nefasto) de cada grafo.
+ *
+ * @author Rogério Picas
+ * @date 18-10-2026
+ * @version 1.0
+ */
+#define _CRT_SECURE_NO_WARNINGS
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "antinodos.h"
+
+ /** @def CAPACIDADE_INICIAL_ANTINODOS
+  *  @brief Número de posições da tabela quando é criada.
+  */
+#define CAPACIDADE_INICIAL_ANTINODOS 64
+
+#pragma region Funções Auxiliares
+
+/**
+ * @brief Função de comparação para ordenar células com qsort.
+ */
+static int compararCelulas(const void* a, const void* b) {
+	long long ca = *(const long long*)a;
+	long long cb = *(const long long*)b;
+	return (ca > cb) - (ca < cb);
+}
+
+/**
+ * @brief Calcula a posição inicial de uma célula na tabela (dispersão multiplicativa).
+ */
+static int posicaoInicial(const ANTINODOS* antinodos, long long celula) {
+	uint64_t h = (uint64_t)celula * 0x9E3779B97F4A7C15ULL;
+	return (int)((h ^ (h >> 32)) & (uint64_t)(antinodos->capacidade - 1));
+}
+
+/**
+ * @brief Procura a posição de uma célula na tabela.
+ *
+ * @return posição da célula, ou posição livre onde deve ser inserida.
+ */
+static int procurarPosicao(const ANTINODOS* antinodos, long long celula) {
+	int mascara = antinodos->capacidade - 1;
+	int i = posicaoInicial(antinodos, celula);
+	while (antinodos->celulas[i] != CELULA_SEM_ANTINODO && antinodos->celulas[i] != celula) {
+		i = (i + 1) & mascara;
+	}
+	return i;
+}
+
+/**
+ * @brief Reserva as tabelas com a capacidade indicada, todas as posições livres.
+ *
+ * @return @c 0 em caso de sucesso, @c 2 se a alocação falhar.
+ */
+static int reservarTabela(ANTINODOS* antinodos, int capacidade) {
+	long long* celulas = (long long*)malloc((size_t)capacidade * sizeof(long long));
+	int* contagens = (int*)malloc((size_t)capacidade * sizeof(int));
+	if (celulas == NULL || contagens == NULL)
+	{
+		free(celulas);
+		free(contagens);
+		return 2;
+	}
+	for (int i = 0; i < capacidade; i++) {
+		celulas[i] = CELULA_SEM_ANTINODO;
+	}
+	antinodos->celulas = celulas;
+	antinodos->contagens = contagens;
+	antinodos->capacidade = capacidade;
+	return 0;
+}
+
+/**
+ * @brief Duplica a capacidade da tabela, voltando a inserir todas as células.
+ *
+ * @return @c 0 em caso de sucesso, @c 2 se a alocação falhar (a tabela fica inalterada).
+ */
+static int crescerTabela(ANTINODOS* antinodos) {
+	ANTINODOS antiga = *antinodos;
+	if (reservarTabela(antinodos, antiga.capacidade * 2) != 0) return 2;
+
+	for (int i = 0; i < antiga.capacidade; i++) {
+		if (antiga.celulas[i] != CELULA_SEM_ANTINODO)
+		{
+			int j = procurarPosicao(antinodos, antiga.celulas[i]);
+			antinodos->celulas[j] = antiga.celulas[i];
+			antinodos->contagens[j] = antiga.contagens[i];
+		}
+	}
+	free(antiga.celulas);
+	free(antiga.contagens);
+	return 0;
+}
+
+/**
+ * @brief Soma 1 à contagem de uma célula, inserindo-a se for nova.
+ *
+ * @return @c 0 em caso de sucesso, @c 2 se a alocação falhar.
+ */
+static int incrementarCelula(ANTINODOS* antinodos, long long celula) {
+	int i = procurarPosicao(antinodos, celula);
+	if (antinodos->celulas[i] == celula)
+	{
+		antinodos->contagens[i]++;
+		return 0;
+	}
+
+	// Célula nova: a tabela nunca passa de metade ocupada
+	if (2 * (antinodos->numCelulas + 1) > antinodos->capacidade)
+	{
+		if (crescerTabela(antinodos) != 0) return 2;
+		i = procurarPosicao(antinodos, celula);
+	}
+	antinodos->celulas[i] = celula;
+	antinodos->contagens[i] = 1;
+	antinodos->numCelulas++;
+	return 0;
+}
+
+/**
+ * @brief Subtrai 1 à contagem de uma célula, retirando-a da tabela quando chega a 0.
+ *
+ * A posição libertada é preenchida recuando as células seguintes da mesma sequência de
+ * sondagem, pelo que a tabela não precisa de marcas de posições apagadas.
+ */
+static void decrementarCelula(ANTINODOS* antinodos, long long celula) {
+	int i = procurarPosicao(antinodos, celula);
+	if (antinodos->celulas[i] != celula) return;
+	if (--antinodos->contagens[i] > 0) return;
+
+	int mascara = antinodos->capacidade - 1;
+	int j = i;
+	while (1) {
+		j = (j + 1) & mascara;
+		if (antinodos->celulas[j] == CELULA_SEM_ANTINODO) break;
+
+		int k = posicaoInicial(antinodos, antinodos->celulas[j]);
+		// A célula em j só pode recuar para i se a sua posição inicial não estiver em ]i, j]
+		bool entre = (i <= j) ? (i < k && k <= j) : (i < k || k <= j);
+		if (!entre)
+		{
+			antinodos->celulas[i] = antinodos->celulas[j];
+			antinodos->contagens[i] = antinodos->contagens[j];
+			i = j;
+		}
+	}
+	antinodos->celulas[i] = CELULA_SEM_ANTINODO;
+	antinodos->numCelulas--;
+}
+
+/**
+ * @brief Soma ou subtrai à contagem os antinodos de um par de antenas.
+ *
+ * @return @c 0 em caso de sucesso, @c 2 se a alocação falhar.
+ */
+static int contarPar(ANTINODOS* antinodos, const ANTENAS* a, const ANTENAS* b, int sentido) {
+	long long celulas[2];
+	int num = posicoesAntinodos(a, b, celulas);
+	for (int i = 0; i < num; i++) {
+		if (sentido > 0)
+		{
+			if (incrementarCelula(antinodos, celulas[i]) != 0) return 2;
+		}
+		else
+		{
+			decrementarCelula(antinodos, celulas[i]);
+		}
+	}
+	return 0;
+}
+
+#pragma endregion
+
+#pragma region Funções dos Antinodos
+
+/**
+ * @brief Calcula as posições com efeito nefasto criadas por um par de antenas da mesma frequência.
+ *
+ * Segue a regra de @c efeitoNefasto: só há efeito se as antenas estiverem a pelo menos 2 linhas
+ * de distância, e as posições afetadas são as simétricas de cada antena em relação à outra
+ * (2a - b e 2b - a). As posições fora da cidade são ignoradas.
+ *
+ * @param[in] a - primeira antena.
+ * @param[in] b - segunda antena.
+ * @param[out] celulas - array com 2 posições onde são escritas as células (x * MAX_DIM + y).
+ *
+ * @return número de células escritas (0 a 2).
+ */
+int posicoesAntinodos(const ANTENAS* a, const ANTENAS* b, long long celulas[2]) {
+	if (a == NULL || b == NULL) return 0;
+	if (abs(a->x - b->x) < 2) return 0;
+
+	int num = 0;
+	int x1 = 2 * a->x - b->x;
+	int y1 = 2 * a->y - b->y;
+	int x2 = 2 * b->x - a->x;
+	int y2 = 2 * b->y - a->y;
+	if (x1 >= 0 && x1 < MAX_DIM && y1 >= 0 && y1 < MAX_DIM)
+	{
+		celulas[num++] = (long long)x1 * MAX_DIM + y1;
+	}
+	if (x2 >= 0 && x2 < MAX_DIM && y2 >= 0 && y2 < MAX_DIM)
+	{
+		celulas[num++] = (long long)x2 * MAX_DIM + y2;
+	}
+	return num;
+}
+
+/**
+ * @brief Cria a contagem de antinodos do grafo, se ainda não existir.
+ *
+ * É a única vez que todos os pares de antenas são percorridos (O(k^2) para k antenas);
+ * a partir daqui a contagem é mantida por @c atualizarAntinodosAntena. Os grafos cujos
+ * antinodos nunca são pedidos não pagam o custo da contagem nas inserções.
+ *
+ * @param[in,out] grafo - apontador para o grafo.
+ *
+ * @return @c 0 em caso de sucesso, @c 1 se o grafo for nulo, @c 2 se a alocação falhar.
+ */
+int ativarAntinodos(GRAFO* grafo) {
+	if (grafo == NULL) return 1;
+	if (grafo->antinodos != NULL) return 0;
+
+	ANTINODOS* antinodos = (ANTINODOS*)calloc(1, sizeof(ANTINODOS));
+	if (antinodos == NULL) return 2;
+	if (reservarTabela(antinodos, CAPACIDADE_INICIAL_ANTINODOS) != 0)
+	{
+		free(antinodos);
+		return 2;
+	}
+
+	for (VERTICE* a = grafo->vertices; a != NULL; a = a->prox) {
+		for (VERTICE* b = a->prox; b != NULL; b = b->prox) {
+			if (contarPar(antinodos, &a->antena, &b->antena, 1) != 0)
+			{
+				destruirAntinodos(antinodos);
+				return 2;
+			}
+		}
+	}
+	grafo->antinodos = antinodos;
+	return 0;
+}
+
+/**
+ * @brief Soma (ou subtrai) à contagem os pares formados por uma antena e as restantes antenas do grafo.
+ *
+ * Chamada depois de inserir a antena (sentido 1), antes de a remover (sentido -1) e, num
+ * movimento, antes e depois de mudar as coordenadas. Só os k - 1 pares que envolvem a antena
+ * mudam, pelo que o custo é O(k). Se faltar memória a meio, a contagem deixa de ser fiável e
+ * é descartada; volta a ser criada no próximo pedido.
+ *
+ * @param[in,out] grafo - apontador para o grafo (nada é feito se a contagem não estiver ativa).
+ * @param[in] vertice - antena inserida, removida ou movida.
+ * @param[in] sentido - 1 para somar os pares, -1 para os subtrair.
+ */
+void atualizarAntinodosAntena(GRAFO* grafo, const VERTICE* vertice, int sentido) {
+	if (grafo == NULL || grafo->antinodos == NULL || vertice == NULL) return;
+
+	for (VERTICE* outro = grafo->vertices; outro != NULL; outro = outro->prox) {
+		if (outro == vertice) continue;
+		if (contarPar(grafo->antinodos, &vertice->antena, &outro->antena, sentido) != 0)
+		{
+			grafo->antinodos = destruirAntinodos(grafo->antinodos);
+			return;
+		}
+	}
+}
+
+/**
+ * @brief Devolve o número de pares de antenas do grafo com efeito nefasto na célula (x, y).
+ *
+ * @param[in,out] grafo - apontador para o grafo (a contagem é criada se ainda não existir).
+ * @param[in] x - coordenada X.
+ * @param[in] y - coordenada Y.
+ *
+ * @return número de pares, ou @c 0 se não houver efeito ou ocorrer um erro.
+ */
+int contagemAntinodo(GRAFO* grafo, int x, int y) {
+	if (x < 0 || x >= MAX_DIM || y < 0 || y >= MAX_DIM) return 0;
+	if (ativarAntinodos(grafo) != 0) return 0;
+
+	long long celula = (long long)x * MAX_DIM + y;
+	int i = procurarPosicao(grafo->antinodos, celula);
+	return grafo->antinodos->celulas[i] == celula ? grafo->antinodos->contagens[i] : 0;
+}
+
+/**
+ * @brief Verifica se a célula (x, y) tem efeito nefasto no grafo.
+ *
+ * @param[in,out] grafo - apontador para o grafo.
+ * @param[in] x - coordenada X.
+ * @param[in] y - coordenada Y.
+ *
+ * @return @c true se a célula tiver efeito nefasto, @c false caso contrário ou em caso de erro.
+ */
+bool existeAntinodo(GRAFO* grafo, int x, int y) {
+	return contagemAntinodo(grafo, x, y) > 0;
+}
+
+/**
+ * @brief Devolve o número de células com efeito nefasto do grafo.
+ *
+ * @param[in,out] grafo - apontador para o grafo.
+ *
+ * @return número de células, ou @c -1 em caso de erro.
+ */
+int numeroAntinodos(GRAFO* grafo) {
+	if (ativarAntinodos(grafo) != 0) return -1;
+	return grafo->antinodos->numCelulas;
+}
+
+/**
+ * @brief Copia as células com efeito nefasto do grafo, por ordem crescente.
+ *
+ * @param[in,out] grafo - apontador para o grafo.
+ * @param[out] celulas - array onde são escritas as células (x * MAX_DIM + y).
+ * @param[in] max - número máximo de células a escrever (as menores, se não couberem todas).
+ *
+ * @return número total de células do grafo (pode ser maior do que @p max), ou @c -1 em caso de erro.
+ */
+int obterAntinodos(GRAFO* grafo, long long* celulas, int max) {
+	if (ativarAntinodos(grafo) != 0) return -1;
+	ANTINODOS* antinodos = grafo->antinodos;
+	if (celulas == NULL || max <= 0 || antinodos->numCelulas == 0) return antinodos->numCelulas;
+
+	long long* todas = celulas;
+	if (max < antinodos->numCelulas)
+	{
+		todas = (long long*)malloc((size_t)antinodos->numCelulas * sizeof(long long));
+		if (todas == NULL) return -1;
+	}
+
+	int num = 0;
+	for (int i = 0; i < antinodos->capacidade; i++) {
+		if (antinodos->celulas[i] != CELULA_SEM_ANTINODO)
+		{
+			todas[num++] = antinodos->celulas[i];
+		}
+	}
+	qsort(todas, (size_t)num, sizeof(long long), compararCelulas);
+
+	if (todas != celulas)
+	{
+		memcpy(celulas, todas, (size_t)max * sizeof(long long));
+		free(todas);
+	}
+	return num;
+}
+
+/**
+ * @brief Liberta a memória dos antinodos de um grafo.
+ *
+ * @param antinodos - apontador para os antinodos a destruir.
+ * @return NULL, indicando que os antinodos foram destruídos.
+ */
+ANTINODOS* destruirAntinodos(ANTINODOS* antinodos) {
+	if (antinodos == NULL) return NULL;
+
+	free(antinodos->celulas);
+	free(antinodos->contagens);
+	free(antinodos);
+	return NULL;
+}
+
+#pragma endregion
@@ -0,0 +1,113 @@
+#pragma once
+
+/**
+ * @file antinodos.h
+ * @brief Posições com efeito nefasto (antinodos) de cada grafo, com o número de pares de antenas
+ *        que afetam cada célula, atualizado em O(k) a cada inserção, remoção ou movimento de antena
+ *
+ * @author Rogério Picas
+ * @date 18-10-2026
+ * @version 1.0
+ *
+ */
+#include "funcoes.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+ /** @def CELULA_SEM_ANTINODO
+  *  @brief Valor das posições livres da tabela de antinodos.
+  */
+#define CELULA_SEM_ANTINODO (-1LL)
+
+#pragma region Estruturas
+
+/**
+ * @struct Antinodos
+ * @brief Contagem de referências das células com efeito nefasto de um grafo.
+ *
+ * Tabela de dispersão com endereçamento aberto (sondagem linear), indexada pela célula
+ * (x * MAX_DIM + y): só as células afetadas ocupam memória, mesmo numa cidade grande.
+ */
+typedef struct Antinodos {
+    long long* celulas;  /**< Célula guardada em cada posição da tabela, ou CELULA_SEM_ANTINODO */
+    int* contagens;      /**< Número de pares de antenas que têm efeito nefasto na célula */
+    int capacidade;      /**< Número de posições da tabela (potência de 2) */
+    int numCelulas;      /**< Número de células com contagem > 0 */
+} ANTINODOS;
+
+#pragma endregion
+
+#pragma region Funções dos Antinodos
+
+/**
+ * @brief Calcula as posições com efeito nefasto criadas por um par de antenas da mesma frequência.
+ * @param a Primeira antena.
+ * @param b Segunda antena.
+ * @param celulas Array com 2 posições onde são escritas as células (x * MAX_DIM + y) dentro da cidade.
+ * @return Número de células escritas (0 a 2).
+ */
+int posicoesAntinodos(const ANTENAS* a, const ANTENAS* b, long long celulas[2]);
+
+/**
+ * @brief Cria a contagem de antinodos do grafo, se ainda não existir (percorre todos os pares uma vez).
+ * @param grafo Apontador para o grafo.
+ * @return 0 se a operação for bem-sucedida, 1 se o grafo for nulo, 2 em caso de falha de alocação.
+ */
+int ativarAntinodos(GRAFO* grafo);
+
+/**
+ * @brief Soma (ou subtrai) à contagem os pares formados por uma antena e as restantes antenas do grafo.
+ * @param grafo Apontador para o grafo (nada é feito se a contagem não estiver ativa).
+ * @param vertice Antena inserida, removida ou movida (ignorada na lista de vértices do grafo).
+ * @param sentido 1 para somar os pares, -1 para os subtrair.
+ */
+void atualizarAntinodosAntena(GRAFO* grafo, const VERTICE* vertice, int sentido);
+
+/**
+ * @brief Devolve o número de pares de antenas do grafo com efeito nefasto na célula (x, y).
+ * @param grafo Apontador para o grafo.
+ * @param x Coordenada X.
+ * @param y Coordenada Y.
+ * @return Número de pares (0 se não houver efeito ou ocorrer um erro).
+ */
+int contagemAntinodo(GRAFO* grafo, int x, int y);
+
+/**
+ * @brief Verifica se a célula (x, y) tem efeito nefasto no grafo.
+ * @param grafo Apontador para o grafo.
+ * @param x Coordenada X.
+ * @param y Coordenada Y.
+ * @return true se a célula tiver efeito nefasto, false caso contrário.
+ */
+bool existeAntinodo(GRAFO* grafo, int x, int y);
+
+/**
+ * @brief Devolve o número de células com efeito nefasto do grafo.
+ * @param grafo Apontador para o grafo.
+ * @return Número de células, ou -1 em caso de erro.
+ */
+int numeroAntinodos(GRAFO* grafo);
+
+/**
+ * @brief Copia as células com efeito nefasto do grafo, por ordem crescente.
+ * @param grafo Apontador para o grafo.
+ * @param celulas Array onde são escritas as células (x * MAX_DIM + y).
+ * @param max Número máximo de células a escrever.
+ * @return Número total de células do grafo (pode ser maior do que @p max), ou -1 em caso de erro.
+ */
+int obterAntinodos(GRAFO* grafo, long long* celulas, int max);
+
+/**
+ * @brief Liberta a memória dos antinodos de um grafo.
+ * @param antinodos Apontador para os antinodos a destruir.
+ * @return NULL, indicando que os antinodos foram destruídos.
+ */
+ANTINODOS* destruirAntinodos(ANTINODOS* antinodos);
+
+#pragma endregion
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,428 @@
+/**
+ * @file arvore.c
+ * @brief Implementação da árvore de suporte mínima das antenas de um grafo.
+ *
+ * Em vez do grafo completo (O(V²) ligações), cada antena só propõe, em cada um dos oito setores
+ * de 45 graus à sua volta, a ligação à antena mais próxima nesse setor. Numa árvore mínima, se
+ * (u, v) não for a ligação mais curta de u no setor de v, a antena w mais próxima desse setor
+ * forma com u e v um triângulo em que (u, v) é a ligação mais comprida (o ângulo em u é inferior
+ * a 60 graus, e na distância de Manhattan vale o argumento dos octantes); por isso as no máximo
+ * 8V ligações propostas contêm uma árvore mínima. A antena mais próxima de cada setor é procurada
+ * numa grelha de baldes própria do grafo, anel a anel, até nenhum anel seguinte poder ter uma
+ * antena mais próxima (ou o setor sair da área ocupada pelas antenas).
+ *
+ * As ligações propostas são ordenadas em paralelo (cada thread ordena uma parte e as partes são
+ * fundidas duas a duas) e a árvore é escolhida com o algoritmo de Kruskal e uma estrutura de
+ * conjuntos disjuntos. Os custos são comparados como inteiros (soma das diferenças ou quadrado
+ * da distância euclidiana), sem erros de arredondamento.
+ *
+ * @author Rogério Picas
+ * @date 18-10-2026
+ * @version 1.0
+ */
+#define _CRT_SECURE_NO_WARNINGS
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <math.h>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+#include "arvore.h"
+#include "reserva.h"
+
+ /** @def NUM_SETORES
+  *  @brief Número de setores (de 45 graus) em que cada antena procura a vizinha mais próxima.
+  */
+#define NUM_SETORES 8
+
+#pragma region Estruturas Auxiliares
+
+/**
+ * @struct Candidata
+ * @brief Ligação proposta entre duas antenas (índices na lista de vértices do grafo).
+ */
+typedef struct Candidata {
+    unsigned long long chave; /**< Custo inteiro (Manhattan, ou quadrado da distância euclidiana) */
+    int a;                    /**< Índice de uma das antenas */
+    int b;                    /**< Índice da outra antena */
+} CANDIDATA;
+
+/**
+ * @struct GrelhaSuporte
+ * @brief Baldes com os índices das antenas do grafo, em arrays contíguos.
+ */
+typedef struct GrelhaSuporte {
+    int minX;          /**< Menor coordenada X das antenas */
+    int minY;          /**< Menor coordenada Y das antenas */
+    int maxX;          /**< Maior coordenada X das antenas (relativa a minX) */
+    int maxY;          /**< Maior coordenada Y das antenas (relativa a minY) */
+    int lado;          /**< Lado de cada balde (em células da cidade) */
+    int colunas;       /**< Número de baldes em X */
+    int linhas;        /**< Número de baldes em Y */
+    int* inicio;       /**< Início de cada balde em antenas (colunas * linhas + 1 posições) */
+    int* antenas;      /**< Índices das antenas, agrupados por balde */
+    int* x;            /**< Coordenada X (relativa a minX) de cada posição de antenas */
+    int* y;            /**< Coordenada Y (relativa a minY) de cada posição de antenas */
+} GRELHA_SUPORTE;
+
+#pragma endregion
+
+#pragma region Funções Auxiliares
+
+/**
+ * @brief Custo inteiro da ligação entre duas antenas.
+ */
+static unsigned long long chaveDistancia(METRICA_DISTANCIA metrica, int dx, int dy) {
+	unsigned long long ax = (unsigned long long)(dx < 0 ? -(long long)dx : dx);
+	unsigned long long ay = (unsigned long long)(dy < 0 ? -(long long)dy : dy);
+	return metrica == METRICA_MANHATTAN ? ax + ay : ax * ax + ay * ay;
+}
+
+/**
+ * @brief Setor (0 a 7, de 45 graus, no sentido contrário ao dos ponteiros do relógio) da direção (dx, dy).
+ *
+ * Os setores são semiabertos, para que cada direção pertença a um só; a posição (0, 0) fica no setor 0.
+ */
+static int setorDirecao(int dx, int dy) {
+	if (dx > 0 && dy >= 0) return dy < dx ? 0 : 1;
+	if (dx <= 0 && dy > 0) return -dx < dy ? 2 : 3;
+	if (dx < 0 && dy <= 0) return -dy < -dx ? 4 : 5;
+	if (dx >= 0 && dy < 0) return dx < -dy ? 6 : 7;
+	return 0;
+}
+
+/**
+ * @brief Função de comparação das candidatas (custo, depois índices), para o qsort.
+ */
+static int compararCandidatas(const void* p, const void* q) {
+	const CANDIDATA* a = (const CANDIDATA*)p;
+	const CANDIDATA* b = (const CANDIDATA*)q;
+	if (a->chave != b->chave) return a->chave < b->chave ? -1 : 1;
+	if (a->a != b->a) return a->a < b->a ? -1 : 1;
+	return (a->b > b->b) - (a->b < b->b);
+}
+
+/**
+ * @brief Funde duas sequências ordenadas de candidatas.
+ */
+static void fundirCandidatas(const CANDIDATA* a, int numA, const CANDIDATA* b, int numB, CANDIDATA* destino) {
+	int i = 0, j = 0, k = 0;
+	while (i < numA && j < numB) {
+		destino[k++] = compararCandidatas(&b[j], &a[i]) < 0 ? b[j++] : a[i++];
+	}
+	while (i < numA) destino[k++] = a[i++];
+	while (j < numB) destino[k++] = b[j++];
+}
+
+/**
+ * @brief Ordena as candidatas em paralelo: cada thread ordena uma parte com qsort e as partes
+ *        são fundidas duas a duas, com as fusões de cada nível repartidas pelas threads.
+ *
+ * @param[in,out] candidatas - array a ordenar.
+ * @param[in] num - número de candidatas.
+ * @param[in] auxiliar - array de trabalho com num posições.
+ * @param[in] numThreads - número de threads (e de partes).
+ */
+static void ordenarCandidatas(CANDIDATA* candidatas, int num, CANDIDATA* auxiliar, int numThreads) {
+	int partes = numThreads < 1 ? 1 : numThreads;
+	if (partes > num / 1024) partes = num / 1024 > 0 ? num / 1024 : 1;
+	int tamanho = (num + partes - 1) / partes;
+
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(partes)
+#endif
+	for (int p = 0; p < partes; p++) {
+		int inicio = p * tamanho;
+		int fim = inicio + tamanho < num ? inicio + tamanho : num;
+		if (inicio < fim) qsort(candidatas + inicio, (size_t)(fim - inicio), sizeof(CANDIDATA), compararCandidatas);
+	}
+
+	CANDIDATA* origem = candidatas;
+	CANDIDATA* destino = auxiliar;
+	for (long long largura = tamanho; largura < num; largura *= 2) {
+		int numFusoes = (int)((num + 2 * largura - 1) / (2 * largura));
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(partes)
+#endif
+		for (int f = 0; f < numFusoes; f++) {
+			long long inicio = 2 * largura * f;
+			long long meio = inicio + largura < num ? inicio + largura : num;
+			long long fim = meio + largura < num ? meio + largura : num;
+			fundirCandidatas(origem + inicio, (int)(meio - inicio), origem + meio, (int)(fim - meio), destino + inicio);
+		}
+		CANDIDATA* t = origem; origem = destino; destino = t;
+	}
+	if (origem != candidatas) memcpy(candidatas, origem, (size_t)num * sizeof(CANDIDATA));
+}
+
+/**
+ * @brief Representante do conjunto de um elemento (com compressão do caminho a meias).
+ */
+static int representante(int* pai, int x) {
+	while (pai[x] != x) {
+		pai[x] = pai[pai[x]];
+		x = pai[x];
+	}
+	return x;
+}
+
+/**
+ * @brief Procura, em cada setor à volta de uma antena, a antena mais próxima.
+ *
+ * Os anéis de baldes são percorridos do mais próximo para o mais afastado. Depois do anel r,
+ * qualquer antena ainda por ver está a pelo menos r * lado + 1 em cada coordenada, pelo que um
+ * setor fica fechado quando já tem uma antena a essa distância ou menos, ou quando o anel já
+ * cobriu toda a grelha na direção do setor. Os setores que ficam fora da área das antenas (por
+ * exemplo, os setores acima de uma antena com a maior coordenada Y) são fechados logo.
+ *
+ * @param[in] grelha - grelha com as antenas.
+ * @param[in] i - posição da antena no array de antenas da grelha.
+ * @param[in] metrica - métrica da distância.
+ * @param[out] candidatas - NUM_SETORES posições com a ligação de cada setor (b = -1 se o setor estiver vazio).
+ */
+static void procurarVizinhas(const GRELHA_SUPORTE* grelha, int i, METRICA_DISTANCIA metrica, CANDIDATA* candidatas) {
+	const int* x = grelha->x;
+	const int* y = grelha->y;
+	int cx = x[i] / grelha->lado;
+	int cy = y[i] / grelha->lado;
+	bool direita = x[i] < grelha->maxX, esquerda = x[i] > 0;
+	bool cima = y[i] < grelha->maxY, baixo = y[i] > 0;
+	int limite[NUM_SETORES] = {
+		direita ? grelha->colunas - 1 - cx : -1,
+		direita && cima ? grelha->linhas - 1 - cy : -1,
+		cima ? grelha->linhas - 1 - cy : -1,
+		esquerda && cima ? cx : -1,
+		esquerda ? cx : -1,
+		esquerda && baixo ? cy : -1,
+		baixo ? cy : -1,
+		direita && baixo ? grelha->colunas - 1 - cx : -1
+	};
+
+	for (int s = 0; s < NUM_SETORES; s++) {
+		candidatas[s].chave = ULLONG_MAX;
+		candidatas[s].a = grelha->antenas[i];
+		candidatas[s].b = -1;
+	}
+
+	int abertos = 0;
+	for (int s = 0; s < NUM_SETORES; s++) {
+		if (limite[s] >= 0) abertos |= 1 << s;
+	}
+	for (int r = 0; abertos != 0; r++) {
+		// Só a parte do anel nos quadrantes dos setores ainda abertos (setores 2 a 5 à esquerda,
+		// 0, 1, 6 e 7 à direita, 0 a 3 em cima e 4 a 7 em baixo), dentro da grelha
+		int gxMin = abertos & 0x3C ? cx - r : cx, gxMax = abertos & 0xC3 ? cx + r : cx;
+		int gyMin = abertos & 0xF0 ? cy - r : cy, gyMax = abertos & 0x0F ? cy + r : cy;
+		if (gxMin < 0) gxMin = 0;
+		if (gyMin < 0) gyMin = 0;
+		if (gxMax >= grelha->colunas) gxMax = grelha->colunas - 1;
+		if (gyMax >= grelha->linhas) gyMax = grelha->linhas - 1;
+
+		for (int gy = gyMin; gy <= gyMax; gy++) {
+			// Nas linhas do meio do anel só as duas colunas das pontas pertencem ao anel
+			bool linhaInteira = gy == cy - r || gy == cy + r;
+			for (int gx = gxMin; gx <= gxMax; gx++) {
+				if (!linhaInteira && gx != cx - r && gx != cx + r)
+				{
+					if (gx < cx + r) gx = cx + r - 1;
+					continue;
+				}
+				int balde = gy * grelha->colunas + gx;
+				for (int j = grelha->inicio[balde]; j < grelha->inicio[balde + 1]; j++) {
+					if (j == i) continue;
+					int dx = x[j] - x[i], dy = y[j] - y[i];
+					int s = setorDirecao(dx, dy);
+					unsigned long long chave = chaveDistancia(metrica, dx, dy);
+					if (chave < candidatas[s].chave || (chave == candidatas[s].chave && grelha->antenas[j] < candidatas[s].b))
+					{
+						candidatas[s].chave = chave;
+						candidatas[s].b = grelha->antenas[j];
+					}
+				}
+			}
+		}
+
+		long long distanciaMinima = (long long)r * grelha->lado + 1;
+		unsigned long long chaveMinima = metrica == METRICA_MANHATTAN
+			? (unsigned long long)distanciaMinima
+			: (unsigned long long)distanciaMinima * (unsigned long long)distanciaMinima;
+		for (int s = 0; s < NUM_SETORES; s++) {
+			if ((abertos >> s) & 1 && (candidatas[s].chave <= chaveMinima || r >= limite[s]))
+			{
+				abertos &= ~(1 << s);
+			}
+		}
+	}
+}
+
+#pragma endregion
+
+#pragma region Funções da Árvore de Suporte
+
+/**
+ * @brief Calcula a árvore de suporte mínima das antenas do grafo.
+ *
+ * @param[in,out] grafo - apontador para o grafo (o campo indice dos vértices é reescrito).
+ * @param[in] metrica - métrica da distância entre antenas.
+ * @param[in] numThreads - número de threads a usar (<= 0 usa o valor por omissão do OpenMP).
+ *
+ * @return apontador para a árvore, ou NULL se o grafo for nulo ou alguma alocação falhar.
+ */
+ARVORE_SUPORTE* construirArvoreSuporte(GRAFO* grafo, METRICA_DISTANCIA metrica, int numThreads) {
+	if (grafo == NULL) return NULL;
+
+	ARVORE_SUPORTE* arvore = (ARVORE_SUPORTE*)calloc(1, sizeof(ARVORE_SUPORTE));
+	if (arvore == NULL) return NULL;
+	arvore->frequencia = grafo->frequencia;
+	arvore->metrica = metrica;
+
+	int n = 0;
+	int minX = INT_MAX, minY = INT_MAX, maxX = INT_MIN, maxY = INT_MIN;
+	for (VERTICE* v = grafo->vertices; v != NULL; v = v->prox) {
+		v->indice = n++;
+		if (v->antena.x < minX) minX = v->antena.x;
+		if (v->antena.y < minY) minY = v->antena.y;
+		if (v->antena.x > maxX) maxX = v->antena.x;
+		if (v->antena.y > maxY) maxY = v->antena.y;
+	}
+	if (n < 2) return arvore;
+
+#ifdef _OPENMP
+	if (numThreads <= 0) numThreads = omp_get_max_threads();
+#else
+	numThreads = 1;
+#endif
+
+	// Baldes com cerca de uma antena cada, na área ocupada pelas antenas
+	GRELHA_SUPORTE grelha = { minX, minY, maxX - minX, maxY - minY };
+	double area = (double)(maxX - minX + 1) * (maxY - minY + 1);
+	grelha.lado = (int)ceil(sqrt(area / n));
+	if (grelha.lado < 1) grelha.lado = 1;
+	grelha.colunas = (maxX - minX) / grelha.lado + 1;
+	grelha.linhas = (maxY - minY) / grelha.lado + 1;
+	int numBaldes = grelha.colunas * grelha.linhas;
+
+	VERTICE** vertices = (VERTICE**)malloc((size_t)n * sizeof(VERTICE*));
+	int* x = (int*)malloc((size_t)n * 4 * sizeof(int));
+	grelha.inicio = (int*)calloc((size_t)numBaldes + 1, sizeof(int));
+	grelha.antenas = (int*)malloc((size_t)n * sizeof(int));
+	CANDIDATA* candidatas = (CANDIDATA*)malloc((size_t)n * NUM_SETORES * sizeof(CANDIDATA));
+	CANDIDATA* auxiliar = (CANDIDATA*)malloc((size_t)n * NUM_SETORES * sizeof(CANDIDATA));
+	int* pai = (int*)malloc((size_t)n * 2 * sizeof(int));
+	arvore->ligacoes = (LIGACAO_SUPORTE*)malloc((size_t)(n - 1) * sizeof(LIGACAO_SUPORTE));
+	if (!vertices || !x || !grelha.inicio || !grelha.antenas || !candidatas || !auxiliar || !pai || !arvore->ligacoes)
+	{
+		free(vertices); free(x); free(grelha.inicio); free(grelha.antenas);
+		free(candidatas); free(auxiliar); free(pai);
+		return destruirArvoreSuporte(arvore);
+	}
+	int* y = x + n;
+	grelha.x = x + 2 * (size_t)n;
+	grelha.y = x + 3 * (size_t)n;
+
+	int i = 0;
+	for (VERTICE* v = grafo->vertices; v != NULL; v = v->prox, i++) {
+		vertices[i] = v;
+		x[i] = v->antena.x - minX;
+		y[i] = v->antena.y - minY;
+		grelha.inicio[(y[i] / grelha.lado) * grelha.colunas + x[i] / grelha.lado]++;
+	}
+	// inicio[b] passa a ser o fim do balde b; as antenas são colocadas do fim para o início
+	for (int b = 1; b < numBaldes; b++) grelha.inicio[b] += grelha.inicio[b - 1];
+	grelha.inicio[numBaldes] = n;
+	for (i = n - 1; i >= 0; i--) {
+		int b = (y[i] / grelha.lado) * grelha.colunas + x[i] / grelha.lado;
+		int posicao = --grelha.inicio[b];
+		grelha.antenas[posicao] = i;
+		grelha.x[posicao] = x[i];
+		grelha.y[posicao] = y[i];
+	}
+
+	// Vizinhas mais próximas de cada antena, por setor (cada antena é independente); as antenas
+	// são percorridas pela ordem dos baldes, para que as vizinhas estejam perto na memória
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(numThreads) schedule(dynamic, 256)
+#endif
+	for (int a = 0; a < n; a++) {
+		procurarVizinhas(&grelha, a, metrica, &candidatas[(size_t)a * NUM_SETORES]);
+	}
+
+	int numCandidatas = 0;
+	for (long long k = 0; k < (long long)n * NUM_SETORES; k++) {
+		if (candidatas[k].b >= 0) candidatas[numCandidatas++] = candidatas[k];
+	}
+	ordenarCandidatas(candidatas, numCandidatas, auxiliar, numThreads);
+
+	// Kruskal: as candidatas por ordem crescente de custo, enquanto ligarem conjuntos diferentes
+	int* tamanho = pai + n;
+	for (i = 0; i < n; i++) {
+		pai[i] = i;
+		tamanho[i] = 1;
+	}
+	for (int k = 0; k < numCandidatas && arvore->numLigacoes < n - 1; k++) {
+		int ra = representante(pai, candidatas[k].a);
+		int rb = representante(pai, candidatas[k].b);
+		if (ra == rb) continue;
+		if (tamanho[ra] < tamanho[rb]) { int t = ra; ra = rb; rb = t; }
+		pai[rb] = ra;
+		tamanho[ra] += tamanho[rb];
+
+		const ANTENAS* a = &vertices[candidatas[k].a]->antena;
+		const ANTENAS* b = &vertices[candidatas[k].b]->antena;
+		LIGACAO_SUPORTE* l = &arvore->ligacoes[arvore->numLigacoes++];
+		l->xOrigem = a->x;
+		l->yOrigem = a->y;
+		l->xDestino = b->x;
+		l->yDestino = b->y;
+		l->custo = metrica == METRICA_MANHATTAN ? (double)candidatas[k].chave : sqrt((double)candidatas[k].chave);
+		arvore->custoTotal += l->custo;
+	}
+
+	free(vertices); free(x); free(grelha.inicio); free(grelha.antenas);
+	free(candidatas); free(auxiliar); free(pai);
+	return arvore;
+}
+
+/**
+ * @brief Cria no grafo as ligações da árvore que ainda não existem.
+ *
+ * As ligações em falta são reservadas de uma só vez antes de serem criadas com conectarVertices.
+ *
+ * @param[in,out] grafo - apontador para o grafo.
+ * @param[in] arvore - apontador para a árvore.
+ *
+ * @return número de ligações criadas, ou @c -1 se algum argumento for nulo, a árvore for de outra
+ *         frequência ou alguma ligação não puder ser criada.
+ */
+int materializarArvoreSuporte(GRAFO* grafo, const ARVORE_SUPORTE* arvore) {
+	if (grafo == NULL || arvore == NULL || arvore->frequencia != grafo->frequencia) return -1;
+
+	reservarGrafo(grafo, 0, arvore->numLigacoes);
+
+	int criadas = 0;
+	for (int k = 0; k < arvore->numLigacoes; k++) {
+		const LIGACAO_SUPORTE* l = &arvore->ligacoes[k];
+		if (existeConexaoEntreVertices(grafo, l->xOrigem, l->yOrigem, l->xDestino, l->yDestino)) continue;
+		if (conectarVertices(grafo, l->xOrigem, l->yOrigem, l->xDestino, l->yDestino) != 0) return -1;
+		criadas++;
+	}
+	return criadas;
+}
+
+/**
+ * @brief Liberta a memória de uma árvore de suporte.
+ *
+ * @param arvore - apontador para a árvore a destruir.
+ * @return NULL, indicando que a árvore foi destruída.
+ */
+ARVORE_SUPORTE* destruirArvoreSuporte(ARVORE_SUPORTE* arvore) {
+	if (arvore == NULL) return NULL;
+
+	free(arvore->ligacoes);
+	free(arvore);
+	return NULL;
+}
+
+#pragma endregion
@@ -0,0 +1,86 @@
+#pragma once
+
+/**
+ * @file arvore.h
+ * @brief Árvore de suporte mínima (backbone de cablagem) das antenas de cada frequência, com
+ *        distância euclidiana ou de Manhattan, sem construir o grafo completo
+ *
+ * @author Rogério Picas
+ * @date 18-10-2026
+ * @version 1.0
+ *
+ */
+#include "funcoes.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#pragma region Estruturas
+
+/**
+ * @enum MetricaDistancia
+ * @brief Distância usada como custo de uma ligação entre duas antenas.
+ */
+typedef enum MetricaDistancia {
+    METRICA_EUCLIDIANA,  /**< Distância em linha reta */
+    METRICA_MANHATTAN    /**< Soma das diferenças das coordenadas (cabos ao longo das ruas) */
+} METRICA_DISTANCIA;
+
+/**
+ * @struct LigacaoSuporte
+ * @brief Ligação da árvore de suporte entre duas antenas.
+ */
+typedef struct LigacaoSuporte {
+    COORDENADA xOrigem;   /**< Coordenada X de uma das antenas */
+    COORDENADA yOrigem;   /**< Coordenada Y de uma das antenas */
+    COORDENADA xDestino;  /**< Coordenada X da outra antena */
+    COORDENADA yDestino;  /**< Coordenada Y da outra antena */
+    double custo;         /**< Distância entre as antenas, na métrica da árvore */
+} LIGACAO_SUPORTE;
+
+/**
+ * @struct ArvoreSuporte
+ * @brief Árvore de suporte mínima de um grafo (numVertices - 1 ligações, por ordem crescente de custo).
+ */
+typedef struct ArvoreSuporte {
+    char frequencia;             /**< Frequência do grafo */
+    METRICA_DISTANCIA metrica;   /**< Métrica dos custos */
+    LIGACAO_SUPORTE* ligacoes;   /**< Ligações da árvore */
+    int numLigacoes;             /**< Número de ligações */
+    double custoTotal;           /**< Soma dos custos das ligações */
+} ARVORE_SUPORTE;
+
+#pragma endregion
+
+#pragma region Funções da Árvore de Suporte
+
+/**
+ * @brief Calcula a árvore de suporte mínima das antenas do grafo, em O(V log V) para antenas bem distribuídas.
+ * @param grafo Apontador para o grafo (as ligações existentes não são consideradas).
+ * @param metrica Métrica da distância entre antenas.
+ * @param numThreads Número de threads a usar (<= 0 usa o valor por omissão do OpenMP; ignorado sem OpenMP).
+ * @return Apontador para a árvore criada ou NULL em caso de erro.
+ */
+ARVORE_SUPORTE* construirArvoreSuporte(GRAFO* grafo, METRICA_DISTANCIA metrica, int numThreads);
+
+/**
+ * @brief Cria no grafo as ligações da árvore que ainda não existem (com conectarVertices).
+ * @param grafo Apontador para o grafo.
+ * @param arvore Apontador para a árvore calculada para esse grafo.
+ * @return Número de ligações criadas, ou -1 se os argumentos forem inválidos ou alguma ligação falhar.
+ */
+int materializarArvoreSuporte(GRAFO* grafo, const ARVORE_SUPORTE* arvore);
+
+/**
+ * @brief Liberta a memória de uma árvore de suporte.
+ * @param arvore Apontador para a árvore a destruir.
+ * @return NULL, indicando que a árvore foi destruída.
+ */
+ARVORE_SUPORTE* destruirArvoreSuporte(ARVORE_SUPORTE* arvore);
+
+#pragma endregion
+
+#ifdef __cplusplus
+}
+#endif
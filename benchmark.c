@@ -0,0 +1,714 @@
+/**
+ * @file benchmark.c
+ * @brief Executável de testes de desempenho: gera uma rede sintética e mede as operações
+ *        principais da biblioteca em várias repetições, com percentis e saída JSON/CSV.
+ *
+ * Para redes grandes a cidade tem de ser maior do que a do enunciado: o alvo benchmark do
+ * CMakeLists.txt liga a uma biblioteca própria, com MAX_DIM=PA_MAX_DIM_BENCHMARK (4096), por exemplo:
+ *   cmake -S . -B build && cmake --build build --target benchmark
+ *   ./build/benchmark --antenas 1000000 --frequencias 8 --grau 4 --repeticoes 5 --saida resultados.json
+ *
+ * @author Rogério Picas
+ * @date 18-10-2026
+ * @version 1.0
+ */
+#define _CRT_SECURE_NO_WARNINGS
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "funcoes.h"
+#include "gerador.h"
+#include "relatorio.h"
+#include "criticos.h"
+#include "centralidade.h"
+#include "cache.h"
+#include "reserva.h"
+#include "densidade.h"
+#include "arvore.h"
+#include "reordenacao.h"
+#include "camadas.h"
+#include "espacial.h"
+#include "registo.h"
+
+#ifdef _WIN32
+#define FICHEIRO_NULO "NUL"
+#else
+#define FICHEIRO_NULO "/dev/null"
+#endif
+
+ /** @def NUM_OPERACOES
+  *  @brief Número de operações medidas em cada repetição.
+  */
+#define NUM_OPERACOES 26
+
+ /** @def CUSTO_SALTO_BENCHMARK
+  *  @brief Custo de mudar de camada na vista multi-camada medida (as ligações de um grafo custam 1).
+  */
+#define CUSTO_SALTO_BENCHMARK 2
+
+#pragma region Estruturas
+
+/**
+ * @struct Amostras
+ * @brief Tempos medidos (um por repetição) para uma operação.
+ */
+typedef struct Amostras {
+    const char* nome;     /**< Nome da função medida */
+    long long operacoes;  /**< Número de chamadas feitas em cada repetição */
+    double* tempos;       /**< Tempo total (ns) de cada repetição */
+    int num;              /**< Número de tempos registados */
+} AMOSTRAS;
+
+/**
+ * @struct Configuracao
+ * @brief Parâmetros do teste de desempenho lidos da linha de comandos.
+ */
+typedef struct Configuracao {
+    int antenas;          /**< Número de antenas da rede sintética */
+    int frequencias;      /**< Número de frequências distintas */
+    double grau;          /**< Grau médio de cada grafo */
+    int repeticoes;       /**< Número de repetições de cada medição */
+    int consultas;        /**< Número de chamadas de BFT/DFS por repetição */
+    int nefasto;          /**< Número de antenas passadas ao efeitoNefasto */
+    int relatorio;        /**< Threads do relatório de interferência (0 = por omissão, -1 = não medir) */
+    int criticos;         /**< Threads da análise de antenas e ligações críticas (0 = por omissão, -1 = não medir) */
+    double centralidade;  /**< Erro da centralidade aproximada (0 = exata, < 0 = não medir) */
+    int cache;            /**< Capacidade da cache de consultas da rede (0 = sem cache) */
+    int densidade;        /**< Threads da construção do mapa de densidade (0 = por omissão, -1 = não medir) */
+    int arvore;           /**< Threads da árvore de suporte mínima (0 = por omissão, -1 = não medir) */
+    int reordenar;        /**< Ordem dos vértices usada para reordenar os grafos (ORDEM_VERTICES), ou -1 para não reordenar */
+    int camadas;          /**< Raio das ligações entre camadas da vista multi-camada (-1 = não medir) */
+    int espacial;         /**< Vizinhos pedidos em cada consulta kNN do índice espacial (-1 = não medir) */
+    int reservar;         /**< 1 para reservar vértices, ligações e baldes antes de inserir as antenas */
+    unsigned int semente; /**< Semente do gerador */
+    char* formato;        /**< "json" ou "csv" */
+    char* saida;          /**< Ficheiro de resultados */
+    char* mapa;           /**< Ficheiro de texto com o mapa gerado */
+    char* gerar;          /**< Se definido, apenas gera o mapa neste ficheiro */
+} CONFIGURACAO;
+
+#pragma endregion
+
+#pragma region Funções Auxiliares
+
+/**
+ * @brief Devolve o instante atual em nanossegundos (relógio de alta resolução do C11).
+ */
+static double agoraNs() {
+	struct timespec ts;
+	timespec_get(&ts, TIME_UTC);
+	return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+/**
+ * @brief Função de comparação para ordenar tempos com qsort.
+ */
+static int compararTempos(const void* a, const void* b) {
+	double da = *(const double*)a;
+	double db = *(const double*)b;
+	return (da > db) - (da < db);
+}
+
+/**
+ * @brief Percentil (método do posto mais próximo) de um array de tempos já ordenado.
+ */
+static double percentil(double* ordenados, int n, double p) {
+	int posto = (int)(p / 100.0 * n + 0.999999);
+	if (posto < 1) posto = 1;
+	if (posto > n) posto = n;
+	return ordenados[posto - 1];
+}
+
+/**
+ * @brief Cria uma rede com os grafos de todas as frequências do mapa e insere as antenas.
+ *
+ * @param[in] mapa - mapa gerado.
+ * @param[in] numFrequencias - número de frequências do mapa.
+ * @param[in] reservar - se verdadeiro, reserva os vértices, as ligações e os baldes antes de inserir (fora da medição).
+ * @param[out] grafos - array onde ficam os grafos, indexado por frequência ('A' = 0).
+ * @param[out] tempo - tempo total (ns) das chamadas a inserirAntenaGrafo.
+ *
+ * @return a rede criada, ou NULL em caso de falha.
+ */
+static REDE* construirRede(MAPA_GERADO* mapa, int numFrequencias, bool reservar, GRAFO** grafos, double* tempo) {
+	REDE* rede = criarRede();
+	if (rede == NULL) return NULL;
+	for (int f = 0; f < numFrequencias; f++) {
+		grafos[f] = criarGrafo(rede, (char)('A' + f));
+	}
+	if (reservar)
+	{
+		reservarRede(rede, mapa->antenas, mapa->numAntenas);
+		int ligacoes[MAX_FREQUENCIAS] = { 0 };
+		for (int i = 0; i < mapa->numLigacoes; i++) {
+			ligacoes[mapa->ligacoes[i].frequencia - 'A']++;
+		}
+		for (int f = 0; f < numFrequencias; f++) {
+			reservarGrafo(grafos[f], 0, ligacoes[f]);
+		}
+	}
+
+	double inicio = agoraNs();
+	for (int i = 0; i < mapa->numAntenas; i++) {
+		ANTENAS* a = &mapa->antenas[i];
+		inserirAntenaGrafo(grafos[a->frequencia - 'A'], a->frequencia, a->x, a->y);
+	}
+	*tempo = agoraNs() - inicio;
+	return rede;
+}
+
+/**
+ * @brief Regista um tempo nas amostras de uma operação.
+ */
+static void registar(AMOSTRAS* amostras, double tempo) {
+	amostras->tempos[amostras->num++] = tempo;
+}
+
+/**
+ * @brief Converte o nome de uma ordem de vértices (morton, hilbert, bfs ou rcm).
+ *
+ * @return a ordem (ORDEM_VERTICES), ou @c -2 se o nome for desconhecido.
+ */
+static int lerOrdem(const char* nome) {
+	if (strcmp(nome, "morton") == 0) return ORDEM_MORTON;
+	if (strcmp(nome, "hilbert") == 0) return ORDEM_HILBERT;
+	if (strcmp(nome, "bfs") == 0) return ORDEM_BFS;
+	if (strcmp(nome, "rcm") == 0) return ORDEM_RCM;
+	return -2;
+}
+
+/**
+ * @brief Mede BFT e DFS a partir das mesmas antenas aleatórias (com --cache, as BFT repetidas são respondidas pela cache).
+ *
+ * @param[in] mapa - mapa gerado, de onde são sorteadas as antenas.
+ * @param[in] grafos - grafos da rede, indexados por frequência.
+ * @param[in] consultas - número de antenas sorteadas.
+ * @param[in,out] estado - estado do gerador aleatório.
+ * @param[out] bft - amostras onde é registado o tempo das BFT.
+ * @param[out] dfs - amostras onde é registado o tempo das DFS.
+ *
+ * @return a soma das antenas alcançadas pelas BFT.
+ */
+static long long medirConsultas(MAPA_GERADO* mapa, GRAFO** grafos, int consultas, uint64_t* estado, AMOSTRAS* bft, AMOSTRAS* dfs) {
+	double tempoBFT = 0, tempoDFS = 0;
+	long long alcancadas = 0;
+	for (int q = 0; q < consultas && mapa->numAntenas > 0; q++) {
+		ANTENAS* a = &mapa->antenas[proximoAleatorio(estado) % mapa->numAntenas];
+		GRAFO* grafo = grafos[a->frequencia - 'A'];
+		int count = 0;
+
+		double inicio = agoraNs();
+		BFT(grafo, a->x, a->y, &count);
+		tempoBFT += agoraNs() - inicio;
+		alcancadas += count;
+
+		resetarVisitados(grafo->vertices);
+		inicio = agoraNs();
+		DFS(grafo, a->x, a->y);
+		tempoDFS += agoraNs() - inicio;
+		resetarVisitados(grafo->vertices);
+	}
+	registar(bft, tempoBFT);
+	registar(dfs, tempoDFS);
+	return alcancadas;
+}
+
+/**
+ * @brief Distâncias (ao quadrado) das k antenas mais próximas de uma posição, percorrendo todas as antenas da rede.
+ *
+ * Referência para kVizinhosMaisProximos: cada antena é comparada com a k-ésima distância já
+ * encontrada e, se for menor, inserida por ordem crescente.
+ *
+ * @param[in] grafos - grafos da rede, indexados por frequência.
+ * @param[in] numFrequencias - número de grafos.
+ * @param[in] x - coordenada X da posição.
+ * @param[in] y - coordenada Y da posição.
+ * @param[in] k - número de vizinhos pretendido.
+ * @param[out] distancias - array com capacidade para k distâncias, por ordem crescente.
+ *
+ * @return o número de vizinhos encontrados (no máximo k).
+ */
+static int kVizinhosLinear(GRAFO** grafos, int numFrequencias, int x, int y, int k, long long* distancias) {
+	int num = 0;
+	for (int f = 0; f < numFrequencias; f++) {
+		for (VERTICE* v = grafos[f]->vertices; v != NULL; v = v->prox) {
+			long long dx = v->antena.x - x, dy = v->antena.y - y;
+			long long d = dx * dx + dy * dy;
+			if (num == k && d >= distancias[k - 1]) continue;
+
+			int i = num < k ? num++ : k - 1;
+			while (i > 0 && distancias[i - 1] > d) {
+				distancias[i] = distancias[i - 1];
+				i--;
+			}
+			distancias[i] = d;
+		}
+	}
+	return num;
+}
+
+/**
+ * @brief Lê os parâmetros da linha de comandos.
+ *
+ * @return @c 0 em caso de sucesso, @c 1 se algum parâmetro for desconhecido ou inválido.
+ */
+static int lerArgumentos(int argc, char* argv[], CONFIGURACAO* cfg) {
+	for (int i = 1; i < argc; i++) {
+		char* valor = i + 1 < argc ? argv[i + 1] : NULL;
+		if (strcmp(argv[i], "--antenas") == 0 && valor) cfg->antenas = atoi(argv[++i]);
+		else if (strcmp(argv[i], "--frequencias") == 0 && valor) cfg->frequencias = atoi(argv[++i]);
+		else if (strcmp(argv[i], "--grau") == 0 && valor) cfg->grau = atof(argv[++i]);
+		else if (strcmp(argv[i], "--repeticoes") == 0 && valor) cfg->repeticoes = atoi(argv[++i]);
+		else if (strcmp(argv[i], "--consultas") == 0 && valor) cfg->consultas = atoi(argv[++i]);
+		else if (strcmp(argv[i], "--nefasto") == 0 && valor) cfg->nefasto = atoi(argv[++i]);
+		else if (strcmp(argv[i], "--relatorio") == 0 && valor) cfg->relatorio = atoi(argv[++i]);
+		else if (strcmp(argv[i], "--criticos") == 0 && valor) cfg->criticos = atoi(argv[++i]);
+		else if (strcmp(argv[i], "--centralidade") == 0 && valor) cfg->centralidade = atof(argv[++i]);
+		else if (strcmp(argv[i], "--cache") == 0 && valor) cfg->cache = atoi(argv[++i]);
+		else if (strcmp(argv[i], "--densidade") == 0 && valor) cfg->densidade = atoi(argv[++i]);
+		else if (strcmp(argv[i], "--arvore") == 0 && valor) cfg->arvore = atoi(argv[++i]);
+		else if (strcmp(argv[i], "--reordenar") == 0 && valor) cfg->reordenar = lerOrdem(argv[++i]);
+		else if (strcmp(argv[i], "--camadas") == 0 && valor) cfg->camadas = atoi(argv[++i]);
+		else if (strcmp(argv[i], "--espacial") == 0 && valor) cfg->espacial = atoi(argv[++i]);
+		else if (strcmp(argv[i], "--semente") == 0 && valor) cfg->semente = (unsigned int)strtoul(argv[++i], NULL, 10);
+		else if (strcmp(argv[i], "--formato") == 0 && valor) cfg->formato = argv[++i];
+		else if (strcmp(argv[i], "--saida") == 0 && valor) cfg->saida = argv[++i];
+		else if (strcmp(argv[i], "--mapa") == 0 && valor) cfg->mapa = argv[++i];
+		else if (strcmp(argv[i], "--gerar") == 0 && valor) cfg->gerar = argv[++i];
+		else if (strcmp(argv[i], "--reservar") == 0) cfg->reservar = 1;
+		else return 1;
+	}
+	if (cfg->repeticoes < 1 || cfg->consultas < 0 || cfg->nefasto < 0 || cfg->relatorio < -1 || cfg->criticos < -1 || cfg->cache < 0 || cfg->densidade < -1 || cfg->arvore < -1 || cfg->camadas < -1 || cfg->espacial < -1 || cfg->espacial == 0) return 1;
+	if (cfg->reordenar == -2) return 1;
+	if (strcmp(cfg->formato, "json") != 0 && strcmp(cfg->formato, "csv") != 0) return 1;
+	return 0;
+}
+
+/**
+ * @brief Escreve os resultados (percentis por operação) em JSON ou CSV.
+ */
+static void escreverResultados(FILE* fp, CONFIGURACAO* cfg, AMOSTRAS* amostras, int numOperacoes) {
+	bool json = strcmp(cfg->formato, "json") == 0;
+
+	if (json)
+	{
+		fprintf(fp, "{\n  \"configuracao\": {\"antenas\": %d, \"frequencias\": %d, \"grau_medio\": %.3f, "
+			"\"repeticoes\": %d, \"consultas\": %d, \"nefasto\": %d, \"semente\": %u, \"reservar\": %d, \"max_dim\": %d},\n"
+			"  \"resultados\": [\n",
+			cfg->antenas, cfg->frequencias, cfg->grau, cfg->repeticoes, cfg->consultas, cfg->nefasto, cfg->semente, cfg->reservar, MAX_DIM);
+	}
+	else
+	{
+		fprintf(fp, "operacao,operacoes,repeticoes,min_ns,p50_ns,p90_ns,p99_ns,max_ns,media_ns,ns_por_operacao\n");
+	}
+
+	bool primeira = true;
+	for (int i = 0; i < numOperacoes; i++) {
+		AMOSTRAS* a = &amostras[i];
+		if (a->num == 0) continue;
+
+		qsort(a->tempos, (size_t)a->num, sizeof(double), compararTempos);
+		double soma = 0;
+		for (int j = 0; j < a->num; j++) soma += a->tempos[j];
+		double p50 = percentil(a->tempos, a->num, 50);
+		double porOperacao = a->operacoes > 0 ? p50 / (double)a->operacoes : 0;
+
+		if (json)
+		{
+			// O separador vem antes de cada entrada: as operações não medidas não deixam vírgulas a mais
+			fprintf(fp, "%s    {\"operacao\": \"%s\", \"operacoes\": %lld, \"repeticoes\": %d, \"min_ns\": %.0f, "
+				"\"p50_ns\": %.0f, \"p90_ns\": %.0f, \"p99_ns\": %.0f, \"max_ns\": %.0f, \"media_ns\": %.0f, "
+				"\"ns_por_operacao\": %.2f}",
+				primeira ? "" : ",\n", a->nome, a->operacoes, a->num, a->tempos[0], p50, percentil(a->tempos, a->num, 90),
+				percentil(a->tempos, a->num, 99), a->tempos[a->num - 1], soma / a->num, porOperacao);
+		}
+		else
+		{
+			fprintf(fp, "%s,%lld,%d,%.0f,%.0f,%.0f,%.0f,%.0f,%.0f,%.2f\n",
+				a->nome, a->operacoes, a->num, a->tempos[0], p50, percentil(a->tempos, a->num, 90),
+				percentil(a->tempos, a->num, 99), a->tempos[a->num - 1], soma / a->num, porOperacao);
+		}
+		fprintf(stderr, "%-26s p50 %12.0f ns  (%8.2f ns/op)\n", a->nome, p50, porOperacao);
+		primeira = false;
+	}
+
+	if (json)
+	{
+		fprintf(fp, "\n  ]\n}\n");
+	}
+}
+
+#pragma endregion
+
+int main(int argc, char* argv[]) {
+	CONFIGURACAO cfg = { 1000, 4, 4.0, 5, 100, 500, -1, -1, -1.0, 0, -1, -1, -1, -1, -1, 0, 1, "json", NULL, "benchmark_mapa.txt", NULL };
+
+	if (lerArgumentos(argc, argv, &cfg) != 0)
+	{
+		fprintf(stderr, "Uso: %s [--antenas N] [--frequencias F] [--grau G] [--repeticoes R] [--consultas Q]\n"
+			"       [--nefasto K] [--relatorio T] [--criticos T] [--centralidade E] [--cache N] [--densidade T] [--arvore T]\n"
+			"       [--reordenar morton|hilbert|bfs|rcm] [--camadas R] [--espacial K]\n"
+			"       [--semente S] [--formato json|csv] [--saida ficheiro] [--mapa ficheiro] [--gerar ficheiro] [--reservar]\n", argv[0]);
+		return 1;
+	}
+	if (cfg.saida == NULL)
+	{
+		cfg.saida = strcmp(cfg.formato, "json") == 0 ? "benchmark.json" : "benchmark.csv";
+	}
+
+	MAPA_GERADO* mapa = gerarMapa(cfg.antenas, cfg.frequencias, cfg.grau, cfg.semente);
+	if (mapa == NULL)
+	{
+		fprintf(stderr, "Parametros invalidos: a cidade (MAX_DIM = %d) tem %lld celulas e aceita ate %d frequencias.\n",
+			MAX_DIM, (long long)MAX_DIM * MAX_DIM, MAX_FREQUENCIAS);
+		return 1;
+	}
+	if (guardarMapaTexto(mapa, cfg.gerar ? cfg.gerar : cfg.mapa) != 0)
+	{
+		fprintf(stderr, "Erro ao escrever o mapa.\n");
+		destruirMapa(mapa);
+		return 1;
+	}
+	if (cfg.gerar)
+	{
+		destruirMapa(mapa);
+		return 0;
+	}
+
+	// As funções da biblioteca escrevem no registo (DFS, efeitoNefasto); essa saída é descartada,
+	// mas continua a ser formatada e escrita pela thread do registo, como numa execução normal
+	FILE* resultados = fopen(cfg.saida, "w");
+	if (resultados == NULL || freopen(FICHEIRO_NULO, "w", stdout) == NULL)
+	{
+		fprintf(stderr, "Erro ao abrir os ficheiros de saida.\n");
+		destruirMapa(mapa);
+		return 1;
+	}
+	iniciarRegisto();
+
+	AMOSTRAS amostras[NUM_OPERACOES] = {
+		{ "carregaGrafo", cfg.antenas },
+		{ "inserirAntenaGrafo", cfg.antenas },
+		{ "conectarVertices", mapa->numLigacoes },
+		{ "BFT", cfg.consultas },
+		{ "DFS", cfg.consultas },
+		{ "efeitoNefasto", 1 },
+		{ "gerarRelatorio", cfg.antenas },
+		{ "analisarCriticos", cfg.frequencias },
+		{ "calcularCentralidade", cfg.antenas },
+		{ "guardarGrafoBin", cfg.frequencias },
+		{ "criarMapaDensidade", cfg.antenas },
+		{ "contarRetangulo", cfg.consultas },
+		{ "contarRetanguloLinear", cfg.consultas },
+		{ "construirArvoreSuporte", cfg.antenas },
+		{ "materializarArvoreSuporte", 0 },
+		{ "reordenarGrafo", cfg.frequencias },
+		{ "BFTReordenado", cfg.consultas },
+		{ "DFSReordenado", cfg.consultas },
+		{ "criarRedeCamadas", cfg.antenas },
+		{ "custoMinimoCamadas", cfg.consultas },
+		{ "alcanceCamadas", cfg.consultas },
+		{ "construirIndiceEspacial", cfg.antenas },
+		{ "consultarRetangulo", cfg.consultas },
+		{ "consultarRetanguloLinear", cfg.consultas },
+		{ "kVizinhosMaisProximos", cfg.consultas },
+		{ "kVizinhosLinear", cfg.consultas },
+	};
+	for (int i = 0; i < NUM_OPERACOES; i++) {
+		amostras[i].tempos = (double*)malloc((size_t)cfg.repeticoes * sizeof(double));
+		if (amostras[i].tempos == NULL) return 1;
+	}
+
+	uint64_t estado = 0x2545F4914F6CDD1DULL ^ cfg.semente;
+	GRAFO* grafos[MAX_FREQUENCIAS];
+
+	for (int r = 0; r < cfg.repeticoes; r++) {
+		fprintf(stderr, "Repeticao %d/%d\n", r + 1, cfg.repeticoes);
+
+		// carregaGrafo
+		REDE* rede = criarRede();
+		double inicio = agoraNs();
+		carregaGrafo(rede, cfg.mapa);
+		registar(&amostras[0], agoraNs() - inicio);
+		destruirRede(rede);
+
+		// inserirAntenaGrafo
+		double tempo;
+		rede = construirRede(mapa, cfg.frequencias, cfg.reservar != 0, grafos, &tempo);
+		if (rede == NULL) return 1;
+		registar(&amostras[1], tempo);
+
+		// conectarVertices
+		inicio = agoraNs();
+		for (int i = 0; i < mapa->numLigacoes; i++) {
+			LIGACAO_GERADA* l = &mapa->ligacoes[i];
+			conectarVertices(grafos[l->frequencia - 'A'], l->x1, l->y1, l->x2, l->y2);
+		}
+		registar(&amostras[2], agoraNs() - inicio);
+
+		// BFT e DFS
+		if (cfg.cache > 0 && ativarCacheConsultas(rede, cfg.cache) != 0) return 1;
+		uint64_t estadoConsultas = estado;
+		long long alcancadas = medirConsultas(mapa, grafos, cfg.consultas, &estado, &amostras[3], &amostras[4]);
+
+		// Com --reordenar, os grafos passam para blocos contíguos e as mesmas consultas são repetidas
+		if (cfg.reordenar >= 0)
+		{
+			inicio = agoraNs();
+			for (int f = 0; f < cfg.frequencias; f++) {
+				if (reordenarGrafo(grafos[f], (ORDEM_VERTICES)cfg.reordenar, NULL) != 0) return 1;
+			}
+			registar(&amostras[15], agoraNs() - inicio);
+
+			long long reordenadas = medirConsultas(mapa, grafos, cfg.consultas, &estadoConsultas, &amostras[16], &amostras[17]);
+			if (reordenadas != alcancadas)
+			{
+				fprintf(stderr, "reordenarGrafo: a BFT alcancou %lld antenas antes e %lld depois.\n", alcancadas, reordenadas);
+			}
+		}
+
+		// guardarGrafoBin
+		inicio = agoraNs();
+		for (int f = 0; f < cfg.frequencias; f++) {
+			// Um grafo sem antenas não tem nada para guardar (guardarGrafoBin devolve false)
+			if (grafos[f]->vertices != NULL && !guardarGrafoBin(grafos[f]->vertices, "benchmark_grafo.bin"))
+			{
+				fprintf(stderr, "guardarGrafoBin: falha ao guardar o grafo da frequencia %c.\n", grafos[f]->frequencia);
+				return 1;
+			}
+		}
+		registar(&amostras[9], agoraNs() - inicio);
+
+		// gerarRelatorioInterferencia (todos os pares de cada frequência, em paralelo)
+		if (cfg.relatorio >= 0)
+		{
+			inicio = agoraNs();
+			RELATORIO_INTERFERENCIA* relatorio = gerarRelatorioInterferencia(rede, cfg.relatorio);
+			registar(&amostras[6], agoraNs() - inicio);
+			destruirRelatorioInterferencia(relatorio);
+		}
+
+		// analisarRedeCritica (um grafo por thread)
+		if (cfg.criticos >= 0)
+		{
+			inicio = agoraNs();
+			ANALISE_CRITICA* analise = analisarRedeCritica(rede, cfg.criticos);
+			registar(&amostras[7], agoraNs() - inicio);
+			destruirAnaliseCritica(analise);
+		}
+
+		// calcularCentralidade (origens repartidas pelas threads; exata com erro 0)
+		if (cfg.centralidade >= 0)
+		{
+			inicio = agoraNs();
+			for (int f = 0; f < cfg.frequencias; f++) {
+				destruirCentralidade(calcularCentralidade(grafos[f], cfg.centralidade, 0.95, cfg.semente, 0));
+			}
+			registar(&amostras[8], agoraNs() - inicio);
+		}
+
+		// Mapa de densidade das antenas e consultas de retângulos, comparadas com a contagem antena a antena
+		if (cfg.densidade >= 0)
+		{
+			inicio = agoraNs();
+			MAPA_DENSIDADE* densidade = criarMapaDensidade(rede, DENSIDADE_ANTENAS, cfg.densidade);
+			registar(&amostras[10], agoraNs() - inicio);
+			if (densidade == NULL) return 1;
+			TABELA_SOMAS* todas = procurarTabelaSomas(densidade, DENSIDADE_TODAS);
+
+			uint64_t estadoRetangulos = estado;
+			long long totalTabela = 0, totalLinear = 0;
+			inicio = agoraNs();
+			for (int q = 0; q < cfg.consultas; q++) {
+				int x0 = (int)(proximoAleatorio(&estado) % MAX_DIM), y0 = (int)(proximoAleatorio(&estado) % MAX_DIM);
+				int lado = (int)(proximoAleatorio(&estado) % (MAX_DIM / 8 + 1));
+				totalTabela += contarRetangulo(todas, x0, y0, x0 + lado, y0 + lado);
+			}
+			registar(&amostras[11], agoraNs() - inicio);
+
+			inicio = agoraNs();
+			for (int q = 0; q < cfg.consultas; q++) {
+				int x0 = (int)(proximoAleatorio(&estadoRetangulos) % MAX_DIM), y0 = (int)(proximoAleatorio(&estadoRetangulos) % MAX_DIM);
+				int lado = (int)(proximoAleatorio(&estadoRetangulos) % (MAX_DIM / 8 + 1));
+				for (int f = 0; f < cfg.frequencias; f++) {
+					for (VERTICE* v = grafos[f]->vertices; v != NULL; v = v->prox) {
+						totalLinear += v->antena.x >= x0 && v->antena.x <= x0 + lado && v->antena.y >= y0 && v->antena.y <= y0 + lado;
+					}
+				}
+			}
+			registar(&amostras[12], agoraNs() - inicio);
+			if (totalTabela != totalLinear)
+			{
+				fprintf(stderr, "contarRetangulo: %lld antenas, a contagem linear deu %lld.\n", totalTabela, totalLinear);
+			}
+			destruirMapaDensidade(densidade);
+		}
+
+		// Vista multi-camada: custo mínimo entre pares de antenas aleatórias e alcance sem limite de custo,
+		// que nunca pode ser menor do que o alcance da BFT na camada da própria antena
+		if (cfg.camadas >= 0 && mapa->numAntenas > 0)
+		{
+			inicio = agoraNs();
+			REDE_CAMADAS* camadas = criarRedeCamadas(rede, cfg.camadas, CUSTO_SALTO_BENCHMARK);
+			registar(&amostras[18], agoraNs() - inicio);
+			if (camadas == NULL) return 1;
+
+			double tempoCusto = 0, tempoAlcance = 0;
+			for (int q = 0; q < cfg.consultas; q++) {
+				ANTENAS* a = &mapa->antenas[proximoAleatorio(&estado) % mapa->numAntenas];
+				ANTENAS* b = &mapa->antenas[proximoAleatorio(&estado) % mapa->numAntenas];
+				inicio = agoraNs();
+				custoMinimoCamadas(camadas, a->frequencia, a->x, a->y, b->frequencia, b->x, b->y);
+				tempoCusto += agoraNs() - inicio;
+
+				int alcance = 0, alcanceGrafo = 0;
+				inicio = agoraNs();
+				alcanceCamadas(camadas, a->frequencia, a->x, a->y, -1, &alcance);
+				tempoAlcance += agoraNs() - inicio;
+
+				GRAFO* grafo = grafos[a->frequencia - 'A'];
+				BFT(grafo, a->x, a->y, &alcanceGrafo);
+				resetarVisitados(grafo->vertices);
+				if (alcance < alcanceGrafo)
+				{
+					fprintf(stderr, "alcanceCamadas: %d antenas a partir de (%d, %d), a BFT alcanca %d.\n", alcance, a->x, a->y, alcanceGrafo);
+				}
+			}
+			registar(&amostras[19], tempoCusto);
+			registar(&amostras[20], tempoAlcance);
+			destruirRedeCamadas(camadas);
+		}
+
+		// Índice espacial: retângulos e k vizinhos mais próximos, comparados com uma passagem por todas as antenas
+		if (cfg.espacial > 0)
+		{
+			inicio = agoraNs();
+			INDICE_ESPACIAL* indice = construirIndiceEspacial(rede, TAM_BALDE);
+			registar(&amostras[21], agoraNs() - inicio);
+			VERTICE** vizinhos = (VERTICE**)malloc((size_t)cfg.espacial * sizeof(VERTICE*));
+			long long* distancias = (long long*)malloc((size_t)cfg.espacial * sizeof(long long));
+			if (indice == NULL || vizinhos == NULL || distancias == NULL) return 1;
+
+			uint64_t estadoEspacial = estado;
+			long long totalIndice = 0, totalLinear = 0;
+			inicio = agoraNs();
+			for (int q = 0; q < cfg.consultas; q++) {
+				int x0 = (int)(proximoAleatorio(&estado) % MAX_DIM), y0 = (int)(proximoAleatorio(&estado) % MAX_DIM);
+				int lado = (int)(proximoAleatorio(&estado) % (MAX_DIM / 8 + 1));
+				totalIndice += consultarRetangulo(indice, x0, y0, x0 + lado, y0 + lado, '\0', NULL, 0);
+			}
+			registar(&amostras[22], agoraNs() - inicio);
+
+			inicio = agoraNs();
+			for (int q = 0; q < cfg.consultas; q++) {
+				int x0 = (int)(proximoAleatorio(&estadoEspacial) % MAX_DIM), y0 = (int)(proximoAleatorio(&estadoEspacial) % MAX_DIM);
+				int lado = (int)(proximoAleatorio(&estadoEspacial) % (MAX_DIM / 8 + 1));
+				for (int f = 0; f < cfg.frequencias; f++) {
+					for (VERTICE* v = grafos[f]->vertices; v != NULL; v = v->prox) {
+						totalLinear += v->antena.x >= x0 && v->antena.x <= x0 + lado && v->antena.y >= y0 && v->antena.y <= y0 + lado;
+					}
+				}
+			}
+			registar(&amostras[23], agoraNs() - inicio);
+			if (totalIndice != totalLinear)
+			{
+				fprintf(stderr, "consultarRetangulo: %lld antenas, a contagem linear deu %lld.\n", totalIndice, totalLinear);
+			}
+
+			// Em caso de empate os vizinhos podem ser outros: compara-se a distância do mais afastado
+			double tempoIndice = 0, tempoLinear = 0;
+			for (int q = 0; q < cfg.consultas; q++) {
+				int x = (int)(proximoAleatorio(&estado) % MAX_DIM), y = (int)(proximoAleatorio(&estado) % MAX_DIM);
+				inicio = agoraNs();
+				int numIndice = kVizinhosMaisProximos(indice, x, y, '\0', cfg.espacial, vizinhos);
+				tempoIndice += agoraNs() - inicio;
+
+				inicio = agoraNs();
+				int numLinear = kVizinhosLinear(grafos, cfg.frequencias, x, y, cfg.espacial, distancias);
+				tempoLinear += agoraNs() - inicio;
+
+				long long dx = numIndice > 0 ? vizinhos[numIndice - 1]->antena.x - x : 0;
+				long long dy = numIndice > 0 ? vizinhos[numIndice - 1]->antena.y - y : 0;
+				if (numIndice != numLinear || (numLinear > 0 && dx * dx + dy * dy != distancias[numLinear - 1]))
+				{
+					fprintf(stderr, "kVizinhosMaisProximos: resultado diferente da procura linear em (%d, %d).\n", x, y);
+				}
+			}
+			registar(&amostras[24], tempoIndice);
+			registar(&amostras[25], tempoLinear);
+
+			free(vizinhos);
+			free(distancias);
+			destruirIndiceEspacial(indice);
+		}
+
+		// Árvore de suporte mínima de cada grafo, depois ligada no próprio grafo (cada grafo fica conexo)
+		if (cfg.arvore >= 0)
+		{
+			ARVORE_SUPORTE* arvores[MAX_FREQUENCIAS];
+			inicio = agoraNs();
+			for (int f = 0; f < cfg.frequencias; f++) {
+				arvores[f] = construirArvoreSuporte(grafos[f], METRICA_EUCLIDIANA, cfg.arvore);
+			}
+			registar(&amostras[13], agoraNs() - inicio);
+
+			long long ligacoes = 0;
+			inicio = agoraNs();
+			for (int f = 0; f < cfg.frequencias; f++) {
+				if (arvores[f] == NULL || materializarArvoreSuporte(grafos[f], arvores[f]) < 0) return 1;
+				ligacoes += arvores[f]->numLigacoes;
+			}
+			registar(&amostras[14], agoraNs() - inicio);
+			amostras[14].operacoes = ligacoes;
+
+			for (int f = 0; f < cfg.frequencias; f++) {
+				int alcancadas = 0;
+				if (grafos[f]->vertices != NULL)
+				{
+					BFT(grafos[f], grafos[f]->vertices->antena.x, grafos[f]->vertices->antena.y, &alcancadas);
+					resetarVisitados(grafos[f]->vertices);
+				}
+				if (alcancadas != grafos[f]->numVertices)
+				{
+					fprintf(stderr, "materializarArvoreSuporte: o grafo %c ficou com %d de %d antenas ligadas.\n",
+						grafos[f]->frequencia, alcancadas, grafos[f]->numVertices);
+				}
+				destruirArvoreSuporte(arvores[f]);
+			}
+		}
+
+		// efeitoNefasto sobre as primeiras antenas do maior grafo
+		GRAFO* maior = grafos[0];
+		for (int f = 1; f < cfg.frequencias; f++) {
+			if (grafos[f]->numVertices > maior->numVertices) maior = grafos[f];
+		}
+		NEFASTO* lista = NULL;
+		int n = 0;
+		for (VERTICE* v = maior->vertices; v != NULL && n < cfg.nefasto; v = v->prox, n++) {
+			inserirEfeitoNefasto(rede, &lista, v->antena.frequencia, v->antena.x, v->antena.y);
+		}
+		amostras[5].operacoes = (long long)n * (n - 1) / 2;	// pares de antenas comparados
+		inicio = agoraNs();
+		efeitoNefasto(rede, lista);
+		registar(&amostras[5], agoraNs() - inicio);
+		while (lista) {
+			NEFASTO* prox = lista->prox;
+			free(lista);
+			lista = prox;
+		}
+
+		destruirRede(rede);
+	}
+	remove("benchmark_grafo.bin");
+	terminarRegisto();
+
+	escreverResultados(resultados, &cfg, amostras, NUM_OPERACOES);
+	fclose(resultados);
+
+	for (int i = 0; i < NUM_OPERACOES; i++) {
+		free(amostras[i].tempos);
+	}
+	destruirMapa(mapa);
+	return 0;
+}
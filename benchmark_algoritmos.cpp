@@ -0,0 +1,169 @@
+/**
+ * @file benchmark_algoritmos.cpp
+ * @brief Compara as travessias da biblioteca em C (BFT, DFS) com os templates de algoritmos.hpp,
+ *        instanciados sobre as listas ligadas do GRAFO e sobre a cópia contígua (CSR).
+ *
+ *   ./benchmark_algoritmos --antenas 200000 --frequencias 4 --grau 4 --consultas 20
+ *
+ * @author Rogério Picas
+ * @date 18-10-2026
+ * @version 1.0
+ */
+#define _CRT_SECURE_NO_WARNINGS
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+#include "algoritmos.hpp"
+#include "funcoes.h"
+#include "gerador.h"
+#include "rede.hpp"
+#include "registo.h"
+
+namespace {
+
+/**
+ * @brief Mede o tempo (ns) de uma função.
+ */
+template <class F>
+double medirNs(F&& f) {
+    auto inicio = std::chrono::steady_clock::now();
+    f();
+    return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - inicio).count();
+}
+
+/**
+ * @brief Escreve uma linha da tabela de resultados.
+ */
+void mostrar(const char* nome, double ns, long long consultas, unsigned long long verificacao) {
+    std::printf("%-28s %14.0f ns  %10.1f ns/consulta  (verificacao %llu)\n",
+                nome, ns, consultas > 0 ? ns / static_cast<double>(consultas) : 0.0, verificacao);
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    int antenas = 200000, frequencias = 4, consultas = 20;
+    double grau = 4.0;
+    unsigned int semente = 1;
+    for (int i = 1; i < argc; i++) {
+        const char* valor = i + 1 < argc ? argv[i + 1] : nullptr;
+        if (std::strcmp(argv[i], "--antenas") == 0 && valor) antenas = std::atoi(argv[++i]);
+        else if (std::strcmp(argv[i], "--frequencias") == 0 && valor) frequencias = std::atoi(argv[++i]);
+        else if (std::strcmp(argv[i], "--grau") == 0 && valor) grau = std::atof(argv[++i]);
+        else if (std::strcmp(argv[i], "--consultas") == 0 && valor) consultas = std::atoi(argv[++i]);
+        else if (std::strcmp(argv[i], "--semente") == 0 && valor) semente = static_cast<unsigned int>(std::strtoul(argv[++i], nullptr, 10));
+        else {
+            std::fprintf(stderr, "Uso: %s [--antenas N] [--frequencias F] [--grau G] [--consultas Q] [--semente S]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    MAPA_GERADO* mapa = gerarMapa(antenas, frequencias, grau, semente);
+    if (mapa == nullptr) {
+        std::fprintf(stderr, "Nao foi possivel gerar a rede (MAX_DIM = %d).\n", MAX_DIM);
+        return 1;
+    }
+    pa::Rede rede;
+    rede.inserir(pa::Intervalo<const ANTENAS>(mapa->antenas, static_cast<std::size_t>(mapa->numAntenas)));
+    for (int i = 0; i < mapa->numLigacoes; i++) {
+        const LIGACAO_GERADA& l = mapa->ligacoes[i];
+        rede.procurar(l.frequencia).ligar(l.x1, l.y1, l.x2, l.y2);
+    }
+    destruirMapa(mapa);
+
+    pa::Grafo maior;
+    for (pa::Grafo g : rede.grafos()) {
+        if (!maior || g.numVertices() > maior.numVertices()) maior = g;
+    }
+    if (!maior) return 0;
+    GRAFO* grafo = maior.c();
+
+    // Origens aleatórias, as mesmas para todas as variantes
+    std::vector<const ANTENAS*> origens;
+    std::vector<pa::Vertice> vertices(maior.numVertices());
+    maior.copiarVertices(vertices);
+    uint64_t estado = 0x9E3779B97F4A7C15ULL ^ semente;
+    for (int q = 0; q < consultas && !vertices.empty(); q++) {
+        origens.push_back(&vertices[proximoAleatorio(&estado) % vertices.size()].antena());
+    }
+
+    // O DFS da biblioteca escreve cada antena alcançada no registo; aqui só interessa o tempo
+    definirNivelRegisto(REGISTO_NENHUM);
+
+    pa::GrafoLigado ligado(grafo);
+    pa::GrafoContiguo contiguo(grafo);
+    std::printf("Grafo %c: %zu vertices, %zu arestas, %zu consultas\n\n",
+                grafo->frequencia, contiguo.numVertices(), contiguo.numArestas(), origens.size());
+
+    unsigned long long total = 0;
+    double ns = medirNs([&] {
+        for (const ANTENAS* a : origens) {
+            int count = 0;
+            BFT(grafo, a->x, a->y, &count);
+            total += static_cast<unsigned long long>(count);
+        }
+    });
+    mostrar("BFT (C, listas ligadas)", ns, static_cast<long long>(origens.size()), total);
+
+    total = 0;
+    ns = medirNs([&] {
+        for (const ANTENAS* a : origens) {
+            total += pa::bfs(ligado, ligado.procurar(a->x, a->y), [](VERTICE*, int) {});
+        }
+    });
+    mostrar("pa::bfs (listas ligadas)", ns, static_cast<long long>(origens.size()), total);
+
+    total = 0;
+    ns = medirNs([&] {
+        for (const ANTENAS* a : origens) {
+            total += pa::bfs(contiguo, contiguo.procurar(a->x, a->y), [](int, int) {});
+        }
+    });
+    mostrar("pa::bfs (CSR)", ns, static_cast<long long>(origens.size()), total);
+
+    total = 0;
+    ns = medirNs([&] {
+        for (const ANTENAS* a : origens) {
+            resetarVisitados(grafo->vertices);
+            DFS(grafo, a->x, a->y);
+        }
+    });
+    for (pa::Vertice v : vertices) total += static_cast<unsigned long long>(v.c()->visitado);
+    mostrar("DFS (C, listas ligadas)", ns, static_cast<long long>(origens.size()), total);
+
+    total = 0;
+    std::size_t ultimo = 0;
+    ns = medirNs([&] {
+        for (const ANTENAS* a : origens) {
+            ultimo = pa::dfs(ligado, ligado.procurar(a->x, a->y), [](VERTICE*, int) {});
+        }
+    });
+    mostrar("pa::dfs (listas ligadas)", ns, static_cast<long long>(origens.size()), ultimo);
+
+    ns = medirNs([&] {
+        for (const ANTENAS* a : origens) {
+            ultimo = pa::dfs(contiguo, contiguo.procurar(a->x, a->y), [](int, int) {});
+        }
+    });
+    mostrar("pa::dfs (CSR)", ns, static_cast<long long>(origens.size()), ultimo);
+
+    std::vector<int> componente;
+    int num = 0;
+    ns = medirNs([&] { num = pa::componentes(ligado, componente); });
+    mostrar("pa::componentes (ligadas)", ns, 1, static_cast<unsigned long long>(num));
+    ns = medirNs([&] { num = pa::componentes(contiguo, componente); });
+    mostrar("pa::componentes (CSR)", ns, 1, static_cast<unsigned long long>(num));
+
+    std::vector<double> distancia;
+    if (!origens.empty()) {
+        pa::GrafoContiguo::No origem = contiguo.procurar(origens[0]->x, origens[0]->y);
+        ns = medirNs([&] { pa::caminhosMaisCurtos(contiguo, origem, pa::distanciaEuclidiana(contiguo), distancia); });
+        unsigned long long alcancados = 0;
+        for (double d : distancia) alcancados += d < std::numeric_limits<double>::infinity();
+        mostrar("pa::caminhosMaisCurtos (CSR)", ns, 1, alcancados);
+    }
+
+    return 0;
+}
@@ -0,0 +1,288 @@
+/**
+ * @file cache.c
+ * @brief Implementação da cache LRU dos resultados das consultas sobre os grafos de uma rede.
+ *
+ * @author Rogério Picas
+ * @date 18-10-2026
+ * @version 1.0
+ */
+#define _CRT_SECURE_NO_WARNINGS
+#include <stdio.h>
+#include <stdlib.h>
+#include <limits.h>
+#include "cache.h"
+
+#pragma region Funções Auxiliares
+
+/**
+ * @brief Calcula o valor de dispersão de uma chave (a época não faz parte da chave).
+ */
+static uint64_t dispersarChave(const CHAVE_CONSULTA* chave) {
+	uint64_t h = (uint64_t)(uintptr_t)chave->grafo ^ ((uint64_t)chave->tipo << 56);
+	for (int i = 0; i < 4; i++) {
+		h ^= (uint64_t)(uint32_t)chave->argumentos[i] + 0x9E3779B97F4A7C15ULL + (h << 6) + (h >> 2);
+	}
+	// Finalização do splitmix64, para que os bits baixos (o balde) dependam de todos os campos
+	h ^= h >> 30;
+	h *= 0xBF58476D1CE4E5B9ULL;
+	h ^= h >> 27;
+	h *= 0x94D049BB133111EBULL;
+	h ^= h >> 31;
+	return h;
+}
+
+/**
+ * @brief Verifica se duas chaves identificam a mesma consulta.
+ */
+static bool mesmaChave(const CHAVE_CONSULTA* a, const CHAVE_CONSULTA* b) {
+	return a->grafo == b->grafo && a->tipo == b->tipo &&
+		a->argumentos[0] == b->argumentos[0] && a->argumentos[1] == b->argumentos[1] &&
+		a->argumentos[2] == b->argumentos[2] && a->argumentos[3] == b->argumentos[3];
+}
+
+/**
+ * @brief Devolve o balde de uma chave.
+ */
+static int baldeChave(const CACHE_CONSULTAS* cache, const CHAVE_CONSULTA* chave) {
+	return (int)(dispersarChave(chave) & (uint64_t)(cache->numBaldes - 1));
+}
+
+/**
+ * @brief Procura a entrada de uma chave, sem verificar a época.
+ *
+ * @return posição da entrada, ou -1 se a chave não estiver na cache.
+ */
+static int procurarEntrada(const CACHE_CONSULTAS* cache, const CHAVE_CONSULTA* chave) {
+	for (int i = cache->baldes[baldeChave(cache, chave)]; i != -1; i = cache->entradas[i].proxBalde) {
+		if (mesmaChave(&cache->entradas[i].chave, chave)) return i;
+	}
+	return -1;
+}
+
+/**
+ * @brief Retira uma entrada da lista LRU.
+ */
+static void retirarListaLRU(CACHE_CONSULTAS* cache, int i) {
+	ENTRADA_CACHE* e = &cache->entradas[i];
+	if (e->maisRecente != -1) cache->entradas[e->maisRecente].menosRecente = e->menosRecente;
+	else cache->maisRecente = e->menosRecente;
+	if (e->menosRecente != -1) cache->entradas[e->menosRecente].maisRecente = e->maisRecente;
+	else cache->menosRecente = e->maisRecente;
+	e->maisRecente = e->menosRecente = -1;
+}
+
+/**
+ * @brief Coloca uma entrada (fora da lista LRU) no início da lista, como a mais recente.
+ */
+static void colocarMaisRecente(CACHE_CONSULTAS* cache, int i) {
+	ENTRADA_CACHE* e = &cache->entradas[i];
+	e->maisRecente = -1;
+	e->menosRecente = cache->maisRecente;
+	if (cache->maisRecente != -1) cache->entradas[cache->maisRecente].maisRecente = i;
+	else cache->menosRecente = i;
+	cache->maisRecente = i;
+}
+
+/**
+ * @brief Retira uma entrada do seu balde e da lista LRU e devolve-a à lista de entradas livres.
+ */
+static void retirarEntrada(CACHE_CONSULTAS* cache, int i) {
+	ENTRADA_CACHE* e = &cache->entradas[i];
+	int* ligacao = &cache->baldes[baldeChave(cache, &e->chave)];
+	while (*ligacao != i) {
+		ligacao = &cache->entradas[*ligacao].proxBalde;
+	}
+	*ligacao = e->proxBalde;
+
+	retirarListaLRU(cache, i);
+	e->chave.grafo = NULL;
+	e->proxBalde = cache->livres;
+	cache->livres = i;
+	cache->numEntradas--;
+}
+
+#pragma endregion
+
+#pragma region Funções da Cache
+
+/**
+ * @brief Cria uma cache vazia com a capacidade indicada.
+ *
+ * A tabela de dispersão tem pelo menos o dobro dos baldes da capacidade (potência de 2), para
+ * que as listas dos baldes tenham, em média, menos de uma entrada.
+ *
+ * @param[in] capacidade - número máximo de entradas.
+ *
+ * @return apontador para a cache criada, ou NULL se a capacidade for inválida ou a alocação falhar.
+ */
+CACHE_CONSULTAS* criarCacheConsultas(int capacidade) {
+	if (capacidade <= 0 || capacidade > INT_MAX / 4) return NULL;
+
+	CACHE_CONSULTAS* cache = (CACHE_CONSULTAS*)calloc(1, sizeof(CACHE_CONSULTAS));
+	if (cache == NULL) return NULL;
+
+	int numBaldes = 1;
+	while (numBaldes < 2 * capacidade) numBaldes *= 2;
+
+	cache->entradas = (ENTRADA_CACHE*)malloc((size_t)capacidade * sizeof(ENTRADA_CACHE));
+	cache->baldes = (int*)malloc((size_t)numBaldes * sizeof(int));
+	if (cache->entradas == NULL || cache->baldes == NULL)
+	{
+		return destruirCacheConsultas(cache);
+	}
+
+	for (int i = 0; i < capacidade; i++) {
+		cache->entradas[i].chave.grafo = NULL;
+		cache->entradas[i].proxBalde = i + 1 < capacidade ? i + 1 : -1;
+		cache->entradas[i].maisRecente = -1;
+		cache->entradas[i].menosRecente = -1;
+	}
+	for (int b = 0; b < numBaldes; b++) {
+		cache->baldes[b] = -1;
+	}
+	cache->capacidade = capacidade;
+	cache->numBaldes = numBaldes;
+	cache->livres = 0;
+	cache->maisRecente = -1;
+	cache->menosRecente = -1;
+	return cache;
+}
+
+/**
+ * @brief Liberta a memória de uma cache.
+ *
+ * @param[in] cache - apontador para a cache a destruir (pode ser NULL).
+ *
+ * @return NULL, indicando que a cache foi destruída.
+ */
+CACHE_CONSULTAS* destruirCacheConsultas(CACHE_CONSULTAS* cache) {
+	if (cache == NULL) return NULL;
+
+	free(cache->entradas);
+	free(cache->baldes);
+	free(cache);
+	return NULL;
+}
+
+/**
+ * @brief Ativa, redimensiona ou desativa a cache de consultas da rede.
+ *
+ * A cache anterior, se existir, é sempre descartada; se a criação da nova falhar, a rede fica
+ * sem cache.
+ *
+ * @param[in,out] rede - apontador para a rede.
+ * @param[in] capacidade - número máximo de entradas (0 desativa a cache).
+ *
+ * @return @c 0 se a operação for bem-sucedida,
+ *         @c 1 se a rede for nula ou a capacidade for negativa,
+ *         @c 2 se a criação da cache falhar.
+ */
+int ativarCacheConsultas(REDE* rede, int capacidade) {
+	if (rede == NULL || capacidade < 0) return 1;
+
+	rede->cache = destruirCacheConsultas(rede->cache);
+	if (capacidade == 0) return 0;
+
+	rede->cache = criarCacheConsultas(capacidade);
+	return rede->cache != NULL ? 0 : 2;
+}
+
+/**
+ * @brief Procura o resultado de uma consulta calculado na época atual do grafo.
+ *
+ * Uma entrada com a mesma chave mas de uma época anterior é descartada e conta como falha.
+ *
+ * @param[in,out] cache - apontador para a cache.
+ * @param[in] chave - consulta a procurar.
+ * @param[out] valor - resultado guardado.
+ *
+ * @return @c true se a cache tiver um resultado válido, @c false caso contrário.
+ */
+bool procurarCache(CACHE_CONSULTAS* cache, const CHAVE_CONSULTA* chave, int* valor) {
+	if (cache == NULL || chave == NULL || chave->grafo == NULL || valor == NULL) return false;
+
+	int i = procurarEntrada(cache, chave);
+	if (i != -1 && cache->entradas[i].epoca != chave->grafo->epoca)
+	{
+		retirarEntrada(cache, i);
+		cache->invalidadas++;
+		i = -1;
+	}
+	if (i == -1)
+	{
+		cache->falhas++;
+		return false;
+	}
+
+	retirarListaLRU(cache, i);
+	colocarMaisRecente(cache, i);
+	*valor = cache->entradas[i].valor;
+	cache->acertos++;
+	return true;
+}
+
+/**
+ * @brief Guarda o resultado de uma consulta, com a época atual do grafo.
+ *
+ * Se a chave já estiver na cache, a entrada é atualizada; caso contrário é usada uma entrada
+ * livre ou, com a cache cheia, a entrada usada há mais tempo.
+ *
+ * @param[in,out] cache - apontador para a cache.
+ * @param[in] chave - consulta a que o resultado corresponde.
+ * @param[in] valor - resultado da consulta.
+ */
+void guardarCache(CACHE_CONSULTAS* cache, const CHAVE_CONSULTA* chave, int valor) {
+	if (cache == NULL || chave == NULL || chave->grafo == NULL) return;
+
+	int i = procurarEntrada(cache, chave);
+	if (i != -1)
+	{
+		retirarListaLRU(cache, i);
+	}
+	else
+	{
+		if (cache->livres == -1)
+		{
+			retirarEntrada(cache, cache->menosRecente);
+		}
+		i = cache->livres;
+		cache->livres = cache->entradas[i].proxBalde;
+		cache->entradas[i].chave = *chave;
+
+		int balde = baldeChave(cache, chave);
+		cache->entradas[i].proxBalde = cache->baldes[balde];
+		cache->baldes[balde] = i;
+		cache->numEntradas++;
+	}
+
+	ENTRADA_CACHE* e = &cache->entradas[i];
+	e->epoca = chave->grafo->epoca;
+	e->valor = valor;
+	colocarMaisRecente(cache, i);
+}
+
+/**
+ * @brief Descarta todas as entradas de um grafo, percorrendo a lista LRU.
+ *
+ * Só é necessária quando o grafo é destruído: as entradas de um grafo alterado já não têm a
+ * época atual e são descartadas quando forem procuradas (ou substituídas por entradas novas).
+ *
+ * @param[in,out] cache - apontador para a cache.
+ * @param[in] grafo - apontador para o grafo.
+ */
+void invalidarCacheGrafo(CACHE_CONSULTAS* cache, const GRAFO* grafo) {
+	if (cache == NULL || grafo == NULL) return;
+
+	int i = cache->maisRecente;
+	while (i != -1) {
+		int seguinte = cache->entradas[i].menosRecente;
+		if (cache->entradas[i].chave.grafo == grafo)
+		{
+			retirarEntrada(cache, i);
+			cache->invalidadas++;
+		}
+		i = seguinte;
+	}
+}
+
+#pragma endregion
@@ -0,0 +1,134 @@
+#pragma once
+
+/**
+ * @file cache.h
+ * @brief Cache LRU dos resultados das consultas de alcance (BFT), de ligação direta
+ *        (existeConexaoEntreVertices) e de contagem de caminhos (countPathsDFS) de uma rede
+ *
+ * Cada entrada guarda a época do grafo no momento em que o resultado foi calculado. A época de um
+ * grafo muda a cada alteração (inserção, movimento ou remoção de antenas, criação ou remoção de
+ * ligações) e é tirada de um contador único da rede, pelo que uma entrada cuja época já não é a do
+ * grafo é descartada na procura, sem ser preciso percorrer a cache a cada alteração.
+ *
+ * A cache, tal como as funções de alteração dos grafos, não pode ser usada por várias threads ao
+ * mesmo tempo.
+ *
+ * @author Rogério Picas
+ * @date 18-10-2026
+ * @version 1.0
+ *
+ */
+#include "funcoes.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#pragma region Estruturas
+
+/**
+ * @enum TipoConsulta
+ * @brief Consultas cujo resultado pode ser guardado na cache.
+ */
+typedef enum TipoConsulta {
+    CONSULTA_BFT,       /**< Número de antenas alcançáveis a partir de (x, y) */
+    CONSULTA_CONEXAO,   /**< Existência de uma ligação direta entre duas antenas */
+    CONSULTA_CAMINHOS   /**< Número de caminhos simples entre duas antenas */
+} TIPO_CONSULTA;
+
+/**
+ * @struct ChaveConsulta
+ * @brief Identificação de uma consulta: grafo, tipo e coordenadas (as que não são usadas ficam a 0).
+ */
+typedef struct ChaveConsulta {
+    const GRAFO* grafo;   /**< Grafo consultado */
+    TIPO_CONSULTA tipo;   /**< Tipo da consulta */
+    int argumentos[4];    /**< Coordenadas da origem e, se houver, do destino */
+} CHAVE_CONSULTA;
+
+/**
+ * @struct EntradaCache
+ * @brief Resultado guardado de uma consulta, ligado na lista do seu balde e na lista LRU.
+ */
+typedef struct EntradaCache {
+    CHAVE_CONSULTA chave;      /**< Consulta a que o resultado corresponde */
+    unsigned long long epoca;  /**< Época do grafo quando o resultado foi calculado */
+    int valor;                 /**< Resultado da consulta */
+    int proxBalde;             /**< Próxima entrada do mesmo balde (ou da lista de entradas livres); -1 no fim */
+    int maisRecente;           /**< Entrada usada a seguir a esta (-1 se for a mais recente) */
+    int menosRecente;          /**< Entrada usada antes desta (-1 se for a menos recente) */
+} ENTRADA_CACHE;
+
+/**
+ * @struct CacheConsultas
+ * @brief Cache com capacidade fixa: quando está cheia, a entrada usada há mais tempo é substituída.
+ */
+typedef struct CacheConsultas {
+    ENTRADA_CACHE* entradas;   /**< Entradas (capacidade posições) */
+    int capacidade;            /**< Número máximo de entradas */
+    int numEntradas;           /**< Entradas ocupadas */
+    int livres;                /**< Primeira entrada livre (-1 se não houver) */
+    int* baldes;               /**< Primeira entrada de cada balde da tabela de dispersão (-1 se vazio) */
+    int numBaldes;             /**< Número de baldes (potência de 2) */
+    int maisRecente;           /**< Entrada usada mais recentemente */
+    int menosRecente;          /**< Entrada usada há mais tempo (a próxima a ser substituída) */
+    long long acertos;         /**< Consultas respondidas pela cache */
+    long long falhas;          /**< Consultas sem resultado válido na cache */
+    long long invalidadas;     /**< Entradas descartadas por o grafo ter sido alterado ou destruído */
+} CACHE_CONSULTAS;
+
+#pragma endregion
+
+#pragma region Funções da Cache
+
+/**
+ * @brief Cria uma cache vazia.
+ * @param capacidade Número máximo de entradas (> 0).
+ * @return Apontador para a cache criada ou NULL em caso de erro.
+ */
+CACHE_CONSULTAS* criarCacheConsultas(int capacidade);
+
+/**
+ * @brief Liberta a memória de uma cache.
+ * @param cache Apontador para a cache a destruir.
+ * @return NULL, indicando que a cache foi destruída.
+ */
+CACHE_CONSULTAS* destruirCacheConsultas(CACHE_CONSULTAS* cache);
+
+/**
+ * @brief Ativa, redimensiona ou desativa a cache de consultas da rede (as entradas anteriores são descartadas).
+ * @param rede Apontador para a rede.
+ * @param capacidade Número máximo de entradas (0 desativa a cache).
+ * @return 0 se a operação for bem-sucedida, 1 se os argumentos forem inválidos e 2 em caso de falha de alocação.
+ */
+int ativarCacheConsultas(REDE* rede, int capacidade);
+
+/**
+ * @brief Procura o resultado de uma consulta calculado na época atual do grafo.
+ * @param cache Apontador para a cache.
+ * @param chave Consulta a procurar.
+ * @param valor Apontador onde é escrito o resultado guardado.
+ * @return true se a cache tiver um resultado válido (a entrada passa a ser a mais recente).
+ */
+bool procurarCache(CACHE_CONSULTAS* cache, const CHAVE_CONSULTA* chave, int* valor);
+
+/**
+ * @brief Guarda o resultado de uma consulta, com a época atual do grafo.
+ * @param cache Apontador para a cache.
+ * @param chave Consulta a que o resultado corresponde.
+ * @param valor Resultado da consulta.
+ */
+void guardarCache(CACHE_CONSULTAS* cache, const CHAVE_CONSULTA* chave, int valor);
+
+/**
+ * @brief Descarta todas as entradas de um grafo (usada quando o grafo é destruído).
+ * @param cache Apontador para a cache.
+ * @param grafo Apontador para o grafo.
+ */
+void invalidarCacheGrafo(CACHE_CONSULTAS* cache, const GRAFO* grafo);
+
+#pragma endregion
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,409 @@
+/**
+ * @file camadas.c
+ * @brief Implementação da vista multi-camada da rede e das travessias com mudança de camada.
+ *
+ * @author Rogério Picas
+ * @date 18-10-2026
+ * @version 1.0
+ */
+#define _CRT_SECURE_NO_WARNINGS
+#include <stdio.h>
+#include <stdlib.h>
+#include <limits.h>
+#include "camadas.h"
+
+#pragma region Estruturas Auxiliares
+
+/**
+ * @struct ParLigacao
+ * @brief Ligação ainda por resolver, recolhida durante a construção da vista.
+ */
+typedef struct ParLigacao {
+    int origem;       /**< Índice do nó origem */
+    VERTICE* destino; /**< Vértice destino (o índice só é conhecido no fim da passagem) */
+    int custo;        /**< Custo da ligação */
+} PAR_LIGACAO;
+
+/**
+ * @struct ListaPares
+ * @brief Array dinâmico de ligações por resolver.
+ */
+typedef struct ListaPares {
+    PAR_LIGACAO* pares; /**< Array de ligações */
+    int num;            /**< Número de ligações guardadas */
+    int capacidade;     /**< Capacidade atual do array */
+} LISTA_PARES;
+
+/**
+ * @struct EntradaHeap
+ * @brief Entrada da fila de prioridade usada pelo algoritmo de Dijkstra.
+ */
+typedef struct EntradaHeap {
+    int custo; /**< Custo acumulado até ao nó */
+    int no;    /**< Índice do nó */
+} ENTRADA_HEAP;
+
+#pragma endregion
+
+#pragma region Funções Auxiliares
+
+/**
+ * @brief Acrescenta uma ligação por resolver à lista, fazendo-a crescer se necessário.
+ *
+ * @return @c true em caso de sucesso, @c false se a alocação falhar.
+ */
+static bool adicionarPar(LISTA_PARES* lista, int origem, VERTICE* destino, int custo) {
+	if (lista->num == lista->capacidade)
+	{
+		int novaCapacidade = lista->capacidade ? lista->capacidade * 2 : 64;
+		PAR_LIGACAO* novo = (PAR_LIGACAO*)realloc(lista->pares, (size_t)novaCapacidade * sizeof(PAR_LIGACAO));
+		if (novo == NULL) return false;
+		lista->pares = novo;
+		lista->capacidade = novaCapacidade;
+	}
+	lista->pares[lista->num].origem = origem;
+	lista->pares[lista->num].destino = destino;
+	lista->pares[lista->num].custo = custo;
+	lista->num++;
+	return true;
+}
+
+/**
+ * @brief Liga o nó @p id às antenas de outras camadas dentro do raio indicado.
+ *
+ * Usa o índice espacial da rede. Só é criada a ligação de saída do nó @p id: a
+ * ligação inversa é criada quando a outra antena do par for processada.
+ *
+ * @return @c true em caso de sucesso, @c false se a alocação falhar.
+ */
+static bool ligarCamadasProximas(REDE_CAMADAS* camadas, LISTA_PARES* pares, GRAFO* grafo, int id) {
+	VERTICE* v = camadas->nos[id].vertice;
+	int x = v->antena.x;
+	int y = v->antena.y;
+	int lado = camadas->indice->ladoBalde;
+
+	int bx0 = (x - camadas->raio < 0 ? 0 : x - camadas->raio) / lado;
+	int by0 = (y - camadas->raio < 0 ? 0 : y - camadas->raio) / lado;
+	int bx1 = (x + camadas->raio >= MAX_DIM ? MAX_DIM - 1 : x + camadas->raio) / lado;
+	int by1 = (y + camadas->raio >= MAX_DIM ? MAX_DIM - 1 : y + camadas->raio) / lado;
+
+	for (int bx = bx0; bx <= bx1; bx++) {
+		for (int by = by0; by <= by1; by++) {
+			BALDE* balde = &camadas->indice->baldes[bx * camadas->indice->baldesPorLado + by];
+			for (int i = 0; i < balde->numEntradas; i++) {
+				VERTICE* u = balde->entradas[i].vertice;
+				if (balde->entradas[i].grafo == grafo) continue;
+				if (abs(u->antena.x - x) > camadas->raio || abs(u->antena.y - y) > camadas->raio) continue;
+
+				if (!adicionarPar(pares, id, u, camadas->custoSalto)) return false;
+			}
+		}
+	}
+	return true;
+}
+
+/**
+ * @brief Insere uma entrada na heap mínima (ordenada por custo).
+ */
+static void heapInserir(ENTRADA_HEAP* heap, int* tamanho, int custo, int no) {
+	int i = (*tamanho)++;
+	while (i > 0 && heap[(i - 1) / 2].custo > custo) {
+		heap[i] = heap[(i - 1) / 2];
+		i = (i - 1) / 2;
+	}
+	heap[i].custo = custo;
+	heap[i].no = no;
+}
+
+/**
+ * @brief Remove e devolve a entrada de menor custo da heap.
+ */
+static ENTRADA_HEAP heapRemover(ENTRADA_HEAP* heap, int* tamanho) {
+	ENTRADA_HEAP topo = heap[0];
+	ENTRADA_HEAP ultimo = heap[--(*tamanho)];
+	int i = 0;
+	while (2 * i + 1 < *tamanho) {
+		int filho = 2 * i + 1;
+		if (filho + 1 < *tamanho && heap[filho + 1].custo < heap[filho].custo) filho++;
+		if (heap[filho].custo >= ultimo.custo) break;
+		heap[i] = heap[filho];
+		i = filho;
+	}
+	heap[i] = ultimo;
+	return topo;
+}
+
+/**
+ * @brief Executa o algoritmo de Dijkstra a partir do nó @p origem.
+ *
+ * A heap pode conter entradas repetidas do mesmo nó (remoção preguiçosa), por isso
+ * é dimensionada para o número de ligações mais um.
+ *
+ * @param[in] camadas - vista multi-camada.
+ * @param[in] origem - índice do nó inicial.
+ * @param[in] custoMaximo - custo máximo a explorar (negativo = sem limite).
+ * @param[in] alvo - nó em que a procura pode parar (-1 para explorar tudo).
+ *
+ * @return array de custos (INT_MAX = não alcançado) a libertar pelo chamador, ou NULL em caso de falha.
+ */
+static int* dijkstraCamadas(REDE_CAMADAS* camadas, int origem, int custoMaximo, int alvo) {
+	int* custos = (int*)malloc((size_t)camadas->numNos * sizeof(int));
+	ENTRADA_HEAP* heap = (ENTRADA_HEAP*)malloc(((size_t)camadas->numLigacoes + 1) * sizeof(ENTRADA_HEAP));
+	if (custos == NULL || heap == NULL)
+	{
+		free(custos);
+		free(heap);
+		return NULL;
+	}
+	for (int i = 0; i < camadas->numNos; i++) custos[i] = INT_MAX;
+
+	int tamanho = 0;
+	custos[origem] = 0;
+	heapInserir(heap, &tamanho, 0, origem);
+
+	while (tamanho > 0) {
+		ENTRADA_HEAP atual = heapRemover(heap, &tamanho);
+		if (atual.custo > custos[atual.no]) continue;
+		if (atual.no == alvo) break;
+
+		NO_CAMADA* no = &camadas->nos[atual.no];
+		for (int i = no->inicio; i < no->inicio + no->grau; i++) {
+			LIGACAO_CAMADA* lig = &camadas->ligacoes[i];
+			int novoCusto = atual.custo + lig->custo;
+			if (custoMaximo >= 0 && novoCusto > custoMaximo) continue;
+			if (novoCusto < custos[lig->destino])
+			{
+				custos[lig->destino] = novoCusto;
+				heapInserir(heap, &tamanho, novoCusto, lig->destino);
+			}
+		}
+	}
+	free(heap);
+	return custos;
+}
+
+#pragma endregion
+
+#pragma region Funções da Vista Multi-Camada
+
+/**
+ * @brief Constrói a vista multi-camada da rede numa única passagem pelos vértices.
+ *
+ * Cada grafo da rede passa a ser uma camada. Durante a passagem por todos os vértices
+ * de @c listaGrafos, cada vértice é numerado (campo @c indice), as suas arestas são
+ * recolhidas como ligações da própria camada (custo 1) e o índice espacial da rede,
+ * partilhado por todas as camadas, é consultado para criar ligações entre camadas
+ * (custo @p custoSalto) com as antenas de outras frequências a uma distância de
+ * Chebyshev não superior a @p raio. No fim, as ligações são guardadas de forma
+ * contígua por nó. A vista é uma fotografia: deve ser reconstruída depois de alterar a rede.
+ *
+ * @param[in] rede - apontador para a rede de grafos.
+ * @param[in] raio - distância máxima entre antenas de camadas diferentes para as ligar (0 = co-localizadas).
+ * @param[in] custoSalto - custo de atravessar uma ligação entre camadas.
+ *
+ * @return apontador para a vista criada, ou NULL se a rede for nula, os parâmetros forem inválidos
+ *         ou ocorrer falha de alocação.
+ */
+REDE_CAMADAS* criarRedeCamadas(REDE* rede, int raio, int custoSalto) {
+	if (rede == NULL || raio < 0 || custoSalto < 0) return NULL;
+
+	REDE_CAMADAS* camadas = (REDE_CAMADAS*)calloc(1, sizeof(REDE_CAMADAS));
+	if (camadas == NULL) return NULL;
+	camadas->raio = raio;
+	camadas->custoSalto = custoSalto;
+
+	int totalVertices = 0;
+	for (GRAFO* grafo = rede->listaGrafos; grafo != NULL; grafo = grafo->prox) {
+		totalVertices += grafo->numVertices;
+		camadas->numCamadas++;
+	}
+
+	camadas->nos = (NO_CAMADA*)calloc(totalVertices > 0 ? (size_t)totalVertices : 1, sizeof(NO_CAMADA));
+	camadas->frequencias = (char*)malloc(camadas->numCamadas > 0 ? (size_t)camadas->numCamadas : 1);
+	camadas->indice = rede->indice;
+	if (camadas->nos == NULL || camadas->frequencias == NULL || camadas->indice == NULL)
+	{
+		return destruirRedeCamadas(camadas);
+	}
+
+	LISTA_PARES pares = { NULL, 0, 0 };
+	int camada = 0;
+
+	for (GRAFO* grafo = rede->listaGrafos; grafo != NULL; grafo = grafo->prox, camada++) {
+		camadas->frequencias[camada] = grafo->frequencia;
+
+		for (VERTICE* v = grafo->vertices; v != NULL && camadas->numNos < totalVertices; v = v->prox) {
+			int id = camadas->numNos++;
+			v->indice = id;
+			camadas->nos[id].vertice = v;
+			camadas->nos[id].camada = camada;
+
+			for (ARESTA* adj = v->adjacentes; adj != NULL; adj = adj->prox) {
+				if (!adicionarPar(&pares, id, adj->destino, 1))
+				{
+					free(pares.pares);
+					return destruirRedeCamadas(camadas);
+				}
+			}
+
+			if (!ligarCamadasProximas(camadas, &pares, grafo, id))
+			{
+				free(pares.pares);
+				return destruirRedeCamadas(camadas);
+			}
+		}
+	}
+
+	// Guarda as ligações de forma contígua por nó (contagem + somas prefixas)
+	camadas->ligacoes = (LIGACAO_CAMADA*)malloc(pares.num > 0 ? (size_t)pares.num * sizeof(LIGACAO_CAMADA) : 1);
+	if (camadas->ligacoes == NULL)
+	{
+		free(pares.pares);
+		return destruirRedeCamadas(camadas);
+	}
+	// Descarta ligações para vértices que não entraram na vista
+	int validos = 0;
+	for (int i = 0; i < pares.num; i++) {
+		VERTICE* destino = pares.pares[i].destino;
+		if (destino->indice < 0 || destino->indice >= camadas->numNos || camadas->nos[destino->indice].vertice != destino) continue;
+		pares.pares[validos++] = pares.pares[i];
+		camadas->nos[pares.pares[i].origem].grau++;
+	}
+	pares.num = validos;
+	int inicio = 0;
+	for (int i = 0; i < camadas->numNos; i++) {
+		camadas->nos[i].inicio = inicio;
+		inicio += camadas->nos[i].grau;
+		camadas->nos[i].grau = 0;
+	}
+	for (int i = 0; i < pares.num; i++) {
+		NO_CAMADA* no = &camadas->nos[pares.pares[i].origem];
+		LIGACAO_CAMADA* lig = &camadas->ligacoes[no->inicio + no->grau++];
+		lig->destino = pares.pares[i].destino->indice;
+		lig->custo = pares.pares[i].custo;
+	}
+	camadas->numLigacoes = pares.num;
+	free(pares.pares);
+
+	return camadas;
+}
+
+/**
+ * @brief Procura o nó da vista correspondente à antena com a frequência e coordenadas indicadas.
+ *
+ * A procura usa o índice espacial da rede, percorrendo apenas o balde da célula (x, y).
+ *
+ * @param[in] camadas - apontador para a vista multi-camada.
+ * @param[in] freq - frequência da antena.
+ * @param[in] x - coordenada X da antena.
+ * @param[in] y - coordenada Y da antena.
+ *
+ * @return índice do nó na vista, ou -1 se a vista for nula ou a antena não existir.
+ */
+int encontrarNoCamadas(REDE_CAMADAS* camadas, char freq, int x, int y) {
+	if (camadas == NULL) return -1;
+
+	BALDE* balde = obterBalde(camadas->indice, x, y);
+	if (balde == NULL) return -1;
+
+	for (int i = 0; i < balde->numEntradas; i++) {
+		VERTICE* v = balde->entradas[i].vertice;
+		if (v->antena.x == x && v->antena.y == y && v->antena.frequencia == freq)
+		{
+			// O campo indice pode ter sido reutilizado por outra vista entretanto
+			if (v->indice >= 0 && v->indice < camadas->numNos && camadas->nos[v->indice].vertice == v)
+			{
+				return v->indice;
+			}
+			for (int j = 0; j < camadas->numNos; j++) {
+				if (camadas->nos[j].vertice == v) return j;
+			}
+		}
+	}
+	return -1;
+}
+
+/**
+ * @brief Calcula o custo mínimo entre duas antenas na vista multi-camada.
+ *
+ * Usa o algoritmo de Dijkstra: cada aresta de um grafo custa 1 e cada mudança de
+ * camada custa @c custoSalto. A procura termina assim que o destino é fixado.
+ *
+ * @param[in] camadas - apontador para a vista multi-camada.
+ * @param[in] freqOrigem - frequência da antena de origem.
+ * @param[in] xOrigem - coordenada X da antena de origem.
+ * @param[in] yOrigem - coordenada Y da antena de origem.
+ * @param[in] freqDestino - frequência da antena de destino.
+ * @param[in] xDestino - coordenada X da antena de destino.
+ * @param[in] yDestino - coordenada Y da antena de destino.
+ *
+ * @return custo mínimo do caminho, @c -1 se o destino não for alcançável,
+ *         @c -2 se a vista for nula, alguma das antenas não existir ou ocorrer falha de alocação.
+ */
+int custoMinimoCamadas(REDE_CAMADAS* camadas, char freqOrigem, int xOrigem, int yOrigem,
+	char freqDestino, int xDestino, int yDestino) {
+
+	int origem = encontrarNoCamadas(camadas, freqOrigem, xOrigem, yOrigem);
+	int destino = encontrarNoCamadas(camadas, freqDestino, xDestino, yDestino);
+	if (origem < 0 || destino < 0) return -2;
+
+	int* custos = dijkstraCamadas(camadas, origem, -1, destino);
+	if (custos == NULL) return -2;
+
+	int resultado = custos[destino] == INT_MAX ? -1 : custos[destino];
+	free(custos);
+	return resultado;
+}
+
+/**
+ * @brief Conta as antenas alcançáveis a partir de uma antena sem ultrapassar um custo máximo.
+ *
+ * Equivalente ao @c BFT, mas na vista multi-camada: a travessia pode mudar de
+ * frequência sempre que existam antenas próximas, pagando @c custoSalto por cada salto.
+ *
+ * @param[in] camadas - apontador para a vista multi-camada.
+ * @param[in] freq - frequência da antena inicial.
+ * @param[in] x - coordenada X da antena inicial.
+ * @param[in] y - coordenada Y da antena inicial.
+ * @param[in] custoMaximo - custo máximo acumulado (valores negativos = sem limite).
+ * @param[out] count - apontador para inteiro onde será armazenado o número de antenas alcançadas.
+ *
+ * @return @c 0 em caso de sucesso,
+ *         @c 1 se a vista ou @p count forem nulos, a antena inicial não existir ou ocorrer falha de alocação.
+ */
+int alcanceCamadas(REDE_CAMADAS* camadas, char freq, int x, int y, int custoMaximo, int* count) {
+	if (count == NULL) return 1;
+
+	int origem = encontrarNoCamadas(camadas, freq, x, y);
+	if (origem < 0) return 1;
+
+	int* custos = dijkstraCamadas(camadas, origem, custoMaximo, -1);
+	if (custos == NULL) return 1;
+
+	*count = 0;
+	for (int i = 0; i < camadas->numNos; i++) {
+		if (custos[i] != INT_MAX) (*count)++;
+	}
+	free(custos);
+	return 0;
+}
+
+/**
+ * @brief Liberta toda a memória ocupada pela vista multi-camada.
+ *
+ * Os grafos, vértices, arestas e o índice espacial da rede não são alterados.
+ *
+ * @param camadas - apontador para a vista a destruir.
+ * @return NULL, indicando que a vista foi destruída.
+ */
+REDE_CAMADAS* destruirRedeCamadas(REDE_CAMADAS* camadas) {
+	if (camadas == NULL) return NULL;
+
+	free(camadas->nos);
+	free(camadas->ligacoes);
+	free(camadas->frequencias);
+	free(camadas);
+	return NULL;
+}
+
+#pragma endregion
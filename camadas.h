@@ -0,0 +1,118 @@
+#pragma once
+
+/**
+ * @file camadas.h
+ * @brief Vista multi-camada da rede: uma camada por frequência e ligações entre camadas
+ *        para antenas co-localizadas ou próximas de frequências diferentes.
+ *
+ * @author Rogério Picas
+ * @date 18-10-2026
+ * @version 1.0
+ *
+ */
+#include "funcoes.h"
+#include "espacial.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#pragma region Estruturas
+
+/**
+ * @struct LigacaoCamada
+ * @brief Ligação de saída de um nó da vista multi-camada.
+ */
+typedef struct LigacaoCamada {
+    int destino; /**< Índice do nó destino na vista */
+    int custo;   /**< Custo de atravessar a ligação */
+} LIGACAO_CAMADA;
+
+/**
+ * @struct NoCamada
+ * @brief Nó da vista multi-camada, associado a um vértice de um dos grafos da rede.
+ */
+typedef struct NoCamada {
+    VERTICE* vertice; /**< Apontador para o vértice original */
+    int camada;       /**< Índice da camada (grafo/frequência) a que o nó pertence */
+    int inicio;       /**< Posição da primeira ligação do nó no array de ligações */
+    int grau;         /**< Número de ligações de saída do nó */
+} NO_CAMADA;
+
+/**
+ * @struct RedeCamadas
+ * @brief Vista multi-camada da rede, com as ligações guardadas de forma contígua por nó.
+ */
+typedef struct RedeCamadas {
+    NO_CAMADA* nos;             /**< Array com todos os nós da vista */
+    int numNos;                 /**< Número de nós da vista */
+    LIGACAO_CAMADA* ligacoes;   /**< Array com as ligações de todos os nós */
+    int numLigacoes;            /**< Número total de ligações (em ambos os sentidos) */
+    char* frequencias;          /**< Frequência de cada camada */
+    int numCamadas;             /**< Número de camadas (grafos) da vista */
+    int raio;                   /**< Distância máxima (Chebyshev) para ligar camadas */
+    int custoSalto;             /**< Custo de mudar de camada */
+    INDICE_ESPACIAL* indice;    /**< Índice espacial da rede, partilhado por todas as camadas (não pertence à vista) */
+} REDE_CAMADAS;
+
+#pragma endregion
+
+#pragma region Funções da Vista Multi-Camada
+
+/**
+ * @brief Constrói a vista multi-camada da rede numa única passagem pelos vértices.
+ * @param rede Apontador para a rede de grafos.
+ * @param raio Distância máxima (Chebyshev) entre antenas de frequências diferentes para as ligar (0 = co-localizadas).
+ * @param custoSalto Custo de atravessar uma ligação entre camadas (as ligações de um grafo custam 1).
+ * @return Apontador para a vista criada ou NULL em caso de erro.
+ */
+REDE_CAMADAS* criarRedeCamadas(REDE* rede, int raio, int custoSalto);
+
+/**
+ * @brief Procura o nó da vista correspondente a uma antena.
+ * @param camadas Apontador para a vista multi-camada.
+ * @param freq Frequência da antena.
+ * @param x Coordenada X da antena.
+ * @param y Coordenada Y da antena.
+ * @return Índice do nó na vista ou -1 se não existir.
+ */
+int encontrarNoCamadas(REDE_CAMADAS* camadas, char freq, int x, int y);
+
+/**
+ * @brief Calcula o custo mínimo entre duas antenas, podendo mudar de camada.
+ * @param camadas Apontador para a vista multi-camada.
+ * @param freqOrigem Frequência da antena de origem.
+ * @param xOrigem Coordenada X da antena de origem.
+ * @param yOrigem Coordenada Y da antena de origem.
+ * @param freqDestino Frequência da antena de destino.
+ * @param xDestino Coordenada X da antena de destino.
+ * @param yDestino Coordenada Y da antena de destino.
+ * @return Custo mínimo, -1 se o destino não for alcançável ou -2 se alguma antena não existir.
+ */
+int custoMinimoCamadas(REDE_CAMADAS* camadas, char freqOrigem, int xOrigem, int yOrigem,
+    char freqDestino, int xDestino, int yDestino);
+
+/**
+ * @brief Conta as antenas (de qualquer frequência) alcançáveis a partir de uma antena dentro de um custo máximo.
+ * @param camadas Apontador para a vista multi-camada.
+ * @param freq Frequência da antena inicial.
+ * @param x Coordenada X da antena inicial.
+ * @param y Coordenada Y da antena inicial.
+ * @param custoMaximo Custo máximo acumulado (valores negativos = sem limite).
+ * @param count Apontador para inteiro onde será armazenado o número de antenas alcançadas.
+ * @return 0 em caso de sucesso, 1 se a vista for inválida ou a antena inicial não existir.
+ */
+int alcanceCamadas(REDE_CAMADAS* camadas, char freq, int x, int y, int custoMaximo, int* count);
+
+/**
+ * @brief Liberta toda a memória da vista multi-camada (a rede e o seu índice não são alterados).
+ * @param camadas Apontador para a vista a destruir.
+ * @return NULL, indicando que a vista foi destruída.
+ */
+REDE_CAMADAS* destruirRedeCamadas(REDE_CAMADAS* camadas);
+
+#pragma endregion
+
+#ifdef __cplusplus
+}
+#endif
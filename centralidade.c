@@ -0,0 +1,313 @@
+/**
+ * @file centralidade.c
+ * @brief Implementação da centralidade de intermediação e de proximidade (algoritmo de Brandes).
+ *
+ * As ligações do grafo são copiadas para arrays contíguos (início de cada vértice e índices dos
+ * vizinhos) antes do cálculo. Cada origem faz uma procura em largura, que conta os caminhos mais
+ * curtos até cada vértice, e depois percorre os vértices pela ordem inversa da procura para
+ * acumular as dependências; as origens são repartidas pelas threads, cada uma com os seus
+ * acumuladores, juntos no fim.
+ *
+ * No modo aproximado só é percorrida uma amostra de origens distintas, escolhidas ao acaso, e os
+ * acumuladores são escalados por numAntenas / numOrigens. A intermediação normalizada de cada
+ * antena é a média de uma variável em [0, 1] sobre as origens, pelo que o limite de Hoeffding
+ * (com a união sobre as numAntenas antenas) dá o número de origens para um erro e uma confiança.
+ * A proximidade é estimada com as mesmas origens (distâncias das origens à antena, como em
+ * Eppstein e Wang), sem limite de erro próprio.
+ *
+ * @author Rogério Picas
+ * @date 18-10-2026
+ * @version 1.0
+ */
+#define _CRT_SECURE_NO_WARNINGS
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+#include "centralidade.h"
+#include "gerador.h"
+
+#pragma region Funções Auxiliares
+
+/**
+ * @brief Erro máximo da intermediação normalizada com @p k origens (limite de Hoeffding).
+ *
+ * A média das contribuições das origens estima a intermediação normalizada multiplicada por
+ * (n - 1) / n; o erro da média é escalado pelo inverso desse fator.
+ */
+static double erroHoeffding(int n, int k, double confianca) {
+	return sqrt(log(2.0 * n / (1.0 - confianca)) / (2.0 * k)) * n / (n - 1);
+}
+
+/**
+ * @brief Função de comparação (decrescente) da intermediação, para o qsort.
+ */
+static int compararIntermediacao(const void* a, const void* b) {
+	double x = ((const CENTRALIDADE_ANTENA*)a)->intermediacao;
+	double y = ((const CENTRALIDADE_ANTENA*)b)->intermediacao;
+	return (x < y) - (x > y);
+}
+
+/**
+ * @brief Função de comparação (decrescente) da proximidade, para o qsort.
+ */
+static int compararProximidade(const void* a, const void* b) {
+	double x = ((const CENTRALIDADE_ANTENA*)a)->proximidade;
+	double y = ((const CENTRALIDADE_ANTENA*)b)->proximidade;
+	return (x < y) - (x > y);
+}
+
+/**
+ * @brief Procura em largura e acumulação das dependências a partir de uma origem (um passo de Brandes).
+ *
+ * @param[in] inicio - início dos vizinhos de cada vértice (n + 1 posições).
+ * @param[in] vizinhos - índices dos vizinhos, agrupados por vértice.
+ * @param[in] origem - índice da origem.
+ * @param[in,out] distancia - distância de cada vértice à origem (-1 em todos, à entrada e à saída).
+ * @param[in,out] sigma - número de caminhos mais curtos até cada vértice (0 em todos, à entrada e à saída).
+ * @param[in,out] dependencia - dependência de cada vértice (0 em todos, à entrada e à saída).
+ * @param[out] ordem - vértices pela ordem da procura.
+ * @param[in,out] intermediacao - acumulador da thread com a soma das dependências de cada vértice.
+ * @param[in,out] somaDistancias - acumulador da thread com a soma das distâncias à origem.
+ * @param[in,out] alcancadas - acumulador da thread com o número de origens que alcançam cada vértice.
+ */
+static void passoBrandes(const int* inicio, const int* vizinhos, int origem,
+	int* distancia, double* sigma, double* dependencia, int* ordem,
+	double* intermediacao, double* somaDistancias, double* alcancadas) {
+	int frente = 0, tras = 0;
+	ordem[tras++] = origem;
+	distancia[origem] = 0;
+	sigma[origem] = 1;
+
+	while (frente < tras) {
+		int v = ordem[frente++];
+		for (int k = inicio[v]; k < inicio[v + 1]; k++) {
+			int w = vizinhos[k];
+			if (distancia[w] < 0)
+			{
+				distancia[w] = distancia[v] + 1;
+				ordem[tras++] = w;
+			}
+			if (distancia[w] == distancia[v] + 1) sigma[w] += sigma[v];
+		}
+	}
+
+	// Pela ordem inversa da procura: cada vértice passa a dependência aos antecessores no caminho
+	for (int i = tras - 1; i > 0; i--) {
+		int w = ordem[i];
+		double fator = (1.0 + dependencia[w]) / sigma[w];
+		for (int k = inicio[w]; k < inicio[w + 1]; k++) {
+			int v = vizinhos[k];
+			if (distancia[v] == distancia[w] - 1) dependencia[v] += sigma[v] * fator;
+		}
+		intermediacao[w] += dependencia[w];
+		somaDistancias[w] += distancia[w];
+		alcancadas[w] += 1;
+	}
+
+	// Só os vértices alcançados foram alterados
+	for (int i = 0; i < tras; i++) {
+		int w = ordem[i];
+		distancia[w] = -1;
+		sigma[w] = 0;
+		dependencia[w] = 0;
+	}
+}
+
+#pragma endregion
+
+#pragma region Funções de Centralidade
+
+/**
+ * @brief Número de origens para um erro e uma confiança (limite de Hoeffding com a união sobre as antenas).
+ *
+ * @param[in] numVertices - número de vértices do grafo.
+ * @param[in] erro - erro máximo pretendido da intermediação normalizada.
+ * @param[in] confianca - probabilidade de o erro ser respeitado por todas as antenas.
+ *
+ * @return número de origens, ou -1 se algum argumento for inválido.
+ */
+int origensCentralidade(int numVertices, double erro, double confianca) {
+	if (numVertices < 3 || erro <= 0 || confianca <= 0 || confianca >= 1) return -1;
+
+	double e = erro * (numVertices - 1) / numVertices;
+	double k = ceil(log(2.0 * numVertices / (1.0 - confianca)) / (2.0 * e * e));
+	return k > numVertices ? numVertices : (int)k;
+}
+
+/**
+ * @brief Calcula a intermediação e a proximidade de todas as antenas do grafo.
+ *
+ * Sem erro (ou quando a amostra teria todas as antenas) são percorridas todas as origens e o
+ * resultado é exato. As ligações de uma antena a si própria são ignoradas; as ligações repetidas
+ * contam como caminhos distintos.
+ *
+ * @param[in,out] grafo - apontador para o grafo.
+ * @param[in] erro - erro máximo da aproximação (<= 0 para o cálculo exato).
+ * @param[in] confianca - confiança do limite de erro.
+ * @param[in] semente - semente da escolha das origens.
+ * @param[in] numThreads - número de threads a usar (<= 0 usa o valor por omissão do OpenMP).
+ *
+ * @return apontador para as centralidades, ou NULL se o grafo for nulo, os argumentos inválidos
+ *         ou alguma alocação falhar.
+ */
+CENTRALIDADE* calcularCentralidade(GRAFO* grafo, double erro, double confianca, unsigned int semente, int numThreads) {
+	if (grafo == NULL) return NULL;
+	if (erro > 0 && (confianca <= 0 || confianca >= 1)) return NULL;
+
+	int n = 0;
+	long long graus = 0;
+	for (VERTICE* v = grafo->vertices; v != NULL; v = v->prox) {
+		v->indice = n++;
+		graus += v->grau;
+	}
+
+	CENTRALIDADE* centralidade = (CENTRALIDADE*)calloc(1, sizeof(CENTRALIDADE));
+	if (centralidade == NULL) return NULL;
+	if (n == 0) return centralidade;
+
+	centralidade->antenas = (CENTRALIDADE_ANTENA*)calloc((size_t)n, sizeof(CENTRALIDADE_ANTENA));
+	int* inicio = (int*)malloc((size_t)(n + 1) * sizeof(int));
+	int* vizinhos = (int*)malloc((size_t)(graus > 0 ? graus : 1) * sizeof(int));
+	int* origens = (int*)malloc((size_t)n * sizeof(int));
+	double* intermediacao = (double*)calloc((size_t)n * 3, sizeof(double));
+	if (!centralidade->antenas || !inicio || !vizinhos || !origens || !intermediacao)
+	{
+		free(inicio); free(vizinhos); free(origens); free(intermediacao);
+		return destruirCentralidade(centralidade);
+	}
+	double* somaDistancias = intermediacao + n;
+	double* alcancadas = intermediacao + 2 * (size_t)n;
+	centralidade->numAntenas = n;
+
+	// Vizinhos de cada vértice em arrays contíguos (sem as ligações de um vértice a si próprio)
+	int i = 0, k = 0;
+	for (VERTICE* v = grafo->vertices; v != NULL; v = v->prox, i++) {
+		CENTRALIDADE_ANTENA* c = &centralidade->antenas[i];
+		c->frequencia = v->antena.frequencia;
+		c->x = v->antena.x;
+		c->y = v->antena.y;
+		c->id = v->id;
+		inicio[i] = k;
+		for (ARESTA* adj = v->adjacentes; adj != NULL; adj = adj->prox) {
+			if (adj->destino != v) vizinhos[k++] = adj->destino->indice;
+		}
+	}
+	inicio[n] = k;
+
+	// Origens: todas, ou uma amostra sem repetições (Fisher-Yates parcial)
+	int numOrigens = erro > 0 ? origensCentralidade(n, erro, confianca) : n;
+	if (numOrigens < 0) numOrigens = n;
+	for (i = 0; i < n; i++) origens[i] = i;
+	if (numOrigens < n)
+	{
+		uint64_t estado = 0x9E3779B97F4A7C15ULL ^ semente;
+		for (i = 0; i < numOrigens; i++) {
+			uint64_t r = ((uint64_t)proximoAleatorio(&estado) << 32) | proximoAleatorio(&estado);
+			int j = i + (int)(r % (uint64_t)(n - i));
+			int t = origens[i]; origens[i] = origens[j]; origens[j] = t;
+		}
+		centralidade->erroMaximo = erroHoeffding(n, numOrigens, confianca);
+	}
+	centralidade->numOrigens = numOrigens;
+
+	bool erroAlocacao = false;
+
+#ifdef _OPENMP
+	if (numThreads <= 0) numThreads = omp_get_max_threads();
+#pragma omp parallel num_threads(numThreads)
+#else
+	(void)numThreads;
+#endif
+	{
+		// Arrays de trabalho e acumuladores próprios da thread
+		int* distancia = (int*)malloc((size_t)n * 2 * sizeof(int));
+		double* trabalho = (double*)calloc((size_t)n * 5, sizeof(double));
+		if (distancia == NULL || trabalho == NULL)
+		{
+#ifdef _OPENMP
+#pragma omp critical(juntarCentralidade)
+#endif
+			erroAlocacao = true;
+		}
+		else
+		{
+			for (int v = 0; v < n; v++) distancia[v] = -1;
+		}
+
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 16)
+#endif
+		for (int o = 0; o < numOrigens; o++) {
+			if (distancia == NULL || trabalho == NULL) continue;
+			passoBrandes(inicio, vizinhos, origens[o], distancia, trabalho, trabalho + n, distancia + n,
+				trabalho + 2 * (size_t)n, trabalho + 3 * (size_t)n, trabalho + 4 * (size_t)n);
+		}
+
+		if (distancia != NULL && trabalho != NULL)
+		{
+#ifdef _OPENMP
+#pragma omp critical(juntarCentralidade)
+#endif
+			for (int v = 0; v < n; v++) {
+				intermediacao[v] += trabalho[2 * (size_t)n + v];
+				somaDistancias[v] += trabalho[3 * (size_t)n + v];
+				alcancadas[v] += trabalho[4 * (size_t)n + v];
+			}
+		}
+		free(distancia);
+		free(trabalho);
+	}
+
+	if (!erroAlocacao)
+	{
+		double escala = (double)n / numOrigens;
+		double pares = n > 2 ? (double)(n - 1) * (n - 2) / 2 : 0;
+		for (i = 0; i < n; i++) {
+			CENTRALIDADE_ANTENA* c = &centralidade->antenas[i];
+			// Cada par aparece duas vezes na soma das dependências (uma por extremo)
+			c->intermediacao = intermediacao[i] * escala / 2;
+			c->intermediacaoNormalizada = pares > 0 ? c->intermediacao / pares : 0;
+			if (c->intermediacaoNormalizada > 1) c->intermediacaoNormalizada = 1;
+
+			double outras = alcancadas[i] * escala;
+			double soma = somaDistancias[i] * escala;
+			c->proximidade = soma > 0 && n > 1 ? outras * outras / ((double)(n - 1) * soma) : 0;
+		}
+	}
+
+	free(inicio); free(vizinhos); free(origens); free(intermediacao);
+	if (erroAlocacao) return destruirCentralidade(centralidade);
+	return centralidade;
+}
+
+/**
+ * @brief Ordena as antenas por ordem decrescente de intermediação ou de proximidade.
+ *
+ * @param[in,out] centralidade - apontador para as centralidades.
+ * @param[in] porProximidade - @c true para ordenar pela proximidade, @c false pela intermediação.
+ */
+void ordenarCentralidade(CENTRALIDADE* centralidade, bool porProximidade) {
+	if (centralidade == NULL || centralidade->numAntenas < 2) return;
+
+	qsort(centralidade->antenas, (size_t)centralidade->numAntenas, sizeof(CENTRALIDADE_ANTENA),
+		porProximidade ? compararProximidade : compararIntermediacao);
+}
+
+/**
+ * @brief Liberta a memória das centralidades.
+ *
+ * @param centralidade - apontador para as centralidades a destruir.
+ * @return NULL, indicando que as centralidades foram destruídas.
+ */
+CENTRALIDADE* destruirCentralidade(CENTRALIDADE* centralidade) {
+	if (centralidade == NULL) return NULL;
+
+	free(centralidade->antenas);
+	free(centralidade);
+	return NULL;
+}
+
+#pragma endregion
@@ -0,0 +1,89 @@
+#pragma once
+
+/**
+ * @file centralidade.h
+ * @brief Centralidade de intermediação (betweenness) e de proximidade (closeness) das antenas
+ *        de um grafo, exata (algoritmo de Brandes) ou aproximada por amostragem de origens
+ *
+ * @author Rogério Picas
+ * @date 18-10-2026
+ * @version 1.0
+ *
+ */
+#include "funcoes.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#pragma region Estruturas
+
+/**
+ * @struct CentralidadeAntena
+ * @brief Centralidades de uma antena.
+ */
+typedef struct CentralidadeAntena {
+    char frequencia;                  /**< Frequência da antena */
+    COORDENADA x;                     /**< Coordenada X da antena */
+    COORDENADA y;                     /**< Coordenada Y da antena */
+    int id;                           /**< Identificador do vértice no seu grafo */
+    double intermediacao;             /**< Número (estimado) de caminhos mais curtos entre outros pares que passam pela antena */
+    double intermediacaoNormalizada;  /**< Intermediação a dividir pelo número de pares de outras antenas, em [0, 1] */
+    double proximidade;               /**< Proximidade de Wasserman-Faust: (r - 1)² / ((n - 1) * soma das distâncias às r - 1 alcançáveis) */
+} CENTRALIDADE_ANTENA;
+
+/**
+ * @struct Centralidade
+ * @brief Centralidades de todas as antenas de um grafo.
+ */
+typedef struct Centralidade {
+    CENTRALIDADE_ANTENA* antenas;     /**< Uma entrada por antena, pela ordem da lista de vértices (até ser ordenada) */
+    int numAntenas;                   /**< Número de antenas */
+    int numOrigens;                   /**< Origens percorridas (numAntenas no cálculo exato) */
+    double erroMaximo;                /**< Erro máximo da intermediação normalizada, com a confiança pedida (0 no cálculo exato) */
+} CENTRALIDADE;
+
+#pragma endregion
+
+#pragma region Funções de Centralidade
+
+/**
+ * @brief Número de origens a amostrar para que a intermediação normalizada de todas as antenas
+ *        tenha, com a confiança indicada, um erro inferior a @p erro (limite de Hoeffding).
+ * @param numVertices Número de vértices do grafo.
+ * @param erro Erro máximo pretendido (> 0).
+ * @param confianca Probabilidade de o erro ser respeitado por todas as antenas, em ]0, 1[.
+ * @return Número de origens (-1 se os argumentos forem inválidos).
+ */
+int origensCentralidade(int numVertices, double erro, double confianca);
+
+/**
+ * @brief Calcula a intermediação e a proximidade de todas as antenas do grafo.
+ * @param grafo Apontador para o grafo (o campo indice dos vértices é reescrito).
+ * @param erro Erro máximo da aproximação (<= 0 para o cálculo exato, com todas as origens).
+ * @param confianca Confiança do limite de erro, em ]0, 1[ (ignorada no cálculo exato).
+ * @param semente Semente da escolha das origens.
+ * @param numThreads Número de threads a usar (<= 0 usa o valor por omissão do OpenMP; ignorado sem OpenMP).
+ * @return Apontador para as centralidades calculadas ou NULL em caso de erro.
+ */
+CENTRALIDADE* calcularCentralidade(GRAFO* grafo, double erro, double confianca, unsigned int semente, int numThreads);
+
+/**
+ * @brief Ordena as antenas por ordem decrescente de intermediação ou de proximidade.
+ * @param centralidade Apontador para as centralidades.
+ * @param porProximidade true para ordenar pela proximidade, false para ordenar pela intermediação.
+ */
+void ordenarCentralidade(CENTRALIDADE* centralidade, bool porProximidade);
+
+/**
+ * @brief Liberta a memória das centralidades.
+ * @param centralidade Apontador para as centralidades a destruir.
+ * @return NULL, indicando que as centralidades foram destruídas.
+ */
+CENTRALIDADE* destruirCentralidade(CENTRALIDADE* centralidade);
+
+#pragma endregion
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,285 @@
+/**
+ * @file criticos.c
+ * @brief Implementação da análise de antenas e ligações críticas (algoritmo de Tarjan iterativo).
+ *
+ * A procura em profundidade usa uma pilha explícita (sem recursão, para que grafos grandes não
+ * esgotem a pilha do programa) e segue os apontadores das arestas, sem procurar os vértices
+ * pelas coordenadas. Cada vértice recebe o tempo de descoberta e o menor tempo alcançável pela
+ * sua subárvore com uma aresta de retorno (lowlink); com esses valores, cada vértice e cada
+ * aresta são classificados uma única vez, em O(V + E).
+ *
+ * @author Rogério Picas
+ * @date 18-10-2026
+ * @version 1.0
+ */
+#define _CRT_SECURE_NO_WARNINGS
+#include <stdio.h>
+#include <stdlib.h>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+#include "criticos.h"
+
+#pragma region Estruturas Auxiliares
+
+/**
+ * @struct PassoTarjan
+ * @brief Vértice na pilha da procura em profundidade.
+ */
+typedef struct PassoTarjan {
+    int vertice;       /**< Índice do vértice */
+    ARESTA* aresta;    /**< Próxima aresta da lista de adjacências a examinar */
+    ARESTA* entrada;   /**< Aresta, na lista deste vértice, que volta ao pai (NULL na raiz) */
+} PASSO_TARJAN;
+
+#pragma endregion
+
+#pragma region Funções Auxiliares
+
+/**
+ * @brief Preenche uma ligação com as coordenadas de dois vértices.
+ */
+static void escreverLigacao(ArestasFICHEIRO* ligacao, const VERTICE* origem, const VERTICE* destino) {
+	ligacao->xOrigem = origem->antena.x;
+	ligacao->yOrigem = origem->antena.y;
+	ligacao->xDestino = destino->antena.x;
+	ligacao->yDestino = destino->antena.y;
+}
+
+#pragma endregion
+
+#pragma region Funções da Análise Crítica
+
+/**
+ * @brief Calcula os pontos de articulação, as pontes e as componentes biconexas de um grafo.
+ *
+ * As ligações atravessadas são empilhadas; quando um filho v de u termina com low[v] >= disc[u],
+ * as ligações empilhadas desde (u, v) formam uma componente biconexa e u é um ponto de
+ * articulação (a raiz só o é se tiver mais de um filho). Se low[v] > disc[u], (u, v) é uma ponte.
+ * A aresta de volta ao pai é reconhecida pelo apontador (e não pelo vértice), para que duas
+ * ligações entre o mesmo par não sejam tomadas por uma ponte. As ligações de uma antena a si
+ * própria são ignoradas.
+ *
+ * Só lê o grafo (e reescreve o campo indice dos seus vértices), pelo que grafos diferentes
+ * podem ser analisados ao mesmo tempo.
+ *
+ * @param[in,out] grafo - apontador para o grafo.
+ * @param[out] analise - estrutura onde é escrito o resultado.
+ *
+ * @return @c 0 se a análise for bem-sucedida,
+ *         @c 1 se algum argumento for nulo,
+ *         @c 2 se a alocação falhar (a análise fica vazia).
+ */
+int analisarGrafoCritico(GRAFO* grafo, ANALISE_CRITICA_GRAFO* analise) {
+	if (grafo == NULL || analise == NULL) return 1;
+
+	ANALISE_CRITICA_GRAFO vazia = { grafo->frequencia };
+	*analise = vazia;
+
+	int n = 0;
+	long long graus = 0;
+	for (VERTICE* v = grafo->vertices; v != NULL; v = v->prox) {
+		v->indice = n++;
+		graus += v->grau;
+	}
+	if (n == 0) return 0;
+	int m = (int)(graus / 2) + 1;
+
+	VERTICE** vertices = (VERTICE**)malloc((size_t)n * sizeof(VERTICE*));
+	int* disc = (int*)malloc((size_t)n * sizeof(int));
+	int* low = (int*)malloc((size_t)n * sizeof(int));
+	bool* articulacao = (bool*)calloc((size_t)n, sizeof(bool));
+	PASSO_TARJAN* pilha = (PASSO_TARJAN*)malloc((size_t)n * sizeof(PASSO_TARJAN));
+	int* pilhaLigacoes = (int*)malloc((size_t)m * 2 * sizeof(int));
+	analise->articulacoes = (VerticeFICHEIRO*)malloc((size_t)n * sizeof(VerticeFICHEIRO));
+	analise->pontes = (ArestasFICHEIRO*)malloc((size_t)n * sizeof(ArestasFICHEIRO));
+	analise->ligacoes = (ArestasFICHEIRO*)malloc((size_t)m * sizeof(ArestasFICHEIRO));
+	analise->inicioComponentes = (int*)malloc((size_t)(m + 1) * sizeof(int));
+	if (!vertices || !disc || !low || !articulacao || !pilha || !pilhaLigacoes ||
+		!analise->articulacoes || !analise->pontes || !analise->ligacoes || !analise->inicioComponentes)
+	{
+		free(vertices); free(disc); free(low); free(articulacao); free(pilha); free(pilhaLigacoes);
+		libertarAnaliseCriticaGrafo(analise);
+		return 2;
+	}
+
+	int i = 0;
+	for (VERTICE* v = grafo->vertices; v != NULL; v = v->prox) {
+		vertices[i] = v;
+		disc[i] = -1;
+		i++;
+	}
+
+	int tempo = 0;
+	int topoLigacoes = 0;
+	for (int raiz = 0; raiz < n; raiz++) {
+		if (disc[raiz] != -1) continue;
+
+		int filhosRaiz = 0;
+		int topo = 0;
+		disc[raiz] = low[raiz] = tempo++;
+		pilha[topo++] = (PASSO_TARJAN){ raiz, vertices[raiz]->adjacentes, NULL };
+
+		while (topo > 0) {
+			PASSO_TARJAN* passo = &pilha[topo - 1];
+			int u = passo->vertice;
+
+			if (passo->aresta != NULL)
+			{
+				ARESTA* aresta = passo->aresta;
+				passo->aresta = aresta->prox;
+				int w = aresta->destino->indice;
+				if (w == u || aresta == passo->entrada) continue;
+
+				if (disc[w] == -1)
+				{
+					// Aresta da árvore: desce para w
+					pilhaLigacoes[2 * topoLigacoes] = u;
+					pilhaLigacoes[2 * topoLigacoes + 1] = w;
+					topoLigacoes++;
+					disc[w] = low[w] = tempo++;
+					if (u == raiz) filhosRaiz++;
+					pilha[topo++] = (PASSO_TARJAN){ w, vertices[w]->adjacentes, aresta->inversa };
+				}
+				else if (disc[w] < disc[u])
+				{
+					// Aresta de retorno para um antecessor (cada uma é empilhada uma só vez)
+					pilhaLigacoes[2 * topoLigacoes] = u;
+					pilhaLigacoes[2 * topoLigacoes + 1] = w;
+					topoLigacoes++;
+					if (disc[w] < low[u]) low[u] = disc[w];
+				}
+				continue;
+			}
+
+			// Todas as arestas de u foram examinadas: volta ao pai
+			topo--;
+			if (topo == 0) break;
+			int pai = pilha[topo - 1].vertice;
+			if (low[u] < low[pai]) low[pai] = low[u];
+
+			if (low[u] >= disc[pai])
+			{
+				if (pai != raiz) articulacao[pai] = true;
+				if (low[u] > disc[pai])
+				{
+					escreverLigacao(&analise->pontes[analise->numPontes++], vertices[pai], vertices[u]);
+				}
+
+				// As ligações empilhadas desde (pai, u) formam uma componente biconexa
+				analise->inicioComponentes[analise->numComponentes++] = analise->numLigacoes;
+				int a, b;
+				do {
+					topoLigacoes--;
+					a = pilhaLigacoes[2 * topoLigacoes];
+					b = pilhaLigacoes[2 * topoLigacoes + 1];
+					escreverLigacao(&analise->ligacoes[analise->numLigacoes++], vertices[a], vertices[b]);
+				} while (a != pai || b != u);
+			}
+		}
+		if (filhosRaiz > 1) articulacao[raiz] = true;
+	}
+	analise->inicioComponentes[analise->numComponentes] = analise->numLigacoes;
+
+	for (i = 0; i < n; i++) {
+		if (!articulacao[i]) continue;
+		VerticeFICHEIRO* p = &analise->articulacoes[analise->numArticulacoes++];
+		p->frequencia = vertices[i]->antena.frequencia;
+		p->x = vertices[i]->antena.x;
+		p->y = vertices[i]->antena.y;
+	}
+
+	free(vertices); free(disc); free(low); free(articulacao); free(pilha); free(pilhaLigacoes);
+	return 0;
+}
+
+/**
+ * @brief Analisa todos os grafos da rede.
+ *
+ * Os grafos são repartidos pelas threads (um grafo de cada vez, por ordem dinâmica, porque as
+ * frequências podem ter tamanhos muito diferentes). Cada grafo só é lido pela thread que o
+ * analisa. Sem OpenMP os grafos são analisados em sequência.
+ *
+ * @param[in,out] rede - apontador para a rede.
+ * @param[in] numThreads - número de threads a usar (<= 0 usa o valor por omissão do OpenMP).
+ *
+ * @return apontador para a análise criada, ou NULL se a rede for nula ou alguma alocação falhar.
+ */
+ANALISE_CRITICA* analisarRedeCritica(REDE* rede, int numThreads) {
+	if (rede == NULL) return NULL;
+
+	int total = 0;
+	for (GRAFO* g = rede->listaGrafos; g != NULL; g = g->prox) total++;
+
+	ANALISE_CRITICA* analise = (ANALISE_CRITICA*)calloc(1, sizeof(ANALISE_CRITICA));
+	if (analise == NULL) return NULL;
+	if (total == 0) return analise;
+
+	analise->grafos = (ANALISE_CRITICA_GRAFO*)calloc((size_t)total, sizeof(ANALISE_CRITICA_GRAFO));
+	GRAFO** grafos = (GRAFO**)malloc((size_t)total * sizeof(GRAFO*));
+	if (analise->grafos == NULL || grafos == NULL)
+	{
+		free(grafos);
+		return destruirAnaliseCritica(analise);
+	}
+	analise->numGrafos = total;
+
+	int n = 0;
+	for (GRAFO* g = rede->listaGrafos; g != NULL; g = g->prox) grafos[n++] = g;
+
+	bool erro = false;
+#ifdef _OPENMP
+	if (numThreads <= 0) numThreads = omp_get_max_threads();
+#pragma omp parallel for num_threads(numThreads) schedule(dynamic, 1)
+#else
+	(void)numThreads;
+#endif
+	for (int i = 0; i < total; i++) {
+		if (analisarGrafoCritico(grafos[i], &analise->grafos[i]) != 0)
+		{
+#ifdef _OPENMP
+#pragma omp critical(erroAnaliseCritica)
+#endif
+			erro = true;
+		}
+	}
+
+	free(grafos);
+	if (erro) return destruirAnaliseCritica(analise);
+	return analise;
+}
+
+/**
+ * @brief Liberta os arrays da análise de um grafo e deixa-a vazia.
+ *
+ * @param[in,out] analise - apontador para a análise.
+ */
+void libertarAnaliseCriticaGrafo(ANALISE_CRITICA_GRAFO* analise) {
+	if (analise == NULL) return;
+
+	free(analise->articulacoes);
+	free(analise->pontes);
+	free(analise->ligacoes);
+	free(analise->inicioComponentes);
+	ANALISE_CRITICA_GRAFO vazia = { analise->frequencia };
+	*analise = vazia;
+}
+
+/**
+ * @brief Liberta a memória da análise de uma rede.
+ *
+ * @param analise - apontador para a análise a destruir.
+ * @return NULL, indicando que a análise foi destruída.
+ */
+ANALISE_CRITICA* destruirAnaliseCritica(ANALISE_CRITICA* analise) {
+	if (analise == NULL) return NULL;
+
+	for (int i = 0; i < analise->numGrafos; i++) {
+		libertarAnaliseCriticaGrafo(&analise->grafos[i]);
+	}
+	free(analise->grafos);
+	free(analise);
+	return NULL;
+}
+
+#pragma endregion
@@ -0,0 +1,87 @@
+#pragma once
+
+/**
+ * @file criticos.h
+ * @brief Antenas e ligações críticas de cada frequência (pontos de articulação, pontes e
+ *        componentes biconexas), calculadas com o algoritmo de Tarjan em versão iterativa
+ *
+ * @author Rogério Picas
+ * @date 18-10-2026
+ * @version 1.0
+ *
+ */
+#include "funcoes.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#pragma region Estruturas
+
+/**
+ * @struct AnaliseCriticaGrafo
+ * @brief Resultado da análise de um grafo (uma frequência).
+ *
+ * As ligações das componentes biconexas estão todas no mesmo array, agrupadas por componente:
+ * as da componente c ocupam as posições de inicioComponentes[c] a inicioComponentes[c + 1] - 1.
+ * Uma ponte é sempre uma componente com uma única ligação.
+ */
+typedef struct AnaliseCriticaGrafo {
+    char frequencia;                 /**< Frequência do grafo analisado */
+    VerticeFICHEIRO* articulacoes;   /**< Antenas cuja falha separa o grafo, pela ordem da lista de vértices */
+    int numArticulacoes;             /**< Número de pontos de articulação */
+    ArestasFICHEIRO* pontes;         /**< Ligações cuja falha separa o grafo */
+    int numPontes;                   /**< Número de pontes */
+    ArestasFICHEIRO* ligacoes;       /**< Ligações (sem as de uma antena a si própria), agrupadas por componente biconexa */
+    int numLigacoes;                 /**< Número de ligações no array */
+    int* inicioComponentes;          /**< Início de cada componente no array de ligações (numComponentes + 1 posições) */
+    int numComponentes;              /**< Número de componentes biconexas */
+} ANALISE_CRITICA_GRAFO;
+
+/**
+ * @struct AnaliseCritica
+ * @brief Resultado da análise de toda a rede, com uma entrada por grafo.
+ */
+typedef struct AnaliseCritica {
+    ANALISE_CRITICA_GRAFO* grafos;   /**< Análises, pela ordem da lista de grafos da rede */
+    int numGrafos;                   /**< Número de grafos analisados */
+} ANALISE_CRITICA;
+
+#pragma endregion
+
+#pragma region Funções da Análise Crítica
+
+/**
+ * @brief Calcula os pontos de articulação, as pontes e as componentes biconexas de um grafo, em O(V + E).
+ * @param grafo Apontador para o grafo (o campo indice dos vértices é reescrito).
+ * @param analise Estrutura onde é escrito o resultado (a libertar com libertarAnaliseCriticaGrafo).
+ * @return 0 se a operação for bem-sucedida, 1 se os argumentos forem nulos e 2 em caso de falha de alocação.
+ */
+int analisarGrafoCritico(GRAFO* grafo, ANALISE_CRITICA_GRAFO* analise);
+
+/**
+ * @brief Analisa todos os grafos da rede, um por thread.
+ * @param rede Apontador para a rede.
+ * @param numThreads Número de threads a usar (<= 0 usa o valor por omissão do OpenMP; ignorado sem OpenMP).
+ * @return Apontador para a análise criada ou NULL em caso de erro.
+ */
+ANALISE_CRITICA* analisarRedeCritica(REDE* rede, int numThreads);
+
+/**
+ * @brief Liberta os arrays da análise de um grafo (a própria estrutura não é libertada).
+ * @param analise Apontador para a análise.
+ */
+void libertarAnaliseCriticaGrafo(ANALISE_CRITICA_GRAFO* analise);
+
+/**
+ * @brief Liberta a memória da análise de uma rede.
+ * @param analise Apontador para a análise a destruir.
+ * @return NULL, indicando que a análise foi destruída.
+ */
+ANALISE_CRITICA* destruirAnaliseCritica(ANALISE_CRITICA* analise);
+
+#pragma endregion
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,393 @@
+/**
+ * @file delta.c
+ * @brief Implementação da leitura e aplicação em lotes de alterações ao mapa.
+ *
+ * @author Rogério Picas
+ * @date 18-10-2026
+ * @version 1.0
+ */
+#define _CRT_SECURE_NO_WARNINGS
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include "delta.h"
+#include "reserva.h"
+#include "espacial.h"
+#include "antinodos.h"
+
+#pragma region Funções Auxiliares
+
+/**
+ * @brief Verifica se o resto de uma linha só tem espaços.
+ */
+static bool restoVazio(const char* resto) {
+	while (*resto) {
+		if (!isspace((unsigned char)*resto)) return false;
+		resto++;
+	}
+	return true;
+}
+
+/**
+ * @brief Prepara a rede para um lote de alterações, fazendo de uma só vez o trabalho comum a todas.
+ *
+ * - Os vértices das inserções e as arestas das ligações são reservados num bloco do grafo de
+ *   cada frequência (criado se ainda não existir), em vez de uma alocação por alteração.
+ * - Os baldes do índice espacial que vão receber antenas (inserções e destinos dos movimentos)
+ *   crescem de uma vez.
+ * - Nos grafos com a contagem de antinodos ativa e com pelo menos tantas inserções, remoções e
+ *   movimentos como antenas, a contagem é desligada: refazê-la no fim do lote (todos os pares
+ *   uma vez) custa menos do que atualizá-la antena a antena. Esses grafos são escritos em @p suspensos.
+ *
+ * Se alguma reserva falhar, as alterações voltam a alocar uma a uma.
+ *
+ * @return número de grafos escritos em @p suspensos.
+ */
+static int prepararLoteDeltas(REDE* rede, const DELTA* lote, int num, GRAFO** suspensos) {
+	int vertices[256] = { 0 }, ligacoes[256] = { 0 }, antenas[256] = { 0 };
+	int destinos = 0;
+	for (int i = 0; i < num; i++) {
+		int f = (unsigned char)lote[i].frequencia;
+		if (lote[i].tipo == DELTA_INSERIR) vertices[f]++;
+		if (lote[i].tipo == DELTA_LIGAR) ligacoes[f]++;
+		if (lote[i].tipo == DELTA_INSERIR || lote[i].tipo == DELTA_REMOVER || lote[i].tipo == DELTA_MOVER) antenas[f]++;
+		if (lote[i].tipo == DELTA_INSERIR || lote[i].tipo == DELTA_MOVER) destinos++;
+	}
+
+	// Cada frequência é tratada na primeira alteração em que aparece
+	int numSuspensos = 0;
+	for (int i = 0; i < num; i++) {
+		int f = (unsigned char)lote[i].frequencia;
+		if (antenas[f] == 0 && ligacoes[f] == 0) continue;
+
+		GRAFO* grafo = vertices[f] > 0
+			? criarGrafo(rede, lote[i].frequencia)
+			: encontrarGrafoPorFrequencia(rede, lote[i].frequencia);
+		if (grafo != NULL)
+		{
+			// Para uma só antena ou ligação, um bloco não poupa alocações
+			if (vertices[f] + ligacoes[f] > 1) reservarGrafo(grafo, vertices[f], ligacoes[f]);
+			if (grafo->antinodos != NULL && antenas[f] >= grafo->numVertices)
+			{
+				grafo->antinodos = destruirAntinodos(grafo->antinodos);
+				suspensos[numSuspensos++] = grafo;
+			}
+		}
+		vertices[f] = ligacoes[f] = antenas[f] = 0;
+	}
+
+	if (destinos > 1 && rede->indice != NULL)
+	{
+		ANTENAS* posicoes = (ANTENAS*)malloc((size_t)destinos * sizeof(ANTENAS));
+		if (posicoes != NULL)
+		{
+			int n = 0;
+			for (int i = 0; i < num; i++) {
+				const DELTA* d = &lote[i];
+				int x = d->tipo == DELTA_MOVER ? d->x2 : d->x1;
+				int y = d->tipo == DELTA_MOVER ? d->y2 : d->y1;
+				if (d->tipo != DELTA_INSERIR && d->tipo != DELTA_MOVER) continue;
+				if (x < 0 || x >= MAX_DIM || y < 0 || y >= MAX_DIM) continue;
+				posicoes[n].frequencia = d->frequencia;
+				posicoes[n].x = (COORDENADA)x;
+				posicoes[n].y = (COORDENADA)y;
+				n++;
+			}
+			reservarIndiceEspacial(rede->indice, posicoes, n);
+			free(posicoes);
+		}
+	}
+	return numSuspensos;
+}
+
+#pragma endregion
+
+#pragma region Funções de Alterações
+
+/**
+ * @brief Interpreta uma linha de texto com uma alteração.
+ *
+ * @param[in] linha - linha a interpretar (com ou sem '\n' no fim).
+ * @param[out] delta - apontador onde é escrita a alteração.
+ *
+ * @return @c 0 se a linha tiver uma alteração válida, @c 1 se for vazia ou um comentário,
+ *         @c 2 se for inválida (comando desconhecido, frequência fora de A-Z, argumentos em falta ou a mais),
+ *         @c 3 se for o comando "aplicar".
+ */
+int interpretarDelta(const char* linha, DELTA* delta) {
+	if (linha == NULL || delta == NULL) return 2;
+
+	while (isspace((unsigned char)*linha)) linha++;
+	if (*linha == '\0' || *linha == '#') return 1;
+
+	char comando[16];
+	int lido = 0;
+	if (sscanf(linha, "%15s%n", comando, &lido) != 1) return 2;
+
+	if (strcmp(comando, "aplicar") == 0)
+	{
+		return restoVazio(linha + lido) ? 3 : 2;
+	}
+
+	int numCoordenadas;
+	if (strcmp(comando, "inserir") == 0)
+	{
+		delta->tipo = DELTA_INSERIR;
+		numCoordenadas = 2;
+	}
+	else if (strcmp(comando, "remover") == 0)
+	{
+		delta->tipo = DELTA_REMOVER;
+		numCoordenadas = 2;
+	}
+	else if (strcmp(comando, "mover") == 0)
+	{
+		delta->tipo = DELTA_MOVER;
+		numCoordenadas = 4;
+	}
+	else if (strcmp(comando, "ligar") == 0)
+	{
+		delta->tipo = DELTA_LIGAR;
+		numCoordenadas = 4;
+	}
+	else if (strcmp(comando, "desligar") == 0)
+	{
+		delta->tipo = DELTA_DESLIGAR;
+		numCoordenadas = 4;
+	}
+	else
+	{
+		return 2;
+	}
+
+	const char* resto = linha + lido;
+	int fim = 0;
+	delta->x2 = delta->y2 = -1;
+	if (numCoordenadas == 2)
+	{
+		if (sscanf(resto, " %c %d %d%n", &delta->frequencia, &delta->x1, &delta->y1, &fim) != 3) return 2;
+	}
+	else
+	{
+		if (sscanf(resto, " %c %d %d %d %d%n", &delta->frequencia, &delta->x1, &delta->y1,
+			&delta->x2, &delta->y2, &fim) != 5) return 2;
+	}
+	if (delta->frequencia < 'A' || delta->frequencia > 'Z') return 2;
+	if (!restoVazio(resto + fim)) return 2;
+
+	return 0;
+}
+
+/**
+ * @brief Escreve uma alteração como uma linha de texto (terminada em '\n').
+ *
+ * A linha escrita é interpretada por @c interpretarDelta como a mesma alteração.
+ *
+ * @param[in] fp - ficheiro onde escrever.
+ * @param[in] delta - alteração a escrever.
+ *
+ * @return @c 0 em caso de sucesso, @c 1 se algum apontador for nulo, o tipo for desconhecido ou a escrita falhar.
+ */
+int escreverDelta(FILE* fp, const DELTA* delta) {
+	if (fp == NULL || delta == NULL) return 1;
+
+	int escritos;
+	switch (delta->tipo) {
+	case DELTA_INSERIR:
+		escritos = fprintf(fp, "inserir %c %d %d\n", delta->frequencia, delta->x1, delta->y1);
+		break;
+	case DELTA_REMOVER:
+		escritos = fprintf(fp, "remover %c %d %d\n", delta->frequencia, delta->x1, delta->y1);
+		break;
+	case DELTA_MOVER:
+		escritos = fprintf(fp, "mover %c %d %d %d %d\n", delta->frequencia, delta->x1, delta->y1, delta->x2, delta->y2);
+		break;
+	case DELTA_LIGAR:
+		escritos = fprintf(fp, "ligar %c %d %d %d %d\n", delta->frequencia, delta->x1, delta->y1, delta->x2, delta->y2);
+		break;
+	case DELTA_DESLIGAR:
+		escritos = fprintf(fp, "desligar %c %d %d %d %d\n", delta->frequencia, delta->x1, delta->y1, delta->x2, delta->y2);
+		break;
+	default:
+		return 1;
+	}
+	return escritos > 0 ? 0 : 1;
+}
+
+/**
+ * @brief Lê um lote de alterações de um ficheiro ou pipe.
+ *
+ * A leitura pára quando o lote fica cheio, quando aparece uma linha "aplicar" (para que um
+ * produtor lento não fique à espera de encher o lote) ou no fim do ficheiro. As linhas
+ * inválidas são contadas e ignoradas.
+ *
+ * @param[in] fp - ficheiro ou pipe de onde ler.
+ * @param[out] lote - array onde são escritas as alterações.
+ * @param[in] max - número máximo de alterações do lote.
+ * @param[in,out] resultado - contagens a atualizar (pode ser NULL).
+ *
+ * @return número de alterações lidas (pode ser 0 com um "aplicar" isolado),
+ *         ou -1 se o fim do ficheiro foi atingido sem ler nenhuma linha.
+ */
+int lerLoteDeltas(FILE* fp, DELTA* lote, int max, RESULTADO_DELTAS* resultado) {
+	if (fp == NULL || lote == NULL || max <= 0) return -1;
+
+	char linha[256];
+	int num = 0;
+	bool leuLinha = false;
+
+	while (num < max && fgets(linha, sizeof(linha), fp) != NULL) {
+		leuLinha = true;
+		if (resultado) resultado->linhas++;
+
+		// Linha demasiado longa: descarta o resto e considera-a inválida
+		size_t comprimento = strlen(linha);
+		if (comprimento == sizeof(linha) - 1 && linha[comprimento - 1] != '\n')
+		{
+			int ch;
+			while ((ch = fgetc(fp)) != EOF && ch != '\n');
+			if (resultado) resultado->invalidas++;
+			continue;
+		}
+
+		int tipo = interpretarDelta(linha, &lote[num]);
+		if (tipo == 0)
+		{
+			num++;
+		}
+		else if (tipo == 2)
+		{
+			if (resultado) resultado->invalidas++;
+		}
+		else if (tipo == 3)
+		{
+			break;
+		}
+	}
+	return leuLinha ? num : -1;
+}
+
+/**
+ * @brief Aplica um lote de alterações à rede, pela ordem em que aparecem.
+ *
+ * Cada alteração usa as funções da biblioteca (inserirAntenaGrafo, removerAntenaGrafo,
+ * moverAntenaGrafo, conectarVertices, removerLigacao), pelo que o índice espacial e a grelha
+ * ficam sempre atualizados. O que é comum ao lote é feito uma só vez (ver @c prepararLoteDeltas):
+ * as reservas de vértices, arestas e baldes, e a contagem de antinodos dos grafos com muitas
+ * alterações, refeita no fim. O lote conta como uma única alteração da rede: a época avança
+ * uma vez e todos os grafos alterados ficam com ela.
+ *
+ * @param[in,out] rede - apontador para a rede.
+ * @param[in] lote - alterações a aplicar.
+ * @param[in] num - número de alterações.
+ * @param[in,out] resultado - contagens a atualizar (pode ser NULL).
+ *
+ * @return @c 0 em caso de sucesso, @c 1 se a rede ou o lote forem nulos.
+ */
+int aplicarLoteDeltas(REDE* rede, const DELTA* lote, int num, RESULTADO_DELTAS* resultado) {
+	if (rede == NULL || (lote == NULL && num > 0)) return 1;
+
+	GRAFO* suspensos[256];
+	int numSuspensos = num > 1 ? prepararLoteDeltas(rede, lote, num, suspensos) : 0;
+	rede->epoca++;
+	rede->emLote = true;
+
+	for (int i = 0; i < num; i++) {
+		const DELTA* d = &lote[i];
+		GRAFO* grafo = d->tipo == DELTA_INSERIR
+			? criarGrafo(rede, d->frequencia)
+			: encontrarGrafoPorFrequencia(rede, d->frequencia);
+
+		int erro = 1;
+		if (grafo != NULL)
+		{
+			switch (d->tipo) {
+			case DELTA_INSERIR:
+				erro = inserirAntenaGrafo(grafo, d->frequencia, d->x1, d->y1);
+				break;
+			case DELTA_REMOVER:
+				erro = removerAntenaGrafo(grafo, d->x1, d->y1);
+				break;
+			case DELTA_MOVER:
+				erro = moverAntenaGrafo(grafo, d->x1, d->y1, d->x2, d->y2);
+				break;
+			case DELTA_LIGAR:
+				erro = conectarVertices(grafo, d->x1, d->y1, d->x2, d->y2);
+				break;
+			case DELTA_DESLIGAR:
+				erro = removerLigacao(grafo, d->x1, d->y1, d->x2, d->y2);
+				break;
+			}
+		}
+
+		if (resultado)
+		{
+			if (erro == 0) resultado->aplicadas++;
+			else resultado->rejeitadas++;
+		}
+	}
+	rede->emLote = false;
+	for (int i = 0; i < numSuspensos; i++) {
+		ativarAntinodos(suspensos[i]);
+	}
+	if (resultado) resultado->lotes++;
+	return 0;
+}
+
+/**
+ * @brief Lê e aplica, lote a lote, todas as alterações de um ficheiro ou pipe aberto.
+ *
+ * Com um pipe, cada lote é aplicado assim que fica cheio ou que chega uma linha "aplicar",
+ * pelo que a rede vai sendo atualizada enquanto o produtor continua a escrever.
+ *
+ * @param[in,out] rede - apontador para a rede.
+ * @param[in] fp - ficheiro ou pipe de onde ler (lido até ao fim).
+ * @param[in] tamanhoLote - número máximo de alterações por lote (<= 0 usa TAM_LOTE_DELTAS).
+ * @param[in,out] resultado - contagens a atualizar (pode ser NULL).
+ *
+ * @return @c 0 em caso de sucesso, @c 1 se a rede ou o ficheiro forem nulos, @c 2 se a alocação falhar.
+ */
+int processarDeltas(REDE* rede, FILE* fp, int tamanhoLote, RESULTADO_DELTAS* resultado) {
+	if (rede == NULL || fp == NULL) return 1;
+	if (tamanhoLote <= 0) tamanhoLote = TAM_LOTE_DELTAS;
+
+	DELTA* lote = (DELTA*)malloc((size_t)tamanhoLote * sizeof(DELTA));
+	if (lote == NULL) return 2;
+
+	int num;
+	while ((num = lerLoteDeltas(fp, lote, tamanhoLote, resultado)) >= 0) {
+		if (num > 0)
+		{
+			aplicarLoteDeltas(rede, lote, num, resultado);
+		}
+	}
+
+	free(lote);
+	return 0;
+}
+
+/**
+ * @brief Abre um ficheiro de alterações e aplica-o à rede.
+ *
+ * @param[in,out] rede - apontador para a rede.
+ * @param[in] filename - nome do ficheiro, ou "-" para ler da entrada padrão (ex.: um pipe).
+ * @param[in] tamanhoLote - número máximo de alterações por lote (<= 0 usa TAM_LOTE_DELTAS).
+ * @param[in,out] resultado - contagens a atualizar (pode ser NULL).
+ *
+ * @return @c 0 em caso de sucesso, @c -1 se o ficheiro não puder ser aberto,
+ *         ou o valor devolvido por @c processarDeltas em caso de erro.
+ */
+int carregarDeltas(REDE* rede, char* filename, int tamanhoLote, RESULTADO_DELTAS* resultado) {
+	if (filename == NULL) return -1;
+
+	bool entradaPadrao = strcmp(filename, "-") == 0;
+	FILE* fp = entradaPadrao ? stdin : fopen(filename, "r");
+	if (fp == NULL) return -1;
+
+	int erro = processarDeltas(rede, fp, tamanhoLote, resultado);
+	if (!entradaPadrao) fclose(fp);
+	return erro;
+}
+
+#pragma endregion
@@ -0,0 +1,138 @@
+#pragma once
+
+/**
+ * @file delta.h
+ * @brief Leitura e aplicação em lotes de alterações ao mapa (inserir, remover e mover antenas,
+ *        ligar e desligar antenas) a partir de um ficheiro ou pipe, sem recarregar a rede
+ *
+ * Formato de cada linha (as coordenadas são linha e coluna, como em carregaGrafo):
+ *   inserir  F x y
+ *   remover  F x y
+ *   mover    F x y novoX novoY
+ *   ligar    F x1 y1 x2 y2
+ *   desligar F x1 y1 x2 y2
+ *   aplicar                      (fecha o lote atual sem esperar que fique cheio)
+ * As linhas vazias e as começadas por '#' são ignoradas.
+ *
+ * @author Rogério Picas
+ * @date 18-10-2026
+ * @version 1.0
+ *
+ */
+#include <stdio.h>
+#include "funcoes.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+ /** @def TAM_LOTE_DELTAS
+  *  @brief Número de alterações aplicadas de cada vez, por omissão.
+  */
+#define TAM_LOTE_DELTAS 256
+
+#pragma region Estruturas
+
+/**
+ * @enum TipoDelta
+ * @brief Tipo de alteração ao mapa.
+ */
+typedef enum TipoDelta {
+    DELTA_INSERIR,   /**< Inserir uma antena em (x1, y1) */
+    DELTA_REMOVER,   /**< Remover a antena de (x1, y1) e as suas ligações */
+    DELTA_MOVER,     /**< Mover a antena de (x1, y1) para (x2, y2), mantendo as ligações */
+    DELTA_LIGAR,     /**< Ligar as antenas (x1, y1) e (x2, y2) */
+    DELTA_DESLIGAR   /**< Remover a ligação entre (x1, y1) e (x2, y2) */
+} TIPO_DELTA;
+
+/**
+ * @struct Delta
+ * @brief Uma alteração ao mapa.
+ */
+typedef struct Delta {
+    TIPO_DELTA tipo;  /**< Tipo de alteração */
+    char frequencia;  /**< Frequência (grafo) a que a alteração se aplica */
+    int x1;           /**< Coordenada X da antena (ou da primeira antena) */
+    int y1;           /**< Coordenada Y da antena (ou da primeira antena) */
+    int x2;           /**< Nova coordenada X, ou coordenada X da segunda antena */
+    int y2;           /**< Nova coordenada Y, ou coordenada Y da segunda antena */
+} DELTA;
+
+/**
+ * @struct ResultadoDeltas
+ * @brief Contagens acumuladas da leitura e aplicação de alterações.
+ */
+typedef struct ResultadoDeltas {
+    long long linhas;        /**< Linhas lidas */
+    long long invalidas;     /**< Linhas com formato inválido (ignoradas) */
+    long long aplicadas;     /**< Alterações aplicadas com sucesso */
+    long long rejeitadas;    /**< Alterações válidas que não puderam ser aplicadas (ex.: antena inexistente) */
+    long long lotes;         /**< Lotes aplicados */
+} RESULTADO_DELTAS;
+
+#pragma endregion
+
+#pragma region Funções de Alterações
+
+/**
+ * @brief Interpreta uma linha de texto com uma alteração.
+ * @param linha Linha a interpretar.
+ * @param delta Apontador onde é escrita a alteração.
+ * @return 0 se a linha tiver uma alteração, 1 se for vazia ou comentário, 2 se for inválida, 3 se for "aplicar".
+ */
+int interpretarDelta(const char* linha, DELTA* delta);
+
+/**
+ * @brief Escreve uma alteração como uma linha de texto, no formato lido por interpretarDelta.
+ * @param fp Ficheiro onde escrever.
+ * @param delta Alteração a escrever.
+ * @return 0 se a escrita for bem-sucedida, 1 se os argumentos forem nulos ou a escrita falhar.
+ */
+int escreverDelta(FILE* fp, const DELTA* delta);
+
+/**
+ * @brief Lê um lote de alterações (até encher, até uma linha "aplicar" ou até ao fim do ficheiro).
+ * @param fp Ficheiro ou pipe de onde ler.
+ * @param lote Array onde são escritas as alterações.
+ * @param max Número máximo de alterações do lote.
+ * @param resultado Contagens a atualizar (pode ser NULL).
+ * @return Número de alterações lidas, ou -1 se o fim do ficheiro foi atingido sem ler nenhuma linha.
+ */
+int lerLoteDeltas(FILE* fp, DELTA* lote, int max, RESULTADO_DELTAS* resultado);
+
+/**
+ * @brief Aplica um lote de alterações à rede, pela ordem em que aparecem, com as reservas feitas de uma
+ *        só vez e uma única época da rede para todo o lote.
+ * @param rede Apontador para a rede.
+ * @param lote Alterações a aplicar, por ordem.
+ * @param num Número de alterações.
+ * @param resultado Contagens a atualizar (pode ser NULL).
+ * @return 0 se a operação for bem-sucedida, 1 se a rede ou o lote forem nulos.
+ */
+int aplicarLoteDeltas(REDE* rede, const DELTA* lote, int num, RESULTADO_DELTAS* resultado);
+
+/**
+ * @brief Lê e aplica, lote a lote, todas as alterações de um ficheiro ou pipe aberto.
+ * @param rede Apontador para a rede.
+ * @param fp Ficheiro ou pipe de onde ler.
+ * @param tamanhoLote Número máximo de alterações por lote (<= 0 usa TAM_LOTE_DELTAS).
+ * @param resultado Contagens a atualizar (pode ser NULL).
+ * @return 0 se a operação for bem-sucedida, 1 se a rede ou o ficheiro forem nulos, 2 em caso de falha de alocação.
+ */
+int processarDeltas(REDE* rede, FILE* fp, int tamanhoLote, RESULTADO_DELTAS* resultado);
+
+/**
+ * @brief Abre um ficheiro de alterações ("-" para a entrada padrão) e aplica-o à rede.
+ * @param rede Apontador para a rede.
+ * @param filename Nome do ficheiro (ou "-").
+ * @param tamanhoLote Número máximo de alterações por lote (<= 0 usa TAM_LOTE_DELTAS).
+ * @param resultado Contagens a atualizar (pode ser NULL).
+ * @return 0 se a operação for bem-sucedida, -1 se o ficheiro não puder ser aberto, ou o erro de processarDeltas.
+ */
+int carregarDeltas(REDE* rede, char* filename, int tamanhoLote, RESULTADO_DELTAS* resultado);
+
+#pragma endregion
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,460 @@
+/**
+ * @file densidade.c
+ * @brief Implementação das tabelas de somas acumuladas 2D e dos mapas de calor da densidade.
+ *
+ * @author Rogério Picas
+ * @date 18-10-2026
+ * @version 1.0
+ */
+#define _CRT_SECURE_NO_WARNINGS
+#include <stdio.h>
+#include <stdlib.h>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+#include "densidade.h"
+#include "antinodos.h"
+#include "grelha.h"
+#include "registo.h"
+
+ /** @def LIMIAR_PARALELO_DENSIDADE
+  *  @brief Número de linhas de uma tabela a partir do qual a acumulação das somas é repartida por várias threads.
+  */
+#define LIMIAR_PARALELO_DENSIDADE 512
+
+ /** @def BLOCO_COLUNAS_DENSIDADE
+  *  @brief Colunas acumuladas por cada thread de uma só vez na passagem vertical (acessos contíguos).
+  */
+#define BLOCO_COLUNAS_DENSIDADE 256
+
+#pragma region Funções Auxiliares
+
+/**
+ * @brief Soma acumulada da posição (i, j) da tabela, isto é, das células (xMin + a, yMin + b) com a < i e b < j.
+ */
+static long long somaAte(const TABELA_SOMAS* tabela, int i, int j) {
+	return tabela->somas[(size_t)i * (tabela->colunas + 1) + j];
+}
+
+/**
+ * @brief Percorre as contagens de um grafo, alargando o retângulo com contagens e somando o total.
+ *
+ * Uma só passagem pelas antenas do grafo (ou pelas células da tabela de antinodos, que é ativada
+ * se ainda não o estiver). Não é usada a grelha da rede porque esta só guarda a frequência visível
+ * de cada célula e antenas de frequências diferentes podem ocupar a mesma célula. Se @p tabela não
+ * for nula, as contagens são também acrescentadas às somas (ainda por acumular) da tabela.
+ *
+ * @param[in,out] grafo - grafo a contar.
+ * @param[in] tipo - o que é contado.
+ * @param[in,out] limites - linha e coluna mínimas e máximas com contagens (xMin, yMin, xMax, yMax).
+ * @param[in,out] total - total das contagens.
+ * @param[in,out] tabela - tabela a preencher, na posição (x - xMin + 1, y - yMin + 1), ou NULL.
+ * @return @c 0 se a operação for bem-sucedida, @c 1 se os antinodos não puderem ser calculados.
+ */
+static int percorrerContagens(GRAFO* grafo, TIPO_DENSIDADE tipo, int limites[4], long long* total, TABELA_SOMAS* tabela) {
+	const ANTINODOS* antinodos = NULL;
+	int numCelulas = 0;
+	if (tipo == DENSIDADE_ANTINODOS)
+	{
+		if (ativarAntinodos(grafo) != 0) return 1;
+		antinodos = grafo->antinodos;
+		numCelulas = antinodos->capacidade;
+	}
+
+	VERTICE* v = tipo == DENSIDADE_ANTENAS ? grafo->vertices : NULL;
+	for (int i = 0; v != NULL || i < numCelulas; i++) {
+		int x, y, contagem;
+		if (v != NULL)
+		{
+			x = v->antena.x;
+			y = v->antena.y;
+			contagem = 1;
+			v = v->prox;
+		}
+		else
+		{
+			long long celula = antinodos->celulas[i];
+			if (celula == CELULA_SEM_ANTINODO || antinodos->contagens[i] <= 0) continue;
+			x = (int)(celula / MAX_DIM);
+			y = (int)(celula % MAX_DIM);
+			contagem = antinodos->contagens[i];
+		}
+
+		if (x < limites[0]) limites[0] = x;
+		if (y < limites[1]) limites[1] = y;
+		if (x > limites[2]) limites[2] = x;
+		if (y > limites[3]) limites[3] = y;
+		*total += contagem;
+		if (tabela != NULL)
+		{
+			tabela->somas[(size_t)(x - tabela->xMin + 1) * (tabela->colunas + 1) + (y - tabela->yMin + 1)] += contagem;
+		}
+	}
+	return 0;
+}
+
+/**
+ * @brief Transforma as contagens de cada célula nas somas acumuladas, numa passagem horizontal e numa vertical.
+ *
+ * Cada linha é acumulada de forma independente e, depois, cada bloco de colunas; nas tabelas grandes
+ * as linhas e os blocos são repartidos pelas threads.
+ *
+ * @param[in,out] tabela - contagens de cada célula na entrada, somas acumuladas na saída.
+ * @param[in] numThreads - número de threads a usar (<= 0 usa o valor por omissão do OpenMP).
+ */
+static void acumularSomas(TABELA_SOMAS* tabela, int numThreads) {
+	int32_t* somas = tabela->somas;
+	int numLinhas = tabela->linhas + 1;
+	int numColunas = tabela->colunas + 1;
+
+#ifdef _OPENMP
+	if (numThreads <= 0) numThreads = omp_get_max_threads();
+#pragma omp parallel for num_threads(numThreads) if(numLinhas > LIMIAR_PARALELO_DENSIDADE)
+#else
+	(void)numThreads;
+#endif
+	for (int x = 1; x < numLinhas; x++) {
+		int32_t* linha = &somas[(size_t)x * numColunas];
+		for (int y = 1; y < numColunas; y++) linha[y] += linha[y - 1];
+	}
+
+	int numBlocos = (numColunas + BLOCO_COLUNAS_DENSIDADE - 1) / BLOCO_COLUNAS_DENSIDADE;
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(numThreads) if(numLinhas > LIMIAR_PARALELO_DENSIDADE)
+#endif
+	for (int b = 0; b < numBlocos; b++) {
+		int inicio = b * BLOCO_COLUNAS_DENSIDADE;
+		int fim = inicio + BLOCO_COLUNAS_DENSIDADE > numColunas ? numColunas : inicio + BLOCO_COLUNAS_DENSIDADE;
+		for (int x = 2; x < numLinhas; x++) {
+			int32_t* linha = &somas[(size_t)x * numColunas];
+			const int32_t* anterior = linha - numColunas;
+			for (int y = inicio; y < fim; y++) linha[y] += anterior[y];
+		}
+	}
+}
+
+#pragma endregion
+
+#pragma region Construção
+
+/**
+ * @brief Constrói a tabela de somas de uma frequência (ou de todas) da rede.
+ *
+ * Uma primeira passagem pelas antenas (ou antinodos) dos grafos contados encontra o retângulo com
+ * contagens e o total; a tabela só cobre esse retângulo, com somas de 32 bits (o total tem de caber
+ * num int32_t). A segunda passagem preenche as contagens e a acumulação custa O(linhas x colunas),
+ * repartida pelas threads nas tabelas grandes.
+ *
+ * @param[in,out] rede - rede a contar (os antinodos dos grafos são ativados se forem contados).
+ * @param[in] frequencia - frequência a contar (DENSIDADE_TODAS para todos os grafos).
+ * @param[in] tipo - o que é contado em cada célula.
+ * @param[in] numThreads - número de threads a usar (<= 0 usa o valor por omissão do OpenMP).
+ * @return Apontador para a tabela criada ou NULL em caso de erro.
+ */
+TABELA_SOMAS* criarTabelaSomas(REDE* rede, char frequencia, TIPO_DENSIDADE tipo, int numThreads) {
+	if (rede == NULL) return NULL;
+	if (frequencia != DENSIDADE_TODAS && encontrarGrafoPorFrequencia(rede, frequencia) == NULL) return NULL;
+
+	int limites[4] = { MAX_DIM, MAX_DIM, -1, -1 };
+	long long total = 0;
+	for (GRAFO* g = rede->listaGrafos; g != NULL; g = g->prox) {
+		if (frequencia != DENSIDADE_TODAS && g->frequencia != frequencia) continue;
+		if (percorrerContagens(g, tipo, limites, &total, NULL) != 0) return NULL;
+	}
+	if (total > INT32_MAX)
+	{
+		REGISTAR_AVISO("\nTotal de %lld demasiado grande para a tabela de somas.", total);
+		return NULL;
+	}
+
+	TABELA_SOMAS* tabela = (TABELA_SOMAS*)calloc(1, sizeof(TABELA_SOMAS));
+	if (tabela == NULL) return NULL;
+	tabela->frequencia = frequencia;
+	tabela->tipo = tipo;
+	tabela->total = total;
+	tabela->epoca = rede->epoca;
+	if (total > 0)
+	{
+		tabela->xMin = limites[0];
+		tabela->yMin = limites[1];
+		tabela->linhas = limites[2] - limites[0] + 1;
+		tabela->colunas = limites[3] - limites[1] + 1;
+	}
+	tabela->somas = (int32_t*)calloc((size_t)(tabela->linhas + 1) * (tabela->colunas + 1), sizeof(int32_t));
+	if (tabela->somas == NULL) return destruirTabelaSomas(tabela);
+	if (total == 0) return tabela;
+
+	total = 0;
+	for (GRAFO* g = rede->listaGrafos; g != NULL; g = g->prox) {
+		if (frequencia != DENSIDADE_TODAS && g->frequencia != frequencia) continue;
+		percorrerContagens(g, tipo, limites, &total, tabela);
+	}
+	acumularSomas(tabela, numThreads);
+	return tabela;
+}
+
+/**
+ * @brief Cria o mapa de densidade de uma rede, com a tabela do total.
+ *
+ * A tabela do total é construída numa passagem por todos os grafos; a de cada frequência só é
+ * construída quando for pedida (procurarTabelaSomas), o que evita ter em memória uma tabela por
+ * frequência numa cidade grande.
+ *
+ * @param[in,out] rede - rede a contar.
+ * @param[in] tipo - o que é contado em cada célula.
+ * @param[in] numThreads - número de threads a usar (<= 0 usa o valor por omissão do OpenMP).
+ * @return Apontador para o mapa criado ou NULL em caso de erro.
+ */
+MAPA_DENSIDADE* criarMapaDensidade(REDE* rede, TIPO_DENSIDADE tipo, int numThreads) {
+	if (rede == NULL) return NULL;
+
+	MAPA_DENSIDADE* mapa = (MAPA_DENSIDADE*)calloc(1, sizeof(MAPA_DENSIDADE));
+	if (mapa == NULL) return NULL;
+	mapa->rede = rede;
+	mapa->tipo = tipo;
+	mapa->numThreads = numThreads;
+
+	if (procurarTabelaSomas(mapa, DENSIDADE_TODAS) == NULL) return destruirMapaDensidade(mapa);
+	return mapa;
+}
+
+/**
+ * @brief Devolve a tabela de uma frequência, construindo-a se ainda não existir ou se a rede tiver mudado.
+ *
+ * @param[in,out] mapa - mapa de densidade.
+ * @param[in] frequencia - frequência procurada (DENSIDADE_TODAS devolve a tabela do total).
+ * @return Apontador para a tabela, ou NULL se a rede não tiver essa frequência ou em caso de erro.
+ */
+TABELA_SOMAS* procurarTabelaSomas(MAPA_DENSIDADE* mapa, char frequencia) {
+	if (mapa == NULL) return NULL;
+
+	TABELA_SOMAS** tabela = &mapa->tabelas[(unsigned char)frequencia];
+	if (*tabela != NULL && (*tabela)->epoca == mapa->rede->epoca) return *tabela;
+
+	*tabela = destruirTabelaSomas(*tabela);
+	*tabela = criarTabelaSomas(mapa->rede, frequencia, mapa->tipo, mapa->numThreads);
+	return *tabela;
+}
+
+/**
+ * @brief Liberta a memória de uma tabela de somas.
+ *
+ * @param tabela - apontador para a tabela a destruir.
+ * @return NULL, indicando que a tabela foi destruída.
+ */
+TABELA_SOMAS* destruirTabelaSomas(TABELA_SOMAS* tabela) {
+	if (tabela == NULL) return NULL;
+
+	free(tabela->somas);
+	free(tabela);
+	return NULL;
+}
+
+/**
+ * @brief Liberta a memória de um mapa de densidade e de todas as suas tabelas.
+ *
+ * @param mapa - apontador para o mapa a destruir.
+ * @return NULL, indicando que o mapa foi destruído.
+ */
+MAPA_DENSIDADE* destruirMapaDensidade(MAPA_DENSIDADE* mapa) {
+	if (mapa == NULL) return NULL;
+
+	for (int f = 0; f <= UCHAR_MAX; f++) destruirTabelaSomas(mapa->tabelas[f]);
+	free(mapa);
+	return NULL;
+}
+
+#pragma endregion
+
+#pragma region Consultas
+
+/**
+ * @brief Soma das contagens no retângulo [x0, x1] x [y0, y1] (inclusive), em O(1).
+ *
+ * O total é obtido com quatro leituras da tabela, por inclusão-exclusão; o retângulo é primeiro
+ * recortado ao retângulo coberto pela tabela.
+ *
+ * @param[in] tabela - tabela de somas.
+ * @param[in] x0 - primeira linha do retângulo.
+ * @param[in] y0 - primeira coluna do retângulo.
+ * @param[in] x1 - última linha do retângulo.
+ * @param[in] y1 - última coluna do retângulo.
+ * @return Total do retângulo, ou @c -1 se a tabela for nula.
+ */
+long long contarRetangulo(const TABELA_SOMAS* tabela, int x0, int y0, int x1, int y1) {
+	if (tabela == NULL) return -1;
+
+	// Fora do retângulo coberto pela tabela tudo conta 0
+	if (x0 < tabela->xMin) x0 = tabela->xMin;
+	if (y0 < tabela->yMin) y0 = tabela->yMin;
+	if (x1 >= tabela->xMin + tabela->linhas) x1 = tabela->xMin + tabela->linhas - 1;
+	if (y1 >= tabela->yMin + tabela->colunas) y1 = tabela->yMin + tabela->colunas - 1;
+	if (x0 > x1 || y0 > y1) return 0;
+
+	x0 -= tabela->xMin;
+	x1 -= tabela->xMin;
+	y0 -= tabela->yMin;
+	y1 -= tabela->yMin;
+	return somaAte(tabela, x1 + 1, y1 + 1) - somaAte(tabela, x0, y1 + 1)
+		- somaAte(tabela, x1 + 1, y0) + somaAte(tabela, x0, y0);
+}
+
+/**
+ * @brief Procura a zona de linhas x colunas células com o maior total (a primeira, em caso de empate).
+ *
+ * Cada posição da zona é avaliada em O(1) com a tabela. Só são avaliadas as posições em que a zona
+ * toca o retângulo coberto pela tabela (as restantes contam 0); as linhas de início são repartidas
+ * pelas threads e os melhores resultados de cada uma juntados no fim.
+ *
+ * @param[in] tabela - tabela de somas.
+ * @param[in] linhas - número de linhas da zona.
+ * @param[in] colunas - número de colunas da zona.
+ * @param[out] x - linha do canto superior esquerdo da zona encontrada.
+ * @param[out] y - coluna do canto superior esquerdo da zona encontrada.
+ * @param[in] numThreads - número de threads a usar (<= 0 usa o valor por omissão do OpenMP).
+ * @return Total da zona encontrada, ou @c -1 se os argumentos forem inválidos.
+ */
+long long zonaMaisDensa(const TABELA_SOMAS* tabela, int linhas, int colunas, int* x, int* y, int numThreads) {
+	if (tabela == NULL || x == NULL || y == NULL) return -1;
+	if (linhas <= 0 || colunas <= 0 || linhas > MAX_DIM || colunas > MAX_DIM) return -1;
+
+	// Sem contagens, todas as zonas valem 0 e fica a primeira
+	long long melhor = -1;
+	int melhorX = 0, melhorY = 0;
+	if (tabela->total == 0)
+	{
+		*x = *y = 0;
+		return 0;
+	}
+	int primeiraX = tabela->xMin - linhas + 1 > 0 ? tabela->xMin - linhas + 1 : 0;
+	int primeiraY = tabela->yMin - colunas + 1 > 0 ? tabela->yMin - colunas + 1 : 0;
+	int ultimaX = tabela->xMin + tabela->linhas - 1 < MAX_DIM - linhas ? tabela->xMin + tabela->linhas - 1 : MAX_DIM - linhas;
+	int ultimaY = tabela->yMin + tabela->colunas - 1 < MAX_DIM - colunas ? tabela->yMin + tabela->colunas - 1 : MAX_DIM - colunas;
+
+#ifdef _OPENMP
+	if (numThreads <= 0) numThreads = omp_get_max_threads();
+#pragma omp parallel num_threads(numThreads) if(ultimaX - primeiraX >= LIMIAR_PARALELO_DENSIDADE)
+#else
+	(void)numThreads;
+#endif
+	{
+		long long melhorLocal = -1;
+		int xLocal = 0, yLocal = 0;
+
+#ifdef _OPENMP
+#pragma omp for
+#endif
+		for (int i = primeiraX; i <= ultimaX; i++) {
+			for (int j = primeiraY; j <= ultimaY; j++) {
+				long long total = contarRetangulo(tabela, i, j, i + linhas - 1, j + colunas - 1);
+				if (total > melhorLocal) {
+					melhorLocal = total;
+					xLocal = i;
+					yLocal = j;
+				}
+			}
+		}
+
+#ifdef _OPENMP
+#pragma omp critical(juntarDensidade)
+#endif
+		{
+			// Em caso de empate fica a zona com a menor linha (e depois coluna), como numa só thread
+			if (melhorLocal > melhor || (melhorLocal == melhor && melhorLocal >= 0
+				&& (xLocal < melhorX || (xLocal == melhorX && yLocal < melhorY))))
+			{
+				melhor = melhorLocal;
+				melhorX = xLocal;
+				melhorY = yLocal;
+			}
+		}
+	}
+
+	*x = melhorX;
+	*y = melhorY;
+	return melhor;
+}
+
+/**
+ * @brief Mostra o mapa de calor de uma região (cada caractere representa escala x escala células).
+ *
+ * O total de cada zona sai da tabela em O(1), pelo que o custo só depende do tamanho do mapa
+ * mostrado e não do número de antenas. São feitas duas passagens: a primeira encontra o total
+ * da zona mais densa, que define a escala dos níveis. Como o mapa da cidade (mostrarRegiaoRede),
+ * é escrito diretamente em @p fp, uma linha de cada vez, e não passa pelo registo.
+ *
+ * @param[in] tabela - tabela de somas.
+ * @param[in] fp - ficheiro de destino (ex.: stdout).
+ * @param[in] x0 - primeira linha da região.
+ * @param[in] y0 - primeira coluna da região.
+ * @param[in] linhas - número de linhas da cidade a mostrar.
+ * @param[in] colunas - número de colunas da cidade a mostrar.
+ * @param[in] escala - lado (em células) da zona representada por cada caractere.
+ * @return @c 0 se a operação for bem-sucedida, @c 1 em caso de erro nos argumentos, @c 2 se a escrita falhar.
+ */
+int mostrarMapaCalor(const TABELA_SOMAS* tabela, FILE* fp, int x0, int y0, int linhas, int colunas, int escala) {
+	static const char niveis[] = ":-=+*#%@";
+	if (tabela == NULL || fp == NULL) return 1;
+	if (linhas <= 0 || colunas <= 0 || escala <= 0) return 1;
+
+	if (x0 < 0) x0 = 0;
+	if (y0 < 0) y0 = 0;
+	int x1 = x0 + linhas > MAX_DIM ? MAX_DIM : x0 + linhas;
+	int y1 = y0 + colunas > MAX_DIM ? MAX_DIM : y0 + colunas;
+	if (x0 >= x1 || y0 >= y1) return 1;
+
+	int largura = (y1 - y0 + escala - 1) / escala;
+	char* linha = (char*)malloc((size_t)largura + 1);
+	if (linha == NULL) return 1;
+
+	long long maximo = 0;
+	for (int x = x0; x < x1; x += escala) {
+		for (int y = y0; y < y1; y += escala) {
+			int xFim = x + escala > x1 ? x1 : x + escala;
+			int yFim = y + escala > y1 ? y1 : y + escala;
+			long long total = contarRetangulo(tabela, x, y, xFim - 1, yFim - 1);
+			if (total > maximo) maximo = total;
+		}
+	}
+
+	for (int x = x0; x < x1; x += escala) {
+		for (int j = 0; j < largura; j++) {
+			int y = y0 + j * escala;
+			int xFim = x + escala > x1 ? x1 : x + escala;
+			int yFim = y + escala > y1 ? y1 : y + escala;
+			long long total = contarRetangulo(tabela, x, y, xFim - 1, yFim - 1);
+			linha[j] = total > 0 ? niveis[(total * 8 - 1) / maximo] : CELULA_LIVRE;
+		}
+		linha[largura] = '\n';
+		if (fwrite(linha, 1, (size_t)largura + 1, fp) != (size_t)largura + 1)
+		{
+			free(linha);
+			return 2;
+		}
+	}
+
+	free(linha);
+	return 0;
+}
+
+/**
+ * @brief Escreve o total de cada zona de escala x escala células da cidade em CSV.
+ *
+ * @param[in] tabela - tabela de somas.
+ * @param[in] fp - ficheiro de destino.
+ * @param[in] escala - lado (em células) de cada zona.
+ * @return @c 0 se a operação for bem-sucedida, @c 1 em caso de erro.
+ */
+int escreverMapaCalor(const TABELA_SOMAS* tabela, FILE* fp, int escala) {
+	if (tabela == NULL || fp == NULL || escala <= 0) return 1;
+
+	for (int x = 0; x < MAX_DIM; x += escala) {
+		for (int y = 0; y < MAX_DIM; y += escala) {
+			fprintf(fp, y == 0 ? "%lld" : ",%lld", contarRetangulo(tabela, x, y, x + escala - 1, y + escala - 1));
+		}
+		fputc('\n', fp);
+	}
+	return ferror(fp) ? 1 : 0;
+}
+
+#pragma endregion
@@ -0,0 +1,179 @@
+#pragma once
+
+/**
+ * @file densidade.h
+ * @brief Tabelas de somas acumuladas 2D (summed-area tables) por frequência: número de antenas ou
+ *        de efeitos nefastos em qualquer retângulo da cidade em O(1) e mapas de calor da densidade
+ *
+ * Cada tabela é uma fotografia da rede no momento em que foi construída: guarda a época da rede
+ * (funcoes.h) e tem de ser reconstruída quando @c rede->epoca for diferente.
+ *
+ * @author Rogério Picas
+ * @date 18-10-2026
+ * @version 1.0
+ *
+ */
+#include <stdio.h>
+#include <stdint.h>
+#include <limits.h>
+#include "funcoes.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+ /** @def DENSIDADE_TODAS
+  *  @brief Frequência das tabelas que somam todos os grafos da rede.
+  */
+#define DENSIDADE_TODAS '\0'
+
+#pragma region Estruturas
+
+/**
+ * @enum TipoDensidade
+ * @brief O que é contado em cada célula.
+ */
+typedef enum TipoDensidade {
+    DENSIDADE_ANTENAS,   /**< Número de antenas na célula */
+    DENSIDADE_ANTINODOS  /**< Número de pares de antenas com efeito nefasto na célula (antinodos.h) */
+} TIPO_DENSIDADE;
+
+/**
+ * @struct TabelaSomas
+ * @brief Somas acumuladas das contagens de uma frequência (ou de todas).
+ *
+ * A tabela só cobre o menor retângulo da cidade com contagens (linhas x colunas células a partir de
+ * (xMin, yMin)); fora dele tudo conta 0. somas[(i + 1) * (colunas + 1) + (j + 1)] é o total das
+ * células (xMin + a, yMin + b) com a <= i e b <= j; a primeira linha e a primeira coluna são 0, o
+ * que evita casos especiais nas consultas.
+ */
+typedef struct TabelaSomas {
+    char frequencia;          /**< Frequência contada (DENSIDADE_TODAS para todos os grafos) */
+    TIPO_DENSIDADE tipo;      /**< O que é contado */
+    long long total;          /**< Total de toda a cidade */
+    int xMin;                 /**< Primeira linha com contagens */
+    int yMin;                 /**< Primeira coluna com contagens */
+    int linhas;               /**< Número de linhas cobertas (0 se não houver contagens) */
+    int colunas;              /**< Número de colunas cobertas (0 se não houver contagens) */
+    int32_t* somas;           /**< (linhas + 1) * (colunas + 1) somas acumuladas */
+    unsigned long long epoca; /**< Época da rede quando a tabela foi construída */
+} TABELA_SOMAS;
+
+/**
+ * @struct MapaDensidade
+ * @brief Tabelas de uma rede, uma por frequência e a de todas as frequências, construídas à medida que são pedidas.
+ *
+ * Só a tabela de todas as frequências é construída com o mapa; as restantes são construídas na
+ * primeira consulta e reconstruídas quando a época da rede muda. O mapa não é thread-safe.
+ */
+typedef struct MapaDensidade {
+    REDE* rede;                             /**< Rede contada */
+    TIPO_DENSIDADE tipo;                    /**< O que é contado */
+    int numThreads;                         /**< Threads usadas na construção das tabelas */
+    TABELA_SOMAS* tabelas[UCHAR_MAX + 1];   /**< Tabela de cada frequência (NULL se ainda não foi pedida); a posição DENSIDADE_TODAS tem o total */
+} MAPA_DENSIDADE;
+
+#pragma endregion
+
+#pragma region Construção
+
+/**
+ * @brief Constrói a tabela de somas de uma frequência (ou de todas) da rede.
+ * @param rede Apontador para a rede.
+ * @param frequencia Frequência a contar (DENSIDADE_TODAS para todos os grafos).
+ * @param tipo O que é contado em cada célula.
+ * @param numThreads Número de threads a usar (<= 0 usa o valor por omissão do OpenMP; ignorado sem OpenMP).
+ * @return Apontador para a tabela criada ou NULL em caso de erro (incluindo uma frequência sem grafo
+ *         ou um total que não cabe em 32 bits).
+ */
+TABELA_SOMAS* criarTabelaSomas(REDE* rede, char frequencia, TIPO_DENSIDADE tipo, int numThreads);
+
+/**
+ * @brief Cria o mapa de densidade de uma rede, com a tabela do total (as restantes são construídas quando forem pedidas).
+ * @param rede Apontador para a rede.
+ * @param tipo O que é contado em cada célula.
+ * @param numThreads Número de threads a usar (<= 0 usa o valor por omissão do OpenMP; ignorado sem OpenMP).
+ * @return Apontador para o mapa criado ou NULL em caso de erro.
+ */
+MAPA_DENSIDADE* criarMapaDensidade(REDE* rede, TIPO_DENSIDADE tipo, int numThreads);
+
+/**
+ * @brief Devolve a tabela de uma frequência, construindo-a se ainda não existir ou se a rede tiver mudado.
+ * @param mapa Apontador para o mapa.
+ * @param frequencia Frequência procurada (DENSIDADE_TODAS devolve a tabela do total).
+ * @return Apontador para a tabela (pertence ao mapa), ou NULL se a rede não tiver essa frequência ou em caso de erro.
+ */
+TABELA_SOMAS* procurarTabelaSomas(MAPA_DENSIDADE* mapa, char frequencia);
+
+/**
+ * @brief Liberta a memória de uma tabela de somas.
+ * @param tabela Apontador para a tabela a destruir.
+ * @return NULL, indicando que a tabela foi destruída.
+ */
+TABELA_SOMAS* destruirTabelaSomas(TABELA_SOMAS* tabela);
+
+/**
+ * @brief Liberta a memória de um mapa de densidade e de todas as suas tabelas.
+ * @param mapa Apontador para o mapa a destruir.
+ * @return NULL, indicando que o mapa foi destruído.
+ */
+MAPA_DENSIDADE* destruirMapaDensidade(MAPA_DENSIDADE* mapa);
+
+#pragma endregion
+
+#pragma region Consultas
+
+/**
+ * @brief Soma das contagens no retângulo [x0, x1] x [y0, y1] (inclusive), em O(1).
+ * @param tabela Apontador para a tabela.
+ * @param x0 Primeira linha do retângulo.
+ * @param y0 Primeira coluna do retângulo.
+ * @param x1 Última linha do retângulo.
+ * @param y1 Última coluna do retângulo.
+ * @return Total do retângulo (a parte fora da cidade conta 0), ou -1 se a tabela for nula.
+ */
+long long contarRetangulo(const TABELA_SOMAS* tabela, int x0, int y0, int x1, int y1);
+
+/**
+ * @brief Procura a zona de linhas x colunas células com o maior total (a primeira, em caso de empate).
+ * @param tabela Apontador para a tabela.
+ * @param linhas Número de linhas da zona.
+ * @param colunas Número de colunas da zona.
+ * @param x Linha do canto superior esquerdo da zona encontrada.
+ * @param y Coluna do canto superior esquerdo da zona encontrada.
+ * @param numThreads Número de threads a usar (<= 0 usa o valor por omissão do OpenMP; ignorado sem OpenMP).
+ * @return Total da zona encontrada, ou -1 se os argumentos forem inválidos.
+ */
+long long zonaMaisDensa(const TABELA_SOMAS* tabela, int linhas, int colunas, int* x, int* y, int numThreads);
+
+/**
+ * @brief Mostra o mapa de calor de uma região (cada caractere representa escala x escala células).
+ *
+ * As zonas sem contagens aparecem como CELULA_LIVRE e as restantes com um de oito níveis
+ * (":-=+*#%@"), proporcionais ao total da zona mais densa da região.
+ *
+ * @param tabela Apontador para a tabela.
+ * @param fp Ficheiro de destino (ex.: stdout).
+ * @param x0 Primeira linha da região.
+ * @param y0 Primeira coluna da região.
+ * @param linhas Número de linhas da cidade a mostrar.
+ * @param colunas Número de colunas da cidade a mostrar.
+ * @param escala Lado (em células) da zona representada por cada caractere (1 = sem redução).
+ * @return 0 se a operação for bem-sucedida, 1 em caso de erro nos argumentos, 2 se a escrita falhar.
+ */
+int mostrarMapaCalor(const TABELA_SOMAS* tabela, FILE* fp, int x0, int y0, int linhas, int colunas, int escala);
+
+/**
+ * @brief Escreve o total de cada zona de escala x escala células da cidade em CSV (uma linha da cidade reduzida por linha).
+ * @param tabela Apontador para a tabela.
+ * @param fp Ficheiro de destino.
+ * @param escala Lado (em células) de cada zona.
+ * @return 0 se a operação for bem-sucedida, 1 em caso de erro.
+ */
+int escreverMapaCalor(const TABELA_SOMAS* tabela, FILE* fp, int escala);
+
+#pragma endregion
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,409 @@
+/**
+ * @file diario.c
+ * @brief Implementação do diário de alterações da rede (acrescentos, compactação e reprodução).
+ *
+ * @author Rogério Picas
+ * @date 18-10-2026
+ * @version 1.0
+ */
+#define _CRT_SECURE_NO_WARNINGS
+#ifndef _WIN32
+#define _POSIX_C_SOURCE 200809L
+#endif
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "diario.h"
+
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+#pragma region Funções Auxiliares
+
+/**
+ * @brief Junta o nome base e uma extensão num nome de ficheiro alocado.
+ */
+static char* juntarNome(const char* base, const char* extensao) {
+	size_t tamanho = strlen(base) + strlen(extensao) + 1;
+	char* nome = (char*)malloc(tamanho);
+	if (nome) snprintf(nome, tamanho, "%s%s", base, extensao);
+	return nome;
+}
+
+/**
+ * @brief Passa para o sistema operativo o que está no buffer do ficheiro e, se pedido, força a escrita no disco.
+ *
+ * @return @c 0 em caso de sucesso, @c 1 se alguma das operações falhar.
+ */
+static int descarregarFicheiro(FILE* fp, bool sincronizar) {
+	if (fflush(fp) != 0) return 1;
+	if (!sincronizar) return 0;
+#ifdef _WIN32
+	return _commit(_fileno(fp)) == 0 ? 0 : 1;
+#else
+	return fsync(fileno(fp)) == 0 ? 0 : 1;
+#endif
+}
+
+/**
+ * @brief Lê o cabeçalho "# geracao N" no início de um ficheiro.
+ *
+ * Um ficheiro sem cabeçalho (ex.: escrito à mão) é tratado como geração 0 e lido desde o início.
+ *
+ * @return geração indicada no cabeçalho, ou 0 se não existir.
+ */
+static long long lerGeracao(FILE* fp) {
+	char linha[64];
+	long long geracao;
+	if (fgets(linha, sizeof(linha), fp) != NULL && sscanf(linha, "# geracao %lld", &geracao) == 1)
+	{
+		return geracao;
+	}
+	rewind(fp);
+	return 0;
+}
+
+/**
+ * @brief Aplica à rede, por lotes, as alterações de um ficheiro de estado ou de diário.
+ *
+ * Ao contrário de @c processarDeltas, uma última linha sem '\n' não é aplicada: é o que fica
+ * de uma escrita interrompida, e pode parecer uma alteração válida diferente da original
+ * (ex.: "inserir A 1 2" cortada de "inserir A 1 23").
+ *
+ * @param[in,out] rede - apontador para a rede.
+ * @param[in] fp - ficheiro a reproduzir (depois do cabeçalho).
+ * @param[in,out] resultado - contagens a atualizar (pode ser NULL).
+ * @param[out] cortado - true se a última linha estava incompleta.
+ *
+ * @return número de alterações lidas, ou -1 se a alocação falhar.
+ */
+static long long reproduzirFicheiro(REDE* rede, FILE* fp, RESULTADO_DELTAS* resultado, bool* cortado) {
+	DELTA* lote = (DELTA*)malloc(TAM_LOTE_DELTAS * sizeof(DELTA));
+	if (lote == NULL) return -1;
+
+	char linha[256];
+	int num = 0;
+	long long lidas = 0;
+	*cortado = false;
+	while (fgets(linha, sizeof(linha), fp) != NULL) {
+		size_t comprimento = strlen(linha);
+		if (comprimento == 0 || linha[comprimento - 1] != '\n')
+		{
+			if (comprimento < sizeof(linha) - 1 || feof(fp))
+			{
+				*cortado = true;
+				break;
+			}
+			// Linha demasiado longa: descarta o resto e considera-a inválida
+			int ch;
+			while ((ch = fgetc(fp)) != EOF && ch != '\n');
+			if (resultado)
+			{
+				resultado->linhas++;
+				resultado->invalidas++;
+			}
+			if (ch == EOF)
+			{
+				*cortado = true;
+				break;
+			}
+			continue;
+		}
+		if (resultado) resultado->linhas++;
+
+		int tipo = interpretarDelta(linha, &lote[num]);
+		if (tipo == 0)
+		{
+			lidas++;
+			if (++num == TAM_LOTE_DELTAS)
+			{
+				aplicarLoteDeltas(rede, lote, num, resultado);
+				num = 0;
+			}
+		}
+		else if (tipo == 2 && resultado)
+		{
+			resultado->invalidas++;
+		}
+	}
+	if (num > 0)
+	{
+		aplicarLoteDeltas(rede, lote, num, resultado);
+	}
+	free(lote);
+	return lidas;
+}
+
+/**
+ * @brief Escreve o estado completo da rede: uma linha "inserir" por antena e uma "ligar" por ligação.
+ *
+ * Os grafos e os vértices são escritos do fim para o início das listas, para que a reprodução
+ * (que insere sempre no início) volte a pôr as listas pela mesma ordem. Cada ligação tem uma
+ * aresta em cada sentido e só é escrita pela aresta de menor endereço, o que também funciona
+ * com as ligações de uma antena a si própria e com as ligações repetidas.
+ *
+ * @return @c 0 em caso de sucesso, @c 1 se a escrita falhar.
+ */
+static int escreverEstado(FILE* fp, REDE* rede) {
+	int numGrafos = 0;
+	for (GRAFO* g = rede->listaGrafos; g != NULL; g = g->prox) {
+		numGrafos++;
+	}
+	GRAFO** grafos = (GRAFO**)malloc((size_t)(numGrafos > 0 ? numGrafos : 1) * sizeof(GRAFO*));
+	if (grafos == NULL) return 1;
+	int i = numGrafos;
+	for (GRAFO* g = rede->listaGrafos; g != NULL; g = g->prox) {
+		grafos[--i] = g;
+	}
+
+	int erro = 0;
+	DELTA delta;
+	for (i = 0; i < numGrafos && !erro; i++) {
+		delta.tipo = DELTA_INSERIR;
+		delta.frequencia = grafos[i]->frequencia;
+		delta.x2 = delta.y2 = -1;
+
+		VERTICE* ultimo = grafos[i]->vertices;
+		while (ultimo && ultimo->prox) ultimo = ultimo->prox;
+		for (VERTICE* v = ultimo; v != NULL && !erro; v = v->ant) {
+			delta.x1 = v->antena.x;
+			delta.y1 = v->antena.y;
+			erro = escreverDelta(fp, &delta);
+		}
+
+		delta.tipo = DELTA_LIGAR;
+		for (VERTICE* v = ultimo; v != NULL && !erro; v = v->ant) {
+			for (ARESTA* adj = v->adjacentes; adj != NULL && !erro; adj = adj->prox) {
+				if ((uintptr_t)adj > (uintptr_t)adj->inversa) continue;
+				delta.x1 = v->antena.x;
+				delta.y1 = v->antena.y;
+				delta.x2 = adj->destino->antena.x;
+				delta.y2 = adj->destino->antena.y;
+				erro = escreverDelta(fp, &delta);
+			}
+		}
+	}
+	free(grafos);
+	return erro;
+}
+
+/**
+ * @brief Cria (ou esvazia) o ficheiro do diário com o cabeçalho da geração atual e deixa-o aberto.
+ *
+ * @return @c 0 em caso de sucesso, @c 1 se o ficheiro não puder ser escrito.
+ */
+static int recomecarDiario(DIARIO* diario) {
+	diario->fp = fopen(diario->ficheiroDiario, "w");
+	if (diario->fp == NULL) return 1;
+	if (fprintf(diario->fp, "# geracao %lld\n", diario->geracao) < 0 ||
+		descarregarFicheiro(diario->fp, diario->sincronizar) != 0)
+	{
+		return 1;
+	}
+	diario->registos = 0;
+	return 0;
+}
+
+#pragma endregion
+
+#pragma region Funções do Diário
+
+/**
+ * @brief Reconstrói a rede a partir do estado e do diário guardados e abre o diário para acrescentar.
+ *
+ * O estado é reproduzido primeiro; o diário só é reproduzido se for da mesma geração. Se o
+ * diário for de outra geração ou acabar numa linha incompleta, é feita logo uma compactação,
+ * para que as alterações seguintes não fiquem a seguir a uma linha cortada. Se nenhum dos
+ * ficheiros existir, é criado um diário vazio.
+ *
+ * @param[in,out] rede - apontador para a rede (normalmente vazia).
+ * @param[in] base - nome base dos ficheiros.
+ * @param[in] limiteCompactacao - alterações a partir das quais aplicarDiario compacta
+ *            (< 0 usa LIMITE_COMPACTACAO_DIARIO, 0 desativa a compactação automática).
+ * @param[in,out] resultado - contagens da reprodução (pode ser NULL).
+ *
+ * @return apontador para o diário aberto, ou NULL se os argumentos forem nulos, a alocação
+ *         falhar ou o diário não puder ser escrito.
+ */
+DIARIO* abrirDiario(REDE* rede, const char* base, long long limiteCompactacao, RESULTADO_DELTAS* resultado) {
+	if (rede == NULL || base == NULL) return NULL;
+
+	DIARIO* diario = (DIARIO*)calloc(1, sizeof(DIARIO));
+	if (diario == NULL) return NULL;
+	diario->ficheiroDiario = juntarNome(base, ".diario");
+	diario->ficheiroEstado = juntarNome(base, ".estado");
+	diario->limiteCompactacao = limiteCompactacao < 0 ? LIMITE_COMPACTACAO_DIARIO : limiteCompactacao;
+	if (diario->ficheiroDiario == NULL || diario->ficheiroEstado == NULL)
+	{
+		return fecharDiario(diario);
+	}
+
+	bool cortado = false;
+	bool compactar = false;
+	FILE* fp = fopen(diario->ficheiroEstado, "r");
+	if (fp)
+	{
+		diario->geracao = lerGeracao(fp);
+		long long lidas = reproduzirFicheiro(rede, fp, resultado, &cortado);
+		fclose(fp);
+		if (lidas < 0) return fecharDiario(diario);
+		compactar = cortado;
+	}
+
+	fp = fopen(diario->ficheiroDiario, "r");
+	bool existeDiario = fp != NULL;
+	if (fp)
+	{
+		if (lerGeracao(fp) == diario->geracao)
+		{
+			diario->registos = reproduzirFicheiro(rede, fp, resultado, &cortado);
+			compactar = compactar || cortado;
+		}
+		else
+		{
+			// Diário de uma geração já incluída no estado (compactação interrompida)
+			compactar = true;
+		}
+		fclose(fp);
+		if (diario->registos < 0) return fecharDiario(diario);
+	}
+
+	if (compactar)
+	{
+		if (compactarDiario(diario, rede) != 0) return fecharDiario(diario);
+	}
+	else if (existeDiario)
+	{
+		diario->fp = fopen(diario->ficheiroDiario, "a");
+	}
+	else if (recomecarDiario(diario) != 0)
+	{
+		return fecharDiario(diario);
+	}
+
+	if (diario->fp == NULL) return fecharDiario(diario);
+	return diario;
+}
+
+/**
+ * @brief Acrescenta uma alteração ao diário, numa só linha, e passa-a ao sistema operativo.
+ *
+ * @param[in,out] diario - apontador para o diário.
+ * @param[in] delta - alteração a registar.
+ *
+ * @return @c 0 em caso de sucesso, @c 1 se algum apontador for nulo, @c 2 se a escrita falhar.
+ */
+int registarDiario(DIARIO* diario, const DELTA* delta) {
+	if (diario == NULL || diario->fp == NULL || delta == NULL) return 1;
+
+	if (escreverDelta(diario->fp, delta) != 0 || descarregarFicheiro(diario->fp, diario->sincronizar) != 0)
+	{
+		return 2;
+	}
+	diario->registos++;
+	return 0;
+}
+
+/**
+ * @brief Aplica uma alteração à rede e regista-a no diário se tiver sido aceite.
+ *
+ * As alterações rejeitadas (ex.: ligar uma antena inexistente) não são registadas, para que a
+ * reprodução do diário não tenha de as voltar a rejeitar. Quando o diário chega ao limite de
+ * compactação, o estado completo é escrito e o diário recomeça vazio.
+ *
+ * @param[in,out] diario - apontador para o diário.
+ * @param[in,out] rede - apontador para a rede.
+ * @param[in] delta - alteração a aplicar.
+ *
+ * @return @c 0 se a alteração foi aplicada e registada, @c 1 se algum apontador for nulo,
+ *         @c 2 se a alteração foi rejeitada, @c 3 se a escrita do diário ou a compactação falhar.
+ */
+int aplicarDiario(DIARIO* diario, REDE* rede, const DELTA* delta) {
+	if (diario == NULL || rede == NULL || delta == NULL) return 1;
+
+	RESULTADO_DELTAS resultado = { 0 };
+	aplicarLoteDeltas(rede, delta, 1, &resultado);
+	if (resultado.aplicadas == 0) return 2;
+
+	if (registarDiario(diario, delta) != 0) return 3;
+	if (diario->limiteCompactacao > 0 && diario->registos >= diario->limiteCompactacao)
+	{
+		if (compactarDiario(diario, rede) != 0) return 3;
+	}
+	return 0;
+}
+
+/**
+ * @brief Escreve o estado completo da rede numa nova geração e recomeça o diário vazio.
+ *
+ * O estado é escrito em "<base>.estado.tmp" e só depois passa a ser o estado guardado; se
+ * a escrita falhar, o estado e o diário anteriores continuam válidos e o diário continua aberto.
+ *
+ * @param[in,out] diario - apontador para o diário.
+ * @param[in] rede - apontador para a rede.
+ *
+ * @return @c 0 em caso de sucesso, @c 1 se algum apontador for nulo, @c 2 se a escrita falhar.
+ */
+int compactarDiario(DIARIO* diario, REDE* rede) {
+	if (diario == NULL || rede == NULL) return 1;
+
+	char* temporario = juntarNome(diario->ficheiroEstado, ".tmp");
+	if (temporario == NULL) return 2;
+	FILE* fp = fopen(temporario, "w");
+	if (fp == NULL)
+	{
+		free(temporario);
+		return 2;
+	}
+	int erro = fprintf(fp, "# geracao %lld\n", diario->geracao + 1) < 0 ||
+		escreverEstado(fp, rede) != 0 ||
+		descarregarFicheiro(fp, diario->sincronizar) != 0;
+	if (fclose(fp) != 0) erro = 1;
+
+	if (!erro)
+	{
+		if (diario->fp) fclose(diario->fp);
+		diario->fp = NULL;
+#ifdef _WIN32
+		remove(diario->ficheiroEstado);	// no Windows o rename não substitui um ficheiro existente
+#endif
+		erro = rename(temporario, diario->ficheiroEstado) != 0;
+		if (!erro) diario->geracao++;
+	}
+	free(temporario);
+
+	if (diario->fp == NULL)
+	{
+		// A partir daqui o diário antigo (de outra geração) é ignorado na reprodução
+		if (erro)
+		{
+			diario->fp = fopen(diario->ficheiroDiario, "a");
+			return 2;
+		}
+		if (recomecarDiario(diario) != 0) return 2;
+	}
+	return erro ? 2 : 0;
+}
+
+/**
+ * @brief Fecha o ficheiro do diário e liberta a memória.
+ *
+ * @param[in] diario - apontador para o diário (pode ser NULL).
+ *
+ * @return NULL, indicando que o diário foi fechado.
+ */
+DIARIO* fecharDiario(DIARIO* diario) {
+	if (diario == NULL) return NULL;
+
+	if (diario->fp) fclose(diario->fp);
+	free(diario->ficheiroDiario);
+	free(diario->ficheiroEstado);
+	free(diario);
+	return NULL;
+}
+
+#pragma endregion
@@ -0,0 +1,105 @@
+#pragma once
+
+/**
+ * @file diario.h
+ * @brief Diário (journal) das alterações à rede, só com acrescentos, compactado periodicamente
+ *        num ficheiro com o estado completo e reproduzido no arranque
+ *
+ * O estado persistido é formado por dois ficheiros de texto no formato das alterações (delta.h):
+ *   <base>.estado  o estado completo na última compactação (uma linha "inserir" por antena e
+ *                  uma linha "ligar" por ligação);
+ *   <base>.diario  as alterações aplicadas desde essa compactação, uma linha por alteração.
+ * Os dois começam com o comentário "# geracao N": o diário só é reproduzido se tiver a mesma
+ * geração do estado, pelo que uma compactação interrompida entre a escrita do estado e a
+ * limpeza do diário não aplica as mesmas alterações duas vezes. O estado é escrito num ficheiro
+ * temporário e só depois toma o lugar do anterior.
+ *
+ * Guardar uma alteração custa uma linha acrescentada ao diário; a última linha de um diário
+ * interrompido a meio da escrita (sem '\n') é ignorada na reprodução.
+ *
+ * @author Rogério Picas
+ * @date 18-10-2026
+ * @version 1.0
+ *
+ */
+#include <stdio.h>
+#include "funcoes.h"
+#include "delta.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+ /** @def LIMITE_COMPACTACAO_DIARIO
+  *  @brief Número de alterações no diário a partir do qual é feita uma compactação, por omissão.
+  */
+#define LIMITE_COMPACTACAO_DIARIO 65536
+
+#pragma region Estruturas
+
+/**
+ * @struct Diario
+ * @brief Diário aberto para acrescentar alterações.
+ */
+typedef struct Diario {
+    FILE* fp;                  /**< Ficheiro do diário, aberto para acrescentar */
+    char* ficheiroDiario;      /**< Nome do ficheiro do diário (<base>.diario) */
+    char* ficheiroEstado;      /**< Nome do ficheiro do estado (<base>.estado) */
+    long long geracao;         /**< Geração do estado e do diário atuais */
+    long long registos;        /**< Alterações escritas no diário desde a última compactação */
+    long long limiteCompactacao; /**< Alterações a partir das quais aplicarDiario compacta (0 = só manualmente) */
+    bool sincronizar;          /**< true para forçar a escrita no disco (fsync) a cada alteração */
+} DIARIO;
+
+#pragma endregion
+
+#pragma region Funções do Diário
+
+/**
+ * @brief Reproduz o estado e o diário guardados na rede (vazia) e abre o diário para novas alterações.
+ * @param rede Apontador para a rede onde o estado é reconstruído.
+ * @param base Nome base dos ficheiros (sem extensão).
+ * @param limiteCompactacao Alterações a partir das quais o diário é compactado (< 0 usa LIMITE_COMPACTACAO_DIARIO, 0 = só manualmente).
+ * @param resultado Contagens da reprodução (pode ser NULL).
+ * @return Apontador para o diário aberto ou NULL em caso de erro.
+ */
+DIARIO* abrirDiario(REDE* rede, const char* base, long long limiteCompactacao, RESULTADO_DELTAS* resultado);
+
+/**
+ * @brief Acrescenta uma alteração ao diário (sem a aplicar).
+ * @param diario Apontador para o diário.
+ * @param delta Alteração a registar.
+ * @return 0 se a operação for bem-sucedida, 1 se os argumentos forem nulos e 2 se a escrita falhar.
+ */
+int registarDiario(DIARIO* diario, const DELTA* delta);
+
+/**
+ * @brief Aplica uma alteração à rede e, se for aceite, regista-a no diário (compactando ao chegar ao limite).
+ * @param diario Apontador para o diário.
+ * @param rede Apontador para a rede.
+ * @param delta Alteração a aplicar.
+ * @return 0 se a alteração foi aplicada e registada, 1 se os argumentos forem nulos,
+ *         2 se a alteração foi rejeitada pela rede (nada é registado) e 3 se a escrita falhar.
+ */
+int aplicarDiario(DIARIO* diario, REDE* rede, const DELTA* delta);
+
+/**
+ * @brief Escreve o estado completo da rede numa nova geração e começa um diário vazio.
+ * @param diario Apontador para o diário.
+ * @param rede Apontador para a rede.
+ * @return 0 se a operação for bem-sucedida, 1 se os argumentos forem nulos e 2 se a escrita falhar.
+ */
+int compactarDiario(DIARIO* diario, REDE* rede);
+
+/**
+ * @brief Fecha o diário e liberta a memória (os ficheiros ficam no disco).
+ * @param diario Apontador para o diário a fechar.
+ * @return NULL, indicando que o diário foi fechado.
+ */
+DIARIO* fecharDiario(DIARIO* diario);
+
+#pragma endregion
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,399 @@
+/**
+ * @file espacial.c
+ * @brief Implementação do índice espacial em grelha uniforme de baldes e das respetivas consultas.
+ *
+ * @author Rogério Picas
+ * @date 18-10-2026
+ * @version 1.0
+ */
+#define _CRT_SECURE_NO_WARNINGS
+#include <stdio.h>
+#include <stdlib.h>
+#include <limits.h>
+#include "espacial.h"
+
+#pragma region Funções do Índice Espacial
+
+/**
+ * @brief Cria um índice espacial vazio que cobre toda a matriz da cidade.
+ *
+ * A cidade é dividida em baldes quadrados de lado @p ladoBalde. Os baldes começam
+ * vazios e os respetivos arrays só são alocados quando recebem o primeiro vértice.
+ *
+ * @param ladoBalde - lado (em células) de cada balde; valores <= 0 usam TAM_BALDE.
+ *
+ * @return apontador para o índice criado, ou NULL se a alocação de memória falhar.
+ */
+INDICE_ESPACIAL* criarIndiceEspacial(int ladoBalde) {
+	if (ladoBalde <= 0) ladoBalde = TAM_BALDE;
+
+	INDICE_ESPACIAL* indice = (INDICE_ESPACIAL*)malloc(sizeof(INDICE_ESPACIAL));
+	if (indice == NULL) return NULL;
+
+	indice->ladoBalde = ladoBalde;
+	indice->baldesPorLado = (MAX_DIM + ladoBalde - 1) / ladoBalde;
+	indice->numVertices = 0;
+	indice->baldes = (BALDE*)calloc((size_t)indice->baldesPorLado * indice->baldesPorLado, sizeof(BALDE));
+	if (indice->baldes == NULL)
+	{
+		free(indice);
+		return NULL;
+	}
+	return indice;
+}
+
+/**
+ * @brief Devolve o balde que contém a célula (x, y).
+ *
+ * @param[in] indice - apontador para o índice espacial.
+ * @param[in] x - coordenada X da célula.
+ * @param[in] y - coordenada Y da célula.
+ *
+ * @return apontador para o balde, ou NULL se o índice for nulo ou a célula estiver fora da cidade.
+ */
+BALDE* obterBalde(INDICE_ESPACIAL* indice, int x, int y) {
+	if (indice == NULL) return NULL;
+	if (x < 0 || x >= MAX_DIM || y < 0 || y >= MAX_DIM) return NULL;
+
+	return &indice->baldes[(x / indice->ladoBalde) * indice->baldesPorLado + (y / indice->ladoBalde)];
+}
+
+/**
+ * @brief Insere um vértice no balde correspondente às coordenadas da sua antena.
+ *
+ * O array do balde cresce para o dobro sempre que fica cheio.
+ *
+ * @param[in,out] indice - apontador para o índice espacial.
+ * @param[in] grafo - apontador para o grafo que contém o vértice.
+ * @param[in] vertice - apontador para o vértice a inserir.
+ *
+ * @return @c 0 se a inserção for bem-sucedida,
+ *         @c 1 se algum apontador for nulo, a posição estiver fora da cidade ou a alocação falhar.
+ */
+int inserirIndiceEspacial(INDICE_ESPACIAL* indice, GRAFO* grafo, VERTICE* vertice) {
+	if (indice == NULL || vertice == NULL) return 1;
+
+	BALDE* balde = obterBalde(indice, vertice->antena.x, vertice->antena.y);
+	if (balde == NULL) return 1;
+
+	if (balde->numEntradas == balde->capacidade)
+	{
+		int novaCapacidade = balde->capacidade ? balde->capacidade * 2 : 4;
+		ENTRADA_INDICE* novo = (ENTRADA_INDICE*)realloc(balde->entradas, (size_t)novaCapacidade * sizeof(ENTRADA_INDICE));
+		if (novo == NULL) return 1;
+		balde->entradas = novo;
+		balde->capacidade = novaCapacidade;
+	}
+	balde->entradas[balde->numEntradas].vertice = vertice;
+	balde->entradas[balde->numEntradas].grafo = grafo;
+	balde->numEntradas++;
+	indice->numVertices++;
+
+	return 0;
+}
+
+/**
+ * @brief Reserva nos baldes o espaço para um conjunto de antenas que vai ser inserido.
+ *
+ * Conta quantas antenas caem em cada balde e aumenta a capacidade de cada array para o número
+ * atual de entradas mais essa contagem, de uma só vez; as inserções seguintes já não precisam
+ * de fazer crescer os arrays.
+ *
+ * @param[in,out] indice - apontador para o índice espacial.
+ * @param[in] antenas - antenas que vão ser inseridas.
+ * @param[in] numAntenas - número de antenas.
+ *
+ * @return @c 0 se a reserva for bem-sucedida,
+ *         @c 1 se o índice for nulo ou os argumentos inválidos,
+ *         @c 2 se a alocação falhar (os baldes já aumentados mantêm-se).
+ */
+int reservarIndiceEspacial(INDICE_ESPACIAL* indice, const ANTENAS* antenas, int numAntenas) {
+	if (indice == NULL || numAntenas < 0 || (antenas == NULL && numAntenas > 0)) return 1;
+	if (numAntenas == 0) return 0;
+
+	int numBaldes = indice->baldesPorLado * indice->baldesPorLado;
+	int* contagens = (int*)calloc((size_t)numBaldes, sizeof(int));
+	if (contagens == NULL) return 2;
+
+	for (int i = 0; i < numAntenas; i++) {
+		BALDE* balde = obterBalde(indice, antenas[i].x, antenas[i].y);
+		if (balde != NULL) contagens[balde - indice->baldes]++;
+	}
+
+	int erro = 0;
+	for (int b = 0; b < numBaldes && erro == 0; b++) {
+		BALDE* balde = &indice->baldes[b];
+		int necessaria = balde->numEntradas + contagens[b];
+		if (contagens[b] == 0 || necessaria <= balde->capacidade) continue;
+
+		ENTRADA_INDICE* novo = (ENTRADA_INDICE*)realloc(balde->entradas, (size_t)necessaria * sizeof(ENTRADA_INDICE));
+		if (novo == NULL)
+		{
+			erro = 2;
+		}
+		else
+		{
+			balde->entradas = novo;
+			balde->capacidade = necessaria;
+		}
+	}
+	free(contagens);
+	return erro;
+}
+
+/**
+ * @brief Remove um vértice do índice espacial.
+ *
+ * Percorre apenas o balde da posição do vértice; a entrada removida é substituída
+ * pela última do balde, pelo que a ordem dentro do balde não é preservada.
+ *
+ * @param[in,out] indice - apontador para o índice espacial.
+ * @param[in] vertice - apontador para o vértice a remover (não é libertado).
+ *
+ * @return @c 0 se o vértice foi removido, @c 1 se algum apontador for nulo ou o vértice não estava indexado.
+ */
+int removerIndiceEspacial(INDICE_ESPACIAL* indice, VERTICE* vertice) {
+	if (indice == NULL || vertice == NULL) return 1;
+
+	BALDE* balde = obterBalde(indice, vertice->antena.x, vertice->antena.y);
+	if (balde == NULL) return 1;
+
+	for (int i = 0; i < balde->numEntradas; i++) {
+		if (balde->entradas[i].vertice == vertice)
+		{
+			balde->entradas[i] = balde->entradas[--balde->numEntradas];
+			indice->numVertices--;
+			return 0;
+		}
+	}
+	return 1;
+}
+
+/**
+ * @brief Procura no índice o vértice de um grafo com as coordenadas (e frequência) indicadas.
+ *
+ * Só o balde da célula (x, y) é percorrido, em vez de toda a lista de vértices do grafo.
+ *
+ * @param[in] indice - apontador para o índice espacial.
+ * @param[in] grafo - grafo a que o vértice deve pertencer.
+ * @param[in] x - coordenada X do vértice.
+ * @param[in] y - coordenada Y do vértice.
+ * @param[in] freq - frequência que a antena deve ter ('\0' para qualquer frequência).
+ *
+ * @return apontador para o vértice encontrado, ou NULL se não existir.
+ */
+VERTICE* procurarIndiceEspacial(INDICE_ESPACIAL* indice, GRAFO* grafo, int x, int y, char freq) {
+	BALDE* balde = obterBalde(indice, x, y);
+	if (balde == NULL) return NULL;
+
+	for (int i = 0; i < balde->numEntradas; i++) {
+		VERTICE* v = balde->entradas[i].vertice;
+		if (balde->entradas[i].grafo == grafo &&
+			v->antena.x == x &&
+			v->antena.y == y &&
+			(freq == '\0' || v->antena.frequencia == freq))
+		{
+			if (grafo) ESTAT_SOMAR(grafo, nosPercorridos, i + 1);
+			return v;
+		}
+	}
+	if (grafo) ESTAT_SOMAR(grafo, nosPercorridos, balde->numEntradas);
+	return NULL;
+}
+
+/**
+ * @brief Constrói um índice espacial com os vértices de todos os grafos da rede.
+ *
+ * Percorre uma única vez a lista de grafos e, para cada grafo, a sua lista de vértices,
+ * inserindo cada vértice no balde respetivo.
+ *
+ * @param[in] rede - apontador para a rede a indexar.
+ * @param[in] ladoBalde - lado (em células) de cada balde; valores <= 0 usam TAM_BALDE.
+ *
+ * @return apontador para o índice criado, ou NULL se a rede for nula ou ocorrer falha de alocação.
+ */
+INDICE_ESPACIAL* construirIndiceEspacial(REDE* rede, int ladoBalde) {
+	if (rede == NULL) return NULL;
+
+	INDICE_ESPACIAL* indice = criarIndiceEspacial(ladoBalde);
+	if (indice == NULL) return NULL;
+
+	for (GRAFO* grafo = rede->listaGrafos; grafo != NULL; grafo = grafo->prox) {
+		for (VERTICE* v = grafo->vertices; v != NULL; v = v->prox) {
+			// Vértices fora da cidade não são indexados; só a falha de alocação aborta
+			if (inserirIndiceEspacial(indice, grafo, v) != 0 && obterBalde(indice, v->antena.x, v->antena.y) != NULL)
+			{
+				return destruirIndiceEspacial(indice);
+			}
+		}
+	}
+	return indice;
+}
+
+/**
+ * @brief Lista as antenas cujas coordenadas estão dentro de um retângulo.
+ *
+ * Apenas os baldes que intersetam o retângulo são visitados. As coordenadas são
+ * ajustadas aos limites da cidade e podem ser dadas por qualquer ordem.
+ *
+ * @param[in] indice - apontador para o índice espacial.
+ * @param[in] x0 - coordenada X de um dos cantos do retângulo.
+ * @param[in] y0 - coordenada Y de um dos cantos do retângulo.
+ * @param[in] x1 - coordenada X do canto oposto do retângulo.
+ * @param[in] y1 - coordenada Y do canto oposto do retângulo.
+ * @param[in] freq - frequência a filtrar ('\0' para todas as frequências).
+ * @param[out] resultado - array onde são escritos os vértices encontrados (NULL para apenas contar).
+ * @param[in] max - capacidade do array @p resultado.
+ *
+ * @return número total de antenas no retângulo (só as primeiras @p max são escritas),
+ *         ou @c -1 se o índice for nulo.
+ */
+int consultarRetangulo(INDICE_ESPACIAL* indice, int x0, int y0, int x1, int y1, char freq,
+	VERTICE** resultado, int max) {
+	if (indice == NULL) return -1;
+
+	if (x0 > x1) { int t = x0; x0 = x1; x1 = t; }
+	if (y0 > y1) { int t = y0; y0 = y1; y1 = t; }
+	if (x0 < 0) x0 = 0;
+	if (y0 < 0) y0 = 0;
+	if (x1 >= MAX_DIM) x1 = MAX_DIM - 1;
+	if (y1 >= MAX_DIM) y1 = MAX_DIM - 1;
+	if (x0 > x1 || y0 > y1) return 0;
+
+	int total = 0;
+	for (int bx = x0 / indice->ladoBalde; bx <= x1 / indice->ladoBalde; bx++) {
+		for (int by = y0 / indice->ladoBalde; by <= y1 / indice->ladoBalde; by++) {
+			BALDE* balde = &indice->baldes[bx * indice->baldesPorLado + by];
+			for (int i = 0; i < balde->numEntradas; i++) {
+				ANTENAS* antena = &balde->entradas[i].vertice->antena;
+				if (antena->x < x0 || antena->x > x1 || antena->y < y0 || antena->y > y1) continue;
+				if (freq != '\0' && antena->frequencia != freq) continue;
+
+				if (resultado != NULL && total < max) resultado[total] = balde->entradas[i].vertice;
+				total++;
+			}
+		}
+	}
+	return total;
+}
+
+/**
+ * @brief Quadrado da distância euclidiana entre a antena de um vértice e a posição (x, y).
+ */
+static long long distancia2(VERTICE* v, int x, int y) {
+	long long dx = v->antena.x - x;
+	long long dy = v->antena.y - y;
+	return dx * dx + dy * dy;
+}
+
+/**
+ * @brief Procura as k antenas mais próximas (distância euclidiana) de uma posição.
+ *
+ * Os baldes são visitados em anéis concêntricos à volta do balde da posição. Os
+ * candidatos são mantidos ordenados por distância (inserção ordenada, k pequeno) e a
+ * procura termina quando já existem k candidatos e nenhuma célula fora dos anéis
+ * visitados pode estar mais perto do que o k-ésimo.
+ *
+ * @param[in] indice - apontador para o índice espacial.
+ * @param[in] x - coordenada X da posição.
+ * @param[in] y - coordenada Y da posição.
+ * @param[in] freq - frequência a filtrar ('\0' para todas as frequências).
+ * @param[in] k - número de vizinhos pretendido.
+ * @param[out] resultado - array com capacidade para @p k vértices, ordenado por distância crescente.
+ *
+ * @return número de vizinhos encontrados (no máximo @p k),
+ *         ou @c -1 se o índice/resultado forem nulos, @p k <= 0 ou ocorrer falha de alocação.
+ */
+int kVizinhosMaisProximos(INDICE_ESPACIAL* indice, int x, int y, char freq, int k, VERTICE** resultado) {
+	if (indice == NULL || resultado == NULL || k <= 0) return -1;
+
+	long long* distancias = (long long*)malloc((size_t)k * sizeof(long long));
+	if (distancias == NULL) return -1;
+
+	int lado = indice->ladoBalde;
+	int cx = x < 0 ? 0 : (x >= MAX_DIM ? MAX_DIM - 1 : x) / lado;
+	int cy = y < 0 ? 0 : (y >= MAX_DIM ? MAX_DIM - 1 : y) / lado;
+	int encontrados = 0;
+
+	for (int r = 0; r < indice->baldesPorLado; r++) {
+		for (int bx = cx - r; bx <= cx + r; bx++) {
+			if (bx < 0 || bx >= indice->baldesPorLado) continue;
+			// Nas linhas interiores do anel só interessam as duas colunas das extremidades
+			int passo = (bx == cx - r || bx == cx + r) ? 1 : 2 * r;
+			for (int by = cy - r; by <= cy + r; by += passo) {
+				if (by < 0 || by >= indice->baldesPorLado) continue;
+
+				BALDE* balde = &indice->baldes[bx * indice->baldesPorLado + by];
+				for (int i = 0; i < balde->numEntradas; i++) {
+					VERTICE* v = balde->entradas[i].vertice;
+					if (freq != '\0' && v->antena.frequencia != freq) continue;
+
+					long long d = distancia2(v, x, y);
+					if (encontrados == k && d >= distancias[k - 1]) continue;
+
+					int pos = encontrados < k ? encontrados++ : k - 1;
+					while (pos > 0 && distancias[pos - 1] > d) {
+						distancias[pos] = distancias[pos - 1];
+						resultado[pos] = resultado[pos - 1];
+						pos--;
+					}
+					distancias[pos] = d;
+					resultado[pos] = v;
+				}
+			}
+		}
+
+		if (encontrados == k)
+		{
+			// Menor distância possível a uma célula fora dos anéis 0..r (lados já no limite da cidade não contam)
+			long long folga = LLONG_MAX;
+			if (cx - r > 0 && (long long)x - (long long)(cx - r) * lado + 1 < folga) folga = (long long)x - (long long)(cx - r) * lado + 1;
+			if (cx + r + 1 < indice->baldesPorLado && (long long)(cx + r + 1) * lado - x < folga) folga = (long long)(cx + r + 1) * lado - x;
+			if (cy - r > 0 && (long long)y - (long long)(cy - r) * lado + 1 < folga) folga = (long long)y - (long long)(cy - r) * lado + 1;
+			if (cy + r + 1 < indice->baldesPorLado && (long long)(cy + r + 1) * lado - y < folga) folga = (long long)(cy + r + 1) * lado - y;
+			if (folga == LLONG_MAX || (folga > 0 && folga * folga > distancias[k - 1])) break;
+		}
+	}
+
+	free(distancias);
+	return encontrados;
+}
+
+/**
+ * @brief Procura a antena mais próxima (distância euclidiana) de uma posição.
+ *
+ * @param[in] indice - apontador para o índice espacial.
+ * @param[in] x - coordenada X da posição.
+ * @param[in] y - coordenada Y da posição.
+ * @param[in] freq - frequência a filtrar ('\0' para todas as frequências).
+ *
+ * @return apontador para o vértice mais próximo, ou NULL se o índice for nulo ou não existir nenhuma antena.
+ */
+VERTICE* vizinhoMaisProximo(INDICE_ESPACIAL* indice, int x, int y, char freq) {
+	VERTICE* resultado = NULL;
+	if (kVizinhosMaisProximos(indice, x, y, freq, 1, &resultado) <= 0) return NULL;
+	return resultado;
+}
+
+/**
+ * @brief Liberta toda a memória ocupada pelo índice espacial.
+ *
+ * Apenas os arrays dos baldes e o próprio índice são libertados; os vértices
+ * continuam a pertencer aos respetivos grafos.
+ *
+ * @param indice - apontador para o índice a destruir.
+ * @return NULL, indicando que o índice foi destruído.
+ */
+INDICE_ESPACIAL* destruirIndiceEspacial(INDICE_ESPACIAL* indice) {
+	if (indice == NULL) return NULL;
+
+	int numBaldes = indice->baldesPorLado * indice->baldesPorLado;
+	for (int i = 0; i < numBaldes; i++) {
+		free(indice->baldes[i].entradas);
+	}
+	free(indice->baldes);
+	free(indice);
+	return NULL;
+}
+
+#pragma endregion
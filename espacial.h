@@ -0,0 +1,170 @@
+#pragma once
+
+/**
+ * @file espacial.h
+ * @brief Índice espacial (grelha uniforme de baldes) sobre as antenas da rede, com consultas
+ *        por retângulo, vizinho mais próximo e k vizinhos mais próximos
+ *
+ * @author Rogério Picas
+ * @date 18-10-2026
+ * @version 1.0
+ *
+ */
+#include <stdio.h>
+#include "funcoes.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+ /** @def TAM_BALDE
+  *  @brief Lado (em células da cidade) de cada balde da grelha do índice espacial.
+  */
+#define TAM_BALDE 4
+
+#pragma region Estruturas
+
+/**
+ * @struct EntradaIndice
+ * @brief Vértice indexado, juntamente com o grafo a que pertence.
+ */
+typedef struct EntradaIndice {
+    VERTICE* vertice; /**< Apontador para o vértice */
+    GRAFO* grafo;     /**< Apontador para o grafo que contém o vértice */
+} ENTRADA_INDICE;
+
+/**
+ * @struct Balde
+ * @brief Conjunto de vértices cujas coordenadas caem na mesma zona da grelha.
+ */
+typedef struct Balde {
+    ENTRADA_INDICE* entradas; /**< Array dinâmico com os vértices do balde */
+    int numEntradas;          /**< Número de vértices guardados no balde */
+    int capacidade;           /**< Capacidade atual do array de entradas */
+} BALDE;
+
+/**
+ * @struct IndiceEspacial
+ * @brief Grelha uniforme de baldes que cobre a matriz da cidade (MAX_DIM x MAX_DIM).
+ */
+typedef struct IndiceEspacial {
+    int ladoBalde;      /**< Lado (em células) de cada balde */
+    int baldesPorLado;  /**< Número de baldes em cada dimensão da grelha */
+    BALDE* baldes;      /**< Array com baldesPorLado * baldesPorLado baldes */
+    int numVertices;    /**< Número total de vértices indexados */
+} INDICE_ESPACIAL;
+
+#pragma endregion
+
+#pragma region Funções do Índice Espacial
+
+/**
+ * @brief Cria um índice espacial vazio.
+ * @param ladoBalde Lado (em células) de cada balde; valores <= 0 usam TAM_BALDE.
+ * @return Apontador para o índice criado ou NULL em caso de falha de alocação.
+ */
+INDICE_ESPACIAL* criarIndiceEspacial(int ladoBalde);
+
+/**
+ * @brief Constrói um índice espacial com todos os vértices de todos os grafos da rede.
+ * @param rede Apontador para a rede a indexar.
+ * @param ladoBalde Lado (em células) de cada balde; valores <= 0 usam TAM_BALDE.
+ * @return Apontador para o índice criado ou NULL em caso de erro.
+ */
+INDICE_ESPACIAL* construirIndiceEspacial(REDE* rede, int ladoBalde);
+
+/**
+ * @brief Insere um vértice no balde correspondente às suas coordenadas.
+ * @param indice Apontador para o índice espacial.
+ * @param grafo Apontador para o grafo que contém o vértice.
+ * @param vertice Apontador para o vértice a inserir.
+ * @return 0 se a inserção for bem-sucedida, 1 em caso de erro.
+ */
+int inserirIndiceEspacial(INDICE_ESPACIAL* indice, GRAFO* grafo, VERTICE* vertice);
+
+/**
+ * @brief Aumenta a capacidade dos baldes para receberem as antenas indicadas sem mais realocações.
+ * @param indice Apontador para o índice espacial.
+ * @param antenas Antenas que vão ser inseridas (as que estiverem fora da cidade são ignoradas).
+ * @param numAntenas Número de antenas.
+ * @return 0 se a operação for bem-sucedida, 1 se algum argumento for inválido e 2 em caso de falha de alocação.
+ */
+int reservarIndiceEspacial(INDICE_ESPACIAL* indice, const ANTENAS* antenas, int numAntenas);
+
+/**
+ * @brief Remove um vértice do índice (o vértice não é libertado).
+ * @param indice Apontador para o índice espacial.
+ * @param vertice Apontador para o vértice a remover.
+ * @return 0 se o vértice foi removido, 1 se não estava indexado.
+ */
+int removerIndiceEspacial(INDICE_ESPACIAL* indice, VERTICE* vertice);
+
+/**
+ * @brief Procura no índice o vértice de um grafo numa dada posição.
+ * @param indice Apontador para o índice espacial.
+ * @param grafo Grafo a que o vértice deve pertencer.
+ * @param x Coordenada X do vértice.
+ * @param y Coordenada Y do vértice.
+ * @param freq Frequência que a antena deve ter ('\0' para qualquer frequência).
+ * @return Apontador para o vértice encontrado ou NULL se não existir.
+ */
+VERTICE* procurarIndiceEspacial(INDICE_ESPACIAL* indice, GRAFO* grafo, int x, int y, char freq);
+
+/**
+ * @brief Lista as antenas dentro de um retângulo (limites incluídos).
+ * @param indice Apontador para o índice espacial.
+ * @param x0 Menor coordenada X do retângulo.
+ * @param y0 Menor coordenada Y do retângulo.
+ * @param x1 Maior coordenada X do retângulo.
+ * @param y1 Maior coordenada Y do retângulo.
+ * @param freq Frequência a filtrar ('\0' para todas as frequências).
+ * @param resultado Array onde são escritos os vértices encontrados (pode ser NULL para apenas contar).
+ * @param max Capacidade do array resultado.
+ * @return Número total de antenas no retângulo (apenas as primeiras max são escritas), ou -1 em caso de erro.
+ */
+int consultarRetangulo(INDICE_ESPACIAL* indice, int x0, int y0, int x1, int y1, char freq,
+    VERTICE** resultado, int max);
+
+/**
+ * @brief Procura as k antenas mais próximas (distância euclidiana) de uma posição.
+ * @param indice Apontador para o índice espacial.
+ * @param x Coordenada X da posição.
+ * @param y Coordenada Y da posição.
+ * @param freq Frequência a filtrar ('\0' para todas as frequências).
+ * @param k Número de vizinhos pretendido.
+ * @param resultado Array com capacidade para k vértices, preenchido por ordem crescente de distância.
+ * @return Número de vizinhos encontrados (no máximo k), ou -1 em caso de erro.
+ */
+int kVizinhosMaisProximos(INDICE_ESPACIAL* indice, int x, int y, char freq, int k, VERTICE** resultado);
+
+/**
+ * @brief Procura a antena mais próxima (distância euclidiana) de uma posição.
+ * @param indice Apontador para o índice espacial.
+ * @param x Coordenada X da posição.
+ * @param y Coordenada Y da posição.
+ * @param freq Frequência a filtrar ('\0' para todas as frequências).
+ * @return Apontador para o vértice mais próximo ou NULL se não existir nenhum.
+ */
+VERTICE* vizinhoMaisProximo(INDICE_ESPACIAL* indice, int x, int y, char freq);
+
+/**
+ * @brief Devolve o balde que contém a célula (x, y).
+ * @param indice Apontador para o índice espacial.
+ * @param x Coordenada X da célula.
+ * @param y Coordenada Y da célula.
+ * @return Apontador para o balde ou NULL se a célula estiver fora da cidade.
+ */
+BALDE* obterBalde(INDICE_ESPACIAL* indice, int x, int y);
+
+/**
+ * @brief Liberta toda a memória do índice (os vértices indexados não são libertados).
+ * @param indice Apontador para o índice a destruir.
+ * @return NULL, indicando que o índice foi destruído.
+ */
+INDICE_ESPACIAL* destruirIndiceEspacial(INDICE_ESPACIAL* indice);
+
+#pragma endregion
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,220 @@
+/**
+ * @file estatisticas.c
+ * @brief Implementação dos temporizadores e da exportação (JSON e Prometheus) das estatísticas.
+ *
+ * @author Rogério Picas
+ * @date 18-10-2026
+ * @version 1.0
+ */
+#define _CRT_SECURE_NO_WARNINGS
+#include <stdio.h>
+#include <stddef.h>
+#include <string.h>
+#include <time.h>
+#include "funcoes.h"
+#include "estatisticas.h"
+
+#pragma region Temporizadores
+
+static bool temporizadoresAtivos = true;
+
+/**
+ * @brief Ativa ou desativa os temporizadores.
+ *
+ * Com os temporizadores desativados as operações continuam a ser contadas, mas não é lido
+ * o relógio no início e no fim de cada chamada.
+ *
+ * @param[in] ativos - true para medir o tempo das operações, false para apenas contar.
+ */
+void ativarTemporizadores(bool ativos) {
+	temporizadoresAtivos = ativos;
+}
+
+/**
+ * @brief Devolve o instante atual em nanossegundos.
+ *
+ * @return instante atual (ns), ou 0 se os temporizadores estiverem desativados ou o relógio falhar.
+ */
+unsigned long long instanteEstatisticas() {
+	if (!temporizadoresAtivos) return 0;
+
+	struct timespec ts;
+	if (timespec_get(&ts, TIME_UTC) == 0) return 0;
+	return (unsigned long long)ts.tv_sec * 1000000000ULL + (unsigned long long)ts.tv_nsec;
+}
+
+/**
+ * @brief Regista uma chamada concluída de uma operação.
+ *
+ * O tempo só é acumulado se @p inicio for diferente de 0 (temporizadores ativos no início da chamada).
+ *
+ * @param[in,out] estat - apontador para as estatísticas a atualizar.
+ * @param[in] op - operação concluída.
+ * @param[in] inicio - instante devolvido por @c instanteEstatisticas no início da operação.
+ */
+void registarChamada(ESTATISTICAS* estat, OPERACAO_ESTATISTICA op, unsigned long long inicio) {
+	if (estat == NULL || op < 0 || op >= EST_NUM_OPERACOES) return;
+
+	estat->chamadas[op]++;
+	if (inicio != 0)
+	{
+		unsigned long long fim = instanteEstatisticas();
+		if (fim > inicio) estat->tempoNs[op] += fim - inicio;
+	}
+}
+
+#pragma endregion
+
+#pragma region Exportação
+
+/**
+ * @brief Coloca a zero as estatísticas da rede e de todos os seus grafos.
+ *
+ * @param[in,out] rede - apontador para a rede.
+ */
+void reiniciarEstatisticas(REDE* rede) {
+#ifdef PA_ESTATISTICAS
+	if (rede == NULL) return;
+
+	memset(&rede->estat, 0, sizeof(ESTATISTICAS));
+	for (GRAFO* g = rede->listaGrafos; g != NULL; g = g->prox) {
+		memset(&g->estat, 0, sizeof(ESTATISTICAS));
+	}
+#else
+	(void)rede;
+#endif
+}
+
+#ifdef PA_ESTATISTICAS
+
+/**
+ * @brief Nomes das operações usados na exportação, pela ordem de OPERACAO_ESTATISTICA.
+ */
+static const char* nomesOperacoes[EST_NUM_OPERACOES] = {
+	"criar_grafo", "carregar", "inserir_antena", "conectar", "encontrar_vertice",
+	"remover_ligacao", "remover_antena", "mostrar", "bft", "dfs", "contar_caminhos", "nefasto"
+};
+
+/**
+ * @brief Escreve em JSON o objeto com os contadores de um grafo ou da rede.
+ */
+static void escreverEstatisticasJSON(FILE* fp, ESTATISTICAS* estat) {
+	fprintf(fp, "\"operacoes\": {");
+	for (int op = 0; op < EST_NUM_OPERACOES; op++) {
+		fprintf(fp, "%s\"%s\": {\"chamadas\": %llu, \"tempo_ns\": %llu, \"alocacoes\": %llu}",
+			op ? ", " : "", nomesOperacoes[op], estat->chamadas[op], estat->tempoNs[op], estat->alocacoes[op]);
+	}
+	fprintf(fp, "}, \"nos_percorridos\": %llu, \"operacoes_fila\": %llu, \"arestas_percorridas\": %llu",
+		estat->nosPercorridos, estat->operacoesFila, estat->arestasPercorridas);
+}
+
+#endif
+
+/**
+ * @brief Exporta as estatísticas da rede e de cada grafo em JSON.
+ *
+ * O objeto "rede" tem as operações sobre a rede (carregamento, desenho, efeito nefasto, criação
+ * de grafos) e cada elemento de "grafos" as operações sobre esse grafo. Sem PA_ESTATISTICAS
+ * é escrito apenas {"ativo": false}.
+ *
+ * @param[in] rede - apontador para a rede.
+ * @param[in] fp - ficheiro onde escrever.
+ *
+ * @return @c 0 em caso de sucesso, @c 1 se a rede ou o ficheiro forem nulos ou a escrita falhar.
+ */
+int exportarEstatisticasJSON(REDE* rede, FILE* fp) {
+	if (rede == NULL || fp == NULL) return 1;
+
+#ifdef PA_ESTATISTICAS
+	fprintf(fp, "{\n  \"ativo\": true,\n  \"temporizadores\": %s,\n  \"rede\": {",
+		temporizadoresAtivos ? "true" : "false");
+	escreverEstatisticasJSON(fp, &rede->estat);
+	fprintf(fp, "},\n  \"grafos\": [");
+	for (GRAFO* g = rede->listaGrafos; g != NULL; g = g->prox) {
+		fprintf(fp, "%s\n    {\"frequencia\": \"%c\", \"vertices\": %d, ", g == rede->listaGrafos ? "" : ",",
+			g->frequencia, g->numVertices);
+		escreverEstatisticasJSON(fp, &g->estat);
+		fprintf(fp, "}");
+	}
+	fprintf(fp, "\n  ]\n}\n");
+#else
+	fprintf(fp, "{\"ativo\": false}\n");
+#endif
+	return ferror(fp) ? 1 : 0;
+}
+
+#ifdef PA_ESTATISTICAS
+
+/**
+ * @brief Escreve uma família de métricas por operação (rede e grafos) no formato do Prometheus.
+ */
+static void escreverFamiliaOperacoes(REDE* rede, FILE* fp, const char* nome, const char* ajuda, size_t deslocamento) {
+	fprintf(fp, "# HELP %s %s\n# TYPE %s counter\n", nome, ajuda, nome);
+	for (int op = 0; op < EST_NUM_OPERACOES; op++) {
+		const unsigned long long* valores = (const unsigned long long*)((const char*)&rede->estat + deslocamento);
+		if (valores[op] != 0)
+		{
+			fprintf(fp, "%s{nivel=\"rede\",operacao=\"%s\"} %llu\n", nome, nomesOperacoes[op], valores[op]);
+		}
+	}
+	for (GRAFO* g = rede->listaGrafos; g != NULL; g = g->prox) {
+		const unsigned long long* valores = (const unsigned long long*)((const char*)&g->estat + deslocamento);
+		for (int op = 0; op < EST_NUM_OPERACOES; op++) {
+			if (valores[op] != 0)
+			{
+				fprintf(fp, "%s{nivel=\"grafo\",frequencia=\"%c\",operacao=\"%s\"} %llu\n",
+					nome, g->frequencia, nomesOperacoes[op], valores[op]);
+			}
+		}
+	}
+}
+
+/**
+ * @brief Escreve uma família com um contador por grafo (e o da rede) no formato do Prometheus.
+ */
+static void escreverFamiliaContador(REDE* rede, FILE* fp, const char* nome, const char* ajuda, size_t deslocamento) {
+	fprintf(fp, "# HELP %s %s\n# TYPE %s counter\n", nome, ajuda, nome);
+	fprintf(fp, "%s{nivel=\"rede\"} %llu\n", nome,
+		*(const unsigned long long*)((const char*)&rede->estat + deslocamento));
+	for (GRAFO* g = rede->listaGrafos; g != NULL; g = g->prox) {
+		fprintf(fp, "%s{nivel=\"grafo\",frequencia=\"%c\"} %llu\n", nome, g->frequencia,
+			*(const unsigned long long*)((const char*)&g->estat + deslocamento));
+	}
+}
+
+#endif
+
+/**
+ * @brief Exporta as estatísticas da rede e de cada grafo no formato de texto do Prometheus.
+ *
+ * As métricas por operação só incluem as séries com valor diferente de zero. Sem PA_ESTATISTICAS
+ * é escrito apenas um comentário.
+ *
+ * @param[in] rede - apontador para a rede.
+ * @param[in] fp - ficheiro onde escrever.
+ *
+ * @return @c 0 em caso de sucesso, @c 1 se a rede ou o ficheiro forem nulos ou a escrita falhar.
+ */
+int exportarEstatisticasPrometheus(REDE* rede, FILE* fp) {
+	if (rede == NULL || fp == NULL) return 1;
+
+#ifdef PA_ESTATISTICAS
+	escreverFamiliaOperacoes(rede, fp, "pa_chamadas_total", "Chamadas concluidas por operacao.",
+		offsetof(ESTATISTICAS, chamadas));
+	escreverFamiliaOperacoes(rede, fp, "pa_tempo_nanossegundos_total", "Tempo acumulado por operacao.",
+		offsetof(ESTATISTICAS, tempoNs));
+	escreverFamiliaOperacoes(rede, fp, "pa_alocacoes_total", "Alocacoes de memoria por operacao.",
+		offsetof(ESTATISTICAS, alocacoes));
+	escreverFamiliaContador(rede, fp, "pa_nos_percorridos_total", "Vertices examinados nas procuras por posicao.",
+		offsetof(ESTATISTICAS, nosPercorridos));
+	escreverFamiliaContador(rede, fp, "pa_operacoes_fila_total", "Insercoes e remocoes na fila do BFT.",
+		offsetof(ESTATISTICAS, operacoesFila));
+	escreverFamiliaContador(rede, fp, "pa_arestas_percorridas_total", "Arestas examinadas pelas travessias.",
+		offsetof(ESTATISTICAS, arestasPercorridas));
+#else
+	fprintf(fp, "# estatisticas desativadas (compilar com -DPA_ESTATISTICAS)\n");
+#endif
+	return ferror(fp) ? 1 : 0;
+}
+
+#pragma endregion
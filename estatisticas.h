@@ -0,0 +1,131 @@
+#pragma once
+
+/**
+ * @file estatisticas.h
+ * @brief Contadores e temporizadores de instrumentação das operações da rede e dos grafos,
+ *        ativados na compilação com -DPA_ESTATISTICAS (sem -DPA_ESTATISTICAS as macros não geram código)
+ *
+ * @author Rogério Picas
+ * @date 18-10-2026
+ * @version 1.0
+ *
+ */
+#include <stdio.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct Rede_Grafos;
+
+#pragma region Estruturas
+
+/**
+ * @enum OperacaoEstatistica
+ * @brief Operações da API com contagem de chamadas, tempo e alocações próprias.
+ */
+typedef enum OperacaoEstatistica {
+    EST_CRIAR_GRAFO,        /**< criarGrafo (apenas quando cria um grafo novo) */
+    EST_CARREGAR,           /**< carregaGrafo */
+    EST_INSERIR_ANTENA,     /**< inserirAntenaGrafo */
+    EST_CONECTAR,           /**< conectarVertices */
+    EST_ENCONTRAR_VERTICE,  /**< encontrarVertice */
+    EST_REMOVER_LIGACAO,    /**< removerLigacao */
+    EST_REMOVER_ANTENA,     /**< removerAntenaGrafo */
+    EST_MOSTRAR,            /**< mostrarRedeGrafos */
+    EST_BFT,                /**< BFT */
+    EST_DFS,                /**< DFS */
+    EST_CONTAR_CAMINHOS,    /**< countPathsDFS */
+    EST_NEFASTO,            /**< efeitoNefasto */
+    EST_NUM_OPERACOES       /**< Número de operações instrumentadas */
+} OPERACAO_ESTATISTICA;
+
+/**
+ * @struct Estatisticas
+ * @brief Contadores acumulados de um grafo ou de uma rede.
+ */
+typedef struct Estatisticas {
+    unsigned long long chamadas[EST_NUM_OPERACOES];   /**< Chamadas concluídas de cada operação */
+    unsigned long long tempoNs[EST_NUM_OPERACOES];    /**< Tempo acumulado (ns) de cada operação, com temporizadores ativos */
+    unsigned long long alocacoes[EST_NUM_OPERACOES];  /**< Alocações de memória (malloc/realloc) feitas por cada operação */
+    unsigned long long nosPercorridos;     /**< Vértices examinados nas procuras por posição (encontrarVertice e verificação de duplicados) */
+    unsigned long long operacoesFila;      /**< Inserções e remoções na fila do BFT */
+    unsigned long long arestasPercorridas; /**< Arestas examinadas pelas travessias (BFT, DFS) e pela procura de ligações a remover */
+} ESTATISTICAS;
+
+#pragma endregion
+
+#pragma region Macros de Instrumentação
+
+/*
+ * As macros recebem o dono das estatísticas (GRAFO* ou REDE*, ambos com o campo "estat").
+ * Sem PA_ESTATISTICAS o campo "estat" não existe e as macros não avaliam os argumentos.
+ */
+#ifdef PA_ESTATISTICAS
+
+#define ESTAT_SOMAR(dono, campo, n)       ((dono)->estat.campo += (unsigned long long)(n))
+#define ESTAT_ALOCACOES(dono, op, n)      ((dono)->estat.alocacoes[op] += (unsigned long long)(n))
+#define ESTAT_INICIO(t)                   unsigned long long t = instanteEstatisticas()
+#define ESTAT_FIM(dono, op, t)            registarChamada(&(dono)->estat, (op), (t))
+
+#else
+
+#define ESTAT_SOMAR(dono, campo, n)       ((void)0)
+#define ESTAT_ALOCACOES(dono, op, n)      ((void)0)
+#define ESTAT_INICIO(t)                   ((void)0)
+#define ESTAT_FIM(dono, op, t)            ((void)0)
+
+#endif
+
+#pragma endregion
+
+#pragma region Funções de Estatísticas
+
+/**
+ * @brief Ativa ou desativa os temporizadores (os contadores ficam sempre ativos com PA_ESTATISTICAS).
+ * @param ativos true para medir o tempo das operações, false para apenas contar.
+ */
+void ativarTemporizadores(bool ativos);
+
+/**
+ * @brief Devolve o instante atual em nanossegundos, ou 0 se os temporizadores estiverem desativados.
+ * @return Instante atual (ns) ou 0.
+ */
+unsigned long long instanteEstatisticas();
+
+/**
+ * @brief Regista uma chamada concluída de uma operação e o tempo decorrido desde @p inicio.
+ * @param estat Apontador para as estatísticas a atualizar.
+ * @param op Operação concluída.
+ * @param inicio Instante devolvido por instanteEstatisticas no início da operação.
+ */
+void registarChamada(ESTATISTICAS* estat, OPERACAO_ESTATISTICA op, unsigned long long inicio);
+
+/**
+ * @brief Coloca a zero as estatísticas da rede e de todos os seus grafos.
+ * @param rede Apontador para a rede.
+ */
+void reiniciarEstatisticas(struct Rede_Grafos* rede);
+
+/**
+ * @brief Exporta as estatísticas da rede e de cada grafo em JSON.
+ * @param rede Apontador para a rede.
+ * @param fp Ficheiro onde escrever.
+ * @return 0 se a operação for bem-sucedida, 1 em caso de erro.
+ */
+int exportarEstatisticasJSON(struct Rede_Grafos* rede, FILE* fp);
+
+/**
+ * @brief Exporta as estatísticas da rede e de cada grafo no formato de texto do Prometheus.
+ * @param rede Apontador para a rede.
+ * @param fp Ficheiro onde escrever.
+ * @return 0 se a operação for bem-sucedida, 1 em caso de erro.
+ */
+int exportarEstatisticasPrometheus(struct Rede_Grafos* rede, FILE* fp);
+
+#pragma endregion
+
+#ifdef __cplusplus
+}
+#endif
@@ -1,33 +1,42 @@
 /**
  * @file funcoes.c
- * @brief Implementao de funes para gesto de grafos de antenas, incluindo criao, manipulao,
- *        procura em largura (BFS) e validao de grafos.
+ * @brief Implementação de funções para gestão de grafos de antenas, incluindo criação, manipulação,
+ *        procura em largura (BFS) e validação de grafos.
  *
- * @author Rogrio Picas
+ * @author Rogério Picas
  * @date 07-05-2025
  * @version 1.0
  */
 #define _CRT_SECURE_NO_WARNINGS
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include "funcoes.h"
+#include "grelha.h"
+#include "espacial.h"
+#include "reordenacao.h"
+#include "antinodos.h"
+#include "reserva.h"
+#include "adjacencia.h"
+#include "cache.h"
+#include "registo.h"
 #include <stdbool.h>
 
 
 
-#pragma region Funes de Criao
+#pragma region Funções de Criação
 
  /**
-  * @brief Cria e inicializa uma nova antena com frequncia e coordenadas definidas
+  * @brief Cria e inicializa uma nova antena com frequência e coordenadas definidas
   *
-  * Esta funo aloca memria para uma nova estrutura ANTENAS, define a frequncia
+  * Esta função aloca memória para uma nova estrutura ANTENAS, define a frequência
   * e as coordenadas (x, y) da antena e retorna um apontador para a estrutura criada.
   *
-  * @param freqAntena caracter que representa a frequncia da antena.
+  * @param freqAntena caracter que representa a frequência da antena.
   * @param x coordenada X da antena.
   * @param y coordenada Y da antena.
   *
-  * @return apontador para a nova estrutura ANTENAS criada, ou NULL se a alocao de memria falhar.
+  * @return apontador para a nova estrutura ANTENAS criada, ou NULL se a alocação de memória falhar.
   */
 ANTENAS* criarAntena(char freqAntena, int x, int y) {
 
@@ -45,41 +54,81 @@ ANTENAS* criarAntena(char freqAntena, int x, int y) {
 }
 
 /**
- * @brief Cria um novo vrtice contendo a informao de alguma antena criada
+ * @brief Inicializa um vértice com os dados de uma antena, sem ligações e fora de qualquer lista.
  *
- * Esta funo aloca memria para um novo vrtice do grafo, inicializa os seus
- * campos com valores apropriados e associa o apontador da estrutura de antena
- * fornecida ao campo "infoAntenas" do vrtice.
+ * @param[out] vertice - vértice a inicializar (alocado à parte ou retirado da reserva do grafo).
+ * @param[in] antena - antena cujos dados são copiados para o vértice.
+ */
+static void inicializarVertice(VERTICE* vertice, ANTENAS* antena) {
+	vertice->antena = *antena;
+	vertice->adjacentes = NULL;
+	vertice->visitado = 0;
+	vertice->indice = -1;
+	vertice->id = -1;
+	vertice->grau = 0;
+	vertice->posicaoMatriz = -1;
+	vertice->prox = NULL;
+	vertice->ant = NULL;
+}
+
+/**
+ * @brief Dá ao grafo uma nova época, a seguir a todas as já usadas na rede.
+ *
+ * Os resultados guardados na cache da rede para o grafo deixam de ser válidos. Como as épocas
+ * vêm de um contador único da rede, um grafo criado mais tarde no mesmo endereço de um grafo
+ * destruído nunca tem a época de uma entrada antiga. Durante um lote de alterações
+ * (@c rede->emLote) o contador já foi avançado no início do lote e todos os grafos alterados
+ * recebem essa mesma época, em vez de uma nova por alteração.
+ *
+ * @param[in,out] grafo - apontador para o grafo alterado.
+ */
+static void marcarAlteracaoGrafo(GRAFO* grafo) {
+	if (grafo->rede == NULL) grafo->epoca++;
+	else if (grafo->rede->emLote) grafo->epoca = grafo->rede->epoca;
+	else grafo->epoca = ++grafo->rede->epoca;
+}
+
+/**
+ * @brief Devolve a cache de consultas da rede do grafo (NULL se o grafo não tiver rede ou a cache estiver desativada).
+ */
+static CACHE_CONSULTAS* cacheGrafo(const GRAFO* grafo) {
+	return grafo && grafo->rede ? grafo->rede->cache : NULL;
+}
+
+/**
+ * @brief Cria um novo vértice contendo a informação de alguma antena criada
  *
- * @param antena -> apontador para a estrutura ANTENAS que ser associada ao vrtice.
+ * Esta função aloca memória para um novo vértice do grafo, inicializa os seus
+ * campos com valores apropriados e copia a frequência e as coordenadas da antena
+ * fornecida para o campo "antena" do vértice (a antena não passa a pertencer ao vértice).
  *
- * @return um novo vrtice criado, ou NULL se a alocao de memria falhar.
+ * @param antena -> apontador para a estrutura ANTENAS cujos dados são copiados para o vértice.
+ *
+ * @return um novo vértice criado, ou NULL se a alocação de memória falhar.
  */
 VERTICE* criarVertice(ANTENAS* antena) {
 
+	if (antena == NULL) return NULL;
+
 	VERTICE* novoVertice = (VERTICE*)malloc(sizeof(VERTICE));
 	if (!novoVertice) return NULL;
 
-	novoVertice->infoAntenas = antena;
-	novoVertice->adjacentes = NULL;
-	novoVertice->visitado = 0;
-	novoVertice->prox = NULL;
-
+	inicializarVertice(novoVertice, antena);
 	return novoVertice;
 }
 
 /**
- * @brief Cria um novo grafo para uma determinada frequncia, ou retorna um existente.
+ * @brief Cria um novo grafo para uma determinada frequência, ou retorna um existente.
  *
- * Esta funo verifica se j existe um grafo com a frequncia especificada dentro
- * da rede. Caso exista, retorna o apontador para esse grafo. Caso contrrio, cria
- * um novo grafo, inicializa os seus campos e adiciona-o  lista de grafos da rede.
+ * Esta função verifica se já existe um grafo com a frequência especificada dentro
+ * da rede. Caso exista, retorna o apontador para esse grafo. Caso contrário, cria
+ * um novo grafo, inicializa os seus campos e adiciona-o à lista de grafos da rede.
  *
- * @param rede apontador para a estrutura REDE onde o grafo ser criado ou procurado.
- * @param freq frequncia associada ao grafo a ser criado.
+ * @param rede apontador para a estrutura REDE onde o grafo será criado ou procurado.
+ * @param freq frequência associada ao grafo a ser criado.
  *
- * @return apontador para o grafo correspondente  frequncia especificada,
- *         ou NULL se ocorrer erro na alocao de memria.
+ * @return apontador para o grafo correspondente à frequência especificada,
+ *         ou NULL se ocorrer erro na alocação de memória.
  */
 GRAFO* criarGrafo(REDE* rede, char freq) {
 	if (rede == NULL) return NULL;
@@ -91,27 +140,42 @@ GRAFO* criarGrafo(REDE* rede, char freq) {
 		}
 		atual = atual->prox;
 	}
-	// Caso no exista a frequencia inserida
+	// Caso não exista a frequencia inserida
+	ESTAT_INICIO(t);
 
 	GRAFO* novoGrafo = (GRAFO*)malloc(sizeof(GRAFO));
 	if (novoGrafo == NULL) return NULL;
+	ESTAT_ALOCACOES(rede, EST_CRIAR_GRAFO, 1);
 
+#ifdef PA_ESTATISTICAS
+	memset(&novoGrafo->estat, 0, sizeof(ESTATISTICAS));
+#endif
 	novoGrafo->vertices = NULL;
 	novoGrafo->numVertices = 0;
+	novoGrafo->maxVertices = 0;
 	novoGrafo->frequencia = freq;
+	novoGrafo->rede = rede;
+	novoGrafo->proximoId = 0;
+	novoGrafo->bloco = NULL;
+	novoGrafo->reserva = NULL;
+	novoGrafo->antinodos = NULL;
+	novoGrafo->matriz = NULL;
+	novoGrafo->epoca = ++rede->epoca;
 	novoGrafo->prox = rede->listaGrafos;
 	rede->listaGrafos = novoGrafo;
 
+	ESTAT_FIM(rede, EST_CRIAR_GRAFO, t);
 	return novoGrafo;
 }
 
 /**
  * @brief Cria e inicializa uma nova estrutura de rede.
  *
- * Esta funo aloca memria para uma nova estrutura REDE, inicializando o campo
- * "listaGrafos" com NULL, indicando que ainda no existem grafos associados.
+ * Esta função aloca memória para uma nova estrutura REDE, inicializando o campo
+ * "listaGrafos" com NULL, indicando que ainda não existem grafos associados, e cria
+ * a grelha de ocupação e o índice espacial vazios da cidade.
  *
- * @return apontador para a nova estrutura REDE criada, ou NULL se a alocao de memria falhar.
+ * @return apontador para a nova estrutura REDE criada, ou NULL se a alocação de memória falhar.
  */
 REDE* criarRede() {
 	REDE* rede = (REDE*)malloc(sizeof(REDE));
@@ -120,26 +184,43 @@ REDE* criarRede() {
 		return NULL;
 	}
 	rede->listaGrafos = NULL;
+	rede->cache = NULL;
+	rede->epoca = 0;
+	rede->emLote = false;
+#ifdef PA_ESTATISTICAS
+	memset(&rede->estat, 0, sizeof(ESTATISTICAS));
+#endif
+	rede->grelha = criarGrelha();
+	rede->indice = criarIndiceEspacial(TAM_BALDE);
+	if (rede->grelha == NULL || rede->indice == NULL)
+	{
+		destruirGrelha(rede->grelha);
+		destruirIndiceEspacial(rede->indice);
+		free(rede);
+		return NULL;
+	}
 	return rede;
 }
 
 #pragma endregion
 
-#pragma region Funes de Manipulao
+#pragma region Funções de Manipulação
 
 /**
- * @brief Insere uma nova antena como vrtice no grafo, se no existir j uma igual.
+ * @brief Insere uma nova antena como vértice no grafo, se não existir já uma igual.
  *
- * Verifica se j existe uma antena com a mesma frequncia e coordenadas (x, y) no grafo.
- * Caso contrrio, cria uma nova antena e o vrtice correspondente e adiciona no incio da lista de vrtices.
+ * Verifica se já existe uma antena com a mesma frequência e coordenadas (x, y) no grafo.
+ * Caso contrário, cria uma nova antena e o vértice correspondente e adiciona no início da lista de vértices.
+ * Se o grafo pertencer a uma rede, a verificação usa apenas o balde (x, y) do índice espacial
+ * da rede, e o novo vértice é registado nesse índice e na grelha de ocupação.
  *
- * @param[in] grafo - apontador para o grafo onde a antena ser inserida.
- * @param[in] frequencia - caractere que representa a frequncia da antena.
+ * @param[in] grafo - apontador para o grafo onde a antena será inserida.
+ * @param[in] frequencia - caractere que representa a frequência da antena.
  * @param[in] x - coordenada x da antena.
  * @param[in] y - coordenada y da antena.
  *
- * @return @c 0 se a insero foi bem-sucedida,
- *         @c 1 em caso de erro (grafo nulo, coordenadas invlidas, antena j existente ou falha na criao).
+ * @return @c 0 se a inserção foi bem-sucedida,
+ *         @c 1 em caso de erro (grafo nulo, coordenadas inválidas, antena já existente ou falha na criação).
  */
 int inserirAntenaGrafo(GRAFO* grafo, char frequencia, int x, int y) {
 
@@ -147,96 +228,264 @@ int inserirAntenaGrafo(GRAFO* grafo, char frequencia, int x, int y) {
 	{
 		return 1;
 	}
-	if (x >= MAX_DIM || y >= MAX_DIM)
+	if (x < 0 || x >= MAX_DIM || y < 0 || y >= MAX_DIM)
 	{
 		return 1;
 	}
-	// Verificar se antena existe na lista
-	VERTICE* atual = grafo->vertices;
-
-	while (atual) {
+	ESTAT_INICIO(t);
 
-		if (atual && atual->infoAntenas &&
-			atual->infoAntenas->frequencia == frequencia &&
-			atual->infoAntenas->x == x &&
-			atual->infoAntenas->y == y) {
+	// Verificar se antena existe (pelo índice espacial da rede, quando disponível)
+	if (grafo->rede && grafo->rede->indice)
+	{
+		if (procurarIndiceEspacial(grafo->rede->indice, grafo, x, y, frequencia) != NULL)
+		{
 			return 1;
 		}
-		atual = atual->prox;
 	}
+	else
+	{
+		VERTICE* atual = grafo->vertices;
 
-	ANTENAS* novaAntena = criarAntena(frequencia, x, y);
-	if (!novaAntena)
+		while (atual) {
+			ESTAT_SOMAR(grafo, nosPercorridos, 1);
+
+			if (atual->antena.frequencia == frequencia &&
+				atual->antena.x == x &&
+				atual->antena.y == y) {
+				return 1;
+			}
+			atual = atual->prox;
+		}
+	}
+
+	ANTENAS novaAntena;
+	novaAntena.frequencia = frequencia;
+	novaAntena.x = (COORDENADA)x;
+	novaAntena.y = (COORDENADA)y;
+
+	// Um vértice reservado, se houver; caso contrário, um vértice alocado à parte
+	VERTICE* novoVertice = retirarVerticeReserva(grafo);
+	if (novoVertice)
 	{
-		return 1;
+		inicializarVertice(novoVertice, &novaAntena);
+	}
+	else
+	{
+		novoVertice = criarVertice(&novaAntena);
+		if (!novoVertice)
+		{
+			return 1;
+		}
+		ESTAT_ALOCACOES(grafo, EST_INSERIR_ANTENA, 1);
 	}
 
-	VERTICE* novoVertice = criarVertice(novaAntena);
-	if (!novoVertice)
+	if (grafo->rede && grafo->rede->indice &&
+		inserirIndiceEspacial(grafo->rede->indice, grafo, novoVertice) != 0)
 	{
-		free(novaAntena);
+		libertarVerticeGrafo(grafo, novoVertice);
 		return 1;
 	}
 
+	novoVertice->id = grafo->proximoId++;
 	novoVertice->prox = grafo->vertices;
+	if (grafo->vertices)
+	{
+		grafo->vertices->ant = novoVertice;
+	}
 	grafo->vertices = novoVertice;
 	grafo->numVertices++;
+	atualizarCapacidadeGrafo(grafo);
+	inserirVerticeMatriz(grafo, novoVertice);
+	adaptarMatrizAdjacencia(grafo);
 
+	if (grafo->rede)
+	{
+		marcarGrelha(grafo->rede->grelha, x, y, frequencia);
+	}
+	atualizarAntinodosAntena(grafo, novoVertice, 1);
+	marcarAlteracaoGrafo(grafo);
+
+	ESTAT_FIM(grafo, EST_INSERIR_ANTENA, t);
 	return 0;
 }
 
 /**
- * @brief Cria uma ligao bidirecional entre dois vrtices no grafo.
+ * @brief Move uma antena para outra posição do grafo, mantendo as suas ligações.
+ *
+ * O vértice não é recriado: só as coordenadas mudam, e o vértice é retirado do balde antigo
+ * do índice espacial e colocado no novo; a grelha da rede é atualizada nas duas células e
+ * a contagem de antinodos só muda nos pares que envolvem a antena.
+ *
+ * @param[in,out] grafo - apontador para o grafo que contém a antena.
+ * @param[in] x - coordenada X atual da antena.
+ * @param[in] y - coordenada Y atual da antena.
+ * @param[in] novoX - nova coordenada X.
+ * @param[in] novoY - nova coordenada Y.
+ *
+ * @return @c 0 se a antena foi movida (ou já estava na nova posição),
+ *         @c 1 se o grafo for nulo, a antena não existir, a nova posição estiver fora da cidade
+ *         ou já tiver uma antena do mesmo grafo.
+ */
+int moverAntenaGrafo(GRAFO* grafo, int x, int y, int novoX, int novoY) {
+	if (grafo == NULL) return 1;
+	if (novoX < 0 || novoX >= MAX_DIM || novoY < 0 || novoY >= MAX_DIM) return 1;
+
+	VERTICE* vertice = encontrarVertice(grafo, x, y);
+	if (vertice == NULL) return 1;
+	if (x == novoX && y == novoY) return 0;
+	if (encontrarVertice(grafo, novoX, novoY) != NULL) return 1;
+
+	atualizarAntinodosAntena(grafo, vertice, -1);
+	if (grafo->rede)
+	{
+		removerIndiceEspacial(grafo->rede->indice, vertice);
+		limparGrelha(grafo->rede, NULL, x, y);
+	}
+	vertice->antena.x = (COORDENADA)novoX;
+	vertice->antena.y = (COORDENADA)novoY;
+	if (grafo->rede)
+	{
+		if (inserirIndiceEspacial(grafo->rede->indice, grafo, vertice) != 0)
+		{
+			// Sem memória para o novo balde: a antena volta à posição anterior
+			vertice->antena.x = (COORDENADA)x;
+			vertice->antena.y = (COORDENADA)y;
+			inserirIndiceEspacial(grafo->rede->indice, grafo, vertice);
+			marcarGrelha(grafo->rede->grelha, x, y, vertice->antena.frequencia);
+			atualizarAntinodosAntena(grafo, vertice, 1);
+			return 1;
+		}
+		marcarGrelha(grafo->rede->grelha, novoX, novoY, vertice->antena.frequencia);
+	}
+	atualizarAntinodosAntena(grafo, vertice, 1);
+	marcarAlteracaoGrafo(grafo);
+
+	return 0;
+}
+
+/**
+ * @brief Insere uma aresta no início da lista de adjacências de um vértice.
+ *
+ * @param[in,out] dono - vértice a que a lista de adjacências pertence.
+ * @param[in] aresta - aresta a inserir.
+ */
+static void ligarAresta(VERTICE* dono, ARESTA* aresta) {
+	aresta->ant = NULL;
+	aresta->prox = dono->adjacentes;
+	if (dono->adjacentes)
+	{
+		dono->adjacentes->ant = aresta;
+	}
+	dono->adjacentes = aresta;
+	dono->grau++;
+}
+
+/**
+ * @brief Retira uma aresta da lista de adjacências de um vértice em O(1).
+ *
+ * @param[in,out] dono - vértice a que a lista de adjacências pertence.
+ * @param[in] aresta - aresta a retirar (não é libertada).
+ */
+static void desligarAresta(VERTICE* dono, ARESTA* aresta) {
+	if (aresta->ant)
+	{
+		aresta->ant->prox = aresta->prox;
+	}
+	else
+	{
+		dono->adjacentes = aresta->prox;
+	}
+	if (aresta->prox)
+	{
+		aresta->prox->ant = aresta->ant;
+	}
+	aresta->prox = aresta->ant = NULL;
+	dono->grau--;
+}
+
+/**
+ * @brief Obtém uma aresta para o grafo: da reserva, se houver, ou alocada à parte.
+ *
+ * @param[in,out] grafo - apontador para o grafo.
+ *
+ * @return apontador para a aresta (por inicializar), ou NULL se a alocação falhar.
+ */
+static ARESTA* novaAresta(GRAFO* grafo) {
+	ARESTA* aresta = retirarArestaReserva(grafo);
+	if (aresta == NULL)
+	{
+		aresta = (ARESTA*)malloc(sizeof(ARESTA));
+		if (aresta != NULL) ESTAT_ALOCACOES(grafo, EST_CONECTAR, 1);
+	}
+	return aresta;
+}
+
+/**
+ * @brief Cria uma ligação bidirecional entre dois vértices no grafo.
  *
- * Esta funo liga os vrtices com coordenadas (x1, y1) e (x2, y2) adicionando arestas
- * nas listas de adjacncia de ambos os vrtices, permitindo assim a navegao em ambas direes.
+ * Esta função liga os vértices com coordenadas (x1, y1) e (x2, y2) adicionando arestas
+ * nas listas de adjacência de ambos os vértices, permitindo assim a navegação em ambas direções.
+ * As duas arestas ficam ligadas entre si (campo @c inversa) para permitir a remoção em O(1).
  *
- * @param[in] grafo - apontador para o grafo onde os vrtices esto inseridos.
- * @param[in] x1 - coordenada x do primeiro vrtice.
- * @param[in] y1 - coordenada y do primeiro vrtice.
- * @param[in] x2 - coordenada x do segundo vrtice.
- * @param[in] y2 - coordenada y do segundo vrtice.
+ * @param[in] grafo - apontador para o grafo onde os vértices estão inseridos.
+ * @param[in] x1 - coordenada x do primeiro vértice.
+ * @param[in] y1 - coordenada y do primeiro vértice.
+ * @param[in] x2 - coordenada x do segundo vértice.
+ * @param[in] y2 - coordenada y do segundo vértice.
  *
- * @return @c 0 se a ligao foi criada com sucesso,
- *         @c 1 em caso de erro (grafo ou vrtices inexistentes ou falha na alocao).
+ * @return @c 0 se a ligação foi criada com sucesso,
+ *         @c 1 em caso de erro (grafo ou vértices inexistentes ou falha na alocação).
  */
 int conectarVertices(GRAFO* grafo, int x1, int y1, int x2, int y2) {
 	if (grafo == NULL || grafo->vertices == NULL)
 		return 1;
+	ESTAT_INICIO(t);
 
 	VERTICE* v1 = encontrarVertice(grafo, x1, y1);
 	VERTICE* v2 = encontrarVertice(grafo, x2, y2);
 
 	if (!v1 || !v2) return 1;
 
+	ARESTA* a1 = novaAresta(grafo);
+	ARESTA* a2 = novaAresta(grafo);
+	if (a1 == NULL || a2 == NULL)
+	{
+		libertarArestaGrafo(grafo, a1);
+		libertarArestaGrafo(grafo, a2);
+		return 1;
+	}
+
+	// Cada aresta guarda a inversa, para poder ser removida sem percorrer listas
+	a1->inversa = a2;
+	a2->inversa = a1;
+
 	// Cria aresta de origem para destino
-	ARESTA* a1 = (ARESTA*)malloc(sizeof(ARESTA));
-	if (a1 == NULL) return 1;
 	a1->destino = v2;
-	a1->prox = v1->adjacentes;
-	v1->adjacentes = a1;
+	ligarAresta(v1, a1);
 
 	// Cria aresta de destino para origem
-	ARESTA* a2 = (ARESTA*)malloc(sizeof(ARESTA));
-	if (a2 == NULL) return 1;
 	a2->destino = v1;
-	a2->prox = v2->adjacentes;
-	v2->adjacentes = a2;
+	ligarAresta(v2, a2);
 
+	ligarMatriz(grafo, v1, v2);
+	adaptarMatrizAdjacencia(grafo);
+	marcarAlteracaoGrafo(grafo);
+
+	ESTAT_FIM(grafo, EST_CONECTAR, t);
 	return 0;
 }
 
 /**
  * @brief Mostra visualmente a rede de grafos numa matriz 2D.
  *
- * Esta funo cria uma matriz de dimenso MAX_DIM x MAX_DIM e preenche-a com
- * '.' inicialmente. Depois, para cada vrtice de cada grafo na rede, coloca na
- * posio correspondente as coordenadas (x,y) o caractere da frequncia desse vrtice.
- * Finalmente imprime a matriz no ecr.
+ * A matriz já não é reconstruída a cada chamada: a rede mantém uma grelha persistente
+ * com a frequência de cada célula ('.' quando livre), atualizada a cada inserção e
+ * remoção de antenas. Esta função limita-se a escrever essa grelha no stdout, uma linha
+ * completa de cada vez (ver @c mostrarRegiaoRede).
  *
- * @param[in] redeGrafos - apontador para a estrutura REDE que contm a lista de grafos.
+ * @param[in] redeGrafos - apontador para a estrutura REDE que contém a lista de grafos.
  *
- * @return @c 0 em caso de sucesso, @c 1 se o apontador da rede for NULL.
+ * @return @c 0 em caso de sucesso, @c 1 se o apontador da rede for NULL, @c 2 se a escrita falhar.
  */
 int mostrarRedeGrafos(REDE* redeGrafos) {
 
@@ -244,70 +493,30 @@ int mostrarRedeGrafos(REDE* redeGrafos) {
 	{
 		return 1;
 	}
-	char matriz[MAX_DIM][MAX_DIM];
-
-	for (int i = 0; i < MAX_DIM; i++) {
-		for (int j = 0; j < MAX_DIM; j++) {
-			matriz[i][j] = '.';
-		}
-	}
-
-	GRAFO* grafoAtual = redeGrafos->listaGrafos;
-
-	while (grafoAtual != NULL) {
-		VERTICE* verticeAtual = grafoAtual->vertices;
-		while (verticeAtual != NULL) {
-
-			int x = verticeAtual->infoAntenas->x;
-			int y = verticeAtual->infoAntenas->y;
-			char freq = verticeAtual->infoAntenas->frequencia;
-
-			if (x >= 0 && x < MAX_DIM && y >= 0 && y < MAX_DIM)
-			{
-				matriz[x][y] = freq;
-			}
-			verticeAtual = verticeAtual->prox;
-		}
-		grafoAtual = grafoAtual->prox;
-	}
-
-	for (int i = 0; i < MAX_DIM; i++) {
-		for (int j = 0; j < MAX_DIM; j++) {
-			printf("%c", matriz[i][j]);
-		}
-		printf("\n");
-	}
-
-	return 0;
+	ESTAT_INICIO(t);
+	int resultado = mostrarRegiaoRede(redeGrafos, stdout, 0, 0, MAX_DIM, MAX_DIM, 1);
+	ESTAT_FIM(redeGrafos, EST_MOSTRAR, t);
+	return resultado;
 }
 
 /**
- * @brief Carrega a informao de um grafo a partir de um ficheiro de texto.
+ * @brief Lê as antenas de um ficheiro de texto com a matriz da cidade.
  *
- * Esta funo l caractere a caractere de um ficheiro de texto usando @c fgetc
- * (em vez de um buffer), interpretando cada letra maiscula como uma antena a ser
- * inserida na rede. A posio da antena  determinada pelas coordenadas da matriz
- * onde a letra foi lida.
- *
- * O grafo correspondente a cada letra  criado atravs da funo @c criarGrafo
- * e a antena  inserida usando @c inserirAntenaRedeGrafos. Linhas com quebras
- * de linha so devidamente tratadas durante a leitura.
+ * Cada letra maiúscula é uma antena, na posição (linha, coluna) em que foi lida.
  *
- * @param[in] - rede apontador para a estrutura de rede onde os grafos sero inseridos.
- * @param[in] - filename nome do ficheiro de texto a ser lido.
+ * @param[in] fp - ficheiro aberto para leitura, posicionado no início.
+ * @param[out] antenas - array onde são escritas as antenas (pode ser NULL para apenas contar).
+ * @param[in] max - capacidade do array antenas.
  *
- * @return 0 em caso de sucesso. Retorna -1 se ocorrer erro na abertura do ficheiro ou na criao do grafo.
+ * @return número total de antenas do ficheiro (apenas as primeiras max são escritas).
  */
-int carregaGrafo(REDE* rede, char* filename) {
-	FILE* fp = fopen(filename, "r");
-	if (!fp) return -1;
-
+static int lerAntenasFicheiro(FILE* fp, ANTENAS* antenas, int max) {
+	int num = 0;
 	for (int i = 0; i < MAX_DIM; i++) {
 		for (int j = 0; j < MAX_DIM; j++) {
 			int ch = fgetc(fp);
 			if (ch == EOF) {
-				fclose(fp);
-				return 0;
+				return num;
 			}
 
 			if (ch == '\n') {
@@ -316,59 +525,124 @@ int carregaGrafo(REDE* rede, char* filename) {
 			}
 
 			if (ch >= 'A' && ch <= 'Z') {
-				GRAFO* grafo = criarGrafo(rede, ch);
-				if (!grafo) {
-					fclose(fp);
-					return -1;
+				if (antenas != NULL && num < max) {
+					antenas[num].frequencia = (char)ch;
+					antenas[num].x = (COORDENADA)i;
+					antenas[num].y = (COORDENADA)j;
 				}
-				inserirAntenaGrafo(grafo, ch, i, j);
+				num++;
 			}
 		}
-		// Ignora eventual \n aps cada linha (caso no tenha sido lido dentro do loop)
+		// Ignora eventual \n após cada linha (caso não tenha sido lido dentro do loop)
 		fgetc(fp);
 	}
+	return num;
+}
+
+/**
+ * @brief Carrega a informação de um grafo a partir de um ficheiro de texto.
+ *
+ * Esta função lê caractere a caractere de um ficheiro de texto usando @c fgetc
+ * (em vez de um buffer), interpretando cada letra maiúscula como uma antena a ser
+ * inserida na rede. A posição da antena é determinada pelas coordenadas da matriz
+ * onde a letra foi lida.
+ *
+ * O ficheiro é lido duas vezes: a primeira passagem só conta as antenas, a segunda
+ * guarda-as num array com o tamanho exato. Com as contagens, a rede reserva de uma só vez
+ * os vértices de cada grafo e os baldes do índice espacial (@c reservarRede), pelo que a
+ * carga não volta a alocar nó a nó nem a fazer crescer os baldes.
+ *
+ * O grafo correspondente a cada letra é criado através da função @c criarGrafo
+ * e a antena é inserida usando @c inserirAntenaGrafo. Linhas com quebras
+ * de linha são devidamente tratadas durante a leitura.
+ *
+ * @param[in] - rede apontador para a estrutura de rede onde os grafos serão inseridos.
+ * @param[in] - filename nome do ficheiro de texto a ser lido.
+ *
+ * @return 0 em caso de sucesso. Retorna -1 se ocorrer erro na abertura do ficheiro ou na criação do grafo.
+ */
+int carregaGrafo(REDE* rede, char* filename) {
+	FILE* fp = fopen(filename, "r");
+	if (!fp) return -1;
+	ESTAT_INICIO(t);
+
+	// Primeira passagem: só conta as antenas, para reservar tudo antes de inserir
+	int numAntenas = lerAntenasFicheiro(fp, NULL, 0);
+	ANTENAS* antenas = (ANTENAS*)malloc((numAntenas > 0 ? (size_t)numAntenas : 1) * sizeof(ANTENAS));
+	if (!antenas) {
+		fclose(fp);
+		return -1;
+	}
+	rewind(fp);
+	lerAntenasFicheiro(fp, antenas, numAntenas);
 	fclose(fp);
+
+	// Se a reserva falhar, as antenas continuam a ser inseridas uma a uma
+	reservarRede(rede, antenas, numAntenas);
+
+	for (int i = 0; i < numAntenas; i++) {
+		GRAFO* grafo = criarGrafo(rede, antenas[i].frequencia);
+		if (!grafo) {
+			free(antenas);
+			return -1;
+		}
+		inserirAntenaGrafo(grafo, antenas[i].frequencia, antenas[i].x, antenas[i].y);
+	}
+	free(antenas);
+	ESTAT_FIM(rede, EST_CARREGAR, t);
 	return 0;
 }
 
 /**
- * @brief Procura um vrtice no grafo com coordenadas especficas.
+ * @brief Procura um vértice no grafo com coordenadas específicas.
  *
- * Esta funo percorre a lista de vrtices de um grafo e retorna o vrtice
- * que possui as coordenadas @p x e @p y. A comparao  feita com base nas
- * coordenadas da antena associada a cada vrtice.
+ * Esta função percorre a lista de vértices de um grafo e retorna o vértice
+ * que possui as coordenadas @p x e @p y. A comparação é feita com base nas
+ * coordenadas da antena associada a cada vértice. Se o grafo pertencer a uma
+ * rede, só é percorrido o balde (x, y) do índice espacial da rede.
  *
  * @param[in] - grafo apontador para a estrutura do grafo.
  * @param[in] - x coordenada X a procurar.
  * @param[in] - y coordenada Y a procurar.
  *
- * @return Apontador para o vrtice encontrado com as coordenadas correspondentes.
- * Retorna NULL se @p grafo for nulo ou se no for encontrado nenhum vrtice com essas coordenadas.
+ * @return Apontador para o vértice encontrado com as coordenadas correspondentes.
+ * Retorna NULL se @p grafo for nulo ou se não for encontrado nenhum vértice com essas coordenadas.
  */
 VERTICE* encontrarVertice(GRAFO* grafo, int x, int y) {
 	if (grafo == NULL) return NULL;
-	VERTICE* vertice = grafo->vertices;
-	while (vertice != NULL) {
-		if (vertice->infoAntenas &&
-			vertice->infoAntenas->x == x &&
-			vertice->infoAntenas->y == y)
-		{
-			return vertice;
+	ESTAT_INICIO(t);
+
+	VERTICE* vertice;
+	if (grafo->rede && grafo->rede->indice)
+	{
+		vertice = procurarIndiceEspacial(grafo->rede->indice, grafo, x, y, '\0');
+	}
+	else
+	{
+		vertice = grafo->vertices;
+		while (vertice != NULL) {
+			ESTAT_SOMAR(grafo, nosPercorridos, 1);
+			if (vertice->antena.x == x &&
+				vertice->antena.y == y)
+			{
+				break;
+			}
+			vertice = vertice->prox;
 		}
-		vertice = vertice->prox;
 	}
-	return NULL;
+	ESTAT_FIM(grafo, EST_ENCONTRAR_VERTICE, t);
+	return vertice;
 }
 
 /**
- * @brief Guarda num ficheiro binrio a estrutura de um grafo com vrtices e arestas.
+ * @brief Guarda num ficheiro binário a estrutura de um grafo com vértices e arestas.
  *
- * Esta funo percorre uma lista ligada de vrtices (estrutura @c VERTICE) e grava em ficheiro binrio
- * a informao de cada vrtice e respetivas arestas adjacentes, utilizando as estruturas @c VerticeFICHEIRO
+ * Esta função percorre uma lista ligada de vértices (estrutura @c VERTICE) e grava em ficheiro binário
+ * a informação de cada vértice e respetivas arestas adjacentes, utilizando as estruturas @c VerticeFICHEIRO
  * e @c ArestasFICHEIRO.
  *
- * @param[in] - head apontador para o incio da lista de vrtices do grafo.
- * @param[in] - filename nome do ficheiro onde os dados binrios sero guardados.
+ * @param[in] - head apontador para o início da lista de vértices do grafo.
+ * @param[in] - filename nome do ficheiro onde os dados binários serão guardados.
  *
  * @return @c true em caso de sucesso. Retorna @c false se @p head for nulo, se ocorrer erro ao abrir o ficheiro,
  *         ou se falhar a escrita dos dados.
@@ -386,18 +660,18 @@ bool guardarGrafoBin(VERTICE* head, char* filename) {
 
 	while (aux != NULL) {
 
-		auxFicheiro.frequencia = aux->infoAntenas->frequencia;
-		auxFicheiro.x = aux->infoAntenas->x;
-		auxFicheiro.y = aux->infoAntenas->y;
+		auxFicheiro.frequencia = aux->antena.frequencia;
+		auxFicheiro.x = aux->antena.x;
+		auxFicheiro.y = aux->antena.y;
 
 		if (fwrite(&auxFicheiro, sizeof(VerticeFICHEIRO), 1, fp) != 1) {
 			fclose(fp);
 			return false;
 		}
 
-		// Guarda as as conexes entre vrtices no mesmo ficheiro
+		// Guarda as as conexões entre vértices no mesmo ficheiro
 		if (aux->adjacentes) {
-			if (!guardarArestas(aux->adjacentes, fp, aux->infoAntenas->x, aux->infoAntenas->y)) {
+			if (guardarArestas(aux->adjacentes, fp, aux->antena.x, aux->antena.y) != 0) {
 				fclose(fp);
 				return false;
 			}
@@ -409,13 +683,13 @@ bool guardarGrafoBin(VERTICE* head, char* filename) {
 }
 
 /**
- * @brief Guarda as arestas de uma lista ligada num ficheiro binrio.
+ * @brief Guarda as arestas de uma lista ligada num ficheiro binário.
  *
- * Esta funo percorre uma lista ligada de arestas (estrutura @c ARESTA) e grava no ficheiro binrio
- * as informaes de origem e destino de cada aresta, utilizando a estrutura @c ArestasFICHEIRO.
+ * Esta função percorre uma lista ligada de arestas (estrutura @c ARESTA) e grava no ficheiro binário
+ * as informações de origem e destino de cada aresta, utilizando a estrutura @c ArestasFICHEIRO.
  *
- * @param[in] - head apontador para o incio da lista ligada de arestas.
- * @param[in] - fp apontador para o ficheiro binrio onde os dados sero gravados.
+ * @param[in] - head apontador para o início da lista ligada de arestas.
+ * @param[in] - fp apontador para o ficheiro binário onde os dados serão gravados.
  * @param[in] - xOrigem coordenada X da antena de origem.
  * @param[in] - yOrigem coordenada Y da antena de origem.
  *
@@ -431,8 +705,8 @@ int guardarArestas(ARESTA* head, FILE* fp, int xOrigem, int yOrigem) {
 	while (aux) {
 		auxFile.xOrigem = xOrigem;
 		auxFile.yOrigem = yOrigem;
-		auxFile.xDestino = aux->destino->infoAntenas->x;
-		auxFile.yDestino = aux->destino->infoAntenas->y;
+		auxFile.xDestino = aux->destino->antena.x;
+		auxFile.yDestino = aux->destino->antena.y;
 
 		if (fwrite(&auxFile, sizeof(ArestasFICHEIRO), 1, fp) != 1) {
 			return -1;
@@ -446,38 +720,34 @@ int guardarArestas(ARESTA* head, FILE* fp, int xOrigem, int yOrigem) {
 /**
  * @brief Valida a integridade de um grafo.
  *
- * Esta funo verifica se o grafo fornecido est corretamente inicializado e se contm
- * um nmero vlido de vrtices,e tambm confirma se cada vrtice possui informao
- * de antena associada.
+ * Esta função verifica em O(1) se o grafo fornecido está corretamente inicializado, se contém
+ * um número válido de vértices (entre 1 e a capacidade do grafo, @c maxVertices) e se o
+ * primeiro vértice possui informação de antena associada.
  *
  * @param[in] grafo - apontador para a estrutura do grafo a validar.
  *
- * @return @c true se o grafo for vlido.
- *         @c false se for nulo, se no contiver vrtices, se o nmero de vrtices estiver fora dos limites,
- *         ou se faltar informao essencial em algum dos vrtices.
+ * @return @c true se o grafo for válido.
+ *         @c false se for nulo, se não contiver vértices, se o número de vértices estiver fora dos limites,
+ *         ou se faltar informação essencial no primeiro vértice.
  */
 
 bool validarGrafo(GRAFO* grafo) {
 	if (!grafo) return false;
 	if (!grafo->vertices) return false;
 	if (grafo->numVertices <= 0 || grafo->numVertices > grafo->maxVertices) return false;
-	for (int i = 0; i < grafo->numVertices; i++) {
-		if (!grafo->vertices) return false;
-		if (!grafo->vertices->infoAntenas) return false;
-	}
-	return true;
+	return grafo->vertices->antena.frequencia != '\0';
 }
 
 /**
- * @brief Marca todos os vrtices de um grafo como no visitados.
+ * @brief Marca todos os vértices de um grafo como não visitados.
  *
- * Esta funo percorre a lista ligada de vrtices e define o campo
- * 'visitado' de cada vrtice como 0 (no visitado).  til aps
- * execues de algoritmos de busca, como BFS ou DFS, para garantir que
+ * Esta função percorre a lista ligada de vértices e define o campo
+ * 'visitado' de cada vértice como 0 (não visitado). É útil após
+ * execuções de algoritmos de busca, como BFS ou DFS, para garantir que
  * os estados de visitado dos vertices sejam reiniciados corretamente.
  *
- * @param grafo - apontador para o primeiro vrtice do grafo.
- * @return VERTICE* - retorna o apontador para o primeiro vrtice (inalterado).
+ * @param grafo - apontador para o primeiro vértice do grafo.
+ * @return VERTICE* - retorna o apontador para o primeiro vértice (inalterado).
  *
  */
 VERTICE* resetarVisitados(VERTICE* grafo) {
@@ -490,17 +760,17 @@ VERTICE* resetarVisitados(VERTICE* grafo) {
 }
 
 /**
- * @brief Procura um grafo na rede pela frequncia especificada.
+ * @brief Procura um grafo na rede pela frequência especificada.
  *
- * Esta funo percorre a lista de grafos presentes na rede e retorna o grafo
- * que possui a frequncia igual a freq.
+ * Esta função percorre a lista de grafos presentes na rede e retorna o grafo
+ * que possui a frequência igual a freq.
  *
- * @param[in] rede - apontador para a estrutura da rede onde os grafos esto armazenados.
- * @param[in] freq - frequncia do grafo a procurar.
+ * @param[in] rede - apontador para a estrutura da rede onde os grafos estão armazenados.
+ * @param[in] freq - frequência do grafo a procurar.
  *
- * @return Apontador para o grafo encontrado com a frequncia indicada.
+ * @return Apontador para o grafo encontrado com a frequência indicada.
  *         Retorna NULL se a rede for nula, a lista de grafos estiver vazia,
- *         ou se nenhum grafo com a frequncia especificada for encontrado.
+ *         ou se nenhum grafo com a frequência especificada for encontrado.
  */
 GRAFO* encontrarGrafoPorFrequencia(REDE* rede, char freq) {
 	if (rede == NULL || rede->listaGrafos == NULL)
@@ -513,17 +783,17 @@ GRAFO* encontrarGrafoPorFrequencia(REDE* rede, char freq) {
 		atual = atual->prox;
 	}
 
-	return NULL;  // Grafo com a frequncia no encontrado
+	return NULL;  // Grafo com a frequência não encontrado
 }
 
 /**
- * @brief Liberta toda a memria ocupada pela lista de arestas ligada a um vrtice.
+ * @brief Liberta toda a memória ocupada pela lista de arestas ligada a um vértice.
  *
- * Esta funo percorre a lista de arestas apontada por 'lista', libertando uma a uma
- * da memria. No final, devolve NULL para indicar que a lista foi destruda.
+ * Esta função percorre a lista de arestas apontada por 'lista', libertando uma a uma
+ * da memória. No final, devolve NULL para indicar que a lista foi destruída.
  *
- * @param lista apontador para o incio da lista de arestas.
- * @return NULL, indicando que a lista foi destruda com sucesso.
+ * @param lista apontador para o início da lista de arestas.
+ * @return NULL, indicando que a lista foi destruída com sucesso.
  */
 ARESTA* destruirArestas(ARESTA* lista) {
 	ARESTA* atual;
@@ -536,22 +806,20 @@ ARESTA* destruirArestas(ARESTA* lista) {
 }
 
 /**
- * @brief Liberta todos os vrtices de um grafo, incluindo as suas arestas e informao associada.
+ * @brief Liberta todos os vértices de um grafo, incluindo as suas arestas e informação associada.
  *
- * Esta funo percorre a lista de vrtices de um grafo. Para cada vrtice:
+ * Esta função percorre a lista de vértices de um grafo. Para cada vértice:
  * - Liberta a sua lista de arestas com 'destruirArestas'
- * - Liberta a estrutura 'ANTENAS' associada
- * - Liberta o prprio vrtice
+ * - Liberta o próprio vértice (que inclui os dados da antena)
  *
- * @param lista - apontador para o incio da lista de vrtices.
- * @return - NULL, indicando que todos os vrtices foram destrudos.
+ * @param lista - apontador para o início da lista de vértices.
+ * @return - NULL, indicando que todos os vértices foram destruídos.
  */
 VERTICE* destruirVertices(VERTICE* lista) {
 	VERTICE* aux;
 	while (lista) {
 		aux = lista->prox;
 		lista->adjacentes = destruirArestas(lista->adjacentes);
-		free(lista->infoAntenas);
 		free(lista);
 		lista = aux;
 	}
@@ -559,38 +827,277 @@ VERTICE* destruirVertices(VERTICE* lista) {
 }
 
 /**
- * @brief Liberta completamente um grafo da memria, incluindo todos os seus vrtices e arestas.
+ * @brief Liberta completamente um grafo da memória, incluindo todos os seus vértices e arestas.
  *
- * Esta funo elimina todos os vrtices do grafo com a funo 'destruirVertices'
- * e de seguida liberta o prprio grafo.
+ * Esta função retira o grafo da lista de grafos da rede, as suas consultas da cache da rede e os
+ * seus vértices do índice espacial e da grelha da rede, elimina todos os vértices do grafo com a função 'destruirVertices' e de
+ * seguida liberta o próprio grafo.
  *
  * @param grafo - apontador para o grafo a destruir.
- * @return - NULL, pois o grafo  completamente removido da memria.
+ * @return - NULL, pois o grafo é completamente removido da memória.
  */
 GRAFO* destruirGrafo(GRAFO* grafo) {
-	if (grafo == NULL) return;
-	grafo->vertices = destruirVertices(grafo->vertices);
+	if (grafo == NULL) return NULL;
+	descartarMatrizAdjacencia(grafo);
+	if (grafo->rede)
+	{
+		GRAFO** ligacao = &grafo->rede->listaGrafos;
+		while (*ligacao != NULL && *ligacao != grafo) {
+			ligacao = &(*ligacao)->prox;
+		}
+		if (*ligacao == grafo) *ligacao = grafo->prox;
+		marcarAlteracaoGrafo(grafo);
+		invalidarCacheGrafo(grafo->rede->cache, grafo);
+
+		for (VERTICE* v = grafo->vertices; v != NULL; v = v->prox) {
+			removerIndiceEspacial(grafo->rede->indice, v);
+			limparGrelha(grafo->rede, grafo, v->antena.x, v->antena.y);
+		}
+	}
+	if (grafo->bloco == NULL && grafo->reserva == NULL)
+	{
+		grafo->vertices = destruirVertices(grafo->vertices);
+	}
+	else
+	{
+		VERTICE* v = grafo->vertices;
+		while (v) {
+			VERTICE* prox = v->prox;
+			while (v->adjacentes) {
+				ARESTA* adj = v->adjacentes;
+				v->adjacentes = adj->prox;
+				libertarArestaGrafo(grafo, adj);
+			}
+			libertarVerticeGrafo(grafo, v);
+			v = prox;
+		}
+		grafo->bloco = destruirBlocoGrafo(grafo->bloco);
+		grafo->reserva = destruirReservaGrafo(grafo->reserva);
+	}
+	grafo->antinodos = destruirAntinodos(grafo->antinodos);
 	free(grafo);
+	return NULL;
+}
+
+/**
+ * @brief Liberta uma rede inteira: todos os grafos, a cache de consultas, a grelha de ocupação e o índice espacial.
+ *
+ * Os grafos são destruídos sem os retirar um a um da grelha e do índice espacial, uma vez que
+ * estes são libertados de uma só vez no fim.
+ *
+ * @param rede - apontador para a rede a destruir (pode ser NULL).
+ * @return - NULL, indicando que a rede foi destruída.
+ */
+REDE* destruirRede(REDE* rede) {
+	if (rede == NULL) return NULL;
+
+	GRAFO* grafo = rede->listaGrafos;
+	while (grafo) {
+		GRAFO* prox = grafo->prox;
+		grafo->rede = NULL;
+		destruirGrafo(grafo);
+		grafo = prox;
+	}
+	rede->listaGrafos = NULL;
+	rede->cache = destruirCacheConsultas(rede->cache);
+	rede->grelha = destruirGrelha(rede->grelha);
+	rede->indice = destruirIndiceEspacial(rede->indice);
+	free(rede);
+	return NULL;
+}
+
+/**
+ * @brief Remove uma aresta e a respetiva aresta inversa em O(1).
+ *
+ * A aresta é retirada da lista do vértice de origem (obtido através da aresta inversa)
+ * e a inversa é retirada da lista do vértice destino, usando os apontadores @c ant/@c prox,
+ * sem percorrer nenhuma lista. Ambas as arestas são libertadas.
+ *
+ * @param[in,out] grafo - apontador para o grafo que contém a aresta.
+ * @param[in] aresta - apontador para a aresta a remover.
+ *
+ * @return @c 0 se a remoção for bem-sucedida,
+ *         @c 1 se algum apontador for nulo ou a aresta não tiver inversa.
+ */
+int removerAresta(GRAFO* grafo, ARESTA* aresta) {
+	if (grafo == NULL || aresta == NULL || aresta->inversa == NULL) return 1;
+
+	ARESTA* inversa = aresta->inversa;
+	VERTICE* origem = inversa->destino;
+	VERTICE* destino = aresta->destino;
+
+	desligarAresta(origem, aresta);
+	desligarAresta(destino, inversa);
+	libertarArestaGrafo(grafo, aresta);
+	libertarArestaGrafo(grafo, inversa);
+
+	desligarMatriz(grafo, origem, destino);
+	adaptarMatrizAdjacencia(grafo);
+	marcarAlteracaoGrafo(grafo);
+	return 0;
+}
+
+/**
+ * @brief Remove a ligação (nos dois sentidos) entre os vértices (x1, y1) e (x2, y2).
+ *
+ * Os vértices são localizados pelo índice espacial da rede e a aresta é procurada apenas
+ * na lista de adjacências do vértice com menor grau; a remoção em si é feita em O(1)
+ * com @c removerAresta. Se existirem ligações repetidas, apenas uma é removida.
+ *
+ * @param[in,out] grafo - apontador para o grafo.
+ * @param[in] x1 - coordenada X do primeiro vértice.
+ * @param[in] y1 - coordenada Y do primeiro vértice.
+ * @param[in] x2 - coordenada X do segundo vértice.
+ * @param[in] y2 - coordenada Y do segundo vértice.
+ *
+ * @return @c 0 se a ligação foi removida,
+ *         @c 1 se o grafo for nulo, algum dos vértices não existir ou não estiverem ligados.
+ */
+int removerLigacao(GRAFO* grafo, int x1, int y1, int x2, int y2) {
+	if (grafo == NULL) return 1;
+	ESTAT_INICIO(t);
+
+	VERTICE* v1 = encontrarVertice(grafo, x1, y1);
+	VERTICE* v2 = encontrarVertice(grafo, x2, y2);
+	if (!v1 || !v2) return 1;
+
+	if (v2->grau < v1->grau)
+	{
+		VERTICE* aux = v1;
+		v1 = v2;
+		v2 = aux;
+	}
+	for (ARESTA* adj = v1->adjacentes; adj != NULL; adj = adj->prox) {
+		ESTAT_SOMAR(grafo, arestasPercorridas, 1);
+		if (adj->destino == v2)
+		{
+			removerAresta(grafo, adj);
+			ESTAT_FIM(grafo, EST_REMOVER_LIGACAO, t);
+			return 0;
+		}
+	}
+	return 1;
+}
+
+/**
+ * @brief Remove uma antena do grafo, incluindo todas as ligações a essa antena.
+ *
+ * Cada aresta do vértice é removida com @c removerAresta, que retira também a aresta
+ * inversa da lista do vizinho em O(1); o custo total é proporcional ao grau do vértice.
+ * O vértice é depois retirado da lista do grafo (também em O(1)), do índice espacial
+ * e da grelha da rede, e a memória do vértice e da antena é libertada.
+ *
+ * @param[in,out] grafo - apontador para o grafo.
+ * @param[in] x - coordenada X da antena a remover.
+ * @param[in] y - coordenada Y da antena a remover.
+ *
+ * @return @c 0 se a antena foi removida,
+ *         @c 1 se o grafo for nulo ou a antena não existir.
+ */
+int removerAntenaGrafo(GRAFO* grafo, int x, int y) {
+	if (grafo == NULL) return 1;
+	ESTAT_INICIO(t);
+
+	VERTICE* vertice = encontrarVertice(grafo, x, y);
+	if (vertice == NULL) return 1;
+
+	atualizarAntinodosAntena(grafo, vertice, -1);
+	while (vertice->adjacentes) {
+		removerAresta(grafo, vertice->adjacentes);
+	}
+
+	if (vertice->ant)
+	{
+		vertice->ant->prox = vertice->prox;
+	}
+	else
+	{
+		grafo->vertices = vertice->prox;
+	}
+	if (vertice->prox)
+	{
+		vertice->prox->ant = vertice->ant;
+	}
+	grafo->numVertices--;
+	removerVerticeMatriz(grafo, vertice);
+	adaptarMatrizAdjacencia(grafo);
+	marcarAlteracaoGrafo(grafo);
+
+	if (grafo->rede)
+	{
+		removerIndiceEspacial(grafo->rede->indice, vertice);
+		limparGrelha(grafo->rede, NULL, x, y);
+	}
+
+	libertarVerticeGrafo(grafo, vertice);
+	ESTAT_FIM(grafo, EST_REMOVER_ANTENA, t);
 	return 0;
 }
 
+/**
+ * @brief Liberta um vértice, exceto se estiver no bloco contíguo do grafo.
+ *
+ * Depois de @c reordenarGrafo, os vértices estão num array do bloco do grafo e
+ * só são libertados com o bloco; os vértices inseridos depois continuam a ser alocados um a um.
+ * Os vértices reservados (ver @c reservarGrafo) voltam à reserva, para a inserção seguinte.
+ *
+ * @param[in] grafo - apontador para o grafo que contém o vértice.
+ * @param[in] vertice - apontador para o vértice (já retirado da lista do grafo).
+ */
+void libertarVerticeGrafo(GRAFO* grafo, VERTICE* vertice) {
+	if (vertice == NULL) return;
+
+	BLOCO_GRAFO* bloco = grafo ? grafo->bloco : NULL;
+	if (bloco == NULL || !dentroBloco(vertice, bloco->vertices, bloco->numVertices, sizeof(VERTICE)))
+	{
+		if (!devolverVerticeReserva(grafo, vertice)) free(vertice);
+	}
+	atualizarCapacidadeGrafo(grafo);
+}
+
+/**
+ * @brief Liberta uma aresta, exceto se estiver no bloco contíguo do grafo (as arestas reservadas voltam à reserva).
+ *
+ * @param[in] grafo - apontador para o grafo que contém a aresta.
+ * @param[in] aresta - apontador para a aresta (já retirada da lista de adjacências).
+ */
+void libertarArestaGrafo(GRAFO* grafo, ARESTA* aresta) {
+	if (aresta == NULL) return;
+
+	BLOCO_GRAFO* bloco = grafo ? grafo->bloco : NULL;
+	if (bloco == NULL || !dentroBloco(aresta, bloco->arestas, bloco->numArestas, sizeof(ARESTA)))
+	{
+		if (!devolverArestaReserva(grafo, aresta)) free(aresta);
+	}
+}
+
 bool existeConexao(ARESTA* head, int xDestino, int yDestino) {
 	if (head == NULL) return false;
-	if (head->destino->infoAntenas->x == xDestino && head->destino->infoAntenas->y == yDestino)
+	if (head->destino->antena.x == xDestino && head->destino->antena.y == yDestino)
 		return true;
 	return existeConexao(head->prox, xDestino, yDestino);
 }
 
 bool existeConexaoEntreVertices(GRAFO* grafo, int xOrigem, int yOrigem, int xDestino, int yDestino) {
+	CACHE_CONSULTAS* cache = cacheGrafo(grafo);
+	CHAVE_CONSULTA chave = { grafo, CONSULTA_CONEXAO, { xOrigem, yOrigem, xDestino, yDestino } };
+	int guardado;
+	if (cache && procurarCache(cache, &chave, &guardado)) return guardado != 0;
+
 	VERTICE* verticeOrigem = encontrarVertice(grafo, xOrigem, yOrigem);
 	if (verticeOrigem == NULL) return false;
 
-	return existeConexao(verticeOrigem->adjacentes, xDestino, yDestino);
+	// Grafo pequeno e denso: basta ler o bit da matriz de adjacências
+	bool ligados = grafo->matriz
+		? ligadosMatriz(grafo->matriz, verticeOrigem, encontrarVertice(grafo, xDestino, yDestino))
+		: existeConexao(verticeOrigem->adjacentes, xDestino, yDestino);
+	guardarCache(cache, &chave, ligados);
+	return ligados;
 }
 
 #pragma endregion
 
-#pragma region Funes Auxiliares para o BFS
+#pragma region Funções Auxiliares para o BFS
 
 /**
  * @brief Inicializa uma fila vazia.
@@ -606,30 +1113,30 @@ void criarFila(FILA* fila) {
 }
 
 /**
- * @brief Verifica se a fila est vazia.
+ * @brief Verifica se a fila está vazia.
  *
- * Esta funo verifica se a fila tem elementos, retornando true se estiver vazia
- * (ou seja, se o campo frente for NULL), ou falso caso contrrio.
+ * Esta função verifica se a fila tem elementos, retornando true se estiver vazia
+ * (ou seja, se o campo frente for NULL), ou falso caso contrário.
  *
  * @param[in] fila - apontador para a fila a ser verificada.
  *
  * @return @c true se a fila estiver vazia,
- *         @c false caso contrrio.
+ *         @c false caso contrário.
  */
 bool filaVazia(FILA* fila) {
 	return(fila->frente == NULL);
 }
 
 /**
- * @brief Adiciona um vrtice ao final da fila.
+ * @brief Adiciona um vértice ao final da fila.
  *
- * Esta funo cria um novo n para a fila contendo o vrtice indicado e insere-o no final.
+ * Esta função cria um novo nó para a fila contendo o vértice indicado e insere-o no final.
  *
- * @param[in,out] fila - apontador para a fila onde o vrtice ser inserido.
- * @param[in] vertice - apontador para o vrtice a ser enfileirado.
+ * @param[in,out] fila - apontador para a fila onde o vértice será inserido.
+ * @param[in] vertice - apontador para o vértice a ser enfileirado.
  *
- * @return @c true se a insero foi bem-sucedida,
- *         @c false caso no tenha sido possvel alocar memria para o novo n.
+ * @return @c true se a inserção foi bem-sucedida,
+ *         @c false caso não tenha sido possível alocar memória para o novo nó.
  */
 bool enfilarVertice(FILA* fila, VERTICE* vertice) {
 	NOFILA* novo = (NOFILA*)malloc(sizeof(NOFILA));
@@ -650,14 +1157,14 @@ bool enfilarVertice(FILA* fila, VERTICE* vertice) {
 }
 
 /**
- * @brief Remove e retorna o vrtice no incio da fila.
+ * @brief Remove e retorna o vértice no início da fila.
  *
- * Esta funo retira o primeiro n da fila, libera a memria desse n,
- * e retorna o vrtice que ele continha. Se a fila estiver vazia, retorna NULL.
+ * Esta função retira o primeiro nó da fila, libera a memória desse nó,
+ * e retorna o vértice que ele continha. Se a fila estiver vazia, retorna NULL.
  *
- * @param[in,out] fila - apontador para a fila de onde ser removido o vrtice.
+ * @param[in,out] fila - apontador para a fila de onde será removido o vértice.
  *
- * @return Apontador para o vrtice removido da fila,
+ * @return Apontador para o vértice removido da fila,
  *         ou NULL se a fila estiver vazia.
  */
 VERTICE* desenfilarVertice(FILA* fila) {
@@ -677,18 +1184,21 @@ VERTICE* desenfilarVertice(FILA* fila) {
 }
 
 /**
- * @brief Realiza uma busca em largura (Breadth-First Traversal) no grafo a partir do vrtice dado.
+ * @brief Realiza uma busca em largura (Breadth-First Traversal) no grafo a partir do vértice dado.
  *
- * Inicia a travessia no vrtice com coordenadas (x, y) e conta quantos vrtices so visitados.
- * Marca os vrtices visitados durante a travessia e no final limpa o estado visitado para todos.
+ * Inicia a travessia no vértice com coordenadas (x, y) e conta quantos vértices são visitados.
+ * Marca os vértices visitados durante a travessia e no final limpa o estado visitado para todos.
+ * Se o grafo tiver matriz de adjacências, a contagem é feita sobre os bits da matriz.
+ * Com a cache de consultas da rede ativa, uma contagem já feita desde a última alteração ao
+ * grafo é devolvida sem percorrer o grafo.
  *
- * @param[in,out] grafo - apontador para o grafo onde ser realizada a travessia.
- * @param[in] x - coordenada x do vrtice inicial.
- * @param[in] y - coordenada y do vrtice inicial.
- * @param[out] count - apontador para inteiro onde ser armazenado o nmero de vrtices visitados.
+ * @param[in,out] grafo - apontador para o grafo onde será realizada a travessia.
+ * @param[in] x - coordenada x do vértice inicial.
+ * @param[in] y - coordenada y do vértice inicial.
+ * @param[out] count - apontador para inteiro onde será armazenado o número de vértices visitados.
  *
  * @return @c 0 se a travessia foi executada com sucesso,
- *         @c 1 se o grafo for invlido, estiver vazio ou o vrtice inicial no for encontrado.
+ *         @c 1 se o grafo for inválido, estiver vazio ou o vértice inicial não for encontrado.
  */
 int BFT(GRAFO* grafo, int x, int y, int* count) {
 	if (!grafo || grafo->numVertices == 0)
@@ -696,10 +1206,24 @@ int BFT(GRAFO* grafo, int x, int y, int* count) {
 		return 1;
 	}
 	*count = 0;
+	CACHE_CONSULTAS* cache = cacheGrafo(grafo);
+	CHAVE_CONSULTA chave = { grafo, CONSULTA_BFT, { x, y, 0, 0 } };
+	if (cache && procurarCache(cache, &chave, count)) return 0;
+	ESTAT_INICIO(t);
 
 	VERTICE* inicio = encontrarVertice(grafo, x, y);
 	if (!inicio) return 1;
 
+	// Grafo pequeno e denso: a fronteira de cada nível é o OR das linhas da matriz de adjacências
+	if (grafo->matriz)
+	{
+		*count = contarAlcancaveisMatriz(grafo->matriz, inicio);
+		resetarVisitados(grafo->vertices);
+		guardarCache(cache, &chave, *count);
+		ESTAT_FIM(grafo, EST_BFT, t);
+		return 0;
+	}
+
 	VERTICE* vertice = grafo->vertices;
 	while (vertice) {
 		vertice->visitado = 0;
@@ -711,18 +1235,24 @@ int BFT(GRAFO* grafo, int x, int y, int* count) {
 
 	inicio->visitado = 1;
 	enfilarVertice(&fila, inicio);
+	ESTAT_SOMAR(grafo, operacoesFila, 1);
+	ESTAT_ALOCACOES(grafo, EST_BFT, 1);
 
 	while (!filaVazia(&fila)) {
 		VERTICE* atual = desenfilarVertice(&fila);
+		ESTAT_SOMAR(grafo, operacoesFila, 1);
 		(*count)++;
 
 		ARESTA* adj = atual->adjacentes;
 		while (adj) {
 			VERTICE* vizinho = adj->destino;
+			ESTAT_SOMAR(grafo, arestasPercorridas, 1);
 			if (!vizinho->visitado)
 			{
 				vizinho->visitado = 1;
 				enfilarVertice(&fila, vizinho);
+				ESTAT_SOMAR(grafo, operacoesFila, 1);
+				ESTAT_ALOCACOES(grafo, EST_BFT, 1);
 			}
 			adj = adj->prox;
 		}
@@ -730,40 +1260,87 @@ int BFT(GRAFO* grafo, int x, int y, int* count) {
 	}
 
 	resetarVisitados(grafo->vertices);
+	guardarCache(cache, &chave, *count);
 
+	ESTAT_FIM(grafo, EST_BFT, t);
 	return 0;
 }
 int DFS(GRAFO* grafo, int x, int y) {
 	if (grafo == NULL) return 1;
 	if (x > MAX_DIM || x < 0 || y > MAX_DIM || y < 0) return 2;
 
+	ESTAT_INICIO(t);
+
 	VERTICE* vertice = encontrarVertice(grafo, x, y);
 	if (!vertice) return 3;
 
-	ARESTA* adj = vertice->adjacentes;
+	// Pilha explícita com a próxima aresta a explorar de cada vértice do caminho atual,
+	// para que a profundidade da procura não dependa da pilha de chamadas
+	int capacidade = 64;
+	int topo = 0;
+	ARESTA** pilha = (ARESTA**)malloc((size_t)capacidade * sizeof(ARESTA*));
+	if (pilha == NULL) return 4;
+	ESTAT_ALOCACOES(grafo, EST_DFS, 1);
+
 	vertice->visitado = 1;
+	pilha[topo++] = vertice->adjacentes;
+
+	while (topo > 0) {
+		ARESTA* adj = pilha[topo - 1];
+		if (adj == NULL)
+		{
+			topo--;
+			continue;
+		}
+		pilha[topo - 1] = adj->prox;
+		ESTAT_SOMAR(grafo, arestasPercorridas, 1);
 
-	while (adj) {
 		VERTICE* vizinho = adj->destino;
 		if (!vizinho->visitado)
 		{
 			vizinho->visitado = 1;
-			printf("Antena alcancada: (%d,%d)\n", vizinho->infoAntenas->x, vizinho->infoAntenas->y);
-			DFS(grafo, vizinho->infoAntenas->x, vizinho->infoAntenas->y);
+			REGISTAR_INFO("Antena alcancada: (%d,%d)\n", vizinho->antena.x, vizinho->antena.y);
+
+			if (topo == capacidade)
+			{
+				ARESTA** nova = (ARESTA**)realloc(pilha, (size_t)capacidade * 2 * sizeof(ARESTA*));
+				if (nova == NULL)
+				{
+					free(pilha);
+					return 4;
+				}
+				pilha = nova;
+				capacidade *= 2;
+				ESTAT_ALOCACOES(grafo, EST_DFS, 1);
+			}
+			pilha[topo++] = vizinho->adjacentes;
 		}
-		adj = adj->prox;
 	}
+	free(pilha);
+	ESTAT_FIM(grafo, EST_DFS, t);
 	return 0;
 }
 
 int countPathsDFS(GRAFO* grafo, int xOrigem, int yOrigem, int xDestino, int yDestino) {
 	if (grafo == NULL) return -1;
+	CACHE_CONSULTAS* cache = cacheGrafo(grafo);
+	CHAVE_CONSULTA chave = { grafo, CONSULTA_CAMINHOS, { xOrigem, yOrigem, xDestino, yDestino } };
+	int guardado;
+	if (cache && procurarCache(cache, &chave, &guardado)) return guardado;
+	ESTAT_INICIO(t);
 
 	VERTICE* origem = encontrarVertice(grafo, xOrigem, yOrigem);
 	VERTICE* destino = encontrarVertice(grafo, xDestino, yDestino);
 	if (!origem || !destino) return -1;
 
-	return countPaths(origem, destino);
+	// Com a matriz (e sem ligações repetidas, que o countPaths conta uma a uma) os caminhos são
+	// enumerados sobre os bits
+	int total = grafo->matriz && grafo->matriz->repetidas == 0
+		? contarCaminhosMatriz(grafo->matriz, origem, destino)
+		: countPaths(origem, destino);
+	guardarCache(cache, &chave, total);
+	ESTAT_FIM(grafo, EST_CONTAR_CAMINHOS, t);
+	return total;
 }
 
 int countPaths(VERTICE* origem, VERTICE* destino) {
@@ -786,39 +1363,63 @@ int countPaths(VERTICE* origem, VERTICE* destino) {
 	return totalPaths;
 }
 
+/**
+ * @brief Acrescenta ao início da lista um nó com a frequência e as coordenadas indicadas.
+ *
+ * O nó fica associado ao vértice da antena dessa frequência em (x, y), se existir, mas guarda a
+ * sua própria cópia da posição; as posições calculadas pelo efeito nefasto usam a frequência '#'
+ * e não têm vértice.
+ *
+ * @param[in] rede - apontador para a rede.
+ * @param[in,out] nefasto - apontador para o início da lista.
+ * @param[in] frequencia - frequência do nó.
+ * @param[in] x - coordenada X do nó.
+ * @param[in] y - coordenada Y do nó.
+ */
 void inserirEfeitoNefasto(REDE* rede, NEFASTO** nefasto, char frequencia, int x, int y) {
-	NEFASTO* novoNefasto = (NEFASTO*)malloc(sizeof(NEFASTO));
-	if (novoNefasto == NULL) return NULL;
-
-	VERTICE* vertice = encontrarVertice(rede->listaGrafos, x, y);
-	if (vertice = NULL) {
-		free(novoNefasto);
-		return;
-	}
+	if (rede == NULL || nefasto == NULL) return;
+	if (x < 0 || x >= MAX_DIM || y < 0 || y >= MAX_DIM) return;
 
-	vertice->infoAntenas->frequencia = frequencia;
-	novoNefasto->vertice = vertice;
+	NEFASTO* novoNefasto = (NEFASTO*)malloc(sizeof(NEFASTO));
+	if (novoNefasto == NULL) return;
+	ESTAT_ALOCACOES(rede, EST_NEFASTO, 1);
+
+	// Só é guardada uma cópia da posição: o vértice (se existir) nunca é alterado
+	novoNefasto->vertice = encontrarVertice(encontrarGrafoPorFrequencia(rede, frequencia), x, y);
+	novoNefasto->antena.x = (COORDENADA)x;
+	novoNefasto->antena.y = (COORDENADA)y;
+	novoNefasto->antena.frequencia = frequencia;
 	novoNefasto->prox = *nefasto;
 	*nefasto = novoNefasto;
 }
 
+/**
+ * @brief Calcula as posições com efeito nefasto dos pares de nós da lista com a mesma frequência.
+ *
+ * Compara as cópias guardadas nos nós; nem a lista nem os vértices da rede são alterados. As posições
+ * são apenas escritas no registo, sem alocar nós: quem precisar de as guardar usa os antinodos do grafo.
+ *
+ * @param[in] rede - apontador para a rede.
+ * @param[in] nefasto - lista de nós a analisar.
+ * @return true se a análise foi feita, false se a lista ou a rede estiverem vazias.
+ */
 bool efeitoNefasto(REDE* rede, NEFASTO* nefasto) {
 
 	if (nefasto == NULL) return false;
 
-	rede = rede->listaGrafos;
-	if (rede->listaGrafos == NULL) return false;
+	if (rede == NULL || rede->listaGrafos == NULL) return false;
+	ESTAT_INICIO(t);
 
 	NEFASTO* aux1;
 	NEFASTO* aux2;
 	for (aux1 = nefasto; aux1 != NULL; aux1 = aux1->prox) {
 		for (aux2 = aux1->prox; aux2 != NULL; aux2 = aux2->prox) {
-			if (aux1->vertice->infoAntenas == aux2->vertice->infoAntenas) {
-				int x1 = aux1->vertice->infoAntenas->x;
-				int x2 = aux2->vertice->infoAntenas->x;
-				int y1 = aux1->vertice->infoAntenas->y;
-				int y2 = aux2->vertice->infoAntenas->y;
-				printf("Antena x1y1: (%d, %d) && Antena x2y2: (%d, %d)", x1, y1, x2, y2);
+			if (aux1->antena.frequencia == aux2->antena.frequencia) {
+				int x1 = aux1->antena.x;
+				int x2 = aux2->antena.x;
+				int y1 = aux1->antena.y;
+				int y2 = aux2->antena.y;
+				REGISTAR_DEPURACAO("Antena x1y1: (%d, %d) && Antena x2y2: (%d, %d)", x1, y1, x2, y2);
 
 				if (x2 >= x1 + 2 || x1 >= x2 + 2 || x2 <= x1 - 2 || x1 <= x2 - 2)
 				{
@@ -846,36 +1447,29 @@ bool efeitoNefasto(REDE* rede, NEFASTO* nefasto) {
 						newY2 = y2 - numPosY;
 					}
 
-					printf("\nPosicoes do efeito nefasto: x1y1: (%d, %d) | x2y2: (%d, %d)\n", newX1, newY1, newX2, newY2); // Mostrar as posies do efeito nefasto
+					REGISTAR_INFO("\nPosicoes do efeito nefasto: x1y1: (%d, %d) | x2y2: (%d, %d)\n", newX1, newY1, newX2, newY2); // Mostrar as posições do efeito nefasto
 
-					if (newX1 >= 0 && newX1 < MAX_DIM && newY1 >= 0 && newY1 < MAX_DIM) { // verificar se newX1 e newY1 esto dentro dos limites vlidos da cidade
-						inserirEfeitoNefasto(rede, &nefasto, '#', newX1, newY1);
-					}
-					else
-					{
-						printf("\nEfeito nefasto fora de limite x1y1: (%d, %d)", newX1, newY1);
+					if (newX1 < 0 || newX1 >= MAX_DIM || newY1 < 0 || newY1 >= MAX_DIM) { // verificar se newX1 e newY1 estão dentro dos limites válidos da cidade
+						REGISTAR_INFO("\nEfeito nefasto fora de limite x1y1: (%d, %d)", newX1, newY1);
 					}
 
-					if (newX2 >= 0 && newX2 < MAX_DIM && newY2 >= 0 && newY2 < MAX_DIM) { // verificar se newX2 e newY2 esto dentro dos limites vlidos da cidade
-						inserirEfeitoNefasto(rede, &nefasto, '#', newX2, newY2);
-					}
-					else
-					{
-						printf("\nEfeito nefasto fora de limite x2y2: (%d, %d)", newX2, newY2);
+					if (newX2 < 0 || newX2 >= MAX_DIM || newY2 < 0 || newY2 >= MAX_DIM) { // verificar se newX2 e newY2 estão dentro dos limites válidos da cidade
+						REGISTAR_INFO("\nEfeito nefasto fora de limite x2y2: (%d, %d)", newX2, newY2);
 					}
 				}
 				else
 				{
-					printf("\nAntenas muito proximas!");
+					REGISTAR_DEPURACAO("\nAntenas muito proximas!");
 				}
 			}
 			else {
-				printf("\nAntenas com frequencias diferentes!");
+				REGISTAR_DEPURACAO("\nAntenas com frequencias diferentes!");
 			}
 
-			printf("\n --------------------------- \n");
+			REGISTAR_DEPURACAO("\n --------------------------- \n");
 		}
 	}
+	ESTAT_FIM(rede, EST_NEFASTO, t);
 	return true;
 }
 #pragma endregion
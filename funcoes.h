@@ -2,72 +2,110 @@
 
 /**
  * @funcoes.h
- * @brief Definies de estruturas e funes para a gesto de redes de antenas no grafo
+ * @brief Definições de estruturas e funções para a gestão de redes de antenas no grafo
  *
- * @author Rogrio Picas
+ * @author Rogério Picas
  * @date 07-05-2025
  * @version 1.0
  *
  */
 #define _CRT_SECURE_NO_WARNINGS
 #include <stdbool.h>
+#include <stdint.h>
+#include "estatisticas.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
 
  /** @def MAX_DIM
-  *  @brief Dimenso da matriz da cidade.
+  *  @brief Dimensão da matriz da cidade (pode ser redefinida na compilação, ex.: -DMAX_DIM=4096).
   */
+#ifndef MAX_DIM
 #define MAX_DIM 20
+#endif
+
+ /** @typedef COORDENADA
+  *  @brief Tipo das coordenadas de uma antena: 16 bits quando a cidade cabe (MAX_DIM <= 32767), 32 bits caso contrário.
+  */
+#if MAX_DIM <= INT16_MAX
+typedef int16_t COORDENADA;
+#else
+typedef int32_t COORDENADA;
+#endif
 
 #pragma region Estruturas
 
    /**
     * @struct Antenas
-    * @brief Representa uma antena com frequncia e posio na matriz da cidade.
+    * @brief Representa uma antena com frequência e posição na matriz da cidade.
     */
 typedef struct Antenas {
-    char frequencia; /**< Frequncia da antena (A-Z) */
-    int x;           /**< Coordenada X na matriz */
-    int y;           /**< Coordenada Y na matriz */
+    COORDENADA x;    /**< Coordenada X na matriz */
+    COORDENADA y;    /**< Coordenada Y na matriz */
+    char frequencia; /**< Frequência da antena (A-Z) */
 } ANTENAS;
 
 /**
  * @struct Aresta
- * @brief Representa uma aresta (conexo) entre vrtices no grafo.
+ * @brief Representa uma aresta (conexão) entre vértices no grafo.
  */
 typedef struct Aresta {
-    struct Vertice* destino; /**< Apontador para o vrtice destino da aresta */
-    struct Aresta* prox;     /**< Apontador para a prxima aresta na lista ligada */
+    struct Vertice* destino; /**< Apontador para o vértice destino da aresta */
+    struct Aresta* prox;     /**< Apontador para a próxima aresta na lista ligada */
+    struct Aresta* ant;      /**< Apontador para a aresta anterior na lista ligada (remoção em O(1)) */
+    struct Aresta* inversa;  /**< Apontador para a aresta no sentido contrário, na lista do vértice destino */
 } ARESTA;
 
 /**
  * @struct Vertice
- * @brief Representa um vrtice no grafo, contendo a antena e as ligaes.
+ * @brief Representa um vértice no grafo, contendo a antena e as ligações.
+ *
+ * Os dados da antena estão guardados no próprio vértice (e não numa estrutura alocada à parte),
+ * para que as procuras por posição ou frequência não precisem de seguir mais um apontador;
+ * com coordenadas de 16 bits o vértice inteiro cabe em 48 bytes.
  */
 typedef struct Vertice {
-    ANTENAS* infoAntenas; /**< Apontador para a antena associada ao vrtice */
-    ARESTA* adjacentes;   /**< Lista ligada das arestas (ligaes) para outros vrtices */
-    int visitado;         /**< Indicador se o vrtice foi visitado */
-    struct Vertice* prox; /**< Apontador para o prximo vrtice na lista do grafo */
+    ARESTA* adjacentes;   /**< Lista ligada das arestas (ligações) para outros vértices */
+    struct Vertice* prox; /**< Apontador para o próximo vértice na lista do grafo */
+    struct Vertice* ant;  /**< Apontador para o vértice anterior na lista do grafo (remoção em O(1)) */
+    int visitado;         /**< Indicador se o vértice foi visitado */
+    int indice;           /**< Índice auxiliar atribuído pela última vista que numerou o vértice */
+    int id;               /**< Número de ordem de inserção no grafo (não muda quando o grafo é reordenado) */
+    int grau;             /**< Número de arestas na lista de adjacências */
+    ANTENAS antena;       /**< Frequência e coordenadas da antena associada ao vértice */
+    signed char posicaoMatriz; /**< Posição na matriz de adjacências do grafo (-1 se o grafo não tiver matriz) */
 } VERTICE;
 
 /**
  * @struct Grafo
- * @brief Representa um grafo contendo uma lista de vrtices e outras informaes.
+ * @brief Representa um grafo contendo uma lista de vértices e outras informações.
  */
 typedef struct Grafo {
-    char frequencia;     /**< Frequncia comum a todas as antenas do grafo */
-    VERTICE* vertices;   /**< Apontador para a lista de vrtices do grafo */
-    int maxVertices;     /**< Nmero mximo de vrtices permitido no grafo */
-    int numVertices;     /**< Nmero atual de vrtices no grafo */
-    struct Grafo* prox;  /**< Apontador para o prximo grafo na lista de grafos */
+    char frequencia;     /**< Frequência comum a todas as antenas do grafo */
+    VERTICE* vertices;   /**< Apontador para a lista de vértices do grafo */
+    int maxVertices;     /**< Capacidade do grafo: vértices atuais mais os vértices reservados ainda livres */
+    int numVertices;     /**< Número atual de vértices no grafo */
+    struct Rede_Grafos* rede; /**< Apontador para a rede a que o grafo pertence */
+    int proximoId;       /**< Id a atribuir ao próximo vértice inserido */
+    struct BlocoGrafo* bloco; /**< Bloco contíguo criado pela última reordenação (NULL se nunca foi reordenado) */
+    struct ReservaGrafo* reserva; /**< Vértices e arestas reservados para as próximas inserções (NULL se nada foi reservado) */
+    struct Antinodos* antinodos; /**< Posições com efeito nefasto do grafo (NULL até serem pedidas) */
+    struct MatrizAdjacencia* matriz; /**< Matriz de adjacências em bits (só nos grafos pequenos e densos; NULL nos restantes) */
+    unsigned long long epoca; /**< Época da última alteração (tirada do contador da rede; invalida os resultados na cache) */
+    struct Grafo* prox;  /**< Apontador para o próximo grafo na lista de grafos */
+#ifdef PA_ESTATISTICAS
+    ESTATISTICAS estat;  /**< Contadores das operações sobre o grafo */
+#endif
 } GRAFO;
 
 /**
  * @struct NoFila
- * @brief N da fila usado para BFT
+ * @brief Nó da fila usado para BFT
  */
 typedef struct NoFila {
-    VERTICE* vertice;   /**< Apontador para o vrtice armazenado no n da fila */
-    struct NoFila* prox;/**< Apontador para o prximo n da fila */
+    VERTICE* vertice;   /**< Apontador para o vértice armazenado no nó da fila */
+    struct NoFila* prox;/**< Apontador para o próximo nó da fila */
 } NOFILA;
 
 /**
@@ -75,51 +113,67 @@ typedef struct NoFila {
  * @brief Estrutura para fila ligada (BFT)
  */
 typedef struct Fila {
-    NOFILA* frente; /**< Apontador para o n da frente da fila */
-    NOFILA* tras;   /**< Apontador para o n do final da fila */
+    NOFILA* frente; /**< Apontador para o nó da frente da fila */
+    NOFILA* tras;   /**< Apontador para o nó do final da fila */
 } FILA;
 
 /**
  * @struct Rede_Grafos
- * @brief Representa uma rede de grafos, onde cada grafo est associado a uma frequncia.
+ * @brief Representa uma rede de grafos, onde cada grafo está associado a uma frequência.
  */
 typedef struct Rede_Grafos {
-    GRAFO* listaGrafos; /**< Apontador para a lista ligada de grafos */
+    GRAFO* listaGrafos;     /**< Apontador para a lista ligada de grafos */
+    struct Grelha* grelha;  /**< Grelha de ocupação/frequências da cidade, atualizada a cada inserção e remoção */
+    struct IndiceEspacial* indice; /**< Índice espacial com todas as antenas da rede */
+    struct CacheConsultas* cache;  /**< Cache dos resultados das consultas (NULL se desativada) */
+    unsigned long long epoca;      /**< Contador das alterações aos grafos da rede (nunca diminui) */
+    bool emLote;                   /**< Um lote de alterações está a ser aplicado: os grafos alterados recebem a época atual */
+#ifdef PA_ESTATISTICAS
+    ESTATISTICAS estat;     /**< Contadores das operações sobre a rede */
+#endif
 } REDE;
 
 /**
  * @struct VerticeFicheiro
- * @brief Estrutura auxiliar para armazenar informaes de vrtices para ficheiro binario
+ * @brief Estrutura auxiliar para armazenar informações de vértices para ficheiro binario
  */
 typedef struct VerticeFicheiro {
-    char frequencia; /**< Frequncia da antena */
-    int x;           /**< Coordenada X do vrtice */
-    int y;           /**< Coordenada Y do vrtice */
+    char frequencia; /**< Frequência da antena */
+    int x;           /**< Coordenada X do vértice */
+    int y;           /**< Coordenada Y do vértice */
 } VerticeFICHEIRO;
 
 /**
  * @struct ArestasFicheiro
- * @brief Estrutura auxiliar para armazenar informaes de arestas para o ficheiro binario
+ * @brief Estrutura auxiliar para armazenar informações de arestas para o ficheiro binario
  */
 typedef struct ArestasFicheiro {
-    int xOrigem;  /**< Coordenada X do vrtice origem da aresta */
-    int yOrigem;  /**< Coordenada Y do vrtice origem da aresta */
-    int xDestino; /**< Coordenada X do vrtice destino da aresta */
-    int yDestino; /**< Coordenada Y do vrtice destino da aresta */
+    int xOrigem;  /**< Coordenada X do vértice origem da aresta */
+    int yOrigem;  /**< Coordenada Y do vértice origem da aresta */
+    int xDestino; /**< Coordenada X do vértice destino da aresta */
+    int yDestino; /**< Coordenada Y do vértice destino da aresta */
 } ArestasFICHEIRO;
 
+/**
+ * @struct Nefasto
+ * @brief Nó da lista de antenas (ou de posições) analisadas por efeitoNefasto.
+ *
+ * A frequência e as coordenadas do nó são uma cópia: as funções do efeito nefasto nunca
+ * escrevem nos vértices da rede.
+ */
 typedef struct Nefasto {
-    VERTICE* vertice;
-    struct Nefasto* prox;
+    VERTICE* vertice;     /**< Vértice da antena na rede (NULL se a posição não tiver uma antena dessa frequência) */
+    ANTENAS antena;       /**< Frequência e coordenadas do nó */
+    struct Nefasto* prox; /**< Apontador para o próximo nó da lista */
 }NEFASTO;
 
 #pragma endregion
 
-#pragma region Funes de Criao
+#pragma region Funções de Criação
 
 /**
- * @brief Cria uma nova antena com a frequncia e coordenadas indicadas.
- * @param freqAntena Frequncia da antena (letra de A-Z).
+ * @brief Cria uma nova antena com a frequência e coordenadas indicadas.
+ * @param freqAntena Frequência da antena (letra de A-Z).
  * @param x Coordenada X.
  * @param y Coordenada Y.
  * @return Apontador para a antena criada.
@@ -128,16 +182,16 @@ typedef struct Nefasto {
 ANTENAS* criarAntena(char freqAntena, int x, int y);
 
 /**
- * @brief Cria um novo vrtice associado a uma antena.
+ * @brief Cria um novo vértice com os dados de uma antena (copiados para o vértice).
  * @param antena Apontador para a antena.
- * @return Apontador para o vrtice criado.
+ * @return Apontador para o vértice criado.
  */
 
 VERTICE* criarVertice(ANTENAS* antena);
 
 /**
- * @brief Cria um novo grafo com capacidade para um nmero definido de ligaes.
- * @param maxLigacoes Nmero mximo de vrtices que o grafo pode conter.
+ * @brief Cria um novo grafo com capacidade para um número definido de ligações.
+ * @param maxLigacoes Número máximo de vértices que o grafo pode conter.
  * @return Apontador para o grafo criado.
  */
 
@@ -152,106 +206,118 @@ REDE* criarRede();
 
 #pragma endregion
 
-#pragma region Funes de Insero e Manipulao
+#pragma region Funções de Inserção e Manipulação
 
 /**
- * @brief - insere uma nova antena no grafo com base na frequncia e coordenadas indicadas.
+ * @brief - insere uma nova antena no grafo com base na frequência e coordenadas indicadas.
  *
- * @param - grafo: apontador para o grafo onde a antena ser inserida.
- * @param - frequencia: frequncia da antena (caracter A-Z).
+ * @param - grafo: apontador para o grafo onde a antena será inserida.
+ * @param - frequencia: frequência da antena (caracter A-Z).
  * @param - x: coordenada X da antena.
  * @param - y: coordenada Y da antena.
- * @return - 0 se a insero for bem-sucedida, 1 em caso de erro.
+ * @return - 0 se a inserção for bem-sucedida, 1 em caso de erro.
  */
 int inserirAntenaGrafo(GRAFO* grafo, char frequencia, int x, int y);
 
 /**
- * @brief - conecta dois vrtices no grafo com uma aresta bidirecional.
+ * @brief - move uma antena para outra posição, mantendo as suas ligações.
+ *
+ * @param - grafo: apontador para o grafo que contém a antena.
+ * @param - x: coordenada X atual da antena.
+ * @param - y: coordenada Y atual da antena.
+ * @param - novoX: nova coordenada X.
+ * @param - novoY: nova coordenada Y.
+ * @return - 0 se a antena foi movida, 1 em caso de erro (antena inexistente, posição inválida ou já ocupada no grafo).
+ */
+int moverAntenaGrafo(GRAFO* grafo, int x, int y, int novoX, int novoY);
+
+/**
+ * @brief - conecta dois vértices no grafo com uma aresta bidirecional.
  *
- * @param - grafo: apontador para o grafo onde a conexo ser feita.
- * @param - x1: coordenada X do primeiro vrtice (origem).
- * @param - y1: coordenada Y do primeiro vrtice (origem).
- * @param - x2: coordenada X do segundo vrtice (destino).
- * @param - y2: coordenada Y do segundo vrtice (destino).
- * @return - 0 se a conexo for bem-sucedida, 1 em caso de erro.
+ * @param - grafo: apontador para o grafo onde a conexão será feita.
+ * @param - x1: coordenada X do primeiro vértice (origem).
+ * @param - y1: coordenada Y do primeiro vértice (origem).
+ * @param - x2: coordenada X do segundo vértice (destino).
+ * @param - y2: coordenada Y do segundo vértice (destino).
+ * @return - 0 se a conexão for bem-sucedida, 1 em caso de erro.
  */
 int conectarVertices(GRAFO* grafo, int x1, int y1, int x2, int y2);
 
 /**
- * @brief - mostra a rede de grafos numa matriz, baseada nas frequncias presentes.
+ * @brief - mostra a rede de grafos numa matriz, a partir da grelha de ocupação da rede.
  *
  * @param - redeGrafos: apontador para a rede de grafos a mostrar.
- * @return - 0 se a operao for bem-sucedida, 1 em caso de erro.
+ * @return - 0 se a operação for bem-sucedida, 1 em caso de erro.
  */
 int mostrarRedeGrafos(REDE* redeGrafos);
 
 /**
- * @brief - procura um grafo na rede pela sua frequncia.
+ * @brief - procura um grafo na rede pela sua frequência.
  *
  * @param - rede: apontador para a rede de grafos.
- * @param - freq: frequncia do grafo a procurar.
- * @return - apontador para o grafo encontrado ou NULL se no existir.
+ * @param - freq: frequência do grafo a procurar.
+ * @return - apontador para o grafo encontrado ou NULL se não existir.
  */
 GRAFO* encontrarGrafoPorFrequencia(REDE* rede, char freq);
 
 /**
  * @brief - carrega grafos a partir de um ficheiro de texto para a rede.
  *
- * @param - rede: apontador para a rede onde os grafos sero inseridos.
+ * @param - rede: apontador para a rede onde os grafos serão inseridos.
  * @param - filename: nome do ficheiro de texto a ler.
  * @return - 0 se a carga for bem-sucedida, 1 em caso de erro.
  */
 int carregaGrafo(REDE* rede, char* filename);
 
 /**
- * @brief - procura um vrtice no grafo pela sua posio (x, y).
+ * @brief - procura um vértice no grafo pela sua posição (x, y).
  *
- * @param - grafo: apontador para o grafo onde a procura ser feita.
- * @param - x: coordenada X do vrtice procurado.
- * @param - y: coordenada Y do vrtice procurado.
- * @return - apontador para o vrtice encontrado ou NULL se no existir.
+ * @param - grafo: apontador para o grafo onde a procura será feita.
+ * @param - x: coordenada X do vértice procurado.
+ * @param - y: coordenada Y do vértice procurado.
+ * @return - apontador para o vértice encontrado ou NULL se não existir.
  */
 VERTICE* encontrarVertice(GRAFO* grafo, int x, int y);
 
 /**
- * @brief - procura um vrtice no grafo pela sua posio (x, y).
+ * @brief - procura um vértice no grafo pela sua posição (x, y).
  *
- * @param - grafo: apontador para o grafo onde a procura ser feita.
- * @param - x: coordenada X do vrtice procurado.
- * @param - y: coordenada Y do vrtice procurado.
- * @return - apontador para o vrtice encontrado ou NULL se no existir.
+ * @param - grafo: apontador para o grafo onde a procura será feita.
+ * @param - x: coordenada X do vértice procurado.
+ * @param - y: coordenada Y do vértice procurado.
+ * @return - apontador para o vértice encontrado ou NULL se não existir.
  */
 VERTICE* encontrarVertice(GRAFO* grafo, int x, int y);
 
 /**
- * @brief - guarda as arestas de um vrtice num ficheiro.
+ * @brief - guarda as arestas de um vértice num ficheiro.
  *
  * @param - head: apontador para a lista de arestas a guardar.
  * @param - fp: apontador para o ficheiro aberto para escrita.
- * @param - xOrigem: coordenada X do vrtice origem das arestas.
- * @param - yOrigem: coordenada Y do vrtice origem das arestas.
- * @return - nmero de arestas guardadas com sucesso.
+ * @param - xOrigem: coordenada X do vértice origem das arestas.
+ * @param - yOrigem: coordenada Y do vértice origem das arestas.
+ * @return - número de arestas guardadas com sucesso.
  */
 int guardarArestas(ARESTA* head, FILE* fp, int xOrigem, int yOrigem);
 
 /**
- * @brief - guarda o grafo num ficheiro binrio.
+ * @brief - guarda o grafo num ficheiro binário.
  *
- * @param - head: apontador para a lista de vrtices do grafo.
- * @param - filename: nome do ficheiro onde ser guardado o grafo.
- * @return - true se a operao foi bem sucedida, false caso contrrio.
+ * @param - head: apontador para a lista de vértices do grafo.
+ * @param - filename: nome do ficheiro onde será guardado o grafo.
+ * @return - true se a operação foi bem sucedida, false caso contrário.
  */
 bool guardarGrafoBin(VERTICE* head, char* filename);
 
 /**
- * @brief - verifica se existe uma conexo entre dois vrtices especificados pelas suas coordenadas.
+ * @brief - verifica se existe uma conexão entre dois vértices especificados pelas suas coordenadas.
  *
  * @param - grafo: apontador para o grafo.
- * @param - xOrigem: coordenada X do vrtice origem.
- * @param - yOrigem: coordenada Y do vrtice origem.
- * @param - xDestino: coordenada X do vrtice destino.
- * @param - yDestino: coordenada Y do vrtice destino.
- * @return - true se existe conexo, false caso contrrio.
+ * @param - xOrigem: coordenada X do vértice origem.
+ * @param - yOrigem: coordenada Y do vértice origem.
+ * @param - xDestino: coordenada X do vértice destino.
+ * @param - yDestino: coordenada Y do vértice destino.
+ * @return - true se existe conexão, false caso contrário.
  */
 bool existeConexaoEntreVertices(GRAFO* grafo, int xOrigem, int yOrigem, int xDestino, int yDestino);
 
@@ -259,9 +325,9 @@ bool existeConexaoEntreVertices(GRAFO* grafo, int xOrigem, int yOrigem, int xDes
  * @brief - verifica se uma aresta aponta para o destino especificado.
  *
  * @param - head: apontador para a lista de arestas.
- * @param - xDestino: coordenada X do vrtice destino.
- * @param - yDestino: coordenada Y do vrtice destino.
- * @return - true se existir uma aresta para o destino, false caso contrrio.
+ * @param - xDestino: coordenada X do vértice destino.
+ * @param - yDestino: coordenada Y do vértice destino.
+ * @return - true se existir uma aresta para o destino, false caso contrário.
  */
 bool existeConexao(ARESTA* head, int xDestino, int yDestino);
 
@@ -269,47 +335,118 @@ bool existeConexao(ARESTA* head, int xDestino, int yDestino);
 
 #pragma endregion
 
-#pragma region Funes de Eliminao
+#pragma region Funções de Eliminação
 
 /**
- * @brief Liberta toda a memria associada a um grafo, incluindo os seus vrtices e arestas.
+ * @brief Liberta toda a memória associada a um grafo, incluindo os seus vértices e arestas.
  *
- * Esta funo destri um grafo completo, removendo todos os vrtices e as respetivas listas de arestas,
- * libertando toda a memria ocupada.
+ * Esta função destrói um grafo completo, removendo todos os vértices e as respetivas listas de arestas,
+ * libertando toda a memória ocupada. Se o grafo pertencer a uma rede, é também retirado da lista de grafos da rede.
  *
  * @param grafo - apontador para o grafo a destruir.
- * @return - NULL, indicando que o grafo foi destrudo.
+ * @return - NULL, indicando que o grafo foi destruído.
  */
 GRAFO* destruirGrafo(GRAFO* grafo);
 
 /**
- * @brief Liberta toda a memria associada  lista de vrtices, incluindo as listas de arestas e as antenas.
+ * @brief Liberta toda a memória associada a uma rede: os grafos, a cache de consultas, a grelha de ocupação e o índice espacial.
  *
- * Para cada vrtice da lista, esta funo remove todas as arestas adjacentes, liberta a memria da antena
- * associada e do prprio vrtice.
+ * @param rede - apontador para a rede a destruir.
+ * @return - NULL, indicando que a rede foi destruída.
+ */
+REDE* destruirRede(REDE* rede);
+
+/**
+ * @brief Liberta toda a memória associada à lista de vértices, incluindo as listas de arestas e as antenas.
+ *
+ * Para cada vértice da lista, esta função remove todas as arestas adjacentes, liberta a memória da antena
+ * associada e do próprio vértice.
  *
- * @param lista - apontador para o incio da lista de vrtices a destruir.
- * @return - NULL, indicando que a lista foi destruda.
+ * @param lista - apontador para o início da lista de vértices a destruir.
+ * @return - NULL, indicando que a lista foi destruída.
  */
 VERTICE* destruirVertices(VERTICE* lista);
 
 /**
- * @brief Liberta toda a memria associada  lista de arestas.
+ * @brief Liberta toda a memória associada à lista de arestas.
  *
- * Para cada aresta da lista, esta funo liberta a memria ocupada pela estrutura da aresta.
+ * Para cada aresta da lista, esta função liberta a memória ocupada pela estrutura da aresta.
  *
- * @param lista - apontador para o incio da lista de arestas a destruir.
- * @return - NULL, indicando que a lista foi destruda.
+ * @param lista - apontador para o início da lista de arestas a destruir.
+ * @return - NULL, indicando que a lista foi destruída.
  */
 ARESTA* destruirArestas(ARESTA* lista);
 
+/**
+ * @brief - remove uma aresta e a respetiva aresta inversa, sem percorrer listas.
+ *
+ * @param - grafo: apontador para o grafo que contém a aresta.
+ * @param - aresta: apontador para a aresta a remover (handle obtido das listas de adjacências).
+ * @return - 0 se a remoção for bem-sucedida, 1 em caso de erro.
+ */
+int removerAresta(GRAFO* grafo, ARESTA* aresta);
+
+/**
+ * @brief - remove uma ligação (nos dois sentidos) entre dois vértices do grafo.
+ *
+ * @param - grafo: apontador para o grafo.
+ * @param - x1: coordenada X do primeiro vértice.
+ * @param - y1: coordenada Y do primeiro vértice.
+ * @param - x2: coordenada X do segundo vértice.
+ * @param - y2: coordenada Y do segundo vértice.
+ * @return - 0 se a remoção for bem-sucedida, 1 se a ligação não existir ou em caso de erro.
+ */
+int removerLigacao(GRAFO* grafo, int x1, int y1, int x2, int y2);
+
+/**
+ * @brief - remove uma antena do grafo, incluindo todas as ligações a essa antena.
+ *
+ * @param - grafo: apontador para o grafo.
+ * @param - x: coordenada X da antena.
+ * @param - y: coordenada Y da antena.
+ * @return - 0 se a remoção for bem-sucedida, 1 se a antena não existir ou em caso de erro.
+ */
+int removerAntenaGrafo(GRAFO* grafo, int x, int y);
+
+/**
+ * @brief - liberta um vértice, exceto se estiver no bloco contíguo do grafo.
+ *
+ * @param - grafo: apontador para o grafo que contém o vértice.
+ * @param - vertice: apontador para o vértice (já retirado da lista do grafo).
+ */
+void libertarVerticeGrafo(GRAFO* grafo, VERTICE* vertice);
+
+/**
+ * @brief - liberta uma aresta, exceto se estiver no bloco contíguo do grafo.
+ *
+ * @param - grafo: apontador para o grafo que contém a aresta.
+ * @param - aresta: apontador para a aresta (já retirada da lista de adjacências).
+ */
+void libertarArestaGrafo(GRAFO* grafo, ARESTA* aresta);
+
+/**
+ * @brief - acrescenta ao início da lista um nó com a frequência e as coordenadas indicadas.
+ *
+ * @param - rede: apontador para a rede (usada para associar o nó à antena dessa frequência, se existir).
+ * @param - nefasto: apontador para o início da lista.
+ * @param - frequencia: frequência do nó.
+ * @param - x: coordenada X do nó.
+ * @param - y: coordenada Y do nó.
+ */
 void inserirEfeitoNefasto(REDE* rede, NEFASTO** nefasto, char frequencia, int x, int y);
 
+/**
+ * @brief - calcula (e regista) as posições com efeito nefasto dos pares de nós da lista com a mesma frequência.
+ *
+ * @param - rede: apontador para a rede.
+ * @param - nefasto: lista de nós a analisar (não é alterada, tal como os vértices da rede).
+ * @return true se a análise foi feita, false se a lista ou a rede estiverem vazias.
+ */
 bool efeitoNefasto(REDE* rede, NEFASTO* nefasto);
 
 #pragma endregion
 
-#pragma region Funes Auxiliares para BFS
+#pragma region Funções Auxiliares para BFS
 
 /**
  * @brief - cria uma fila vazia.
@@ -319,54 +456,54 @@ bool efeitoNefasto(REDE* rede, NEFASTO* nefasto);
 void criarFila(FILA* fila);
 
 /**
- * @brief - verifica se a fila est vazia.
+ * @brief - verifica se a fila está vazia.
  *
  * @param - fila: apontador para a fila a verificar.
- * @return - true se a fila estiver vazia (frente == NULL), caso contrrio false.
+ * @return - true se a fila estiver vazia (frente == NULL), caso contrário false.
  */
 bool filaVazia(FILA* fila);
 
 /**
- * @brief - enfileira um vrtice na fila.
+ * @brief - enfileira um vértice na fila.
  *
  * @param - fila: apontador para a fila.
- * @param - vertice: apontador para o vrtice a inserir.
- * @return - true se o vrtice foi inserido com sucesso, false em caso de falha de alocao.
+ * @param - vertice: apontador para o vértice a inserir.
+ * @return - true se o vértice foi inserido com sucesso, false em caso de falha de alocação.
  */
 bool enfilarVertice(FILA* fila, VERTICE* vertice);
 
 /**
- * @brief - desenfileira o vrtice da frente da fila.
+ * @brief - desenfileira o vértice da frente da fila.
  *
  * @param - fila: apontador para a fila.
- * @return - apontador para o vrtice removido, ou NULL se a fila estiver vazia.
+ * @return - apontador para o vértice removido, ou NULL se a fila estiver vazia.
  */
 VERTICE* desenfilarVertice(FILA* fila);
 
 /**
  * @brief - executa uma busca em largura (BFT) no grafo a partir da antena inicial indicada.
  *
- * @param - grafo: apontador para o grafo onde ser executada a busca.
+ * @param - grafo: apontador para o grafo onde será executada a busca.
  * @param - x: coordenada X da antena inicial.
  * @param - y: coordenada Y da antena inicial.
- * @param - count: apontador para inteiro onde ser armazenado o nmero de vrtices visitados.
- * @return - 0 em caso de sucesso, 1 se grafo invlido ou antena inicial no encontrada.
+ * @param - count: apontador para inteiro onde será armazenado o número de vértices visitados.
+ * @return - 0 em caso de sucesso, 1 se grafo inválido ou antena inicial não encontrada.
  */
 int BFT(GRAFO* grafo, int x, int y, int* count);
 
 /**
- * @brief - valida o grafo, verificando se no  NULL e se tem vrtices.
+ * @brief - valida o grafo em O(1), verificando se não é NULL, se tem vértices e se o número de vértices está dentro da capacidade.
  *
  * @param - grafo: apontador para o grafo a validar.
- * @return - true se o grafo for vlido, false caso contrrio.
+ * @return - true se o grafo for válido, false caso contrário.
  */
 bool validarGrafo(GRAFO* grafo);
 
 /**
- * @brief - reinicia o campo visitado de todos os vrtices para 0 (no visitado).
+ * @brief - reinicia o campo visitado de todos os vértices para 0 (não visitado).
  *
- * @param - grafo: apontador para a lista de vrtices.
- * @return - apontador para a lista de vrtices aps reiniciar o campo visitado.
+ * @param - grafo: apontador para a lista de vértices.
+ * @return - apontador para a lista de vértices após reiniciar o campo visitado.
  */
 VERTICE* resetarVisitados(VERTICE* grafo);
 
@@ -376,3 +513,7 @@ int countPaths(VERTICE* origem, VERTICE* destino);
 
 int DFS(GRAFO* grafo, int x, int y);
 #pragma endregion
+
+#ifdef __cplusplus
+}
+#endif
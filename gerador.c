@@ -0,0 +1,205 @@
+/**
+ * @file gerador.c
+ * @brief Implementação do gerador de mapas sintéticos para testes de desempenho.
+ *
+ * @author Rogério Picas
+ * @date 18-10-2026
+ * @version 1.0
+ */
+#define _CRT_SECURE_NO_WARNINGS
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "gerador.h"
+
+#pragma region Funções Auxiliares
+
+/**
+ * @brief Gera um número pseudo-aleatório (xorshift64*), reprodutível em qualquer plataforma.
+ *
+ * Ao contrário de @c rand, o resultado não depende da biblioteca C nem do valor de RAND_MAX,
+ * pelo que a mesma semente produz sempre o mesmo mapa.
+ *
+ * @param[in,out] estado - apontador para o estado do gerador (não pode ser 0).
+ *
+ * @return próximo número pseudo-aleatório de 32 bits.
+ */
+uint32_t proximoAleatorio(uint64_t* estado) {
+	uint64_t x = *estado;
+	x ^= x >> 12;
+	x ^= x << 25;
+	x ^= x >> 27;
+	*estado = x;
+	return (uint32_t)((x * 0x2545F4914F6CDD1DULL) >> 32);
+}
+
+/**
+ * @brief Devolve um número pseudo-aleatório no intervalo [0, n).
+ */
+static uint64_t aleatorioIntervalo(uint64_t* estado, uint64_t n) {
+	uint64_t r = ((uint64_t)proximoAleatorio(estado) << 32) | proximoAleatorio(estado);
+	return r % n;
+}
+
+#pragma endregion
+
+#pragma region Funções do Gerador
+
+/**
+ * @brief Gera um mapa sintético da cidade com antenas e ligações aleatórias.
+ *
+ * As posições são escolhidas por amostragem seletiva (uma passagem pelas células da
+ * cidade, cada uma escolhida com probabilidade "faltam / restantes"), o que garante
+ * exatamente @p numAntenas posições distintas sem memória auxiliar. As antenas são
+ * depois baralhadas, para que a ordem de inserção não siga a ordem das linhas.
+ * Em cada frequência com k antenas são geradas cerca de grauMedio * k / 2 ligações
+ * entre pares aleatórios de antenas distintas.
+ *
+ * @param[in] numAntenas - número de antenas a colocar (no máximo MAX_DIM * MAX_DIM).
+ * @param[in] numFrequencias - número de frequências distintas (1 a MAX_FREQUENCIAS).
+ * @param[in] grauMedio - grau médio pretendido em cada grafo de frequência (>= 0).
+ * @param[in] semente - semente do gerador pseudo-aleatório.
+ *
+ * @return apontador para o mapa gerado, ou NULL se os parâmetros forem inválidos ou a alocação falhar.
+ */
+MAPA_GERADO* gerarMapa(int numAntenas, int numFrequencias, double grauMedio, unsigned int semente) {
+	long long numCelulas = (long long)MAX_DIM * MAX_DIM;
+	if (numAntenas < 0 || numAntenas > numCelulas) return NULL;
+	if (numFrequencias < 1 || numFrequencias > MAX_FREQUENCIAS || grauMedio < 0) return NULL;
+
+	uint64_t estado = 0x9E3779B97F4A7C15ULL ^ semente;
+	if (estado == 0) estado = 1;
+
+	MAPA_GERADO* mapa = (MAPA_GERADO*)calloc(1, sizeof(MAPA_GERADO));
+	if (mapa == NULL) return NULL;
+	mapa->antenas = (ANTENAS*)malloc(numAntenas > 0 ? (size_t)numAntenas * sizeof(ANTENAS) : 1);
+	if (mapa->antenas == NULL) return destruirMapa(mapa);
+
+	// Amostragem seletiva das posições
+	long long faltam = numAntenas;
+	for (long long c = 0; c < numCelulas && faltam > 0; c++) {
+		if ((long long)aleatorioIntervalo(&estado, (uint64_t)(numCelulas - c)) < faltam)
+		{
+			ANTENAS* antena = &mapa->antenas[mapa->numAntenas++];
+			antena->x = (COORDENADA)(c / MAX_DIM);
+			antena->y = (COORDENADA)(c % MAX_DIM);
+			antena->frequencia = (char)('A' + proximoAleatorio(&estado) % numFrequencias);
+			faltam--;
+		}
+	}
+
+	// Baralha as antenas (Fisher-Yates)
+	for (int i = mapa->numAntenas - 1; i > 0; i--) {
+		int j = (int)aleatorioIntervalo(&estado, (uint64_t)i + 1);
+		ANTENAS aux = mapa->antenas[i];
+		mapa->antenas[i] = mapa->antenas[j];
+		mapa->antenas[j] = aux;
+	}
+
+	// Agrupa as antenas por frequência (contagem + somas prefixas)
+	int inicio[MAX_FREQUENCIAS + 1] = { 0 };
+	int* grupos = (int*)malloc(numAntenas > 0 ? (size_t)numAntenas * sizeof(int) : 1);
+	if (grupos == NULL) return destruirMapa(mapa);
+
+	for (int i = 0; i < mapa->numAntenas; i++) {
+		inicio[mapa->antenas[i].frequencia - 'A' + 1]++;
+	}
+	for (int f = 0; f < numFrequencias; f++) {
+		inicio[f + 1] += inicio[f];
+	}
+	int posicao[MAX_FREQUENCIAS];
+	memcpy(posicao, inicio, sizeof(posicao));
+	for (int i = 0; i < mapa->numAntenas; i++) {
+		grupos[posicao[mapa->antenas[i].frequencia - 'A']++] = i;
+	}
+
+	long long totalLigacoes = 0;
+	for (int f = 0; f < numFrequencias; f++) {
+		int k = inicio[f + 1] - inicio[f];
+		if (k >= 2) totalLigacoes += (long long)(grauMedio * k / 2.0 + 0.5);
+	}
+	mapa->ligacoes = (LIGACAO_GERADA*)malloc(totalLigacoes > 0 ? (size_t)totalLigacoes * sizeof(LIGACAO_GERADA) : 1);
+	if (mapa->ligacoes == NULL)
+	{
+		free(grupos);
+		return destruirMapa(mapa);
+	}
+
+	for (int f = 0; f < numFrequencias; f++) {
+		int k = inicio[f + 1] - inicio[f];
+		if (k < 2) continue;
+
+		long long m = (long long)(grauMedio * k / 2.0 + 0.5);
+		for (long long e = 0; e < m; e++) {
+			int u = grupos[inicio[f] + (int)aleatorioIntervalo(&estado, (uint64_t)k)];
+			int v = grupos[inicio[f] + (int)aleatorioIntervalo(&estado, (uint64_t)k - 1)];
+			if (v == u) v = grupos[inicio[f + 1] - 1];
+
+			LIGACAO_GERADA* lig = &mapa->ligacoes[mapa->numLigacoes++];
+			lig->frequencia = (char)('A' + f);
+			lig->x1 = mapa->antenas[u].x;
+			lig->y1 = mapa->antenas[u].y;
+			lig->x2 = mapa->antenas[v].x;
+			lig->y2 = mapa->antenas[v].y;
+		}
+	}
+
+	free(grupos);
+	return mapa;
+}
+
+/**
+ * @brief Guarda as antenas de um mapa gerado num ficheiro de texto no formato de antenas.txt.
+ *
+ * Escreve MAX_DIM linhas de MAX_DIM caracteres ('.' ou a letra da frequência), uma linha de
+ * cada vez, pronto a ser lido por @c carregaGrafo.
+ *
+ * @param[in] mapa - apontador para o mapa gerado.
+ * @param[in] filename - nome do ficheiro de texto a escrever.
+ *
+ * @return @c 0 em caso de sucesso, @c 1 se o mapa for nulo, o ficheiro não puder ser escrito ou a alocação falhar.
+ */
+int guardarMapaTexto(MAPA_GERADO* mapa, char* filename) {
+	if (mapa == NULL || filename == NULL) return 1;
+
+	char* celulas = (char*)malloc((size_t)MAX_DIM * MAX_DIM);
+	if (celulas == NULL) return 1;
+	memset(celulas, '.', (size_t)MAX_DIM * MAX_DIM);
+	for (int i = 0; i < mapa->numAntenas; i++) {
+		celulas[(size_t)mapa->antenas[i].x * MAX_DIM + mapa->antenas[i].y] = mapa->antenas[i].frequencia;
+	}
+
+	FILE* fp = fopen(filename, "w");
+	if (fp == NULL)
+	{
+		free(celulas);
+		return 1;
+	}
+	int erro = 0;
+	for (int i = 0; i < MAX_DIM && !erro; i++) {
+		if (fwrite(&celulas[(size_t)i * MAX_DIM], 1, MAX_DIM, fp) != MAX_DIM || fputc('\n', fp) == EOF)
+		{
+			erro = 1;
+		}
+	}
+	fclose(fp);
+	free(celulas);
+	return erro;
+}
+
+/**
+ * @brief Liberta toda a memória de um mapa gerado.
+ *
+ * @param mapa - apontador para o mapa a destruir.
+ * @return NULL, indicando que o mapa foi destruído.
+ */
+MAPA_GERADO* destruirMapa(MAPA_GERADO* mapa) {
+	if (mapa == NULL) return NULL;
+
+	free(mapa->antenas);
+	free(mapa->ligacoes);
+	free(mapa);
+	return NULL;
+}
+
+#pragma endregion
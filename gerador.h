@@ -0,0 +1,89 @@
+#pragma once
+
+/**
+ * @file gerador.h
+ * @brief Gerador de mapas sintéticos (antenas e ligações) para testes de desempenho
+ *
+ * @author Rogério Picas
+ * @date 18-10-2026
+ * @version 1.0
+ *
+ */
+#include <stdint.h>
+#include "funcoes.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+ /** @def MAX_FREQUENCIAS
+  *  @brief Número máximo de frequências num mapa gerado (letras A-Z, as aceites por carregaGrafo).
+  */
+#define MAX_FREQUENCIAS 26
+
+#pragma region Estruturas
+
+/**
+ * @struct LigacaoGerada
+ * @brief Ligação gerada entre duas antenas da mesma frequência.
+ */
+typedef struct LigacaoGerada {
+    char frequencia; /**< Frequência comum às duas antenas */
+    int x1;          /**< Coordenada X da primeira antena */
+    int y1;          /**< Coordenada Y da primeira antena */
+    int x2;          /**< Coordenada X da segunda antena */
+    int y2;          /**< Coordenada Y da segunda antena */
+} LIGACAO_GERADA;
+
+/**
+ * @struct MapaGerado
+ * @brief Mapa sintético: antenas em posições distintas e ligações aleatórias por frequência.
+ */
+typedef struct MapaGerado {
+    ANTENAS* antenas;          /**< Array com as antenas geradas (por ordem aleatória) */
+    int numAntenas;            /**< Número de antenas geradas */
+    LIGACAO_GERADA* ligacoes;  /**< Array com as ligações geradas */
+    int numLigacoes;           /**< Número de ligações geradas */
+} MAPA_GERADO;
+
+#pragma endregion
+
+#pragma region Funções do Gerador
+
+/**
+ * @brief Gera um número pseudo-aleatório (xorshift64*), reprodutível em qualquer plataforma.
+ * @param estado Apontador para o estado do gerador (não pode ser 0).
+ * @return Próximo número pseudo-aleatório de 32 bits.
+ */
+uint32_t proximoAleatorio(uint64_t* estado);
+
+/**
+ * @brief Gera um mapa sintético da cidade (MAX_DIM x MAX_DIM).
+ * @param numAntenas Número de antenas a colocar (no máximo MAX_DIM * MAX_DIM).
+ * @param numFrequencias Número de frequências distintas (1 a MAX_FREQUENCIAS).
+ * @param grauMedio Grau médio pretendido em cada grafo de frequência.
+ * @param semente Semente do gerador pseudo-aleatório.
+ * @return Apontador para o mapa gerado ou NULL em caso de erro.
+ */
+MAPA_GERADO* gerarMapa(int numAntenas, int numFrequencias, double grauMedio, unsigned int semente);
+
+/**
+ * @brief Guarda as antenas de um mapa gerado num ficheiro de texto no formato lido por carregaGrafo.
+ * @param mapa Apontador para o mapa gerado.
+ * @param filename Nome do ficheiro de texto a escrever.
+ * @return 0 se a operação for bem-sucedida, 1 em caso de erro.
+ */
+int guardarMapaTexto(MAPA_GERADO* mapa, char* filename);
+
+/**
+ * @brief Liberta toda a memória de um mapa gerado.
+ * @param mapa Apontador para o mapa a destruir.
+ * @return NULL, indicando que o mapa foi destruído.
+ */
+MAPA_GERADO* destruirMapa(MAPA_GERADO* mapa);
+
+#pragma endregion
+
+#ifdef __cplusplus
+}
+#endif
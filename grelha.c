@@ -0,0 +1,228 @@
+/**
+ * @file grelha.c
+ * @brief Implementação da grelha persistente de ocupação e do desenho rápido do mapa.
+ *
+ * @author Rogério Picas
+ * @date 18-10-2026
+ * @version 1.0
+ */
+#define _CRT_SECURE_NO_WARNINGS
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "grelha.h"
+#include "espacial.h"
+
+#pragma region Funções da Grelha
+
+/**
+ * @brief Cria uma grelha vazia com a dimensão da cidade.
+ *
+ * Todas as células começam com @c CELULA_LIVRE e com o bit de ocupação a 0.
+ *
+ * @return apontador para a grelha criada, ou NULL se a alocação de memória falhar.
+ */
+GRELHA* criarGrelha() {
+	GRELHA* grelha = (GRELHA*)malloc(sizeof(GRELHA));
+	if (grelha == NULL) return NULL;
+
+	grelha->palavrasPorLinha = (MAX_DIM + 63) / 64;
+	grelha->frequencias = (char*)malloc((size_t)MAX_DIM * MAX_DIM);
+	grelha->ocupacao = (uint64_t*)calloc((size_t)MAX_DIM * grelha->palavrasPorLinha, sizeof(uint64_t));
+	if (grelha->frequencias == NULL || grelha->ocupacao == NULL)
+	{
+		return destruirGrelha(grelha);
+	}
+	memset(grelha->frequencias, CELULA_LIVRE, (size_t)MAX_DIM * MAX_DIM);
+
+	return grelha;
+}
+
+/**
+ * @brief Marca a célula (x, y) como ocupada por uma antena da frequência indicada.
+ *
+ * @param[in,out] grelha - apontador para a grelha.
+ * @param[in] x - coordenada X da célula.
+ * @param[in] y - coordenada Y da célula.
+ * @param[in] freq - frequência da antena inserida.
+ */
+void marcarGrelha(GRELHA* grelha, int x, int y, char freq) {
+	if (grelha == NULL) return;
+	if (x < 0 || x >= MAX_DIM || y < 0 || y >= MAX_DIM) return;
+
+	grelha->frequencias[(size_t)x * MAX_DIM + y] = freq;
+	grelha->ocupacao[(size_t)x * grelha->palavrasPorLinha + y / 64] |= (uint64_t)1 << (y % 64);
+}
+
+/**
+ * @brief Atualiza a célula (x, y) depois de lá ter sido removida uma antena.
+ *
+ * Como várias frequências podem partilhar a mesma célula, procura no balde (x, y) do
+ * índice espacial da rede outra antena nessa posição que não pertença a @p excluido.
+ * Se existir, a célula passa a mostrar a sua frequência; caso contrário fica livre.
+ * A antena removida já deve ter sido retirada do índice.
+ *
+ * @param[in,out] rede - apontador para a rede que contém a grelha.
+ * @param[in] excluido - grafo a ignorar na procura, ou NULL.
+ * @param[in] x - coordenada X da célula.
+ * @param[in] y - coordenada Y da célula.
+ */
+void limparGrelha(REDE* rede, GRAFO* excluido, int x, int y) {
+	if (rede == NULL || rede->grelha == NULL) return;
+	if (x < 0 || x >= MAX_DIM || y < 0 || y >= MAX_DIM) return;
+
+	GRELHA* grelha = rede->grelha;
+	BALDE* balde = obterBalde(rede->indice, x, y);
+	if (balde != NULL)
+	{
+		for (int i = 0; i < balde->numEntradas; i++) {
+			ANTENAS* antena = &balde->entradas[i].vertice->antena;
+			if (balde->entradas[i].grafo != excluido && antena->x == x && antena->y == y)
+			{
+				grelha->frequencias[(size_t)x * MAX_DIM + y] = antena->frequencia;
+				return;
+			}
+		}
+	}
+	grelha->frequencias[(size_t)x * MAX_DIM + y] = CELULA_LIVRE;
+	grelha->ocupacao[(size_t)x * grelha->palavrasPorLinha + y / 64] &= ~((uint64_t)1 << (y % 64));
+}
+
+/**
+ * @brief Verifica se a célula (x, y) tem alguma antena.
+ *
+ * @param[in] grelha - apontador para a grelha.
+ * @param[in] x - coordenada X da célula.
+ * @param[in] y - coordenada Y da célula.
+ *
+ * @return @c true se a célula estiver ocupada, @c false se estiver livre, fora da cidade ou a grelha for nula.
+ */
+bool celulaOcupada(GRELHA* grelha, int x, int y) {
+	if (grelha == NULL) return false;
+	if (x < 0 || x >= MAX_DIM || y < 0 || y >= MAX_DIM) return false;
+
+	return (grelha->ocupacao[(size_t)x * grelha->palavrasPorLinha + y / 64] >> (y % 64)) & 1;
+}
+
+/**
+ * @brief Devolve a posição do bit menos significativo a 1 de uma palavra não nula.
+ */
+static int primeiroBit(uint64_t palavra) {
+#if defined(__GNUC__) || defined(__clang__)
+	return __builtin_ctzll(palavra);
+#else
+	int bit = 0;
+	while (!((palavra >> bit) & 1)) bit++;
+	return bit;
+#endif
+}
+
+/**
+ * @brief Calcula o caractere que representa uma zona da cidade num mapa reduzido.
+ *
+ * Usa o bitset para saltar palavras vazias: apenas as células ocupadas são consultadas.
+ *
+ * @return @c CELULA_LIVRE se a zona estiver vazia, a frequência se todas as antenas
+ *         da zona tiverem a mesma frequência, ou @c CELULA_MISTA caso contrário.
+ */
+static char resumirZona(GRELHA* grelha, int x0, int y0, int x1, int y1) {
+	char resultado = CELULA_LIVRE;
+
+	for (int x = x0; x < x1; x++) {
+		uint64_t* linha = &grelha->ocupacao[(size_t)x * grelha->palavrasPorLinha];
+		for (int p = y0 / 64; p <= (y1 - 1) / 64; p++) {
+			uint64_t palavra = linha[p];
+			if (p == y0 / 64) palavra &= ~(uint64_t)0 << (y0 % 64);
+			if (p == (y1 - 1) / 64 && y1 % 64 != 0) palavra &= ~(~(uint64_t)0 << (y1 % 64));
+
+			while (palavra) {
+				int bit = primeiroBit(palavra);
+				palavra &= palavra - 1;
+
+				char freq = grelha->frequencias[(size_t)x * MAX_DIM + p * 64 + bit];
+				if (resultado == CELULA_LIVRE) resultado = freq;
+				else if (resultado != freq) return CELULA_MISTA;
+			}
+		}
+	}
+	return resultado;
+}
+
+/**
+ * @brief Mostra uma região retangular da cidade, escrevendo uma linha completa de cada vez.
+ *
+ * Com @p escala igual a 1 cada linha é copiada diretamente da grelha; com escala maior,
+ * cada caractere resume uma zona de escala x escala células (ver @c resumirZona), o que
+ * permite ver mapas grandes num terminal. A região é ajustada aos limites da cidade.
+ * O mapa é o resultado pedido e não uma mensagem de diagnóstico, por isso é escrito
+ * diretamente em @p fp (com um fwrite por linha) e não passa pelo registo.
+ *
+ * @param[in] rede - apontador para a rede a mostrar.
+ * @param[in] fp - ficheiro de destino (ex.: stdout).
+ * @param[in] x0 - primeira linha da região.
+ * @param[in] y0 - primeira coluna da região.
+ * @param[in] linhas - número de linhas da cidade a mostrar.
+ * @param[in] colunas - número de colunas da cidade a mostrar.
+ * @param[in] escala - lado (em células) da zona representada por cada caractere.
+ *
+ * @return @c 0 em caso de sucesso,
+ *         @c 1 se a rede/grelha ou o ficheiro forem nulos, os parâmetros forem inválidos ou a alocação falhar,
+ *         @c 2 se a escrita falhar.
+ */
+int mostrarRegiaoRede(REDE* rede, FILE* fp, int x0, int y0, int linhas, int colunas, int escala) {
+	if (rede == NULL || rede->grelha == NULL || fp == NULL) return 1;
+	if (linhas <= 0 || colunas <= 0 || escala <= 0) return 1;
+
+	if (x0 < 0) x0 = 0;
+	if (y0 < 0) y0 = 0;
+	int x1 = x0 + linhas > MAX_DIM ? MAX_DIM : x0 + linhas;
+	int y1 = y0 + colunas > MAX_DIM ? MAX_DIM : y0 + colunas;
+	if (x0 >= x1 || y0 >= y1) return 1;
+
+	int largura = (y1 - y0 + escala - 1) / escala;
+	char* linha = (char*)malloc((size_t)largura + 1);
+	if (linha == NULL) return 1;
+
+	GRELHA* grelha = rede->grelha;
+	for (int x = x0; x < x1; x += escala) {
+		if (escala == 1)
+		{
+			memcpy(linha, &grelha->frequencias[(size_t)x * MAX_DIM + y0], (size_t)largura);
+		}
+		else
+		{
+			int xFim = x + escala > x1 ? x1 : x + escala;
+			for (int j = 0; j < largura; j++) {
+				int y = y0 + j * escala;
+				int yFim = y + escala > y1 ? y1 : y + escala;
+				linha[j] = resumirZona(grelha, x, y, xFim, yFim);
+			}
+		}
+		linha[largura] = '\n';
+		if (fwrite(linha, 1, (size_t)largura + 1, fp) != (size_t)largura + 1)
+		{
+			free(linha);
+			return 2;
+		}
+	}
+
+	free(linha);
+	return 0;
+}
+
+/**
+ * @brief Liberta toda a memória ocupada pela grelha.
+ *
+ * @param grelha - apontador para a grelha a destruir.
+ * @return NULL, indicando que a grelha foi destruída.
+ */
+GRELHA* destruirGrelha(GRELHA* grelha) {
+	if (grelha == NULL) return NULL;
+
+	free(grelha->frequencias);
+	free(grelha->ocupacao);
+	free(grelha);
+	return NULL;
+}
+
+#pragma endregion
@@ -0,0 +1,104 @@
+#pragma once
+
+/**
+ * @file grelha.h
+ * @brief Grelha persistente de ocupação e frequências da cidade, mantida pela rede
+ *        a cada inserção/remoção de antenas e usada para desenhar o mapa.
+ *
+ * @author Rogério Picas
+ * @date 18-10-2026
+ * @version 1.0
+ *
+ */
+#include <stdio.h>
+#include <stdint.h>
+#include "funcoes.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+ /** @def CELULA_LIVRE
+  *  @brief Caractere usado para representar uma célula sem antenas.
+  */
+#define CELULA_LIVRE '.'
+
+ /** @def CELULA_MISTA
+  *  @brief Caractere usado num mapa reduzido quando a zona tem antenas de várias frequências.
+  */
+#define CELULA_MISTA '*'
+
+#pragma region Estruturas
+
+/**
+ * @struct Grelha
+ * @brief Estado de cada célula da cidade: bitset de ocupação e frequência visível.
+ */
+typedef struct Grelha {
+    char* frequencias;      /**< MAX_DIM * MAX_DIM caracteres, linha a linha (CELULA_LIVRE se vazia) */
+    uint64_t* ocupacao;     /**< Bitset de ocupação, palavrasPorLinha palavras por linha */
+    int palavrasPorLinha;   /**< Número de palavras de 64 bits em cada linha do bitset */
+} GRELHA;
+
+#pragma endregion
+
+#pragma region Funções da Grelha
+
+/**
+ * @brief Cria uma grelha vazia com a dimensão da cidade.
+ * @return Apontador para a grelha criada ou NULL em caso de falha de alocação.
+ */
+GRELHA* criarGrelha();
+
+/**
+ * @brief Marca a célula (x, y) como ocupada por uma antena da frequência indicada.
+ * @param grelha Apontador para a grelha.
+ * @param x Coordenada X da célula.
+ * @param y Coordenada Y da célula.
+ * @param freq Frequência da antena.
+ */
+void marcarGrelha(GRELHA* grelha, int x, int y, char freq);
+
+/**
+ * @brief Atualiza a célula (x, y) depois de lá ter sido removida uma antena.
+ * @param rede Apontador para a rede (usada para procurar outras antenas na mesma célula).
+ * @param excluido Grafo a ignorar na procura (ex.: grafo a ser destruído), ou NULL.
+ * @param x Coordenada X da célula.
+ * @param y Coordenada Y da célula.
+ */
+void limparGrelha(REDE* rede, GRAFO* excluido, int x, int y);
+
+/**
+ * @brief Verifica se a célula (x, y) tem alguma antena.
+ * @param grelha Apontador para a grelha.
+ * @param x Coordenada X da célula.
+ * @param y Coordenada Y da célula.
+ * @return true se a célula estiver ocupada, false caso contrário.
+ */
+bool celulaOcupada(GRELHA* grelha, int x, int y);
+
+/**
+ * @brief Mostra uma região da cidade, opcionalmente reduzida (cada caractere representa escala x escala células).
+ * @param rede Apontador para a rede a mostrar.
+ * @param fp Ficheiro de destino (ex.: stdout).
+ * @param x0 Primeira linha da região.
+ * @param y0 Primeira coluna da região.
+ * @param linhas Número de linhas da cidade a mostrar.
+ * @param colunas Número de colunas da cidade a mostrar.
+ * @param escala Lado (em células) da zona representada por cada caractere (1 = sem redução).
+ * @return 0 se a operação for bem-sucedida, 1 em caso de erro nos argumentos, 2 se a escrita falhar.
+ */
+int mostrarRegiaoRede(REDE* rede, FILE* fp, int x0, int y0, int linhas, int colunas, int escala);
+
+/**
+ * @brief Liberta toda a memória ocupada pela grelha.
+ * @param grelha Apontador para a grelha a destruir.
+ * @return NULL, indicando que a grelha foi destruída.
+ */
+GRELHA* destruirGrelha(GRELHA* grelha);
+
+#pragma endregion
+
+#ifdef __cplusplus
+}
+#endif
@@ -1,8 +1,8 @@
 /**
  * @main.c
- * @brief main.c da soluo que ir representar o funcionamento das funes desenvolvidas
+ * @brief main.c da solução que irá representar o funcionamento das funções desenvolvidas
  *
- * @author Rogrio Picas
+ * @author Rogério Picas
  * @date 07-05-2025
  * @version 1.0
  *
@@ -21,11 +21,11 @@ int main() {
 	// Carrega ficheiro (que pode criar grafos)
 	carregaGrafo(rede, ficheiroTexto);
 
-	// Criao de grafos por frequencia:
+	// Criação de grafos por frequencia:
 	GRAFO* grafoA = criarGrafo(rede, 'A');
 	GRAFO* grafoB = criarGrafo(rede, 'B');
 
-	// Insero de antenas nos grafos por frequencia
+	// Inserção de antenas nos grafos por frequencia
 	// Frequencia - A
 	inserirAntenaGrafo(grafoA, 'A', 2, 5);
 	inserirAntenaGrafo(grafoA, 'A', 4, 6);
@@ -39,14 +39,14 @@ int main() {
 	//Teste duplicada
 	inserirAntenaGrafo(grafoB, 'B', 6, 3);
 
-	//Conectar antenas na frequncia A
+	//Conectar antenas na frequência A
 	conectarVertices(grafoA, 2, 5, 4, 6);
 	conectarVertices(grafoA, 19, 17, 4, 6);
 	conectarVertices(grafoA, 19, 17, 2, 5);
-	// Teste conexo
+	// Teste conexão
 	conectarVertices(grafoA, 19, 17, 5, 5);
 
-	//Conectar antenas na frequncia B
+	//Conectar antenas na frequência B
 	conectarVertices(grafoB, 3, 6, 5, 7);
 	conectarVertices(grafoB, 6, 3, 5, 7);
 	conectarVertices(grafoB, 6, 3, 3, 6);
@@ -54,7 +54,7 @@ int main() {
 	conectarVertices(grafoB, 13, 6, 5, 7);
 	conectarVertices(grafoB, 13, 6, 3, 6);
 
-	// Teste de conexo entre vertices
+	// Teste de conexão entre vertices
 	bool conexao = existeConexaoEntreVertices(grafoA, 2, 5, 4, 6);
 	if (!conexao)
 	{
@@ -71,20 +71,20 @@ int main() {
 	VERTICE* destino = encontrarVertice(grafoA, 19, 17);
 
 	//if (origem == NULL || destino == NULL) {
-	//	printf("Origem ou destino no encontrados.\n");
+	//	printf("Origem ou destino não encontrados.\n");
 	//}
 	//else {
 	//	int totalPaths = countPaths(origem, destino);
 	//	printf("Total de caminhos possiveis de (%d,%d) para (%d,%d): %d\n",
-	//		origem->infoAntenas->x, origem->infoAntenas->y,
-	//		destino->infoAntenas->x, destino->infoAntenas->y,
+	//		origem->antena.x, origem->antena.y,
+	//		destino->antena.x, destino->antena.y,
 	//		totalPaths);
 	//}
 
 
 	mostrarRedeGrafos(rede);
 
-	// Utilizao do DFS
+	// Utilização do DFS
 	printf("DFS -> Antenas alcancadas a partir de (3, 6)\n");
 	DFS(grafoB, 3, 6);
 
@@ -93,14 +93,14 @@ int main() {
 	while (v) {
 		if (v->visitado) {
 			printf("  (%d, %d), frequencia: %c\n",
-				v->infoAntenas->x,
-				v->infoAntenas->y,
-				v->infoAntenas->frequencia);
+				v->antena.x,
+				v->antena.y,
+				v->antena.frequencia);
 		}
 		v = v->prox;
 	}
 
-	// Funo para destruir o grafo
+	// Função para destruir o grafo
 	//destruirGrafo(grafoA);
 
 	// Listagem de grafos pela frequencia e numero de vertices
@@ -112,11 +112,9 @@ int main() {
 
 		VERTICE* v = listarGrafos->vertices;
 		while (v != NULL) {
-			if (v->infoAntenas != NULL) {
-				printf("  Vertice coord: (%d, %d)\n",
-					v->infoAntenas->x,
-					v->infoAntenas->y);
-			}
+			printf("  Vertice coord: (%d, %d)\n",
+				v->antena.x,
+				v->antena.y);
 			v = v->prox;
 		}
 		listarGrafos = listarGrafos->prox;
@@ -125,6 +123,9 @@ int main() {
 	// Guardar grafos para ficheiro binario
 	bool binGrafoA = guardarGrafoBin(grafoA->vertices, ficheiroBin);
 	bool binGrafoB = guardarGrafoBin(grafoB->vertices, ficheiroBin);
+
+	// Liberta a rede com todos os grafos
+	rede = destruirRede(rede);
 	if (!binGrafoA || !binGrafoB)
 	{
 		return false;
@@ -0,0 +1,86 @@
+#pragma once
+
+/**
+ * @file protocolo.h
+ * @brief Protocolo binário do servidor de consultas (servidor.c), para os clientes que ligam ao socket
+ *
+ * Cada pedido e cada resposta é um bloco de tamanho fixo (24 e 16 bytes), com os inteiros na
+ * ordem de bytes da máquina (o socket é local). Um cliente pode enviar vários pedidos seguidos
+ * sem esperar pelas respostas; cada resposta leva o id do pedido a que responde, e as respostas
+ * de pedidos de lotes diferentes podem chegar por outra ordem. Depois de enviar o último pedido,
+ * o cliente pode fechar o sentido de escrita (shutdown): o servidor envia as respostas que faltam
+ * e só depois fecha a ligação.
+ *
+ * @author Rogério Picas
+ * @date 18-10-2026
+ * @version 1.0
+ *
+ */
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+ /** @def FREQUENCIA_TODAS
+  *  @brief Frequência dos pedidos de interferência que somam todos os grafos.
+  */
+#define FREQUENCIA_TODAS '*'
+
+#pragma region Estruturas
+
+/**
+ * @enum TipoPedido
+ * @brief Consultas aceites pelo servidor.
+ */
+typedef enum TipoPedido {
+    PEDIDO_PROCURAR = 1,     /**< Existe uma antena da frequência em (x1, y1)? (valor 1 ou 0) */
+    PEDIDO_LIGACAO = 2,      /**< As antenas (x1, y1) e (x2, y2) estão ligadas diretamente? (valor 1 ou 0) */
+    PEDIDO_ALCANCE = 3,      /**< Número de antenas alcançáveis a partir de (x1, y1), como a BFT */
+    PEDIDO_DISTANCIA = 4,    /**< Menor número de ligações entre (x1, y1) e (x2, y2) (-1 se não houver caminho) */
+    PEDIDO_INTERFERENCIA = 5 /**< Pares de antenas com efeito nefasto na célula (x1, y1) (FREQUENCIA_TODAS soma todos os grafos) */
+} TIPO_PEDIDO;
+
+/**
+ * @enum EstadoResposta
+ * @brief Resultado de um pedido.
+ */
+typedef enum EstadoResposta {
+    RESPOSTA_OK = 0,              /**< O valor tem a resposta */
+    RESPOSTA_NAO_ENCONTRADO = 1,  /**< A frequência ou uma das antenas não existe */
+    RESPOSTA_INVALIDO = 2,        /**< Tipo de pedido desconhecido */
+    RESPOSTA_ERRO = 3             /**< Falha interna (ex.: falta de memória) */
+} ESTADO_RESPOSTA;
+
+/**
+ * @struct PedidoServidor
+ * @brief Pedido enviado ao servidor (24 bytes).
+ */
+typedef struct PedidoServidor {
+    uint32_t id;          /**< Identificador escolhido pelo cliente, devolvido na resposta */
+    uint8_t tipo;         /**< Tipo do pedido (TIPO_PEDIDO) */
+    char frequencia;      /**< Frequência (grafo) consultada */
+    uint16_t reservado;   /**< A 0 */
+    int32_t x1;           /**< Coordenada X da antena (ou da origem) */
+    int32_t y1;           /**< Coordenada Y da antena (ou da origem) */
+    int32_t x2;           /**< Coordenada X do destino (pedidos com duas antenas) */
+    int32_t y2;           /**< Coordenada Y do destino (pedidos com duas antenas) */
+} PEDIDO_SERVIDOR;
+
+/**
+ * @struct RespostaServidor
+ * @brief Resposta do servidor (16 bytes).
+ */
+typedef struct RespostaServidor {
+    uint32_t id;          /**< Id do pedido */
+    uint8_t tipo;         /**< Tipo do pedido */
+    uint8_t estado;       /**< Resultado (ESTADO_RESPOSTA) */
+    uint16_t reservado;   /**< A 0 */
+    int64_t valor;        /**< Resposta, se o estado for RESPOSTA_OK */
+} RESPOSTA_SERVIDOR;
+
+#pragma endregion
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,391 @@
+#pragma once
+
+/**
+ * @file rede.hpp
+ * @brief Interface C++ sobre a biblioteca: a rede é dona dos grafos (RAII, só pode ser movida) e os
+ *        grafos e vértices são acedidos através de handles leves, sem cópias escondidas
+ *
+ * A classe @c Rede liberta a rede (e todos os grafos) com @c destruirRede no destrutor; não pode ser
+ * copiada, apenas movida. @c Grafo e @c Vertice são handles que guardam apenas o apontador para a
+ * estrutura em C (como uma referência) e deixam de ser válidos quando o grafo é removido ou a rede
+ * destruída. Os acessos em bloco escrevem num @c Intervalo fornecido por quem chama (apontador e
+ * tamanho, como um std::span), pelo que nenhuma função aloca memória por conta própria.
+ *
+ * @author Rogério Picas
+ * @date 18-10-2026
+ * @version 1.0
+ *
+ */
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include "funcoes.h"
+#include "reserva.h"
+
+namespace pa {
+
+#pragma region Intervalo
+
+/**
+ * @class Intervalo
+ * @brief Vista sobre uma sequência contígua de elementos (apontador e tamanho), sem posse da memória.
+ *
+ * Pode ser criada a partir de um array, de um apontador e tamanho, ou de qualquer contentor com
+ * @c data() e @c size() (std::vector, std::array, std::span, ...).
+ */
+template <class T>
+class Intervalo {
+public:
+    constexpr Intervalo() noexcept : dados_(nullptr), tamanho_(0) {}
+    constexpr Intervalo(T* dados, std::size_t tamanho) noexcept : dados_(dados), tamanho_(tamanho) {}
+
+    template <std::size_t N>
+    constexpr Intervalo(T (&array)[N]) noexcept : dados_(array), tamanho_(N) {}
+
+    template <class C, class = std::enable_if_t<
+        std::is_convertible<decltype(std::declval<C&>().data()), T*>::value>>
+    constexpr Intervalo(C& contentor) noexcept : dados_(contentor.data()), tamanho_(contentor.size()) {}
+
+    /** @brief Conversão de Intervalo<U> para Intervalo<const U>. */
+    template <class U, class = std::enable_if_t<std::is_same<const U, T>::value && !std::is_same<U, T>::value>>
+    constexpr Intervalo(const Intervalo<U>& outro) noexcept : dados_(outro.data()), tamanho_(outro.size()) {}
+
+    constexpr T* data() const noexcept { return dados_; }
+    constexpr std::size_t size() const noexcept { return tamanho_; }
+    constexpr bool empty() const noexcept { return tamanho_ == 0; }
+    constexpr T* begin() const noexcept { return dados_; }
+    constexpr T* end() const noexcept { return dados_ + tamanho_; }
+    constexpr T& operator[](std::size_t i) const noexcept { return dados_[i]; }
+
+private:
+    T* dados_;
+    std::size_t tamanho_;
+};
+
+#pragma endregion
+
+#pragma region Handles
+
+/**
+ * @class Vertice
+ * @brief Handle de um vértice (antena) de um grafo.
+ */
+class Vertice {
+public:
+    constexpr Vertice() noexcept : vertice_(nullptr) {}
+    constexpr explicit Vertice(VERTICE* vertice) noexcept : vertice_(vertice) {}
+
+    /** @brief Iterador sobre a lista de adjacências, que devolve o vértice destino de cada aresta. */
+    class IteradorVizinhos {
+    public:
+        explicit IteradorVizinhos(ARESTA* aresta) noexcept : aresta_(aresta) {}
+        Vertice operator*() const noexcept { return Vertice(aresta_->destino); }
+        IteradorVizinhos& operator++() noexcept { aresta_ = aresta_->prox; return *this; }
+        bool operator==(const IteradorVizinhos& outro) const noexcept { return aresta_ == outro.aresta_; }
+        bool operator!=(const IteradorVizinhos& outro) const noexcept { return aresta_ != outro.aresta_; }
+    private:
+        ARESTA* aresta_;
+    };
+
+    /** @brief Intervalo com os vizinhos do vértice, pela ordem das arestas. */
+    struct Vizinhos {
+        ARESTA* primeira;
+        IteradorVizinhos begin() const noexcept { return IteradorVizinhos(primeira); }
+        IteradorVizinhos end() const noexcept { return IteradorVizinhos(nullptr); }
+    };
+
+    explicit operator bool() const noexcept { return vertice_ != nullptr; }
+    bool operator==(const Vertice& outro) const noexcept { return vertice_ == outro.vertice_; }
+    bool operator!=(const Vertice& outro) const noexcept { return vertice_ != outro.vertice_; }
+
+    const ANTENAS& antena() const noexcept { return vertice_->antena; }
+    char frequencia() const noexcept { return vertice_->antena.frequencia; }
+    int x() const noexcept { return vertice_->antena.x; }
+    int y() const noexcept { return vertice_->antena.y; }
+    int id() const noexcept { return vertice_->id; }
+    int grau() const noexcept { return vertice_->grau; }
+    Vizinhos vizinhos() const noexcept { return Vizinhos{ vertice_->adjacentes }; }
+
+    /** @brief Apontador para o vértice em C. */
+    VERTICE* c() const noexcept { return vertice_; }
+
+private:
+    VERTICE* vertice_;
+};
+
+/**
+ * @class Grafo
+ * @brief Handle de um grafo (uma frequência) de uma rede; o grafo pertence à rede.
+ */
+class Grafo {
+public:
+    constexpr Grafo() noexcept : grafo_(nullptr) {}
+    constexpr explicit Grafo(GRAFO* grafo) noexcept : grafo_(grafo) {}
+
+    /** @brief Iterador sobre a lista de vértices do grafo. */
+    class IteradorVertices {
+    public:
+        explicit IteradorVertices(VERTICE* vertice) noexcept : vertice_(vertice) {}
+        Vertice operator*() const noexcept { return Vertice(vertice_); }
+        IteradorVertices& operator++() noexcept { vertice_ = vertice_->prox; return *this; }
+        bool operator==(const IteradorVertices& outro) const noexcept { return vertice_ == outro.vertice_; }
+        bool operator!=(const IteradorVertices& outro) const noexcept { return vertice_ != outro.vertice_; }
+    private:
+        VERTICE* vertice_;
+    };
+
+    /** @brief Intervalo com os vértices do grafo, pela ordem da lista. */
+    struct Vertices {
+        VERTICE* primeiro;
+        IteradorVertices begin() const noexcept { return IteradorVertices(primeiro); }
+        IteradorVertices end() const noexcept { return IteradorVertices(nullptr); }
+    };
+
+    explicit operator bool() const noexcept { return grafo_ != nullptr; }
+    bool operator==(const Grafo& outro) const noexcept { return grafo_ == outro.grafo_; }
+    bool operator!=(const Grafo& outro) const noexcept { return grafo_ != outro.grafo_; }
+
+    char frequencia() const noexcept { return grafo_->frequencia; }
+    std::size_t numVertices() const noexcept { return static_cast<std::size_t>(grafo_->numVertices); }
+    Vertices vertices() const noexcept { return Vertices{ grafo_->vertices }; }
+
+    /** @brief Número de vértices que o grafo comporta sem alocar memória (vértices atuais mais os reservados). */
+    std::size_t capacidade() const noexcept { return static_cast<std::size_t>(grafo_->maxVertices); }
+
+    /**
+     * @brief Reserva espaço para mais vértices e ligações (ver @c reservarGrafo).
+     * @return true se a reserva foi feita.
+     */
+    bool reservar(std::size_t numVertices, std::size_t numLigacoes) {
+        return reservarGrafo(grafo_, static_cast<int>(numVertices), static_cast<int>(numLigacoes)) == 0;
+    }
+
+    /** @brief Número de ligações (cada ligação conta uma vez, embora tenha uma aresta em cada sentido). */
+    std::size_t numLigacoes() const noexcept {
+        std::size_t total = 0;
+        for (VERTICE* v = grafo_->vertices; v != nullptr; v = v->prox) total += static_cast<std::size_t>(v->grau);
+        return total / 2;
+    }
+
+    /**
+     * @brief Procura o vértice da posição (x, y).
+     * @return O vértice, ou um handle vazio se não existir.
+     */
+    Vertice procurar(int x, int y) const { return Vertice(encontrarVertice(grafo_, x, y)); }
+
+    /** @brief Insere uma antena na posição (x, y). @return true se foi inserida. */
+    bool inserir(int x, int y) { return inserirAntenaGrafo(grafo_, grafo_->frequencia, x, y) == 0; }
+
+    /** @brief Move a antena de (x, y) para (novoX, novoY). @return true se foi movida. */
+    bool mover(int x, int y, int novoX, int novoY) { return moverAntenaGrafo(grafo_, x, y, novoX, novoY) == 0; }
+
+    /** @brief Remove a antena de (x, y) e as suas ligações. @return true se foi removida. */
+    bool remover(int x, int y) { return removerAntenaGrafo(grafo_, x, y) == 0; }
+
+    /** @brief Liga as antenas de (x1, y1) e (x2, y2). @return true se a ligação foi criada. */
+    bool ligar(int x1, int y1, int x2, int y2) { return conectarVertices(grafo_, x1, y1, x2, y2) == 0; }
+
+    /** @brief Remove a ligação entre (x1, y1) e (x2, y2). @return true se a ligação existia. */
+    bool desligar(int x1, int y1, int x2, int y2) { return removerLigacao(grafo_, x1, y1, x2, y2) == 0; }
+
+    /**
+     * @brief Insere várias antenas (as posições de cada ANTENAS; a frequência é a do grafo),
+     *        depois de reservar os vértices para todas.
+     * @return Número de antenas inseridas.
+     */
+    std::size_t inserir(Intervalo<const ANTENAS> antenas) {
+        std::size_t inseridas = 0;
+        reservar(antenas.size(), 0);
+        for (const ANTENAS& a : antenas) inseridas += inserir(a.x, a.y);
+        return inseridas;
+    }
+
+    /**
+     * @brief Cria várias ligações, depois de reservar as arestas para todas.
+     * @return Número de ligações criadas.
+     */
+    std::size_t ligar(Intervalo<const ArestasFICHEIRO> ligacoes) {
+        std::size_t criadas = 0;
+        reservar(0, ligacoes.size());
+        for (const ArestasFICHEIRO& l : ligacoes) criadas += ligar(l.xOrigem, l.yOrigem, l.xDestino, l.yDestino);
+        return criadas;
+    }
+
+    /**
+     * @brief Copia os handles dos vértices, pela ordem da lista, para o intervalo indicado.
+     * @return Número total de vértices (se for maior do que o intervalo, só os primeiros são copiados).
+     */
+    std::size_t copiarVertices(Intervalo<Vertice> destino) const noexcept {
+        std::size_t n = 0;
+        for (VERTICE* v = grafo_->vertices; v != nullptr; v = v->prox, n++) {
+            if (n < destino.size()) destino[n] = Vertice(v);
+        }
+        return n;
+    }
+
+    /**
+     * @brief Copia as antenas, pela ordem da lista de vértices, para o intervalo indicado.
+     * @return Número total de antenas (se for maior do que o intervalo, só as primeiras são copiadas).
+     */
+    std::size_t copiarAntenas(Intervalo<ANTENAS> destino) const noexcept {
+        std::size_t n = 0;
+        for (VERTICE* v = grafo_->vertices; v != nullptr; v = v->prox, n++) {
+            if (n < destino.size()) destino[n] = v->antena;
+        }
+        return n;
+    }
+
+    /**
+     * @brief Copia as ligações para o intervalo indicado, uma vez cada (com a origem antes do destino,
+     *        por ordem de x e depois de y).
+     * @return Número total de ligações (se for maior do que o intervalo, só as primeiras são copiadas).
+     */
+    std::size_t copiarLigacoes(Intervalo<ArestasFICHEIRO> destino) const noexcept {
+        std::size_t n = 0;
+        for (VERTICE* v = grafo_->vertices; v != nullptr; v = v->prox) {
+            for (ARESTA* a = v->adjacentes; a != nullptr; a = a->prox) {
+                const ANTENAS& o = v->antena;
+                const ANTENAS& d = a->destino->antena;
+                if (o.x > d.x || (o.x == d.x && o.y > d.y)) continue;
+                if (n < destino.size()) destino[n] = ArestasFICHEIRO{ o.x, o.y, d.x, d.y };
+                n++;
+            }
+        }
+        return n;
+    }
+
+    /** @brief Apontador para o grafo em C. */
+    GRAFO* c() const noexcept { return grafo_; }
+
+private:
+    GRAFO* grafo_;
+};
+
+#pragma endregion
+
+#pragma region Rede
+
+/**
+ * @class Rede
+ * @brief Dona de uma REDE: liberta a rede e todos os seus grafos no destrutor.
+ *
+ * Só pode ser movida (a rede de origem fica vazia); uma cópia teria de duplicar todos os grafos,
+ * pelo que não existe.
+ */
+class Rede {
+public:
+    /**
+     * @brief Cria uma rede vazia.
+     * @throw std::bad_alloc se não houver memória para a rede.
+     */
+    Rede() : rede_(criarRede()) {
+        if (rede_ == nullptr) throw std::bad_alloc();
+    }
+
+    /** @brief Fica com a posse de uma rede já criada em C (pode ser NULL). */
+    explicit Rede(REDE* rede) noexcept : rede_(rede) {}
+
+    ~Rede() { destruirRede(rede_); }
+
+    Rede(const Rede&) = delete;
+    Rede& operator=(const Rede&) = delete;
+
+    Rede(Rede&& outra) noexcept : rede_(outra.rede_) { outra.rede_ = nullptr; }
+
+    Rede& operator=(Rede&& outra) noexcept {
+        if (this != &outra)
+        {
+            destruirRede(rede_);
+            rede_ = outra.rede_;
+            outra.rede_ = nullptr;
+        }
+        return *this;
+    }
+
+    /** @brief Iterador sobre a lista de grafos da rede. */
+    class IteradorGrafos {
+    public:
+        explicit IteradorGrafos(GRAFO* grafo) noexcept : grafo_(grafo) {}
+        Grafo operator*() const noexcept { return Grafo(grafo_); }
+        IteradorGrafos& operator++() noexcept { grafo_ = grafo_->prox; return *this; }
+        bool operator==(const IteradorGrafos& outro) const noexcept { return grafo_ == outro.grafo_; }
+        bool operator!=(const IteradorGrafos& outro) const noexcept { return grafo_ != outro.grafo_; }
+    private:
+        GRAFO* grafo_;
+    };
+
+    /** @brief Intervalo com os grafos da rede. */
+    struct Grafos {
+        GRAFO* primeiro;
+        IteradorGrafos begin() const noexcept { return IteradorGrafos(primeiro); }
+        IteradorGrafos end() const noexcept { return IteradorGrafos(nullptr); }
+    };
+
+    explicit operator bool() const noexcept { return rede_ != nullptr; }
+    Grafos grafos() const noexcept { return Grafos{ rede_ ? rede_->listaGrafos : nullptr }; }
+
+    /**
+     * @brief Devolve o grafo da frequência indicada, criando-o se ainda não existir.
+     * @return O grafo, ou um handle vazio se não houver memória.
+     */
+    Grafo grafo(char frequencia) { return Grafo(criarGrafo(rede_, frequencia)); }
+
+    /**
+     * @brief Procura o grafo da frequência indicada, sem o criar.
+     * @return O grafo, ou um handle vazio se não existir.
+     */
+    Grafo procurar(char frequencia) const { return Grafo(encontrarGrafoPorFrequencia(rede_, frequencia)); }
+
+    /**
+     * @brief Destrói um grafo da rede (todos os handles do grafo e dos seus vértices deixam de ser válidos).
+     * @param grafo Grafo a destruir; fica vazio.
+     */
+    void remover(Grafo& grafo) noexcept {
+        destruirGrafo(grafo.c());
+        grafo = Grafo();
+    }
+
+    /**
+     * @brief Reserva os grafos, os vértices e os baldes do índice espacial para as antenas indicadas (ver @c reservarRede).
+     * @return true se a reserva foi feita.
+     */
+    bool reservar(Intervalo<const ANTENAS> antenas) {
+        return reservarRede(rede_, antenas.data(), static_cast<int>(antenas.size())) == 0;
+    }
+
+    /**
+     * @brief Insere várias antenas, cada uma no grafo da sua frequência (criado se necessário),
+     *        depois de reservar o espaço para todas.
+     * @return Número de antenas inseridas.
+     */
+    std::size_t inserir(Intervalo<const ANTENAS> antenas) {
+        std::size_t inseridas = 0;
+        GRAFO* grafo = nullptr;
+        reservar(antenas);
+        for (const ANTENAS& a : antenas) {
+            if (grafo == nullptr || grafo->frequencia != a.frequencia) grafo = criarGrafo(rede_, a.frequencia);
+            inseridas += inserirAntenaGrafo(grafo, a.frequencia, a.x, a.y) == 0;
+        }
+        return inseridas;
+    }
+
+    /**
+     * @brief Carrega as antenas de um ficheiro de texto (ver @c carregaGrafo).
+     * @return true se o ficheiro foi lido.
+     */
+    bool carregar(const char* ficheiro) { return carregaGrafo(rede_, const_cast<char*>(ficheiro)) == 0; }
+
+    /** @brief Apontador para a rede em C (continua a pertencer a este objeto). */
+    REDE* c() const noexcept { return rede_; }
+
+    /** @brief Entrega a rede em C a quem chama, que passa a ter de a libertar com @c destruirRede. */
+    REDE* libertar() noexcept { return std::exchange(rede_, nullptr); }
+
+private:
+    REDE* rede_;
+};
+
+#pragma endregion
+
+} // namespace pa
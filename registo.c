@@ -0,0 +1,368 @@
+/**
+ * @file registo.c
+ * @brief Implementação do registo da biblioteca (escrita direta ou buffer circular com thread própria).
+ *
+ * O buffer é um anel de TAM_BUFFER_REGISTO entradas com um número de sequência cada: os
+ * produtores reservam as posições de cada texto com uma única operação compare-and-swap sobre
+ * a cauda, copiam o texto e publicam as entradas; a thread do registo é o único consumidor e escreve
+ * as entradas publicadas por ordem. Nenhuma das partes usa locks; se o anel estiver cheio,
+ * o produtor cede o processador até haver espaço (nenhuma mensagem é perdida; só os textos com
+ * mais de MAX_ENTRADAS_TEXTO entradas são truncados).
+ *
+ * @author Rogério Picas
+ * @date 18-10-2026
+ * @version 1.0
+ */
+#define _CRT_SECURE_NO_WARNINGS
+#ifndef _WIN32
+#define _POSIX_C_SOURCE 200809L
+#endif
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <stdbool.h>
+#include "registo.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <stdatomic.h>
+#include <pthread.h>
+#include <sched.h>
+#include <time.h>
+#endif
+
+ /** @def TAM_BUFFER_REGISTO
+  *  @brief Número de entradas do anel (potência de 2).
+  */
+#define TAM_BUFFER_REGISTO 4096
+
+ /** @def TAM_TEXTO_REGISTO
+  *  @brief Caracteres de cada entrada; os textos maiores ocupam várias entradas seguidas.
+  */
+#define TAM_TEXTO_REGISTO 116
+
+ /** @def MAX_ENTRADAS_TEXTO
+  *  @brief Entradas máximas de um só texto (metade do anel); o resto de um texto maior é descartado.
+  */
+#define MAX_ENTRADAS_TEXTO (TAM_BUFFER_REGISTO / 2)
+
+ /** @def TAM_FORMATACAO_REGISTO
+  *  @brief Tamanho do buffer local usado pelo vsnprintf (as mensagens maiores são alocadas).
+  */
+#define TAM_FORMATACAO_REGISTO 512
+
+#pragma region Operações Atómicas e Threads
+
+#ifdef _WIN32
+
+typedef volatile LONG64 ATOMICO;
+typedef HANDLE THREAD_REGISTO;
+
+static long long carregarAtomico(ATOMICO* p) {
+	return InterlockedCompareExchange64(p, 0, 0);
+}
+
+static void guardarAtomico(ATOMICO* p, long long valor) {
+	InterlockedExchange64(p, valor);
+}
+
+static bool trocarAtomico(ATOMICO* p, long long esperado, long long novo) {
+	return InterlockedCompareExchange64(p, novo, esperado) == esperado;
+}
+
+static void esperarRegisto(bool ceder) {
+	if (ceder) SwitchToThread();
+	else Sleep(1);
+}
+
+#else
+
+typedef _Atomic long long ATOMICO;
+typedef pthread_t THREAD_REGISTO;
+
+static long long carregarAtomico(ATOMICO* p) {
+	return atomic_load_explicit(p, memory_order_acquire);
+}
+
+static void guardarAtomico(ATOMICO* p, long long valor) {
+	atomic_store_explicit(p, valor, memory_order_release);
+}
+
+static bool trocarAtomico(ATOMICO* p, long long esperado, long long novo) {
+	return atomic_compare_exchange_strong_explicit(p, &esperado, novo, memory_order_relaxed, memory_order_relaxed);
+}
+
+static void esperarRegisto(bool ceder) {
+	if (ceder)
+	{
+		sched_yield();
+	}
+	else
+	{
+		struct timespec pausa = { 0, 1000000 };
+		nanosleep(&pausa, NULL);
+	}
+}
+
+#endif
+
+#pragma endregion
+
+#pragma region Estado do Registo
+
+/**
+ * @struct EntradaRegisto
+ * @brief Posição do anel com um pedaço de texto.
+ */
+typedef struct EntradaRegisto {
+	ATOMICO sequencia;               /**< Igual à posição se livre, posição + 1 se publicada */
+	unsigned short tamanho;          /**< Número de caracteres do texto */
+	char texto[TAM_TEXTO_REGISTO];   /**< Texto (sem '\0') */
+} ENTRADA_REGISTO;
+
+static ENTRADA_REGISTO anel[TAM_BUFFER_REGISTO];
+static ATOMICO cauda;                // próxima posição a reservar pelos produtores
+static long long cabeca;             // próxima posição a escrever (só usada pela thread do registo)
+static ATOMICO ativo;                // 1 enquanto a thread do registo estiver a correr
+static ATOMICO parar;                // pedido de fim à thread do registo
+static THREAD_REGISTO thread;
+static ATOMICO nivelMinimo;          // nível mínimo escrito (0 = REGISTO_DEPURACAO)
+static FILE* destino = NULL;
+static bool terminarNoFim = false;
+
+/**
+ * @brief Devolve o ficheiro onde o registo é escrito (stdout por omissão).
+ */
+static FILE* ficheiroDestino() {
+	return destino ? destino : stdout;
+}
+
+#pragma endregion
+
+#pragma region Funções Auxiliares
+
+/**
+ * @brief Copia um texto para o anel, repartido pelas entradas necessárias.
+ *
+ * Todas as entradas do texto são reservadas com um só compare-and-swap, pelo que ficam seguidas
+ * no anel e os pedaços de textos de produtores diferentes nunca se misturam. Basta verificar que
+ * a última entrada está livre: a thread do registo liberta as entradas por ordem. Os textos com mais
+ * de MAX_ENTRADAS_TEXTO entradas são truncados.
+ */
+static void publicarTexto(const char* texto, size_t tamanho) {
+	long long numEntradas = (long long)((tamanho + TAM_TEXTO_REGISTO - 1) / TAM_TEXTO_REGISTO);
+	if (numEntradas > MAX_ENTRADAS_TEXTO)
+	{
+		numEntradas = MAX_ENTRADAS_TEXTO;
+		tamanho = (size_t)MAX_ENTRADAS_TEXTO * TAM_TEXTO_REGISTO;
+	}
+
+	long long posicao = carregarAtomico(&cauda);
+	while (1) {
+		long long ultima = posicao + numEntradas - 1;
+		long long diferenca = carregarAtomico(&anel[ultima & (TAM_BUFFER_REGISTO - 1)].sequencia) - ultima;
+		if (diferenca == 0)
+		{
+			if (trocarAtomico(&cauda, posicao, posicao + numEntradas)) break;
+		}
+		else if (diferenca < 0)
+		{
+			// Anel cheio: a entrada ainda não foi escrita pela thread do registo
+			esperarRegisto(true);
+		}
+		posicao = carregarAtomico(&cauda);
+	}
+
+	for (long long i = 0; i < numEntradas; i++) {
+		size_t parte = tamanho < TAM_TEXTO_REGISTO ? tamanho : TAM_TEXTO_REGISTO;
+		ENTRADA_REGISTO* entrada = &anel[(posicao + i) & (TAM_BUFFER_REGISTO - 1)];
+		memcpy(entrada->texto, texto, parte);
+		entrada->tamanho = (unsigned short)parte;
+		guardarAtomico(&entrada->sequencia, posicao + i + 1);
+
+		texto += parte;
+		tamanho -= parte;
+	}
+}
+
+/**
+ * @brief Ciclo da thread do registo: escreve as entradas publicadas até ser pedido o fim e o anel ficar vazio.
+ */
+static void esvaziarRegisto() {
+	FILE* fp = ficheiroDestino();
+	while (1) {
+		ENTRADA_REGISTO* entrada = &anel[cabeca & (TAM_BUFFER_REGISTO - 1)];
+		if (carregarAtomico(&entrada->sequencia) == cabeca + 1)
+		{
+			fwrite(entrada->texto, 1, entrada->tamanho, fp);
+			guardarAtomico(&entrada->sequencia, cabeca + TAM_BUFFER_REGISTO);
+			cabeca++;
+		}
+		else if (carregarAtomico(&parar) && carregarAtomico(&cauda) == cabeca)
+		{
+			break;
+		}
+		else
+		{
+			// Nada publicado: o texto acumulado no FILE é escrito antes de esperar
+			fflush(fp);
+			esperarRegisto(false);
+		}
+	}
+	fflush(fp);
+}
+
+#ifdef _WIN32
+static DWORD WINAPI correrThreadRegisto(LPVOID argumento) {
+	(void)argumento;
+	esvaziarRegisto();
+	return 0;
+}
+#else
+static void* correrThreadRegisto(void* argumento) {
+	(void)argumento;
+	esvaziarRegisto();
+	return NULL;
+}
+#endif
+
+#pragma endregion
+
+#pragma region Funções do Registo
+
+/**
+ * @brief Define o nível mínimo das mensagens escritas.
+ *
+ * @param[in] nivel - nível mínimo (REGISTO_NENHUM desliga o registo).
+ */
+void definirNivelRegisto(NIVEL_REGISTO nivel) {
+	guardarAtomico(&nivelMinimo, (long long)nivel);
+}
+
+/**
+ * @brief Define o ficheiro onde o registo é escrito.
+ *
+ * Deve ser chamada com a thread do registo parada (antes de @c iniciarRegisto ou depois de @c terminarRegisto).
+ *
+ * @param[in] fp - ficheiro de destino (NULL volta a usar stdout).
+ */
+void definirDestinoRegisto(FILE* fp) {
+	destino = fp;
+}
+
+/**
+ * @brief Inicia a thread que escreve o registo.
+ *
+ * A partir daqui, quem regista apenas formata e copia o texto para o anel; a escrita no
+ * ficheiro (e a espera pelo stdout) fica na thread do registo. A thread é terminada
+ * automaticamente no fim do programa, caso @c terminarRegisto não seja chamada.
+ * Deve ser chamada enquanto nenhuma outra thread estiver a registar.
+ *
+ * @return @c 0 em caso de sucesso, @c 1 se o registo já estiver iniciado, @c 2 se a thread não puder ser criada.
+ */
+int iniciarRegisto() {
+	if (carregarAtomico(&ativo)) return 1;
+
+	for (long long i = 0; i < TAM_BUFFER_REGISTO; i++) {
+		guardarAtomico(&anel[i].sequencia, i);
+	}
+	guardarAtomico(&cauda, 0);
+	cabeca = 0;
+	guardarAtomico(&parar, 0);
+
+#ifdef _WIN32
+	thread = CreateThread(NULL, 0, correrThreadRegisto, NULL, 0, NULL);
+	if (thread == NULL) return 2;
+#else
+	if (pthread_create(&thread, NULL, correrThreadRegisto, NULL) != 0) return 2;
+#endif
+	guardarAtomico(&ativo, 1);
+
+	if (!terminarNoFim)
+	{
+		atexit(terminarRegisto);
+		terminarNoFim = true;
+	}
+	return 0;
+}
+
+/**
+ * @brief Escreve as mensagens pendentes e termina a thread do registo.
+ *
+ * As mensagens registadas depois voltam a ser escritas diretamente no ficheiro de destino.
+ * Deve ser chamada enquanto nenhuma outra thread estiver a registar.
+ */
+void terminarRegisto() {
+	if (!carregarAtomico(&ativo)) return;
+
+	guardarAtomico(&parar, 1);
+	guardarAtomico(&ativo, 0);
+#ifdef _WIN32
+	WaitForSingleObject(thread, INFINITE);
+	CloseHandle(thread);
+#else
+	pthread_join(thread, NULL);
+#endif
+}
+
+/**
+ * @brief Regista um texto já formatado.
+ *
+ * Sem a thread do registo o texto é escrito logo no ficheiro de destino (mantendo a ordem
+ * em relação ao que o programa escreve no stdout); com ela, é copiado para o anel.
+ *
+ * @param[in] nivel - nível da mensagem.
+ * @param[in] texto - texto a registar.
+ * @param[in] tamanho - número de caracteres do texto.
+ */
+void registarTexto(NIVEL_REGISTO nivel, const char* texto, size_t tamanho) {
+	if ((long long)nivel < carregarAtomico(&nivelMinimo) || texto == NULL || tamanho == 0) return;
+
+	if (carregarAtomico(&ativo))
+	{
+		publicarTexto(texto, tamanho);
+	}
+	else
+	{
+		fwrite(texto, 1, tamanho, ficheiroDestino());
+	}
+}
+
+/**
+ * @brief Regista uma mensagem formatada como no printf.
+ *
+ * O nível é verificado antes de formatar, pelo que as mensagens abaixo do nível mínimo
+ * não custam mais do que uma comparação.
+ *
+ * @param[in] nivel - nível da mensagem.
+ * @param[in] formato - formato da mensagem, seguido dos argumentos.
+ */
+void registarMensagem(NIVEL_REGISTO nivel, const char* formato, ...) {
+	if ((long long)nivel < carregarAtomico(&nivelMinimo) || formato == NULL) return;
+
+	char local[TAM_FORMATACAO_REGISTO];
+	va_list argumentos;
+	va_start(argumentos, formato);
+	int tamanho = vsnprintf(local, sizeof(local), formato, argumentos);
+	va_end(argumentos);
+	if (tamanho <= 0) return;
+
+	if ((size_t)tamanho < sizeof(local))
+	{
+		registarTexto(nivel, local, (size_t)tamanho);
+		return;
+	}
+
+	// Mensagem maior do que o buffer local
+	char* texto = (char*)malloc((size_t)tamanho + 1);
+	if (texto == NULL) return;
+	va_start(argumentos, formato);
+	vsnprintf(texto, (size_t)tamanho + 1, formato, argumentos);
+	va_end(argumentos);
+	registarTexto(nivel, texto, (size_t)tamanho);
+	free(texto);
+}
+
+#pragma endregion
@@ -0,0 +1,120 @@
+#pragma once
+
+/**
+ * @file registo.h
+ * @brief Registo (saída de texto) da biblioteca com níveis de severidade, escrito diretamente ou,
+ *        com iniciarRegisto, através de um buffer circular sem locks esvaziado por uma thread própria
+ *
+ * As mensagens abaixo de PA_REGISTO_NIVEL (definido na compilação, por omissão 0) não geram código:
+ * por exemplo, -DPA_REGISTO_NIVEL=1 retira as mensagens de depuração e -DPA_REGISTO_NIVEL=4 retira todas.
+ *
+ * @author Rogério Picas
+ * @date 18-10-2026
+ * @version 1.0
+ *
+ */
+#include <stdio.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+ /** @def PA_REGISTO_NIVEL
+  *  @brief Nível mínimo das mensagens compiladas (0 = depuração, ..., 3 = erro, 4 = nenhuma).
+  */
+#ifndef PA_REGISTO_NIVEL
+#define PA_REGISTO_NIVEL 0
+#endif
+
+#pragma region Estruturas
+
+/**
+ * @enum NivelRegisto
+ * @brief Severidade de uma mensagem do registo.
+ */
+typedef enum NivelRegisto {
+    REGISTO_DEPURACAO,  /**< Detalhe interno das operações (ex.: cada par comparado pelo efeitoNefasto) */
+    REGISTO_INFO,       /**< Resultados das operações (ex.: antenas alcançadas, mapa da cidade) */
+    REGISTO_AVISO,      /**< Situações anómalas que não impedem a operação */
+    REGISTO_ERRO,       /**< Falhas das operações */
+    REGISTO_NENHUM      /**< Usado apenas como nível mínimo, para desligar o registo */
+} NIVEL_REGISTO;
+
+#pragma endregion
+
+#pragma region Macros do Registo
+
+#if PA_REGISTO_NIVEL <= 0
+#define REGISTAR_DEPURACAO(...)  registarMensagem(REGISTO_DEPURACAO, __VA_ARGS__)
+#else
+#define REGISTAR_DEPURACAO(...)  ((void)0)
+#endif
+
+#if PA_REGISTO_NIVEL <= 1
+#define REGISTAR_INFO(...)       registarMensagem(REGISTO_INFO, __VA_ARGS__)
+#define REGISTAR_TEXTO_INFO(texto, tamanho)  registarTexto(REGISTO_INFO, (texto), (tamanho))
+#else
+#define REGISTAR_INFO(...)       ((void)0)
+#define REGISTAR_TEXTO_INFO(texto, tamanho)  ((void)0)
+#endif
+
+#if PA_REGISTO_NIVEL <= 2
+#define REGISTAR_AVISO(...)      registarMensagem(REGISTO_AVISO, __VA_ARGS__)
+#else
+#define REGISTAR_AVISO(...)      ((void)0)
+#endif
+
+#if PA_REGISTO_NIVEL <= 3
+#define REGISTAR_ERRO(...)       registarMensagem(REGISTO_ERRO, __VA_ARGS__)
+#else
+#define REGISTAR_ERRO(...)       ((void)0)
+#endif
+
+#pragma endregion
+
+#pragma region Funções do Registo
+
+/**
+ * @brief Define o nível mínimo das mensagens escritas (as restantes são descartadas logo na chamada).
+ * @param nivel Nível mínimo (REGISTO_NENHUM desliga o registo).
+ */
+void definirNivelRegisto(NIVEL_REGISTO nivel);
+
+/**
+ * @brief Define o ficheiro onde o registo é escrito (deve ser chamada com o registo parado).
+ * @param fp Ficheiro de destino (NULL volta a usar stdout).
+ */
+void definirDestinoRegisto(FILE* fp);
+
+/**
+ * @brief Inicia a thread que escreve o registo: a partir daqui as mensagens são apenas copiadas para o buffer.
+ * @return 0 se a operação for bem-sucedida, 1 se o registo já estiver iniciado, 2 se a thread não puder ser criada.
+ */
+int iniciarRegisto();
+
+/**
+ * @brief Escreve as mensagens pendentes e termina a thread do registo (as mensagens seguintes são escritas diretamente).
+ */
+void terminarRegisto();
+
+/**
+ * @brief Regista uma mensagem formatada como no printf.
+ * @param nivel Nível da mensagem.
+ * @param formato Formato da mensagem.
+ */
+void registarMensagem(NIVEL_REGISTO nivel, const char* formato, ...);
+
+/**
+ * @brief Regista um texto já formatado (ex.: uma linha do mapa), sem passar pelo vsnprintf.
+ * @param nivel Nível da mensagem.
+ * @param texto Texto a registar (não precisa de terminar em '\0').
+ * @param tamanho Número de caracteres do texto.
+ */
+void registarTexto(NIVEL_REGISTO nivel, const char* texto, size_t tamanho);
+
+#pragma endregion
+
+#ifdef __cplusplus
+}
+#endif
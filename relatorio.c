@@ -0,0 +1,250 @@
+/**
+ * @file relatorio.c
+ * @brief Implementação do relatório de interferência por antena.
+ *
+ * @author Rogério Picas
+ * @date 18-10-2026
+ * @version 1.0
+ */
+#define _CRT_SECURE_NO_WARNINGS
+#include <stdio.h>
+#include <stdlib.h>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+#include "relatorio.h"
+#include "antinodos.h"
+#include "espacial.h"
+#include "grelha.h"
+
+#pragma region Funções Auxiliares
+
+/**
+ * @brief Verifica se a célula (x, y) tem uma antena de frequência diferente da indicada.
+ *
+ * Só lê o balde do índice espacial, pelo que pode ser chamada por várias threads ao mesmo tempo.
+ */
+static bool antenaOutraFrequencia(INDICE_ESPACIAL* indice, int x, int y, char freq) {
+	BALDE* balde = obterBalde(indice, x, y);
+	if (balde == NULL) return false;
+
+	for (int i = 0; i < balde->numEntradas; i++) {
+		const ANTENAS* antena = &balde->entradas[i].vertice->antena;
+		if (antena->x == x && antena->y == y && antena->frequencia != freq) return true;
+	}
+	return false;
+}
+
+/**
+ * @brief Soma às linhas de duas antenas os antinodos do par que formam.
+ *
+ * @param[in] rede - rede a que as antenas pertencem (grelha e índice espacial).
+ * @param[in] a - primeira antena.
+ * @param[in] b - segunda antena.
+ * @param[in,out] linhaA - linha da primeira antena.
+ * @param[in,out] linhaB - linha da segunda antena, ou NULL para somar apenas à primeira.
+ */
+static void contarParRelatorio(REDE* rede, const ANTENAS* a, const ANTENAS* b, LINHA_RELATORIO* linhaA, LINHA_RELATORIO* linhaB) {
+	long long celulas[2];
+	int num = posicoesAntinodos(a, b, celulas);
+	for (int i = 0; i < num; i++) {
+		int x = (int)(celulas[i] / MAX_DIM);
+		int y = (int)(celulas[i] % MAX_DIM);
+		int ocupado = celulaOcupada(rede->grelha, x, y) ? 1 : 0;
+		int outra = ocupado && antenaOutraFrequencia(rede->indice, x, y, a->frequencia) ? 1 : 0;
+
+		linhaA->antinodos++;
+		linhaA->ocupados += ocupado;
+		linhaA->outrasFrequencias += outra;
+		if (linhaB != NULL)
+		{
+			linhaB->antinodos++;
+			linhaB->ocupados += ocupado;
+			linhaB->outrasFrequencias += outra;
+		}
+	}
+}
+
+/**
+ * @brief Antena de uma linha do relatório.
+ */
+static ANTENAS antenaLinha(const LINHA_RELATORIO* linha) {
+	ANTENAS antena = { linha->x, linha->y, linha->frequencia };
+	return antena;
+}
+
+#pragma endregion
+
+#pragma region Funções do Relatório
+
+/**
+ * @brief Calcula as métricas de interferência de todas as antenas da rede.
+ *
+ * As antenas são copiadas para um array (uma linha por antena, agrupadas por grafo). Cada
+ * linha só é escrita pela thread que a tem, pelo que não há contadores por thread nem junção
+ * no fim; a grelha e o índice espacial da rede só são lidos. Há duas formas de repartir:
+ *
+ * - Os grafos pequenos são repartidos inteiros pelas threads: cada par (i < j) é contado uma
+ *   vez e somado às duas linhas, que são do mesmo grafo e portanto da mesma thread.
+ * - Um grafo com mais pares do que a parte de cada thread deixaria uma thread com quase todo o
+ *   trabalho; as suas linhas são repartidas uma a uma, e cada linha soma os pares com todas as
+ *   outras antenas do grafo (cada par é calculado duas vezes, uma por linha).
+ *
+ * Com uma só thread (ou sem OpenMP) todos os grafos são tratados da primeira forma.
+ *
+ * @param[in] rede - apontador para a rede.
+ * @param[in] numThreads - número de threads a usar (<= 0 usa o valor por omissão do OpenMP).
+ *
+ * @return apontador para o relatório criado, ou NULL se a rede for nula ou a alocação falhar.
+ */
+RELATORIO_INTERFERENCIA* gerarRelatorioInterferencia(REDE* rede, int numThreads) {
+	if (rede == NULL) return NULL;
+
+	int total = 0, numGrupos = 0;
+	for (GRAFO* g = rede->listaGrafos; g != NULL; g = g->prox) {
+		for (VERTICE* v = g->vertices; v != NULL; v = v->prox) total++;
+		numGrupos++;
+	}
+
+	RELATORIO_INTERFERENCIA* relatorio = (RELATORIO_INTERFERENCIA*)calloc(1, sizeof(RELATORIO_INTERFERENCIA));
+	if (relatorio == NULL) return NULL;
+	if (total == 0) return relatorio;
+
+	relatorio->linhas = (LINHA_RELATORIO*)calloc((size_t)total, sizeof(LINHA_RELATORIO));
+	int* inicioGrupo = (int*)malloc(((size_t)numGrupos + 1) * sizeof(int));
+	if (relatorio->linhas == NULL || inicioGrupo == NULL)
+	{
+		free(inicioGrupo);
+		return destruirRelatorioInterferencia(relatorio);
+	}
+	relatorio->numLinhas = total;
+
+	// Uma linha por antena; o grupo (grafo) g ocupa as linhas [inicioGrupo[g], inicioGrupo[g + 1])
+	int n = 0, numGrupo = 0;
+	long long totalPares = 0;
+	for (GRAFO* g = rede->listaGrafos; g != NULL; g = g->prox) {
+		inicioGrupo[numGrupo++] = n;
+		for (VERTICE* v = g->vertices; v != NULL; v = v->prox) {
+			relatorio->linhas[n].frequencia = v->antena.frequencia;
+			relatorio->linhas[n].x = v->antena.x;
+			relatorio->linhas[n].y = v->antena.y;
+			relatorio->linhas[n].id = v->id;
+			n++;
+		}
+		long long k = n - inicioGrupo[numGrupo - 1];
+		totalPares += k * (k - 1) / 2;
+	}
+	inicioGrupo[numGrupos] = n;
+
+	LINHA_RELATORIO* linhas = relatorio->linhas;
+
+#ifdef _OPENMP
+	if (numThreads <= 0) numThreads = omp_get_max_threads();
+#else
+	numThreads = 1;
+#endif
+	// Um grafo é grande se tiver mais pares do que a parte de cada thread (nunca com uma só thread)
+	long long limitePares = numThreads > 1 ? totalPares / numThreads : totalPares;
+
+#ifdef _OPENMP
+#pragma omp parallel num_threads(numThreads)
+#endif
+	{
+		// Grafos pequenos: um grafo inteiro por thread, cada par contado uma vez
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 1) nowait
+#endif
+		for (int g = 0; g < numGrupos; g++) {
+			long long k = inicioGrupo[g + 1] - inicioGrupo[g];
+			if (k * (k - 1) / 2 > limitePares) continue;
+			for (int i = inicioGrupo[g]; i < inicioGrupo[g + 1]; i++) {
+				ANTENAS a = antenaLinha(&linhas[i]);
+				for (int j = i + 1; j < inicioGrupo[g + 1]; j++) {
+					ANTENAS b = antenaLinha(&linhas[j]);
+					contarParRelatorio(rede, &a, &b, &linhas[i], &linhas[j]);
+				}
+			}
+		}
+
+		// Grafos grandes: uma linha por thread, com os pares dessa antena com todas as outras
+		for (int g = 0; g < numGrupos; g++) {
+			long long k = inicioGrupo[g + 1] - inicioGrupo[g];
+			if (k * (k - 1) / 2 <= limitePares) continue;
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 16) nowait
+#endif
+			for (int i = inicioGrupo[g]; i < inicioGrupo[g + 1]; i++) {
+				ANTENAS a = antenaLinha(&linhas[i]);
+				for (int j = inicioGrupo[g]; j < inicioGrupo[g + 1]; j++) {
+					if (j == i) continue;
+					ANTENAS b = antenaLinha(&linhas[j]);
+					contarParRelatorio(rede, &a, &b, &linhas[i], NULL);
+				}
+			}
+		}
+	}
+
+	free(inicioGrupo);
+	return relatorio;
+}
+
+/**
+ * @brief Escreve o relatório em formato CSV.
+ *
+ * Colunas: frequencia, x, y, id, antinodos, ocupados, outras_frequencias.
+ *
+ * @param[in] relatorio - apontador para o relatório.
+ * @param[in] fp - ficheiro de destino.
+ *
+ * @return @c 0 em caso de sucesso, @c 1 se os argumentos forem nulos, @c 2 se a escrita falhar.
+ */
+int exportarRelatorioCSV(const RELATORIO_INTERFERENCIA* relatorio, FILE* fp) {
+	if (relatorio == NULL || fp == NULL) return 1;
+
+	if (fprintf(fp, "frequencia,x,y,id,antinodos,ocupados,outras_frequencias\n") < 0) return 2;
+	for (int i = 0; i < relatorio->numLinhas; i++) {
+		const LINHA_RELATORIO* l = &relatorio->linhas[i];
+		if (fprintf(fp, "%c,%d,%d,%d,%d,%d,%d\n", l->frequencia, l->x, l->y, l->id,
+			l->antinodos, l->ocupados, l->outrasFrequencias) < 0) return 2;
+	}
+	return 0;
+}
+
+/**
+ * @brief Guarda o relatório num ficheiro binário.
+ *
+ * Tal como em @c guardarGrafoBin, cada registo é a própria estrutura (LINHA_RELATORIO),
+ * pela ordem das linhas do relatório.
+ *
+ * @param[in] relatorio - apontador para o relatório.
+ * @param[in] filename - nome do ficheiro.
+ *
+ * @return @c true em caso de sucesso, @c false caso contrário.
+ */
+bool guardarRelatorioBin(const RELATORIO_INTERFERENCIA* relatorio, char* filename) {
+	if (relatorio == NULL || filename == NULL) return false;
+
+	FILE* fp = fopen(filename, "wb");
+	if (fp == NULL) return false;
+
+	bool ok = relatorio->numLinhas == 0 ||
+		fwrite(relatorio->linhas, sizeof(LINHA_RELATORIO), (size_t)relatorio->numLinhas, fp) == (size_t)relatorio->numLinhas;
+	if (fclose(fp) != 0) ok = false;
+	return ok;
+}
+
+/**
+ * @brief Liberta a memória de um relatório.
+ *
+ * @param relatorio - apontador para o relatório a destruir.
+ * @return NULL, indicando que o relatório foi destruído.
+ */
+RELATORIO_INTERFERENCIA* destruirRelatorioInterferencia(RELATORIO_INTERFERENCIA* relatorio) {
+	if (relatorio == NULL) return NULL;
+
+	free(relatorio->linhas);
+	free(relatorio);
+	return NULL;
+}
+
+#pragma endregion
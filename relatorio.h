@@ -0,0 +1,84 @@
+#pragma once
+
+/**
+ * @file relatorio.h
+ * @brief Relatório de interferência por antena (antinodos em que participa e quantos caem
+ *        em células ocupadas ou em antenas de outras frequências), calculado em paralelo
+ *
+ * @author Rogério Picas
+ * @date 18-10-2026
+ * @version 1.0
+ *
+ */
+#include <stdio.h>
+#include "funcoes.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#pragma region Estruturas
+
+/**
+ * @struct LinhaRelatorio
+ * @brief Métricas de interferência de uma antena (também é o registo do ficheiro binário).
+ */
+typedef struct LinhaRelatorio {
+    char frequencia;        /**< Frequência da antena */
+    COORDENADA x;           /**< Coordenada X da antena */
+    COORDENADA y;           /**< Coordenada Y da antena */
+    int id;                 /**< Identificador do vértice no seu grafo */
+    int antinodos;          /**< Antinodos (dentro da cidade) criados por pares que incluem a antena */
+    int ocupados;           /**< Desses antinodos, quantos caem numa célula com alguma antena */
+    int outrasFrequencias;  /**< Desses antinodos, quantos caem numa antena de outra frequência */
+} LINHA_RELATORIO;
+
+/**
+ * @struct RelatorioInterferencia
+ * @brief Relatório de interferência de toda a rede, com uma linha por antena.
+ */
+typedef struct RelatorioInterferencia {
+    LINHA_RELATORIO* linhas;  /**< Linhas, agrupadas por grafo, pela ordem das listas de vértices */
+    int numLinhas;            /**< Número de linhas (antenas) */
+} RELATORIO_INTERFERENCIA;
+
+#pragma endregion
+
+#pragma region Funções do Relatório
+
+/**
+ * @brief Calcula as métricas de interferência de todas as antenas da rede.
+ * @param rede Apontador para a rede.
+ * @param numThreads Número de threads a usar (<= 0 usa o valor por omissão do OpenMP; ignorado sem OpenMP).
+ * @return Apontador para o relatório criado ou NULL em caso de erro.
+ */
+RELATORIO_INTERFERENCIA* gerarRelatorioInterferencia(REDE* rede, int numThreads);
+
+/**
+ * @brief Escreve o relatório em formato CSV, com uma linha de cabeçalho.
+ * @param relatorio Apontador para o relatório.
+ * @param fp Ficheiro de destino.
+ * @return 0 se a operação for bem-sucedida, 1 se os argumentos forem nulos, 2 em caso de erro de escrita.
+ */
+int exportarRelatorioCSV(const RELATORIO_INTERFERENCIA* relatorio, FILE* fp);
+
+/**
+ * @brief Guarda o relatório num ficheiro binário, uma estrutura LINHA_RELATORIO por antena.
+ * @param relatorio Apontador para o relatório.
+ * @param filename Nome do ficheiro.
+ * @return true se a operação for bem-sucedida, false caso contrário.
+ */
+bool guardarRelatorioBin(const RELATORIO_INTERFERENCIA* relatorio, char* filename);
+
+/**
+ * @brief Liberta a memória de um relatório.
+ * @param relatorio Apontador para o relatório a destruir.
+ * @return NULL, indicando que o relatório foi destruído.
+ */
+RELATORIO_INTERFERENCIA* destruirRelatorioInterferencia(RELATORIO_INTERFERENCIA* relatorio);
+
+#pragma endregion
+
+#ifdef __cplusplus
+}
+#endif
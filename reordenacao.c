@@ -0,0 +1,448 @@
+/**
+ * @file reordenacao.c
+ * @brief Implementação da reordenação dos vértices de um grafo em blocos contíguos.
+ *
+ * @author Rogério Picas
+ * @date 18-10-2026
+ * @version 1.0
+ */
+#define _CRT_SECURE_NO_WARNINGS
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include "reordenacao.h"
+#include "espacial.h"
+
+#pragma region Funções Auxiliares
+
+/**
+ * @struct ChaveVertice
+ * @brief Par (chave, vértice) usado para ordenar os vértices.
+ */
+typedef struct ChaveVertice {
+    unsigned long long chave; /**< Chave de ordenação */
+    int vertice;              /**< Posição do vértice na lista original */
+} CHAVE_VERTICE;
+
+/**
+ * @brief Função de comparação para ordenar pares (chave, vértice) com qsort (desempate pela posição original).
+ */
+static int compararChaves(const void* a, const void* b) {
+	const CHAVE_VERTICE* ca = (const CHAVE_VERTICE*)a;
+	const CHAVE_VERTICE* cb = (const CHAVE_VERTICE*)b;
+	if (ca->chave != cb->chave) return ca->chave < cb->chave ? -1 : 1;
+	return (ca->vertice > cb->vertice) - (ca->vertice < cb->vertice);
+}
+
+/**
+ * @brief Função de comparação para ordenar arestas pelo índice do vértice destino.
+ */
+static int compararArestas(const void* a, const void* b) {
+	int ia = (*(ARESTA* const*)a)->destino->indice;
+	int ib = (*(ARESTA* const*)b)->destino->indice;
+	return (ia > ib) - (ia < ib);
+}
+
+/**
+ * @brief Espalha os 32 bits de @p v pelas posições pares de uma palavra de 64 bits.
+ */
+static unsigned long long espalharBits(unsigned long long v) {
+	v &= 0xFFFFFFFFULL;
+	v = (v | (v << 16)) & 0x0000FFFF0000FFFFULL;
+	v = (v | (v << 8)) & 0x00FF00FF00FF00FFULL;
+	v = (v | (v << 4)) & 0x0F0F0F0F0F0F0F0FULL;
+	v = (v | (v << 2)) & 0x3333333333333333ULL;
+	v = (v | (v << 1)) & 0x5555555555555555ULL;
+	return v;
+}
+
+/**
+ * @brief Calcula a posição da célula (x, y) na curva Z (Morton).
+ *
+ * @param[in] x - coordenada X (>= 0).
+ * @param[in] y - coordenada Y (>= 0).
+ *
+ * @return posição na curva (bits de x nas posições ímpares e de y nas pares).
+ */
+unsigned long long chaveMorton(int x, int y) {
+	return (espalharBits((unsigned long long)x) << 1) | espalharBits((unsigned long long)y);
+}
+
+/**
+ * @brief Calcula a posição da célula (x, y) na curva de Hilbert que cobre a cidade.
+ *
+ * A curva tem lado igual à menor potência de 2 maior ou igual a MAX_DIM. Em cada nível
+ * o quadrante é escolhido pelos bits de x e y e as coordenadas são rodadas/refletidas
+ * para que a curva seja contínua.
+ *
+ * @param[in] x - coordenada X (0 a MAX_DIM - 1).
+ * @param[in] y - coordenada Y (0 a MAX_DIM - 1).
+ *
+ * @return posição na curva.
+ */
+unsigned long long chaveHilbert(int x, int y) {
+	long long n = 1;
+	while (n < MAX_DIM) n <<= 1;
+
+	unsigned long long d = 0;
+	for (long long s = n / 2; s > 0; s /= 2) {
+		int rx = (x & s) > 0;
+		int ry = (y & s) > 0;
+		d += (unsigned long long)s * (unsigned long long)s * (unsigned long long)((3 * rx) ^ ry);
+		if (ry == 0)
+		{
+			if (rx == 1)
+			{
+				x = (int)(n - 1 - x);
+				y = (int)(n - 1 - y);
+			}
+			int aux = x;
+			x = y;
+			y = aux;
+		}
+	}
+	return d;
+}
+
+/**
+ * @brief Verifica se um endereço pertence a um array contíguo.
+ *
+ * @param[in] p - endereço a verificar.
+ * @param[in] inicio - início do array (pode ser NULL).
+ * @param[in] num - número de elementos do array.
+ * @param[in] tamanho - tamanho de cada elemento.
+ *
+ * @return @c true se @p p estiver dentro do array, @c false caso contrário.
+ */
+bool dentroBloco(const void* p, const void* inicio, int num, size_t tamanho) {
+	if (inicio == NULL || p == NULL) return false;
+	uintptr_t ip = (uintptr_t)p;
+	uintptr_t ii = (uintptr_t)inicio;
+	return ip >= ii && ip < ii + (uintptr_t)num * tamanho;
+}
+
+/**
+ * @brief Ordena os vértices pela chave da curva de preenchimento do espaço.
+ *
+ * @param[in] antigos - vértices pela ordem atual.
+ * @param[in] n - número de vértices.
+ * @param[in] ordem - ORDEM_MORTON ou ORDEM_HILBERT.
+ * @param[out] nova - nova[k] recebe a posição atual do vértice que fica na posição k.
+ *
+ * @return @c 0 em caso de sucesso, @c 2 se a alocação falhar.
+ */
+static int ordemEspacial(VERTICE** antigos, int n, ORDEM_VERTICES ordem, int* nova) {
+	CHAVE_VERTICE* chaves = (CHAVE_VERTICE*)malloc((size_t)n * sizeof(CHAVE_VERTICE));
+	if (chaves == NULL) return 2;
+
+	for (int i = 0; i < n; i++) {
+		ANTENAS* a = &antigos[i]->antena;
+		chaves[i].chave = ordem == ORDEM_HILBERT ? chaveHilbert(a->x, a->y) : chaveMorton(a->x, a->y);
+		chaves[i].vertice = i;
+	}
+	qsort(chaves, (size_t)n, sizeof(CHAVE_VERTICE), compararChaves);
+	for (int k = 0; k < n; k++) {
+		nova[k] = chaves[k].vertice;
+	}
+	free(chaves);
+	return 0;
+}
+
+/**
+ * @brief Ordena os vértices pela ordem de visita de uma procura em largura (BFS ou RCM).
+ *
+ * Cada componente é visitada a partir do primeiro vértice ainda não visitado: pela ordem da
+ * lista (BFS) ou por grau crescente (RCM). No RCM os vizinhos de cada vértice são enfileirados
+ * por grau crescente e a ordem final é invertida. O próprio array @p nova serve de fila.
+ *
+ * @param[in] antigos - vértices pela ordem atual (com o campo indice igual à posição atual).
+ * @param[in] n - número de vértices.
+ * @param[in] rcm - true para Reverse Cuthill-McKee, false para BFS simples.
+ * @param[out] nova - nova[k] recebe a posição atual do vértice que fica na posição k.
+ *
+ * @return @c 0 em caso de sucesso, @c 2 se a alocação falhar.
+ */
+static int ordemLargura(VERTICE** antigos, int n, bool rcm, int* nova) {
+	char* visitado = (char*)calloc((size_t)n, 1);
+	int* inicios = (int*)malloc((size_t)n * sizeof(int));
+	CHAVE_VERTICE* vizinhos = NULL;
+	int capacidadeVizinhos = 0;
+	if (visitado == NULL || inicios == NULL)
+	{
+		free(visitado);
+		free(inicios);
+		return 2;
+	}
+
+	// Candidatos a início de componente: pela ordem da lista ou por grau crescente
+	for (int i = 0; i < n; i++) inicios[i] = i;
+	if (rcm)
+	{
+		CHAVE_VERTICE* graus = (CHAVE_VERTICE*)malloc((size_t)n * sizeof(CHAVE_VERTICE));
+		if (graus == NULL)
+		{
+			free(visitado);
+			free(inicios);
+			return 2;
+		}
+		for (int i = 0; i < n; i++) {
+			graus[i].chave = (unsigned long long)antigos[i]->grau;
+			graus[i].vertice = i;
+		}
+		qsort(graus, (size_t)n, sizeof(CHAVE_VERTICE), compararChaves);
+		for (int i = 0; i < n; i++) inicios[i] = graus[i].vertice;
+		free(graus);
+	}
+
+	int fim = 0;
+	for (int c = 0; c < n; c++) {
+		if (visitado[inicios[c]]) continue;
+
+		int frente = fim;
+		visitado[inicios[c]] = 1;
+		nova[fim++] = inicios[c];
+
+		while (frente < fim) {
+			VERTICE* atual = antigos[nova[frente++]];
+
+			if (!rcm)
+			{
+				for (ARESTA* adj = atual->adjacentes; adj != NULL; adj = adj->prox) {
+					int j = adj->destino->indice;
+					if (!visitado[j])
+					{
+						visitado[j] = 1;
+						nova[fim++] = j;
+					}
+				}
+				continue;
+			}
+
+			// RCM: vizinhos por visitar, enfileirados por grau crescente
+			if (atual->grau > capacidadeVizinhos)
+			{
+				CHAVE_VERTICE* novo = (CHAVE_VERTICE*)realloc(vizinhos, (size_t)atual->grau * sizeof(CHAVE_VERTICE));
+				if (novo == NULL)
+				{
+					free(vizinhos);
+					free(visitado);
+					free(inicios);
+					return 2;
+				}
+				vizinhos = novo;
+				capacidadeVizinhos = atual->grau;
+			}
+			int numVizinhos = 0;
+			for (ARESTA* adj = atual->adjacentes; adj != NULL; adj = adj->prox) {
+				int j = adj->destino->indice;
+				if (!visitado[j])
+				{
+					visitado[j] = 1;
+					vizinhos[numVizinhos].chave = (unsigned long long)adj->destino->grau;
+					vizinhos[numVizinhos].vertice = j;
+					numVizinhos++;
+				}
+			}
+			if (numVizinhos > 1) qsort(vizinhos, (size_t)numVizinhos, sizeof(CHAVE_VERTICE), compararChaves);
+			for (int v = 0; v < numVizinhos; v++) {
+				nova[fim++] = vizinhos[v].vertice;
+			}
+		}
+	}
+
+	if (rcm)
+	{
+		for (int i = 0, j = n - 1; i < j; i++, j--) {
+			int aux = nova[i];
+			nova[i] = nova[j];
+			nova[j] = aux;
+		}
+	}
+
+	free(vizinhos);
+	free(visitado);
+	free(inicios);
+	return 0;
+}
+
+#pragma endregion
+
+#pragma region Funções de Reordenação
+
+/**
+ * @brief Reordena os vértices e as arestas do grafo, copiando-os para um bloco contíguo.
+ *
+ * Calcula a nova ordem dos vértices (curva de Morton/Hilbert pelas coordenadas, ou ordem
+ * BFS/RCM pelas ligações) e copia vértices e arestas para dois arrays: os vértices
+ * ficam seguidos pela nova ordem, e as arestas de cada vértice ficam seguidas e ordenadas pelo
+ * destino, pelo que as travessias e as procuras passam a percorrer a memória sequencialmente.
+ * A lista de vértices, as listas de adjacências, as arestas inversas e o índice espacial da
+ * rede são atualizados, e os nós antigos são libertados.
+ *
+ * O campo @c id de cada vértice não muda e é o mapeamento para a numeração original; o campo
+ * @c indice passa a ser a posição no bloco. Todos os apontadores para vértices e arestas do
+ * grafo obtidos antes da reordenação deixam de ser válidos.
+ *
+ * @param[in,out] grafo - apontador para o grafo a reordenar.
+ * @param[in] ordem - critério de ordenação.
+ * @param[out] ids - array com numVertices posições onde é escrito o id original de cada vértice,
+ *                   pela nova ordem (pode ser NULL).
+ *
+ * @return @c 0 em caso de sucesso, @c 1 se o grafo for nulo,
+ *         @c 2 se a alocação falhar (neste caso o grafo fica inalterado).
+ */
+int reordenarGrafo(GRAFO* grafo, ORDEM_VERTICES ordem, int* ids) {
+	if (grafo == NULL) return 1;
+
+	int n = 0;
+	int m = 0;
+	for (VERTICE* v = grafo->vertices; v != NULL; v = v->prox) {
+		n++;
+		m += v->grau;
+	}
+	if (n == 0) return 0;
+
+	VERTICE** antigos = (VERTICE**)malloc((size_t)n * sizeof(VERTICE*));
+	int* nova = (int*)malloc((size_t)n * sizeof(int));
+	ARESTA** origens = (ARESTA**)malloc((m > 0 ? (size_t)m : 1) * sizeof(ARESTA*));
+	BLOCO_GRAFO* bloco = (BLOCO_GRAFO*)calloc(1, sizeof(BLOCO_GRAFO));
+	if (antigos == NULL || nova == NULL || origens == NULL || bloco == NULL)
+	{
+		free(antigos);
+		free(nova);
+		free(origens);
+		free(bloco);
+		return 2;
+	}
+	bloco->vertices = (VERTICE*)malloc((size_t)n * sizeof(VERTICE));
+	bloco->arestas = (ARESTA*)malloc((m > 0 ? (size_t)m : 1) * sizeof(ARESTA));
+	bloco->numVertices = n;
+	bloco->numArestas = m;
+
+	int i = 0;
+	for (VERTICE* v = grafo->vertices; v != NULL; v = v->prox) {
+		v->indice = i;
+		antigos[i++] = v;
+	}
+
+	int erro = bloco->vertices == NULL || bloco->arestas == NULL ? 2 : 0;
+	if (!erro)
+	{
+		erro = ordem == ORDEM_BFS || ordem == ORDEM_RCM
+			? ordemLargura(antigos, n, ordem == ORDEM_RCM, nova)
+			: ordemEspacial(antigos, n, ordem, nova);
+	}
+	if (erro)
+	{
+		free(antigos);
+		free(nova);
+		free(origens);
+		destruirBlocoGrafo(bloco);
+		return erro;
+	}
+
+	// Posição de cada vértice antigo no bloco
+	for (int k = 0; k < n; k++) {
+		antigos[nova[k]]->indice = k;
+	}
+
+	// Vértices, pela nova ordem
+	for (int k = 0; k < n; k++) {
+		VERTICE* antigo = antigos[nova[k]];
+		VERTICE* novo = &bloco->vertices[k];
+
+		novo->antena = antigo->antena;
+		novo->adjacentes = NULL;
+		novo->visitado = 0;
+		novo->indice = k;
+		novo->id = antigo->id;
+		novo->grau = antigo->grau;
+		novo->posicaoMatriz = antigo->posicaoMatriz;
+		novo->ant = k > 0 ? &bloco->vertices[k - 1] : NULL;
+		novo->prox = k < n - 1 ? &bloco->vertices[k + 1] : NULL;
+	}
+
+	// Arestas agrupadas por origem e ordenadas pelo destino; a aresta antiga guarda
+	// temporariamente no campo "ant" a sua cópia, para resolver as inversas a seguir
+	int pos = 0;
+	for (int k = 0; k < n; k++) {
+		VERTICE* antigo = antigos[nova[k]];
+		int inicio = pos;
+		for (ARESTA* adj = antigo->adjacentes; adj != NULL; adj = adj->prox) {
+			origens[pos++] = adj;
+		}
+		qsort(&origens[inicio], (size_t)(pos - inicio), sizeof(ARESTA*), compararArestas);
+
+		for (int e = inicio; e < pos; e++) {
+			ARESTA* novaAresta = &bloco->arestas[e];
+			novaAresta->destino = &bloco->vertices[origens[e]->destino->indice];
+			novaAresta->ant = e > inicio ? &bloco->arestas[e - 1] : NULL;
+			novaAresta->prox = e < pos - 1 ? &bloco->arestas[e + 1] : NULL;
+		}
+		bloco->vertices[k].adjacentes = pos > inicio ? &bloco->arestas[inicio] : NULL;
+	}
+	for (int e = 0; e < m; e++) {
+		origens[e]->ant = &bloco->arestas[e];
+	}
+	for (int e = 0; e < m; e++) {
+		bloco->arestas[e].inversa = origens[e]->inversa->ant;
+	}
+
+	// Índice espacial: cada entrada passa a apontar para a cópia do vértice
+	if (grafo->rede && grafo->rede->indice)
+	{
+		for (int k = 0; k < n; k++) {
+			VERTICE* antigo = antigos[nova[k]];
+			BALDE* balde = obterBalde(grafo->rede->indice, antigo->antena.x, antigo->antena.y);
+			for (int b = 0; balde != NULL && b < balde->numEntradas; b++) {
+				if (balde->entradas[b].vertice == antigo)
+				{
+					balde->entradas[b].vertice = &bloco->vertices[k];
+					break;
+				}
+			}
+		}
+	}
+
+	// Liberta os nós antigos (os que estavam no bloco anterior saem com ele)
+	for (int e = 0; e < m; e++) {
+		libertarArestaGrafo(grafo, origens[e]);
+	}
+	for (int k = 0; k < n; k++) {
+		libertarVerticeGrafo(grafo, antigos[k]);
+	}
+	destruirBlocoGrafo(grafo->bloco);
+
+	grafo->bloco = bloco;
+	grafo->vertices = &bloco->vertices[0];
+	grafo->numVertices = n;
+
+	if (ids != NULL)
+	{
+		for (int k = 0; k < n; k++) {
+			ids[k] = bloco->vertices[k].id;
+		}
+	}
+
+	free(antigos);
+	free(nova);
+	free(origens);
+	return 0;
+}
+
+/**
+ * @brief Liberta a memória de um bloco.
+ *
+ * @param bloco - apontador para o bloco a destruir.
+ * @return NULL, indicando que o bloco foi destruído.
+ */
+BLOCO_GRAFO* destruirBlocoGrafo(BLOCO_GRAFO* bloco) {
+	if (bloco == NULL) return NULL;
+
+	free(bloco->vertices);
+	free(bloco->arestas);
+	free(bloco);
+	return NULL;
+}
+
+#pragma endregion
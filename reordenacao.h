@@ -0,0 +1,96 @@
+#pragma once
+
+/**
+ * @file reordenacao.h
+ * @brief Reordenação dos vértices e arestas de um grafo em blocos contíguos de memória,
+ *        segundo uma curva de preenchimento do espaço (Morton/Hilbert) ou a ordem BFS/RCM
+ *
+ * @author Rogério Picas
+ * @date 18-10-2026
+ * @version 1.0
+ *
+ */
+#include "funcoes.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#pragma region Estruturas
+
+/**
+ * @enum OrdemVertices
+ * @brief Critério usado para reordenar os vértices de um grafo.
+ */
+typedef enum OrdemVertices {
+    ORDEM_MORTON,   /**< Curva Z: bits de x e y intercalados */
+    ORDEM_HILBERT,  /**< Curva de Hilbert (vizinhos no espaço ficam mais próximos do que na curva Z) */
+    ORDEM_BFS,      /**< Ordem de visita de uma procura em largura, componente a componente */
+    ORDEM_RCM       /**< Reverse Cuthill-McKee (BFS a partir do vértice de menor grau, vizinhos por grau crescente, invertida) */
+} ORDEM_VERTICES;
+
+/**
+ * @struct BlocoGrafo
+ * @brief Memória contígua com os vértices e as arestas de um grafo reordenado.
+ *
+ * Os nós que estão num bloco não são libertados individualmente: ficam reservados até
+ * à próxima reordenação ou à destruição do grafo (ver libertarVerticeGrafo/libertarArestaGrafo).
+ */
+typedef struct BlocoGrafo {
+    VERTICE* vertices;  /**< Vértices, pela nova ordem */
+    int numVertices;    /**< Número de vértices do bloco */
+    ARESTA* arestas;    /**< Arestas, agrupadas por vértice de origem e ordenadas pelo destino */
+    int numArestas;     /**< Número de arestas do bloco */
+} BLOCO_GRAFO;
+
+#pragma endregion
+
+#pragma region Funções de Reordenação
+
+/**
+ * @brief Reordena os vértices e as arestas do grafo, copiando-os para um bloco contíguo.
+ * @param grafo Apontador para o grafo a reordenar.
+ * @param ordem Critério de ordenação.
+ * @param ids Array com numVertices posições onde é escrito o id original de cada vértice, pela nova ordem (pode ser NULL).
+ * @return 0 se a operação for bem-sucedida, 1 se o grafo for nulo e 2 em caso de falha de alocação (o grafo fica inalterado).
+ */
+int reordenarGrafo(GRAFO* grafo, ORDEM_VERTICES ordem, int* ids);
+
+/**
+ * @brief Calcula a posição da célula (x, y) na curva Z (Morton).
+ * @param x Coordenada X.
+ * @param y Coordenada Y.
+ * @return Posição na curva.
+ */
+unsigned long long chaveMorton(int x, int y);
+
+/**
+ * @brief Calcula a posição da célula (x, y) na curva de Hilbert que cobre a cidade.
+ * @param x Coordenada X.
+ * @param y Coordenada Y.
+ * @return Posição na curva.
+ */
+unsigned long long chaveHilbert(int x, int y);
+
+/**
+ * @brief Verifica se um endereço pertence a um array contíguo.
+ * @param p Endereço a verificar.
+ * @param inicio Início do array (pode ser NULL).
+ * @param num Número de elementos do array.
+ * @param tamanho Tamanho de cada elemento.
+ * @return true se @p p estiver dentro do array.
+ */
+bool dentroBloco(const void* p, const void* inicio, int num, size_t tamanho);
+
+/**
+ * @brief Liberta a memória de um bloco (os nós que lá estão deixam de ser válidos).
+ * @param bloco Apontador para o bloco a destruir.
+ * @return NULL, indicando que o bloco foi destruído.
+ */
+BLOCO_GRAFO* destruirBlocoGrafo(BLOCO_GRAFO* bloco);
+
+#pragma endregion
+
+#ifdef __cplusplus
+}
+#endif
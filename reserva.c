@@ -0,0 +1,268 @@
+/**
+ * @file reserva.c
+ * @brief Implementação da reserva de vértices e arestas de um grafo em blocos contíguos.
+ *
+ * Cada reserva acrescenta um bloco com os nós em falta; todos os nós do bloco entram logo nas
+ * listas de livres (pela ordem do bloco, para que inserções seguidas fiquem em posições
+ * seguidas da memória). As inserções retiram nós dessas listas e as remoções devolvem-nos.
+ *
+ * @author Rogério Picas
+ * @date 18-10-2026
+ * @version 1.0
+ */
+#define _CRT_SECURE_NO_WARNINGS
+#include <stdio.h>
+#include <stdlib.h>
+#include <limits.h>
+#include "reserva.h"
+#include "reordenacao.h"
+#include "espacial.h"
+
+#pragma region Funções Auxiliares
+
+/**
+ * @brief Devolve a reserva do grafo, criando-a vazia se ainda não existir.
+ *
+ * @param[in,out] grafo - apontador para o grafo.
+ *
+ * @return apontador para a reserva, ou NULL se a alocação falhar.
+ */
+static RESERVA_GRAFO* obterReserva(GRAFO* grafo) {
+	if (grafo->reserva == NULL)
+	{
+		grafo->reserva = (RESERVA_GRAFO*)calloc(1, sizeof(RESERVA_GRAFO));
+	}
+	return grafo->reserva;
+}
+
+#pragma endregion
+
+#pragma region Funções de Reserva
+
+/**
+ * @brief Reserva os vértices e as arestas que faltam para as próximas inserções no grafo.
+ *
+ * Os nós que já estão livres na reserva contam para o pedido; só é alocado um novo bloco
+ * (com um único malloc para os vértices e outro para as arestas) com a diferença.
+ *
+ * @param[in,out] grafo - apontador para o grafo.
+ * @param[in] numVertices - número de vértices que vão ser inseridos.
+ * @param[in] numLigacoes - número de ligações que vão ser criadas.
+ *
+ * @return @c 0 se a reserva for bem-sucedida,
+ *         @c 1 se o grafo for nulo ou algum dos números for negativo,
+ *         @c 2 se a alocação falhar (a reserva anterior mantém-se).
+ */
+int reservarGrafo(GRAFO* grafo, int numVertices, int numLigacoes) {
+	if (grafo == NULL || numVertices < 0 || numLigacoes < 0) return 1;
+
+	RESERVA_GRAFO* reserva = obterReserva(grafo);
+	if (reserva == NULL) return 2;
+
+	long long faltamVertices = (long long)numVertices - reserva->numVerticesLivres;
+	long long faltamArestas = 2LL * numLigacoes - reserva->numArestasLivres;
+	if (faltamVertices < 0) faltamVertices = 0;
+	if (faltamArestas < 0) faltamArestas = 0;
+	if (faltamVertices == 0 && faltamArestas == 0) return 0;
+	if (faltamArestas > INT_MAX) return 1;
+
+	BLOCO_RESERVA* bloco = (BLOCO_RESERVA*)calloc(1, sizeof(BLOCO_RESERVA));
+	if (bloco == NULL) return 2;
+	if (faltamVertices > 0)
+	{
+		bloco->vertices = (VERTICE*)malloc((size_t)faltamVertices * sizeof(VERTICE));
+	}
+	if (faltamArestas > 0)
+	{
+		bloco->arestas = (ARESTA*)malloc((size_t)faltamArestas * sizeof(ARESTA));
+	}
+	if ((faltamVertices > 0 && bloco->vertices == NULL) || (faltamArestas > 0 && bloco->arestas == NULL))
+	{
+		free(bloco->vertices);
+		free(bloco->arestas);
+		free(bloco);
+		return 2;
+	}
+	bloco->numVertices = (int)faltamVertices;
+	bloco->numArestas = (int)faltamArestas;
+	bloco->prox = reserva->blocos;
+	reserva->blocos = bloco;
+
+	// Do fim para o início, para que os nós saiam das listas pela ordem do bloco
+	for (int i = bloco->numVertices - 1; i >= 0; i--) {
+		bloco->vertices[i].prox = reserva->verticesLivres;
+		reserva->verticesLivres = &bloco->vertices[i];
+	}
+	reserva->numVerticesLivres += bloco->numVertices;
+	for (int i = bloco->numArestas - 1; i >= 0; i--) {
+		bloco->arestas[i].prox = reserva->arestasLivres;
+		reserva->arestasLivres = &bloco->arestas[i];
+	}
+	reserva->numArestasLivres += bloco->numArestas;
+
+	atualizarCapacidadeGrafo(grafo);
+	return 0;
+}
+
+/**
+ * @brief Reserva na rede o espaço para um conjunto de antenas.
+ *
+ * As antenas são contadas por frequência; o grafo de cada frequência é criado (se ainda não
+ * existir) e fica com os vértices reservados. Os baldes do índice espacial são aumentados
+ * de acordo com as posições das antenas.
+ *
+ * @param[in,out] rede - apontador para a rede.
+ * @param[in] antenas - antenas que vão ser inseridas.
+ * @param[in] numAntenas - número de antenas.
+ *
+ * @return @c 0 se a reserva for bem-sucedida,
+ *         @c 1 se a rede for nula ou os argumentos inválidos,
+ *         @c 2 se alguma alocação falhar.
+ */
+int reservarRede(REDE* rede, const ANTENAS* antenas, int numAntenas) {
+	if (rede == NULL || numAntenas < 0 || (antenas == NULL && numAntenas > 0)) return 1;
+
+	int porFrequencia[256] = { 0 };
+	for (int i = 0; i < numAntenas; i++) {
+		porFrequencia[(unsigned char)antenas[i].frequencia]++;
+	}
+
+	// Os grafos em falta são criados pela ordem em que as frequências aparecem
+	for (int i = 0; i < numAntenas; i++) {
+		int f = (unsigned char)antenas[i].frequencia;
+		if (porFrequencia[f] == 0) continue;
+		GRAFO* grafo = criarGrafo(rede, antenas[i].frequencia);
+		if (grafo == NULL) return 2;
+		int erro = reservarGrafo(grafo, porFrequencia[f], 0);
+		if (erro != 0) return erro;
+		porFrequencia[f] = 0;
+	}
+	return reservarIndiceEspacial(rede->indice, antenas, numAntenas);
+}
+
+/**
+ * @brief Número de ligações que ainda podem ser criadas no grafo sem alocar memória.
+ *
+ * @param[in] grafo - apontador para o grafo.
+ *
+ * @return número de pares de arestas livres na reserva (0 se o grafo for nulo ou não tiver reserva).
+ */
+int ligacoesReservadas(GRAFO* grafo) {
+	if (grafo == NULL || grafo->reserva == NULL) return 0;
+	return grafo->reserva->numArestasLivres / 2;
+}
+
+/**
+ * @brief Atualiza a capacidade do grafo: os vértices atuais mais os vértices reservados livres.
+ *
+ * @param[in,out] grafo - apontador para o grafo.
+ */
+void atualizarCapacidadeGrafo(GRAFO* grafo) {
+	if (grafo == NULL) return;
+	grafo->maxVertices = grafo->numVertices + (grafo->reserva ? grafo->reserva->numVerticesLivres : 0);
+}
+
+/**
+ * @brief Retira o primeiro vértice da lista de livres da reserva.
+ *
+ * @param[in,out] grafo - apontador para o grafo.
+ *
+ * @return apontador para o vértice, ou NULL se o grafo não tiver vértices reservados livres.
+ */
+VERTICE* retirarVerticeReserva(GRAFO* grafo) {
+	if (grafo == NULL || grafo->reserva == NULL || grafo->reserva->verticesLivres == NULL) return NULL;
+
+	RESERVA_GRAFO* reserva = grafo->reserva;
+	VERTICE* vertice = reserva->verticesLivres;
+	reserva->verticesLivres = vertice->prox;
+	reserva->numVerticesLivres--;
+	return vertice;
+}
+
+/**
+ * @brief Retira a primeira aresta da lista de livres da reserva.
+ *
+ * @param[in,out] grafo - apontador para o grafo.
+ *
+ * @return apontador para a aresta, ou NULL se o grafo não tiver arestas reservadas livres.
+ */
+ARESTA* retirarArestaReserva(GRAFO* grafo) {
+	if (grafo == NULL || grafo->reserva == NULL || grafo->reserva->arestasLivres == NULL) return NULL;
+
+	RESERVA_GRAFO* reserva = grafo->reserva;
+	ARESTA* aresta = reserva->arestasLivres;
+	reserva->arestasLivres = aresta->prox;
+	reserva->numArestasLivres--;
+	return aresta;
+}
+
+/**
+ * @brief Devolve um vértice à lista de livres, se estiver num dos blocos da reserva.
+ *
+ * @param[in,out] grafo - apontador para o grafo.
+ * @param[in] vertice - apontador para o vértice (já retirado da lista do grafo).
+ *
+ * @return @c true se o vértice pertence à reserva, @c false caso contrário (deve então ser libertado com free).
+ */
+bool devolverVerticeReserva(GRAFO* grafo, VERTICE* vertice) {
+	if (grafo == NULL || grafo->reserva == NULL || vertice == NULL) return false;
+
+	RESERVA_GRAFO* reserva = grafo->reserva;
+	for (BLOCO_RESERVA* bloco = reserva->blocos; bloco != NULL; bloco = bloco->prox) {
+		if (dentroBloco(vertice, bloco->vertices, bloco->numVertices, sizeof(VERTICE)))
+		{
+			vertice->prox = reserva->verticesLivres;
+			reserva->verticesLivres = vertice;
+			reserva->numVerticesLivres++;
+			return true;
+		}
+	}
+	return false;
+}
+
+/**
+ * @brief Devolve uma aresta à lista de livres, se estiver num dos blocos da reserva.
+ *
+ * @param[in,out] grafo - apontador para o grafo.
+ * @param[in] aresta - apontador para a aresta (já retirada da lista de adjacências).
+ *
+ * @return @c true se a aresta pertence à reserva, @c false caso contrário (deve então ser libertada com free).
+ */
+bool devolverArestaReserva(GRAFO* grafo, ARESTA* aresta) {
+	if (grafo == NULL || grafo->reserva == NULL || aresta == NULL) return false;
+
+	RESERVA_GRAFO* reserva = grafo->reserva;
+	for (BLOCO_RESERVA* bloco = reserva->blocos; bloco != NULL; bloco = bloco->prox) {
+		if (dentroBloco(aresta, bloco->arestas, bloco->numArestas, sizeof(ARESTA)))
+		{
+			aresta->prox = reserva->arestasLivres;
+			reserva->arestasLivres = aresta;
+			reserva->numArestasLivres++;
+			return true;
+		}
+	}
+	return false;
+}
+
+/**
+ * @brief Liberta todos os blocos da reserva e a própria reserva.
+ *
+ * @param reserva - apontador para a reserva a destruir.
+ * @return NULL, indicando que a reserva foi destruída.
+ */
+RESERVA_GRAFO* destruirReservaGrafo(RESERVA_GRAFO* reserva) {
+	if (reserva == NULL) return NULL;
+
+	BLOCO_RESERVA* bloco = reserva->blocos;
+	while (bloco) {
+		BLOCO_RESERVA* prox = bloco->prox;
+		free(bloco->vertices);
+		free(bloco->arestas);
+		free(bloco);
+		bloco = prox;
+	}
+	free(reserva);
+	return NULL;
+}
+
+#pragma endregion
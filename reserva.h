@@ -0,0 +1,125 @@
+#pragma once
+
+/**
+ * @file reserva.h
+ * @brief Reserva de memória para os vértices e as arestas de um grafo (e para os baldes do índice
+ *        espacial da rede), para que uma carga de tamanho conhecido não tenha de alocar nó a nó
+ *
+ * @author Rogério Picas
+ * @date 18-10-2026
+ * @version 1.0
+ *
+ */
+#include "funcoes.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#pragma region Estruturas
+
+/**
+ * @struct BlocoReserva
+ * @brief Arrays contíguos de vértices e arestas reservados de uma só vez.
+ */
+typedef struct BlocoReserva {
+    VERTICE* vertices;           /**< Vértices reservados */
+    int numVertices;             /**< Número de vértices do bloco */
+    ARESTA* arestas;             /**< Arestas reservadas */
+    int numArestas;              /**< Número de arestas do bloco */
+    struct BlocoReserva* prox;   /**< Bloco reservado antes deste */
+} BLOCO_RESERVA;
+
+/**
+ * @struct ReservaGrafo
+ * @brief Nós reservados de um grafo: os blocos e as listas dos nós que estão livres.
+ *
+ * Os nós de um bloco só são libertados com a reserva: quando um vértice ou uma aresta do bloco
+ * é removido do grafo, volta à lista de livres e é usado na inserção seguinte.
+ */
+typedef struct ReservaGrafo {
+    BLOCO_RESERVA* blocos;       /**< Lista dos blocos, do mais recente para o mais antigo */
+    VERTICE* verticesLivres;     /**< Vértices livres, ligados pelo campo prox */
+    int numVerticesLivres;       /**< Número de vértices livres */
+    ARESTA* arestasLivres;       /**< Arestas livres, ligadas pelo campo prox */
+    int numArestasLivres;        /**< Número de arestas livres */
+} RESERVA_GRAFO;
+
+#pragma endregion
+
+#pragma region Funções de Reserva
+
+/**
+ * @brief Reserva espaço para mais vértices e ligações no grafo, de uma só vez.
+ * @param grafo Apontador para o grafo.
+ * @param numVertices Número de vértices que vão ser inseridos.
+ * @param numLigacoes Número de ligações que vão ser criadas (cada uma usa duas arestas).
+ * @return 0 se a operação for bem-sucedida, 1 se o grafo for nulo ou os números negativos e 2 em caso de falha de alocação.
+ */
+int reservarGrafo(GRAFO* grafo, int numVertices, int numLigacoes);
+
+/**
+ * @brief Reserva espaço na rede para um conjunto de antenas: cria os grafos das frequências que ainda
+ *        não existem, reserva os vértices de cada grafo e a capacidade dos baldes do índice espacial.
+ * @param rede Apontador para a rede.
+ * @param antenas Antenas que vão ser inseridas.
+ * @param numAntenas Número de antenas.
+ * @return 0 se a operação for bem-sucedida, 1 se algum argumento for inválido e 2 em caso de falha de alocação.
+ */
+int reservarRede(REDE* rede, const ANTENAS* antenas, int numAntenas);
+
+/**
+ * @brief Número de ligações que ainda podem ser criadas no grafo sem alocar memória.
+ * @param grafo Apontador para o grafo.
+ * @return Número de ligações reservadas e livres.
+ */
+int ligacoesReservadas(GRAFO* grafo);
+
+/**
+ * @brief Atualiza o campo maxVertices do grafo (vértices atuais mais vértices reservados livres).
+ * @param grafo Apontador para o grafo.
+ */
+void atualizarCapacidadeGrafo(GRAFO* grafo);
+
+/**
+ * @brief Retira um vértice livre da reserva do grafo.
+ * @param grafo Apontador para o grafo.
+ * @return Apontador para o vértice (por inicializar) ou NULL se não houver nenhum livre.
+ */
+VERTICE* retirarVerticeReserva(GRAFO* grafo);
+
+/**
+ * @brief Retira uma aresta livre da reserva do grafo.
+ * @param grafo Apontador para o grafo.
+ * @return Apontador para a aresta (por inicializar) ou NULL se não houver nenhuma livre.
+ */
+ARESTA* retirarArestaReserva(GRAFO* grafo);
+
+/**
+ * @brief Devolve um vértice à reserva do grafo, se pertencer a um dos seus blocos.
+ * @param grafo Apontador para o grafo.
+ * @param vertice Apontador para o vértice (já retirado da lista do grafo).
+ * @return true se o vértice ficou na reserva, false se não pertence à reserva.
+ */
+bool devolverVerticeReserva(GRAFO* grafo, VERTICE* vertice);
+
+/**
+ * @brief Devolve uma aresta à reserva do grafo, se pertencer a um dos seus blocos.
+ * @param grafo Apontador para o grafo.
+ * @param aresta Apontador para a aresta (já retirada da lista de adjacências).
+ * @return true se a aresta ficou na reserva, false se não pertence à reserva.
+ */
+bool devolverArestaReserva(GRAFO* grafo, ARESTA* aresta);
+
+/**
+ * @brief Liberta a memória da reserva (os nós que lá estão deixam de ser válidos).
+ * @param reserva Apontador para a reserva a destruir.
+ * @return NULL, indicando que a reserva foi destruída.
+ */
+RESERVA_GRAFO* destruirReservaGrafo(RESERVA_GRAFO* reserva);
+
+#pragma endregion
+
+#ifdef __cplusplus
+}
+#endif
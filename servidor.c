@@ -0,0 +1,903 @@
+/**
+ * @file servidor.c
+ * @brief Servidor de consultas à rede (Linux): um socket Unix local, um ciclo de eventos epoll
+ *        e uma pool de threads que responde aos pedidos sobre a versão publicada da rede.
+ *
+ * A rede é carregada no arranque (mapa de antenas, ficheiro de alterações e/ou diário) e fica
+ * congelada: é publicada uma só versão e as threads de trabalho leem apenas as vistas imutáveis
+ * dessa versão (versoes.h), sem locks, incluindo as contagens de interferência. Uma thread que
+ * passasse a alterar a rede só teria de chamar publicarVersao depois de cada alteração.
+ *
+ * A thread principal faz todo o I/O: aceita ligações, lê os pedidos (protocolo.h) de todas as
+ * ligações prontas e junta cada leitura num lote, que entra na fila das threads de trabalho. Cada
+ * thread ordena o lote por tipo, frequência e origem e responde a pedidos seguidos do mesmo tipo
+ * com o mesmo trabalho: os pedidos de alcance partilham as componentes já calculadas no lote e os
+ * pedidos de distância com a mesma origem partilham uma única procura em largura. Os lotes
+ * respondidos voltam à thread principal por um eventfd e as respostas são escritas sem bloquear;
+ * uma ligação com demasiadas respostas por enviar deixa de ser lida até o cliente as consumir.
+ *
+ *   servidor [--socket caminho] [--mapa antenas.txt] [--alteracoes ficheiro] [--diario base]
+ *            [--threads N] [--lote N]
+ *
+ * @author Rogério Picas
+ * @date 18-10-2026
+ * @version 1.0
+ */
+#define _CRT_SECURE_NO_WARNINGS
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <signal.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/signalfd.h>
+#include "funcoes.h"
+#include "antinodos.h"
+#include "delta.h"
+#include "diario.h"
+#include "versoes.h"
+#include "protocolo.h"
+
+ /** @def MAX_EVENTOS
+  *  @brief Número máximo de eventos tratados em cada chamada a epoll_wait.
+  */
+#define MAX_EVENTOS 64
+
+ /** @def TAM_ENTRADA
+  *  @brief Tamanho do buffer de leitura de cada ligação (bytes).
+  */
+#define TAM_ENTRADA 65536
+
+ /** @def MAX_LOTES_LIGACAO
+  *  @brief Lotes de uma ligação em processamento a partir dos quais a ligação deixa de ser lida.
+  */
+#define MAX_LOTES_LIGACAO 64
+
+ /** @def LIMITE_SAIDA
+  *  @brief Bytes por enviar a partir dos quais a ligação deixa de ser lida.
+  */
+#define LIMITE_SAIDA (4 << 20)
+
+#pragma region Estruturas
+
+/**
+ * @struct Ligacao
+ * @brief Ligação de um cliente (só usada pela thread principal, exceto o apontador guardado nos lotes).
+ */
+typedef struct Ligacao {
+    int fd;                      /**< Socket da ligação (-1 depois de fechado) */
+    unsigned char* entrada;      /**< Bytes lidos ainda sem formar um pedido completo */
+    size_t numEntrada;           /**< Bytes no buffer de entrada */
+    unsigned char* saida;        /**< Respostas por enviar */
+    size_t inicioSaida;          /**< Primeiro byte por enviar */
+    size_t numSaida;             /**< Fim dos bytes por enviar */
+    size_t capSaida;             /**< Capacidade do buffer de saída */
+    int lotesPendentes;          /**< Lotes da ligação ainda nas threads de trabalho */
+    bool fimEntrada;             /**< O cliente fechou o sentido de escrita */
+    uint32_t eventos;            /**< Eventos registados no epoll */
+    struct Ligacao* ant;         /**< Ligação anterior na lista de ligações */
+    struct Ligacao* prox;        /**< Próxima ligação na lista de ligações */
+} LIGACAO;
+
+/**
+ * @struct Lote
+ * @brief Pedidos lidos de uma ligação numa só leitura e as respetivas respostas.
+ */
+typedef struct Lote {
+    LIGACAO* ligacao;            /**< Ligação de onde vieram os pedidos */
+    int num;                     /**< Número de pedidos */
+    PEDIDO_SERVIDOR* pedidos;    /**< Pedidos, pela ordem de chegada */
+    RESPOSTA_SERVIDOR* respostas; /**< Respostas, pela mesma ordem */
+    struct Lote* prox;           /**< Próximo lote na fila */
+} LOTE;
+
+/**
+ * @struct FilaLotes
+ * @brief Fila FIFO de lotes.
+ */
+typedef struct FilaLotes {
+    LOTE* inicio;                /**< Primeiro lote */
+    LOTE* fim;                   /**< Último lote */
+} FILA_LOTES;
+
+/**
+ * @struct ChaveLote
+ * @brief Chave de ordenação de um pedido dentro do lote.
+ */
+typedef struct ChaveLote {
+    uint8_t tipo;                /**< Tipo do pedido */
+    char frequencia;             /**< Frequência do pedido */
+    int x;                       /**< Coordenada X da origem */
+    int y;                       /**< Coordenada Y da origem */
+    int indice;                  /**< Posição do pedido no lote */
+} CHAVE_LOTE;
+
+/**
+ * @struct Servidor
+ * @brief Estado partilhado entre a thread principal e as threads de trabalho.
+ */
+typedef struct Servidor {
+    GESTOR_VERSOES* versoes;     /**< Versões publicadas da rede */
+    pthread_mutex_t trinco;      /**< Protege as duas filas e o pedido de terminar */
+    pthread_cond_t haTrabalho;   /**< Sinalizada quando entra um lote na fila de trabalho */
+    FILA_LOTES trabalho;         /**< Lotes à espera de uma thread de trabalho */
+    FILA_LOTES respondidos;      /**< Lotes respondidos, à espera da thread principal */
+    bool terminar;               /**< As threads de trabalho devem terminar */
+    int avisos;                  /**< eventfd que acorda a thread principal quando há lotes respondidos */
+    int epoll;                   /**< Descritor do epoll */
+    LIGACAO* ligacoes;           /**< Lista das ligações (abertas e fechadas por libertar) */
+    int numFechadas;             /**< Ligações fechadas ainda na lista */
+    int tamanhoLote;             /**< Número máximo de pedidos por lote */
+} SERVIDOR;
+
+/**
+ * @struct ConfiguracaoServidor
+ * @brief Parâmetros do servidor lidos da linha de comandos.
+ */
+typedef struct ConfiguracaoServidor {
+    const char* socket;          /**< Caminho do socket Unix */
+    char* mapa;                  /**< Mapa de antenas (formato de carregaGrafo) */
+    char* alteracoes;            /**< Ficheiro de alterações aplicado depois do mapa */
+    const char* diario;          /**< Nome base do diário a reproduzir */
+    int threads;                 /**< Número de threads de trabalho (0 = uma por processador) */
+    int tamanhoLote;             /**< Número máximo de pedidos por lote */
+} CONFIGURACAO_SERVIDOR;
+
+#pragma endregion
+
+/** Marcas dos descritores que não são ligações, guardadas em epoll_event.data.ptr. */
+static char marcaEscuta, marcaAvisos, marcaSinais;
+
+#pragma region Fila de Lotes
+
+/**
+ * @brief Junta um lote ao fim de uma fila.
+ */
+static void juntarFila(FILA_LOTES* fila, LOTE* lote) {
+	lote->prox = NULL;
+	if (fila->fim) fila->fim->prox = lote;
+	else fila->inicio = lote;
+	fila->fim = lote;
+}
+
+/**
+ * @brief Retira o primeiro lote de uma fila.
+ * @return Apontador para o lote, ou NULL se a fila estiver vazia.
+ */
+static LOTE* retirarFila(FILA_LOTES* fila) {
+	LOTE* lote = fila->inicio;
+	if (lote)
+	{
+		fila->inicio = lote->prox;
+		if (fila->inicio == NULL) fila->fim = NULL;
+	}
+	return lote;
+}
+
+/**
+ * @brief Liberta um lote, os seus pedidos e as suas respostas.
+ * @return NULL, indicando que o lote foi destruído.
+ */
+static LOTE* destruirLote(LOTE* lote) {
+	if (lote)
+	{
+		free(lote->pedidos);
+		free(lote->respostas);
+		free(lote);
+	}
+	return NULL;
+}
+
+#pragma endregion
+
+#pragma region Respostas
+
+/**
+ * @brief Compara duas chaves por tipo, frequência, origem e posição no lote (para qsort).
+ */
+static int compararChaves(const void* a, const void* b) {
+	const CHAVE_LOTE* p = (const CHAVE_LOTE*)a;
+	const CHAVE_LOTE* q = (const CHAVE_LOTE*)b;
+	if (p->tipo != q->tipo) return p->tipo < q->tipo ? -1 : 1;
+	if (p->frequencia != q->frequencia) return p->frequencia < q->frequencia ? -1 : 1;
+	if (p->x != q->x) return p->x < q->x ? -1 : 1;
+	if (p->y != q->y) return p->y < q->y ? -1 : 1;
+	return p->indice - q->indice;
+}
+
+/**
+ * @brief Guarda o estado e o valor da resposta a um pedido do lote.
+ */
+static void responder(LOTE* lote, int indice, uint8_t estado, int64_t valor) {
+	lote->respostas[indice].estado = estado;
+	lote->respostas[indice].valor = valor;
+}
+
+/**
+ * @brief Procura em largura numa vista a partir de uma antena.
+ *
+ * Marca em @p marca (com @p rotulo) ou em @p distancias as antenas alcançadas e deixa-as em
+ * @p fila, pela ordem de visita.
+ *
+ * @return Número de antenas alcançadas, incluindo a origem.
+ */
+static int procurarEmLargura(const VISTA_GRAFO* vista, int origem, int* marca, int rotulo, int* distancias, int* fila) {
+	int inicio = 0, fim = 0;
+	fila[fim++] = origem;
+	if (marca) marca[origem] = rotulo;
+	if (distancias) distancias[origem] = 0;
+	while (inicio < fim) {
+		int v = fila[inicio++];
+		for (int a = vista->inicio[v]; a < vista->inicio[v + 1]; a++) {
+			int w = vista->destinos[a];
+			if (marca ? marca[w] != 0 : distancias[w] >= 0) continue;
+			if (marca) marca[w] = rotulo;
+			if (distancias) distancias[w] = distancias[v] + 1;
+			fila[fim++] = w;
+		}
+	}
+	return fim;
+}
+
+/**
+ * @brief Responde a pedidos de alcance seguidos sobre a mesma vista, calculando cada componente uma só vez.
+ */
+static void responderAlcance(const VISTA_GRAFO* vista, LOTE* lote, const CHAVE_LOTE* chaves, int num) {
+	int n = vista->numVertices;
+	int* componente = (int*)calloc(n > 0 ? (size_t)n : 1, sizeof(int));
+	int* fila = (int*)malloc((n > 0 ? (size_t)n : 1) * sizeof(int));
+	int* tamanhos = (int*)malloc(((size_t)num + 1) * sizeof(int));
+	int numComponentes = 0;
+
+	for (int i = 0; i < num; i++) {
+		int indice = chaves[i].indice;
+		int origem = procurarAntenaVista(vista, chaves[i].x, chaves[i].y);
+		if (origem < 0) responder(lote, indice, RESPOSTA_NAO_ENCONTRADO, 0);
+		else if (!componente || !fila || !tamanhos) responder(lote, indice, RESPOSTA_ERRO, 0);
+		else
+		{
+			if (componente[origem] == 0)
+			{
+				numComponentes++;
+				tamanhos[numComponentes] = procurarEmLargura(vista, origem, componente, numComponentes, NULL, fila);
+			}
+			responder(lote, indice, RESPOSTA_OK, tamanhos[componente[origem]]);
+		}
+	}
+	free(componente);
+	free(fila);
+	free(tamanhos);
+}
+
+/**
+ * @brief Responde a pedidos de distância seguidos sobre a mesma vista, com uma procura por origem distinta.
+ */
+static void responderDistancia(const VISTA_GRAFO* vista, LOTE* lote, const CHAVE_LOTE* chaves, int num) {
+	int n = vista->numVertices;
+	int* distancias = (int*)malloc((n > 0 ? (size_t)n : 1) * sizeof(int));
+	int* fila = (int*)malloc((n > 0 ? (size_t)n : 1) * sizeof(int));
+	if (distancias)
+	{
+		for (int v = 0; v < n; v++) distancias[v] = -1;
+	}
+
+	int i = 0;
+	while (i < num) {
+		// Pedidos com a mesma origem estão seguidos (o lote está ordenado pela origem)
+		int j = i + 1;
+		while (j < num && chaves[j].x == chaves[i].x && chaves[j].y == chaves[i].y) j++;
+
+		int origem = procurarAntenaVista(vista, chaves[i].x, chaves[i].y);
+		int alcancadas = 0;
+		if (origem >= 0 && distancias && fila)
+		{
+			alcancadas = procurarEmLargura(vista, origem, NULL, 0, distancias, fila);
+		}
+
+		for (int k = i; k < j; k++) {
+			const PEDIDO_SERVIDOR* p = &lote->pedidos[chaves[k].indice];
+			int destino = procurarAntenaVista(vista, p->x2, p->y2);
+			if (origem < 0 || destino < 0) responder(lote, chaves[k].indice, RESPOSTA_NAO_ENCONTRADO, 0);
+			else if (!distancias || !fila) responder(lote, chaves[k].indice, RESPOSTA_ERRO, 0);
+			else responder(lote, chaves[k].indice, RESPOSTA_OK, distancias[destino]);
+		}
+
+		// Só as antenas alcançadas foram marcadas: repor apenas essas
+		for (int k = 0; k < alcancadas; k++) distancias[fila[k]] = -1;
+		i = j;
+	}
+	free(distancias);
+	free(fila);
+}
+
+/**
+ * @brief Responde a todos os pedidos de um lote sobre uma versão da rede.
+ *
+ * Os pedidos são ordenados por (tipo, frequência, origem) e cada sequência com o mesmo tipo e a
+ * mesma frequência é respondida de uma vez; as respostas ficam pela ordem dos pedidos.
+ */
+static void responderLote(const VERSAO_REDE* versao, LOTE* lote) {
+	for (int i = 0; i < lote->num; i++) {
+		lote->respostas[i].id = lote->pedidos[i].id;
+		lote->respostas[i].tipo = lote->pedidos[i].tipo;
+		lote->respostas[i].reservado = 0;
+		responder(lote, i, RESPOSTA_ERRO, 0);
+	}
+
+	CHAVE_LOTE* chaves = (CHAVE_LOTE*)malloc((size_t)lote->num * sizeof(CHAVE_LOTE));
+	if (chaves == NULL || versao == NULL)
+	{
+		free(chaves);
+		return;
+	}
+	for (int i = 0; i < lote->num; i++) {
+		chaves[i].tipo = lote->pedidos[i].tipo;
+		chaves[i].frequencia = lote->pedidos[i].frequencia;
+		chaves[i].x = lote->pedidos[i].x1;
+		chaves[i].y = lote->pedidos[i].y1;
+		chaves[i].indice = i;
+	}
+	qsort(chaves, (size_t)lote->num, sizeof(CHAVE_LOTE), compararChaves);
+
+	int i = 0;
+	while (i < lote->num) {
+		int j = i + 1;
+		while (j < lote->num && chaves[j].tipo == chaves[i].tipo && chaves[j].frequencia == chaves[i].frequencia) j++;
+
+		uint8_t tipo = chaves[i].tipo;
+		const VISTA_GRAFO* vista = procurarVistaGrafo(versao, chaves[i].frequencia);
+
+		if (tipo == PEDIDO_INTERFERENCIA)
+		{
+			// As vistas copiaram os antinodos ativados no arranque: a contagem só lê a versão
+			for (int k = i; k < j; k++) {
+				int64_t total = 0;
+				uint8_t estado = RESPOSTA_NAO_ENCONTRADO;
+				for (int g = 0; g < versao->numGrafos && estado != RESPOSTA_ERRO; g++) {
+					const VISTA_GRAFO* v = versao->grafos[g];
+					if (chaves[k].frequencia != FREQUENCIA_TODAS && v->frequencia != chaves[k].frequencia) continue;
+					int contagem = contagemAntinodoVista(v, chaves[k].x, chaves[k].y);
+					if (contagem < 0) estado = RESPOSTA_ERRO;
+					else
+					{
+						total += contagem;
+						estado = RESPOSTA_OK;
+					}
+				}
+				responder(lote, chaves[k].indice, estado, total);
+			}
+		}
+		else if (tipo < PEDIDO_PROCURAR || tipo > PEDIDO_DISTANCIA)
+		{
+			for (int k = i; k < j; k++) responder(lote, chaves[k].indice, RESPOSTA_INVALIDO, 0);
+		}
+		else if (vista == NULL)
+		{
+			for (int k = i; k < j; k++) responder(lote, chaves[k].indice, RESPOSTA_NAO_ENCONTRADO, 0);
+		}
+		else if (tipo == PEDIDO_PROCURAR)
+		{
+			for (int k = i; k < j; k++) {
+				responder(lote, chaves[k].indice, RESPOSTA_OK, procurarAntenaVista(vista, chaves[k].x, chaves[k].y) >= 0);
+			}
+		}
+		else if (tipo == PEDIDO_LIGACAO)
+		{
+			for (int k = i; k < j; k++) {
+				const PEDIDO_SERVIDOR* p = &lote->pedidos[chaves[k].indice];
+				if (procurarAntenaVista(vista, p->x1, p->y1) < 0 || procurarAntenaVista(vista, p->x2, p->y2) < 0)
+				{
+					responder(lote, chaves[k].indice, RESPOSTA_NAO_ENCONTRADO, 0);
+				}
+				else
+				{
+					responder(lote, chaves[k].indice, RESPOSTA_OK, ligadasVista(vista, p->x1, p->y1, p->x2, p->y2));
+				}
+			}
+		}
+		else if (tipo == PEDIDO_ALCANCE) responderAlcance(vista, lote, chaves + i, j - i);
+		else responderDistancia(vista, lote, chaves + i, j - i);
+
+		i = j;
+	}
+	free(chaves);
+}
+
+#pragma endregion
+
+#pragma region Threads de Trabalho
+
+/**
+ * @brief Ciclo de uma thread de trabalho: retira lotes da fila, responde-lhes e devolve-os à thread principal.
+ */
+static void* correrTrabalhador(void* argumento) {
+	SERVIDOR* servidor = (SERVIDOR*)argumento;
+	int leitor = registarLeitor(servidor->versoes);
+
+	for (;;) {
+		pthread_mutex_lock(&servidor->trinco);
+		while (!servidor->terminar && servidor->trabalho.inicio == NULL) {
+			pthread_cond_wait(&servidor->haTrabalho, &servidor->trinco);
+		}
+		LOTE* lote = retirarFila(&servidor->trabalho);
+		pthread_mutex_unlock(&servidor->trinco);
+		if (lote == NULL) break;
+
+		const VERSAO_REDE* versao = entrarLeitura(servidor->versoes, leitor);
+		responderLote(versao, lote);
+		sairLeitura(servidor->versoes, leitor);
+
+		pthread_mutex_lock(&servidor->trinco);
+		juntarFila(&servidor->respondidos, lote);
+		pthread_mutex_unlock(&servidor->trinco);
+
+		uint64_t um = 1;
+		ssize_t escrito = write(servidor->avisos, &um, sizeof(um));
+		(void)escrito;
+	}
+	libertarLeitor(servidor->versoes, leitor);
+	return NULL;
+}
+
+#pragma endregion
+
+#pragma region Ligações
+
+/**
+ * @brief Atualiza os eventos pedidos ao epoll: leitura enquanto a ligação não estiver atrasada, escrita enquanto houver respostas por enviar.
+ */
+static void atualizarEventos(SERVIDOR* servidor, LIGACAO* ligacao) {
+	if (ligacao->fd < 0) return;
+	size_t porEnviar = ligacao->numSaida - ligacao->inicioSaida;
+	uint32_t eventos = 0;
+	if (!ligacao->fimEntrada && ligacao->lotesPendentes < MAX_LOTES_LIGACAO && porEnviar < LIMITE_SAIDA) eventos |= EPOLLIN;
+	if (porEnviar > 0) eventos |= EPOLLOUT;
+	if (eventos == ligacao->eventos) return;
+
+	struct epoll_event ev = { 0 };
+	ev.events = eventos;
+	ev.data.ptr = ligacao;
+	epoll_ctl(servidor->epoll, EPOLL_CTL_MOD, ligacao->fd, &ev);
+	ligacao->eventos = eventos;
+}
+
+/**
+ * @brief Fecha o socket de uma ligação; a memória só é libertada por libertarLigacoes.
+ *
+ * A ligação pode ainda ter lotes nas threads de trabalho ou eventos por tratar na lista
+ * devolvida pelo epoll_wait em curso.
+ */
+static void fecharLigacao(SERVIDOR* servidor, LIGACAO* ligacao) {
+	if (ligacao->fd < 0) return;
+	close(ligacao->fd);
+	ligacao->fd = -1;
+	servidor->numFechadas++;
+}
+
+/**
+ * @brief Liberta as ligações fechadas sem lotes nas threads de trabalho (ou todas as fechadas, se @p todas).
+ */
+static void libertarLigacoes(SERVIDOR* servidor, bool todas) {
+	LIGACAO* ligacao = servidor->ligacoes;
+	while (ligacao && servidor->numFechadas > 0) {
+		LIGACAO* prox = ligacao->prox;
+		if (ligacao->fd < 0 && (todas || ligacao->lotesPendentes == 0))
+		{
+			if (ligacao->ant) ligacao->ant->prox = ligacao->prox;
+			else servidor->ligacoes = ligacao->prox;
+			if (ligacao->prox) ligacao->prox->ant = ligacao->ant;
+			free(ligacao->entrada);
+			free(ligacao->saida);
+			free(ligacao);
+			servidor->numFechadas--;
+		}
+		ligacao = prox;
+	}
+}
+
+/**
+ * @brief Fecha a ligação se o cliente já não enviar pedidos e já tiver recebido todas as respostas.
+ * @return true se a ligação foi fechada.
+ */
+static bool verificarFimLigacao(SERVIDOR* servidor, LIGACAO* ligacao) {
+	if (ligacao->fd >= 0 && ligacao->fimEntrada && ligacao->lotesPendentes == 0 && ligacao->inicioSaida == ligacao->numSaida)
+	{
+		fecharLigacao(servidor, ligacao);
+		return true;
+	}
+	return false;
+}
+
+/**
+ * @brief Envia as respostas pendentes de uma ligação até o socket deixar de aceitar dados.
+ * @return 0 se a ligação continuar válida, 1 se a escrita falhar (a ligação é fechada).
+ */
+static int enviarRespostas(SERVIDOR* servidor, LIGACAO* ligacao) {
+	while (ligacao->inicioSaida < ligacao->numSaida) {
+		ssize_t n = send(ligacao->fd, ligacao->saida + ligacao->inicioSaida, ligacao->numSaida - ligacao->inicioSaida, MSG_NOSIGNAL);
+		if (n > 0) ligacao->inicioSaida += (size_t)n;
+		else if (n < 0 && errno == EINTR) continue;
+		else if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) break;
+		else
+		{
+			fecharLigacao(servidor, ligacao);
+			return 1;
+		}
+	}
+	if (ligacao->inicioSaida == ligacao->numSaida) ligacao->inicioSaida = ligacao->numSaida = 0;
+	atualizarEventos(servidor, ligacao);
+	return 0;
+}
+
+/**
+ * @brief Acrescenta as respostas de um lote ao buffer de saída da ligação.
+ * @return 0 se a operação for bem-sucedida, 1 se a alocação falhar.
+ */
+static int guardarRespostas(LIGACAO* ligacao, const LOTE* lote) {
+	size_t bytes = (size_t)lote->num * sizeof(RESPOSTA_SERVIDOR);
+	if (ligacao->inicioSaida > 0)
+	{
+		memmove(ligacao->saida, ligacao->saida + ligacao->inicioSaida, ligacao->numSaida - ligacao->inicioSaida);
+		ligacao->numSaida -= ligacao->inicioSaida;
+		ligacao->inicioSaida = 0;
+	}
+	if (ligacao->numSaida + bytes > ligacao->capSaida)
+	{
+		size_t capacidade = ligacao->capSaida ? ligacao->capSaida : 4096;
+		while (capacidade < ligacao->numSaida + bytes) capacidade *= 2;
+		unsigned char* saida = (unsigned char*)realloc(ligacao->saida, capacidade);
+		if (saida == NULL) return 1;
+		ligacao->saida = saida;
+		ligacao->capSaida = capacidade;
+	}
+	memcpy(ligacao->saida + ligacao->numSaida, lote->respostas, bytes);
+	ligacao->numSaida += bytes;
+	return 0;
+}
+
+/**
+ * @brief Cria um lote com pedidos completos lidos de uma ligação e coloca-o na fila de trabalho.
+ * @return 0 se a operação for bem-sucedida, 1 se a alocação falhar.
+ */
+static int enviarLote(SERVIDOR* servidor, LIGACAO* ligacao, const unsigned char* dados, int num) {
+	LOTE* lote = (LOTE*)malloc(sizeof(LOTE));
+	if (lote == NULL) return 1;
+	lote->ligacao = ligacao;
+	lote->num = num;
+	lote->pedidos = (PEDIDO_SERVIDOR*)malloc((size_t)num * sizeof(PEDIDO_SERVIDOR));
+	lote->respostas = (RESPOSTA_SERVIDOR*)malloc((size_t)num * sizeof(RESPOSTA_SERVIDOR));
+	if (lote->pedidos == NULL || lote->respostas == NULL)
+	{
+		destruirLote(lote);
+		return 1;
+	}
+	memcpy(lote->pedidos, dados, (size_t)num * sizeof(PEDIDO_SERVIDOR));
+	ligacao->lotesPendentes++;
+
+	pthread_mutex_lock(&servidor->trinco);
+	juntarFila(&servidor->trabalho, lote);
+	pthread_cond_signal(&servidor->haTrabalho);
+	pthread_mutex_unlock(&servidor->trinco);
+	return 0;
+}
+
+/**
+ * @brief Lê os pedidos disponíveis numa ligação e envia-os em lotes para as threads de trabalho.
+ */
+static void lerPedidos(SERVIDOR* servidor, LIGACAO* ligacao) {
+	ssize_t n;
+	do {
+		n = recv(ligacao->fd, ligacao->entrada + ligacao->numEntrada, TAM_ENTRADA - ligacao->numEntrada, 0);
+	} while (n < 0 && errno == EINTR);
+
+	if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) return;
+	if (n < 0)
+	{
+		fecharLigacao(servidor, ligacao);
+		return;
+	}
+	if (n == 0) ligacao->fimEntrada = true;
+	ligacao->numEntrada += (size_t)n;
+
+	// Todos os pedidos completos seguem já; um pedido incompleto fica à espera da próxima leitura
+	int completos = (int)(ligacao->numEntrada / sizeof(PEDIDO_SERVIDOR));
+	for (int i = 0; i < completos; i += servidor->tamanhoLote) {
+		int num = completos - i < servidor->tamanhoLote ? completos - i : servidor->tamanhoLote;
+		if (enviarLote(servidor, ligacao, ligacao->entrada + (size_t)i * sizeof(PEDIDO_SERVIDOR), num) != 0)
+		{
+			fecharLigacao(servidor, ligacao);
+			return;
+		}
+	}
+	size_t usados = (size_t)completos * sizeof(PEDIDO_SERVIDOR);
+	memmove(ligacao->entrada, ligacao->entrada + usados, ligacao->numEntrada - usados);
+	ligacao->numEntrada -= usados;
+
+	if (!verificarFimLigacao(servidor, ligacao)) atualizarEventos(servidor, ligacao);
+}
+
+/**
+ * @brief Aceita todas as ligações pendentes no socket de escuta.
+ */
+static void aceitarLigacoes(SERVIDOR* servidor, int escuta) {
+	for (;;) {
+		int fd = accept4(escuta, NULL, NULL, SOCK_NONBLOCK | SOCK_CLOEXEC);
+		if (fd < 0)
+		{
+			if (errno == EINTR) continue;
+			return;
+		}
+		LIGACAO* ligacao = (LIGACAO*)calloc(1, sizeof(LIGACAO));
+		unsigned char* entrada = (unsigned char*)malloc(TAM_ENTRADA);
+		struct epoll_event ev = { 0 };
+		ev.events = EPOLLIN;
+		ev.data.ptr = ligacao;
+		if (ligacao == NULL || entrada == NULL || epoll_ctl(servidor->epoll, EPOLL_CTL_ADD, fd, &ev) != 0)
+		{
+			free(ligacao);
+			free(entrada);
+			close(fd);
+			continue;
+		}
+		ligacao->fd = fd;
+		ligacao->entrada = entrada;
+		ligacao->eventos = EPOLLIN;
+		ligacao->prox = servidor->ligacoes;
+		if (servidor->ligacoes) servidor->ligacoes->ant = ligacao;
+		servidor->ligacoes = ligacao;
+	}
+}
+
+/**
+ * @brief Recolhe os lotes respondidos pelas threads de trabalho e passa as respostas às ligações.
+ */
+static void recolherRespondidos(SERVIDOR* servidor) {
+	uint64_t avisos;
+	ssize_t lido = read(servidor->avisos, &avisos, sizeof(avisos));
+	(void)lido;
+
+	pthread_mutex_lock(&servidor->trinco);
+	LOTE* lote = servidor->respondidos.inicio;
+	servidor->respondidos.inicio = servidor->respondidos.fim = NULL;
+	pthread_mutex_unlock(&servidor->trinco);
+
+	while (lote) {
+		LOTE* prox = lote->prox;
+		LIGACAO* ligacao = lote->ligacao;
+		ligacao->lotesPendentes--;
+		if (ligacao->fd >= 0)
+		{
+			if (guardarRespostas(ligacao, lote) != 0) fecharLigacao(servidor, ligacao);
+			else if (enviarRespostas(servidor, ligacao) == 0) verificarFimLigacao(servidor, ligacao);
+		}
+		destruirLote(lote);
+		lote = prox;
+	}
+}
+
+#pragma endregion
+
+#pragma region Arranque
+
+/**
+ * @brief Lê os parâmetros do servidor da linha de comandos.
+ * @return 0 se os argumentos forem válidos, 1 caso contrário.
+ */
+static int lerArgumentos(int argc, char* argv[], CONFIGURACAO_SERVIDOR* cfg) {
+	for (int i = 1; i < argc; i++) {
+		char* valor = i + 1 < argc ? argv[i + 1] : NULL;
+		if (strcmp(argv[i], "--socket") == 0 && valor) cfg->socket = argv[++i];
+		else if (strcmp(argv[i], "--mapa") == 0 && valor) cfg->mapa = argv[++i];
+		else if (strcmp(argv[i], "--alteracoes") == 0 && valor) cfg->alteracoes = argv[++i];
+		else if (strcmp(argv[i], "--diario") == 0 && valor) cfg->diario = argv[++i];
+		else if (strcmp(argv[i], "--threads") == 0 && valor) cfg->threads = atoi(argv[++i]);
+		else if (strcmp(argv[i], "--lote") == 0 && valor) cfg->tamanhoLote = atoi(argv[++i]);
+		else return 1;
+	}
+	if (cfg->mapa == NULL && cfg->alteracoes == NULL && cfg->diario == NULL) return 1;
+	if (cfg->threads < 0 || cfg->tamanhoLote <= 0) return 1;
+	return 0;
+}
+
+/**
+ * @brief Carrega a rede a partir do diário, do mapa e/ou do ficheiro de alterações, por esta ordem.
+ * @return Apontador para a rede carregada ou NULL em caso de erro.
+ */
+static REDE* carregarRedeServidor(const CONFIGURACAO_SERVIDOR* cfg) {
+	REDE* rede = criarRede();
+	if (rede == NULL) return NULL;
+
+	if (cfg->diario)
+	{
+		DIARIO* diario = abrirDiario(rede, cfg->diario, 0, NULL);
+		if (diario == NULL)
+		{
+			fprintf(stderr, "Erro ao reproduzir o diario %s.\n", cfg->diario);
+			return destruirRede(rede);
+		}
+		fecharDiario(diario);
+	}
+	if (cfg->mapa && carregaGrafo(rede, cfg->mapa) != 0)
+	{
+		fprintf(stderr, "Erro ao carregar o mapa %s.\n", cfg->mapa);
+		return destruirRede(rede);
+	}
+	if (cfg->alteracoes && carregarDeltas(rede, cfg->alteracoes, 0, NULL) != 0)
+	{
+		fprintf(stderr, "Erro ao aplicar as alteracoes de %s.\n", cfg->alteracoes);
+		return destruirRede(rede);
+	}
+
+	// Os antinodos são calculados já, para que as vistas da versão publicada os copiem
+	for (GRAFO* g = rede->listaGrafos; g != NULL; g = g->prox) {
+		if (ativarAntinodos(g) != 0)
+		{
+			fprintf(stderr, "Memoria insuficiente para os antinodos.\n");
+			return destruirRede(rede);
+		}
+	}
+	return rede;
+}
+
+/**
+ * @brief Cria o socket Unix de escuta (não bloqueante), substituindo um socket antigo com o mesmo caminho.
+ * @return Descritor do socket ou -1 em caso de erro.
+ */
+static int criarEscuta(const char* caminho) {
+	struct sockaddr_un endereco = { 0 };
+	if (strlen(caminho) >= sizeof(endereco.sun_path)) return -1;
+	endereco.sun_family = AF_UNIX;
+	strcpy(endereco.sun_path, caminho);
+
+	int fd = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+	if (fd < 0) return -1;
+	unlink(caminho);
+	if (bind(fd, (struct sockaddr*)&endereco, sizeof(endereco)) != 0 || listen(fd, SOMAXCONN) != 0)
+	{
+		close(fd);
+		return -1;
+	}
+	return fd;
+}
+
+/**
+ * @brief Regista um descritor que não é uma ligação no epoll, identificado por @p marca.
+ * @return 0 se a operação for bem-sucedida, -1 em caso de erro.
+ */
+static int registarDescritor(int epoll, int fd, void* marca) {
+	struct epoll_event ev = { 0 };
+	ev.events = EPOLLIN;
+	ev.data.ptr = marca;
+	return epoll_ctl(epoll, EPOLL_CTL_ADD, fd, &ev);
+}
+
+#pragma endregion
+
+int main(int argc, char* argv[]) {
+	CONFIGURACAO_SERVIDOR cfg = { "pa_servidor.sock", NULL, NULL, NULL, 0, 256 };
+
+	if (lerArgumentos(argc, argv, &cfg) != 0)
+	{
+		fprintf(stderr, "Uso: %s [--socket caminho] [--mapa antenas.txt] [--alteracoes ficheiro] [--diario base]\n"
+			"       [--threads N] [--lote N]\n"
+			"(pelo menos um de --mapa, --alteracoes ou --diario)\n", argv[0]);
+		return 1;
+	}
+
+	REDE* rede = carregarRedeServidor(&cfg);
+	if (rede == NULL) return 1;
+
+	SERVIDOR servidor = { 0 };
+	servidor.tamanhoLote = cfg.tamanhoLote;
+	servidor.versoes = criarGestorVersoes(rede);
+	if (servidor.versoes == NULL)
+	{
+		fprintf(stderr, "Erro ao publicar a versao da rede.\n");
+		destruirRede(rede);
+		return 1;
+	}
+
+	// SIGINT e SIGTERM são lidos pelo signalfd; o bloqueio é herdado pelas threads de trabalho
+	sigset_t sinais;
+	sigemptyset(&sinais);
+	sigaddset(&sinais, SIGINT);
+	sigaddset(&sinais, SIGTERM);
+	pthread_sigmask(SIG_BLOCK, &sinais, NULL);
+	signal(SIGPIPE, SIG_IGN);
+
+	int escuta = criarEscuta(cfg.socket);
+	int fdSinais = signalfd(-1, &sinais, SFD_NONBLOCK | SFD_CLOEXEC);
+	servidor.avisos = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+	servidor.epoll = epoll_create1(EPOLL_CLOEXEC);
+	if (escuta < 0 || fdSinais < 0 || servidor.avisos < 0 || servidor.epoll < 0
+		|| registarDescritor(servidor.epoll, escuta, &marcaEscuta) != 0
+		|| registarDescritor(servidor.epoll, fdSinais, &marcaSinais) != 0
+		|| registarDescritor(servidor.epoll, servidor.avisos, &marcaAvisos) != 0)
+	{
+		fprintf(stderr, "Erro ao criar o socket %s: %s\n", cfg.socket, strerror(errno));
+		return 1;
+	}
+
+	int numThreads = cfg.threads > 0 ? cfg.threads : (int)sysconf(_SC_NPROCESSORS_ONLN);
+	if (numThreads < 1) numThreads = 1;
+	if (numThreads > MAX_LEITORES_VERSOES) numThreads = MAX_LEITORES_VERSOES;
+	pthread_t* threads = (pthread_t*)malloc((size_t)numThreads * sizeof(pthread_t));
+	pthread_mutex_init(&servidor.trinco, NULL);
+	pthread_cond_init(&servidor.haTrabalho, NULL);
+	int criadas = 0;
+	while (threads && criadas < numThreads && pthread_create(&threads[criadas], NULL, correrTrabalhador, &servidor) == 0) criadas++;
+	if (criadas == 0)
+	{
+		fprintf(stderr, "Erro ao criar as threads de trabalho.\n");
+		return 1;
+	}
+
+	int numGrafos = 0, numAntenas = 0;
+	for (GRAFO* g = rede->listaGrafos; g != NULL; g = g->prox) {
+		numGrafos++;
+		numAntenas += g->numVertices;
+	}
+	fprintf(stderr, "Servidor em %s: %d grafos, %d antenas, %d threads.\n", cfg.socket, numGrafos, numAntenas, criadas);
+
+	struct epoll_event eventos[MAX_EVENTOS];
+	bool terminar = false;
+	while (!terminar) {
+		int n = epoll_wait(servidor.epoll, eventos, MAX_EVENTOS, -1);
+		if (n < 0 && errno == EINTR) continue;
+		if (n < 0) break;
+
+		for (int i = 0; i < n; i++) {
+			void* marca = eventos[i].data.ptr;
+			if (marca == &marcaEscuta) aceitarLigacoes(&servidor, escuta);
+			else if (marca == &marcaAvisos) recolherRespondidos(&servidor);
+			else if (marca == &marcaSinais) terminar = true;
+			else
+			{
+				// Uma ligação fechada neste ciclo pode ainda ter eventos nesta lista
+				LIGACAO* ligacao = (LIGACAO*)marca;
+				if (ligacao->fd < 0) continue;
+				// HUP depois do fim da entrada: o cliente fechou os dois sentidos e já não recebe respostas
+				if ((eventos[i].events & EPOLLERR) || ((eventos[i].events & EPOLLHUP) && ligacao->fimEntrada))
+				{
+					fecharLigacao(&servidor, ligacao);
+				}
+				else if (eventos[i].events & EPOLLOUT)
+				{
+					if (enviarRespostas(&servidor, ligacao) == 0) verificarFimLigacao(&servidor, ligacao);
+				}
+				else if (eventos[i].events & (EPOLLIN | EPOLLHUP)) lerPedidos(&servidor, ligacao);
+			}
+		}
+		libertarLigacoes(&servidor, false);
+	}
+
+	// Terminar: as threads acabam os lotes em curso e a fila é descartada
+	pthread_mutex_lock(&servidor.trinco);
+	servidor.terminar = true;
+	while (servidor.trabalho.inicio) juntarFila(&servidor.respondidos, retirarFila(&servidor.trabalho));
+	pthread_cond_broadcast(&servidor.haTrabalho);
+	pthread_mutex_unlock(&servidor.trinco);
+	for (int i = 0; i < criadas; i++) pthread_join(threads[i], NULL);
+	free(threads);
+
+	while (servidor.respondidos.inicio) destruirLote(retirarFila(&servidor.respondidos));
+	for (LIGACAO* ligacao = servidor.ligacoes; ligacao != NULL; ligacao = ligacao->prox) fecharLigacao(&servidor, ligacao);
+	libertarLigacoes(&servidor, true);
+	close(escuta);
+	unlink(cfg.socket);
+	close(fdSinais);
+	close(servidor.avisos);
+	close(servidor.epoll);
+	pthread_mutex_destroy(&servidor.trinco);
+	pthread_cond_destroy(&servidor.haTrabalho);
+	destruirGestorVersoes(servidor.versoes);
+	destruirRede(rede);
+	fprintf(stderr, "Servidor terminado.\n");
+	return 0;
+}
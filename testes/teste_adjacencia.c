@@ -0,0 +1,240 @@
+/**
+ * @file teste_adjacencia.c
+ * @brief Testes da matriz de adjacências em bits: bits, posições e contagens (incluindo ligações
+ *        repetidas e de uma antena a si própria) comparados com as listas depois de alterações aleatórias,
+ *        criação e descarte da matriz conforme o tamanho e o grau médio, alcance e contagem de caminhos
+ *        sobre os bits comparados com as listas.
+ *
+ * @author Rogério Picas
+ * @date 18-10-2026
+ * @version 1.0
+ */
+#include "testes.h"
+#include "adjacencia.h"
+#include "gerador.h"
+
+ /** @def MAX_VERTICES_TESTE
+  *  @brief Número máximo de vértices dos grafos de teste (cabem na zona de 9 x 9 células usada).
+  */
+#define MAX_VERTICES_TESTE 81
+
+/**
+ * @brief Número de arestas, nas listas, de @p a para @p b.
+ */
+static int arestasEntre(const VERTICE* a, const VERTICE* b) {
+	int num = 0;
+	for (ARESTA* e = a->adjacentes; e != NULL; e = e->prox) {
+		if (e->destino == b) num++;
+	}
+	return num;
+}
+
+/**
+ * @brief Alcance a partir de um vértice por uma procura em largura sobre as listas, sem a biblioteca.
+ */
+static int alcanceListas(GRAFO* grafo, VERTICE* origem) {
+	VERTICE* fila[MAX_VERTICES_TESTE];
+	int fim = 0;
+	for (VERTICE* v = grafo->vertices; v != NULL; v = v->prox) v->visitado = 0;
+	origem->visitado = 1;
+	fila[fim++] = origem;
+	for (int i = 0; i < fim; i++) {
+		for (ARESTA* e = fila[i]->adjacentes; e != NULL; e = e->prox) {
+			if (!e->destino->visitado)
+			{
+				e->destino->visitado = 1;
+				fila[fim++] = e->destino;
+			}
+		}
+	}
+	resetarVisitados(grafo->vertices);
+	return fim;
+}
+
+/**
+ * @brief Conta as diferenças entre a matriz (se existir) e as listas do grafo.
+ *
+ * Cada vértice tem uma posição própria, o bit de cada par está a 1 se houver pelo menos uma aresta,
+ * e as ligações repetidas são as que excedem uma por par (uma ligação de uma antena a si própria
+ * tem duas arestas na lista do vértice). Também compara as consultas da biblioteca com as listas.
+ */
+static int diferencasMatriz(GRAFO* grafo) {
+	int diferencas = 0;
+	MATRIZ_ADJACENCIA* matriz = grafo->matriz;
+	if (matriz != NULL)
+	{
+		uint64_t posicoes = 0;
+		int ligacoes = 0, pares = 0;
+		for (VERTICE* v = grafo->vertices; v != NULL; v = v->prox) {
+			if (v->posicaoMatriz < 0 || (posicoes >> v->posicaoMatriz) & 1) diferencas++;
+			else posicoes |= (uint64_t)1 << v->posicaoMatriz;
+		}
+		if (diferencas > 0 || posicoes != matriz->ocupadas) return diferencas + 1;
+
+		for (VERTICE* v = grafo->vertices; v != NULL; v = v->prox) {
+			for (VERTICE* w = v; w != NULL; w = w->prox) {
+				int arestas = arestasEntre(v, w);
+				if (v == w) arestas /= 2;
+				if (ligadosMatriz(matriz, v, w) != (arestas > 0) || ligadosMatriz(matriz, w, v) != (arestas > 0)) diferencas++;
+				ligacoes += arestas;
+				pares += arestas > 0;
+			}
+		}
+		if (matriz->numLigacoes != ligacoes || matriz->repetidas != ligacoes - pares) diferencas++;
+	}
+
+	for (VERTICE* v = grafo->vertices; v != NULL; v = v->prox) {
+		if (matriz == NULL && v->posicaoMatriz != -1) diferencas++;
+		if (alcanceTeste(grafo, v->antena.x, v->antena.y) != alcanceListas(grafo, v)) diferencas++;
+		if (matriz != NULL && contarAlcancaveisMatriz(matriz, v) != alcanceListas(grafo, v)) diferencas++;
+		for (VERTICE* w = grafo->vertices; w != NULL; w = w->prox) {
+			bool ligados = existeConexaoEntreVertices(grafo, v->antena.x, v->antena.y, w->antena.x, w->antena.y);
+			if (ligados != (arestasEntre(v, w) > 0)) diferencas++;
+		}
+	}
+	return diferencas;
+}
+
+/**
+ * @brief Conta os pares de vértices em que a contagem de caminhos da biblioteca difere do countPaths sobre as listas.
+ */
+static int caminhosErrados(GRAFO* grafo) {
+	int errados = 0;
+	for (VERTICE* v = grafo->vertices; v != NULL; v = v->prox) {
+		for (VERTICE* w = grafo->vertices; w != NULL; w = w->prox) {
+			int esperado = countPaths(v, w);
+			if (countPathsDFS(grafo, v->antena.x, v->antena.y, w->antena.x, w->antena.y) != esperado) errados++;
+			if (grafo->matriz != NULL && grafo->matriz->repetidas == 0 && contarCaminhosMatriz(grafo->matriz, v, w) != esperado) errados++;
+		}
+	}
+	return errados;
+}
+
+/**
+ * @brief Escolhe um vértice aleatório do grafo (NULL se estiver vazio).
+ */
+static VERTICE* verticeAleatorio(GRAFO* grafo, uint64_t* estado) {
+	if (grafo->numVertices == 0) return NULL;
+	int n = (int)(proximoAleatorio(estado) % (uint64_t)grafo->numVertices);
+	VERTICE* v = grafo->vertices;
+	while (n-- > 0) v = v->prox;
+	return v;
+}
+
+int main() {
+	INICIAR_TESTES();
+	REDE* rede = criarRede();
+
+	// Sem ligações não há matriz; com grau médio 2 é criada
+	GRAFO* grafo = criarGrafo(rede, 'A');
+	for (int i = 0; i < 4; i++) VERIFICAR(inserirAntenaGrafo(grafo, 'A', i, i) == 0);
+	VERIFICAR(grafo->matriz == NULL);
+	VERIFICAR(conectarVertices(grafo, 0, 0, 1, 1) == 0);
+	VERIFICAR(conectarVertices(grafo, 1, 1, 2, 2) == 0);
+	VERIFICAR(conectarVertices(grafo, 2, 2, 3, 3) == 0);
+	VERIFICAR(grafo->matriz == NULL);
+	VERIFICAR(conectarVertices(grafo, 3, 3, 0, 0) == 0);
+	VERIFICAR(grafo->matriz != NULL);
+	VERIFICAR(diferencasMatriz(grafo) == 0);
+
+	// Ligação repetida: o bit só se apaga quando a última das duas é removida
+	VERIFICAR(conectarVertices(grafo, 0, 0, 1, 1) == 0);
+	VERIFICAR(grafo->matriz != NULL && grafo->matriz->repetidas == 1);
+	VERIFICAR(diferencasMatriz(grafo) == 0 && caminhosErrados(grafo) == 0);
+	VERIFICAR(removerLigacao(grafo, 1, 1, 0, 0) == 0);
+	VERIFICAR(existeConexaoEntreVertices(grafo, 0, 0, 1, 1) && grafo->matriz->repetidas == 0);
+	VERIFICAR(removerLigacao(grafo, 0, 0, 1, 1) == 0);
+	VERIFICAR(!existeConexaoEntreVertices(grafo, 0, 0, 1, 1));
+	VERIFICAR(diferencasMatriz(grafo) == 0 && caminhosErrados(grafo) == 0);
+
+	// Ligação de uma antena a si própria: um bit na diagonal, que não cria caminhos
+	VERIFICAR(conectarVertices(grafo, 2, 2, 2, 2) == 0);
+	VERIFICAR(grafo->matriz != NULL && existeConexaoEntreVertices(grafo, 2, 2, 2, 2));
+	VERIFICAR(diferencasMatriz(grafo) == 0 && caminhosErrados(grafo) == 0);
+	VERIFICAR(conectarVertices(grafo, 2, 2, 2, 2) == 0);
+	VERIFICAR(grafo->matriz->repetidas == 1 && diferencasMatriz(grafo) == 0);
+	VERIFICAR(removerLigacao(grafo, 2, 2, 2, 2) == 0);
+	VERIFICAR(existeConexaoEntreVertices(grafo, 2, 2, 2, 2) && diferencasMatriz(grafo) == 0);
+	VERIFICAR(removerLigacao(grafo, 2, 2, 2, 2) == 0);
+	VERIFICAR(!existeConexaoEntreVertices(grafo, 2, 2, 2, 2) && diferencasMatriz(grafo) == 0);
+
+	// Grau médio abaixo de 1: a matriz é descartada; uma reconstrução dá a mesma matriz
+	VERIFICAR(removerLigacao(grafo, 2, 2, 3, 3) == 0);
+	VERIFICAR(grafo->matriz != NULL);
+	VERIFICAR(removerLigacao(grafo, 1, 1, 2, 2) == 0);
+	VERIFICAR(grafo->matriz == NULL && diferencasMatriz(grafo) == 0);
+	VERIFICAR(construirMatrizAdjacencia(grafo) == 0 && diferencasMatriz(grafo) == 0);
+
+	// Mais de MATRIZ_MAX_VERTICES vértices: a matriz é descartada
+	GRAFO* grande = criarGrafo(rede, 'B');
+	for (int i = 0; i < MATRIZ_MAX_VERTICES; i++) {
+		inserirAntenaGrafo(grande, 'B', i / 8, i % 8);
+		if (i > 0) conectarVertices(grande, i / 8, i % 8, 0, 0);
+		if (i > 1) conectarVertices(grande, i / 8, i % 8, (i - 1) / 8, (i - 1) % 8);
+	}
+	VERIFICAR(grande->numVertices == MATRIZ_MAX_VERTICES && grande->matriz != NULL);
+	VERIFICAR(diferencasMatriz(grande) == 0);
+	VERIFICAR(inserirAntenaGrafo(grande, 'B', 8, 0) == 0);
+	VERIFICAR(grande->matriz == NULL && diferencasMatriz(grande) == 0);
+	VERIFICAR(construirMatrizAdjacencia(grande) == 1);
+
+	// Alterações aleatórias numa zona pequena, com ligações repetidas e de uma antena a si própria
+	GRAFO* aleatorio = criarGrafo(rede, 'C');
+	uint64_t estado = 2024;
+	int comMatriz = 0;
+	for (int i = 0; i < 4000; i++) {
+		int x = (int)(proximoAleatorio(&estado) % 9), y = (int)(proximoAleatorio(&estado) % 9);
+		VERTICE* a = verticeAleatorio(aleatorio, &estado);
+		VERTICE* b = proximoAleatorio(&estado) % 8 == 0 ? a : verticeAleatorio(aleatorio, &estado);
+		switch (proximoAleatorio(&estado) % 8) {
+		case 0:
+			if (aleatorio->numVertices < 40) inserirAntenaGrafo(aleatorio, 'C', x, y);
+			break;
+		case 1:
+			if (a != NULL) removerAntenaGrafo(aleatorio, a->antena.x, a->antena.y);
+			break;
+		case 2:
+			if (a != NULL) moverAntenaGrafo(aleatorio, a->antena.x, a->antena.y, x, y);
+			break;
+		case 3:
+		case 4:
+			if (a != NULL && b != NULL) removerLigacao(aleatorio, a->antena.x, a->antena.y, b->antena.x, b->antena.y);
+			break;
+		default:
+			if (a != NULL && b != NULL) conectarVertices(aleatorio, a->antena.x, a->antena.y, b->antena.x, b->antena.y);
+			break;
+		}
+		if (i % 50 == 49)
+		{
+			VERIFICAR(diferencasMatriz(aleatorio) == 0);
+			comMatriz += aleatorio->matriz != NULL;
+		}
+	}
+	// A matriz tem de ter existido durante parte das verificações
+	VERIFICAR(comMatriz > 0);
+
+	// Contagem de caminhos num grafo pequeno e denso, com e sem ligações repetidas
+	GRAFO* denso = criarGrafo(rede, 'D');
+	for (int i = 0; i < 8; i++) inserirAntenaGrafo(denso, 'D', i, 0);
+	for (int i = 0; i < 20; i++) {
+		VERTICE* a = verticeAleatorio(denso, &estado);
+		VERTICE* b = verticeAleatorio(denso, &estado);
+		if (a != b && !existeConexaoEntreVertices(denso, a->antena.x, a->antena.y, b->antena.x, b->antena.y))
+			conectarVertices(denso, a->antena.x, a->antena.y, b->antena.x, b->antena.y);
+	}
+	VERIFICAR(denso->matriz != NULL && denso->matriz->repetidas == 0);
+	VERIFICAR(diferencasMatriz(denso) == 0 && caminhosErrados(denso) == 0);
+	VERIFICAR(conectarVertices(denso, 0, 0, 1, 0) == 0 && conectarVertices(denso, 0, 0, 1, 0) == 0);
+	VERIFICAR(denso->matriz->repetidas > 0);
+	VERIFICAR(diferencasMatriz(denso) == 0 && caminhosErrados(denso) == 0);
+
+	// Argumentos inválidos
+	VERIFICAR(!adaptarMatrizAdjacencia(NULL));
+	VERIFICAR(construirMatrizAdjacencia(NULL) == 1);
+	VERIFICAR(!ligadosMatriz(NULL, grafo->vertices, grafo->vertices));
+	VERIFICAR(alcancaveisMatriz(NULL, grafo->vertices) == 0);
+	VERIFICAR(contarCaminhosMatriz(NULL, grafo->vertices, grafo->vertices) == 0);
+
+	destruirRede(rede);
+	TERMINAR_TESTES();
+}
@@ -0,0 +1,246 @@
+/**
+ * @file teste_algoritmos.cpp
+ * @brief Testes dos templates de algoritmos.hpp, instanciados sobre as listas ligadas (GrafoLigado) e
+ *        sobre a cópia contígua (GrafoContiguo): alcance e distâncias da BFS, vértices descobertos pela
+ *        DFS, componentes e caminhos mais curtos comparados com Floyd-Warshall sobre uma matriz, e
+ *        contagem de caminhos comparada com o countPaths da biblioteca, com ligações repetidas e
+ *        ligações de uma antena a si própria.
+ *
+ * @author Rogério Picas
+ * @date 18-10-2026
+ * @version 1.0
+ */
+#include <cmath>
+#include <limits>
+#include <vector>
+#include "testes.h"
+#include "algoritmos.hpp"
+#include "gerador.h"
+
+namespace {
+
+/**
+ * @brief Distâncias entre todos os pares (Floyd-Warshall) sobre uma matriz construída a partir das listas.
+ *
+ * Com @p euclidiana o custo de cada ligação é a distância entre as antenas; senão é 1.
+ */
+std::vector<std::vector<double>> floydWarshall(const std::vector<VERTICE*>& vertices, bool euclidiana) {
+    const double infinito = std::numeric_limits<double>::infinity();
+    const std::size_t n = vertices.size();
+    std::vector<std::vector<double>> d(n, std::vector<double>(n, infinito));
+    for (std::size_t i = 0; i < n; i++) {
+        d[i][i] = 0.0;
+        for (ARESTA* e = vertices[i]->adjacentes; e != nullptr; e = e->prox) {
+            std::size_t j = 0;
+            while (vertices[j] != e->destino) j++;
+            const double dx = vertices[i]->antena.x - e->destino->antena.x;
+            const double dy = vertices[i]->antena.y - e->destino->antena.y;
+            const double custo = euclidiana ? std::sqrt(dx * dx + dy * dy) : 1.0;
+            if (custo < d[i][j]) d[i][j] = custo;
+        }
+    }
+    for (std::size_t k = 0; k < n; k++) {
+        for (std::size_t i = 0; i < n; i++) {
+            for (std::size_t j = 0; j < n; j++) {
+                if (d[i][k] + d[k][j] < d[i][j]) d[i][j] = d[i][k] + d[k][j];
+            }
+        }
+    }
+    return d;
+}
+
+/**
+ * @brief Compara os resultados dos templates sobre um armazenamento com Floyd-Warshall e com a biblioteca.
+ * @return Número de resultados errados.
+ */
+template <class G>
+int resultadosErrados(const G& g, GRAFO* grafo, const std::vector<VERTICE*>& vertices) {
+    const double infinito = std::numeric_limits<double>::infinity();
+    const std::size_t n = vertices.size();
+    const auto saltos = floydWarshall(vertices, false);
+    const auto custos = floydWarshall(vertices, true);
+    int errados = 0;
+    if (g.numVertices() != n) return 1;
+
+    // Componentes: dois vértices estão na mesma componente se e só se houver caminho entre eles
+    std::vector<int> componente;
+    const int numComponentes = componentes(g, componente);
+    int maior = -1;
+    for (std::size_t i = 0; i < n; i++) {
+        if (componente[i] > maior) maior = componente[i];
+        for (std::size_t j = 0; j < n; j++) {
+            if ((componente[i] == componente[j]) != (saltos[i][j] < infinito)) errados++;
+        }
+    }
+    if (maior + 1 != numComponentes) errados++;
+
+    for (std::size_t i = 0; i < n; i++) {
+        const auto origem = g.procurar(vertices[i]->antena.x, vertices[i]->antena.y);
+        if (origem == G::NENHUM || g.indice(origem) != i) {
+            errados++;
+            continue;
+        }
+        std::size_t alcancaveis = 0;
+        for (std::size_t j = 0; j < n; j++) {
+            if (saltos[i][j] < infinito) alcancaveis++;
+        }
+
+        // BFS: cada vértice alcançável uma vez, por ordem de distância, com a distância mínima
+        std::vector<int> vezes(n, 0);
+        int ultima = 0;
+        const std::size_t visitados = bfs(g, origem, [&](typename G::No v, int d) {
+            vezes[g.indice(v)]++;
+            if (d < ultima || d != saltos[i][g.indice(v)]) errados++;
+            ultima = d;
+        });
+        if (visitados != alcancaveis || visitados != static_cast<std::size_t>(alcanceTeste(grafo, vertices[i]->antena.x, vertices[i]->antena.y))) errados++;
+        for (std::size_t j = 0; j < n; j++) {
+            if (vezes[j] != (saltos[i][j] < infinito ? 1 : 0)) errados++;
+        }
+
+        // DFS: os mesmos vértices, cada um descoberto uma vez, com profundidade 0 só na origem
+        vezes.assign(n, 0);
+        const std::size_t descobertos = dfs(g, origem, [&](typename G::No v, int profundidade) {
+            vezes[g.indice(v)]++;
+            if ((profundidade == 0) != (v == origem)) errados++;
+        });
+        if (descobertos != alcancaveis) errados++;
+        for (std::size_t j = 0; j < n; j++) {
+            if (vezes[j] != (saltos[i][j] < infinito ? 1 : 0)) errados++;
+        }
+
+        std::vector<int> distancia;
+        if (distanciasSaltos(g, origem, distancia) != alcancaveis) errados++;
+        for (std::size_t j = 0; j < n; j++) {
+            if (distancia[j] != (saltos[i][j] < infinito ? static_cast<int>(saltos[i][j]) : -1)) errados++;
+        }
+
+        // Dijkstra: o custo de Floyd-Warshall, e cada anterior dá o último troço de um caminho mínimo
+        std::vector<double> custo;
+        std::vector<int> anterior;
+        auto peso = distanciaEuclidiana(g);
+        caminhosMaisCurtos(g, origem, peso, custo, &anterior);
+        for (std::size_t j = 0; j < n; j++) {
+            if (custos[i][j] == infinito) {
+                if (custo[j] != infinito || anterior[j] != -1) errados++;
+            }
+            else if (std::fabs(custo[j] - custos[i][j]) > 1e-9) {
+                errados++;
+            }
+            else if (j != i) {
+                const int a = anterior[j];
+                if (a < 0) {
+                    errados++;
+                    continue;
+                }
+                const double troco = peso(g.vertice(static_cast<std::size_t>(a)), g.vertice(j));
+                if (std::fabs(custo[static_cast<std::size_t>(a)] + troco - custo[j]) > 1e-9) errados++;
+            }
+        }
+        if (anterior[i] != -1) errados++;
+    }
+    return errados;
+}
+
+/**
+ * @brief Compara a contagem de caminhos dos templates com o countPaths da biblioteca, para todos os pares.
+ * @return Número de pares com contagens diferentes.
+ */
+template <class G>
+int contagensErradas(const G& g, const std::vector<VERTICE*>& vertices) {
+    int erradas = 0;
+    for (std::size_t i = 0; i < vertices.size(); i++) {
+        for (std::size_t j = 0; j < vertices.size(); j++) {
+            const unsigned long long esperado = static_cast<unsigned long long>(countPaths(vertices[i], vertices[j]));
+            if (contarCaminhos(g, g.vertice(i), g.vertice(j)) != esperado) erradas++;
+        }
+    }
+    return erradas;
+}
+
+/**
+ * @brief Vértices do grafo pela ordem da lista (a ordem usada pelos dois armazenamentos).
+ */
+std::vector<VERTICE*> verticesGrafo(GRAFO* grafo) {
+    std::vector<VERTICE*> vertices;
+    for (VERTICE* v = grafo->vertices; v != nullptr; v = v->prox) vertices.push_back(v);
+    return vertices;
+}
+
+/**
+ * @brief Insere antenas em posições aleatórias e liga pares aleatórios, incluindo ligações repetidas
+ *        e de uma antena a si própria.
+ */
+void preencherGrafo(GRAFO* grafo, int numAntenas, int numLigacoes, uint64_t* estado) {
+    while (grafo->numVertices < numAntenas) {
+        const int x = static_cast<int>(proximoAleatorio(estado) % MAX_DIM);
+        const int y = static_cast<int>(proximoAleatorio(estado) % MAX_DIM);
+        inserirAntenaGrafo(grafo, grafo->frequencia, x, y);
+    }
+    const std::vector<VERTICE*> vertices = verticesGrafo(grafo);
+    for (int i = 0; i < numLigacoes; i++) {
+        const VERTICE* a = vertices[proximoAleatorio(estado) % vertices.size()];
+        const VERTICE* b = i % 10 == 0 ? a : vertices[proximoAleatorio(estado) % vertices.size()];
+        conectarVertices(grafo, a->antena.x, a->antena.y, b->antena.x, b->antena.y);
+        if (i % 7 == 0) conectarVertices(grafo, a->antena.x, a->antena.y, b->antena.x, b->antena.y);
+    }
+}
+
+} // namespace
+
+int main() {
+    INICIAR_TESTES();
+
+    // Grafo esparso com várias componentes
+    REDE* rede = criarRede();
+    GRAFO* grafo = criarGrafo(rede, 'A');
+    uint64_t estado = 5;
+    preencherGrafo(grafo, 45, 40, &estado);
+    std::vector<VERTICE*> vertices = verticesGrafo(grafo);
+    {
+        pa::GrafoLigado ligado(grafo);
+        VERIFICAR(resultadosErrados(ligado, grafo, vertices) == 0);
+    }
+    pa::GrafoContiguo contiguo(grafo);
+    VERIFICAR(resultadosErrados(contiguo, grafo, vertices) == 0);
+
+    // A cópia contígua não muda com o grafo; a vista sobre as listas vê as alterações
+    const std::size_t arestas = contiguo.numArestas();
+    conectarVertices(grafo, vertices[0]->antena.x, vertices[0]->antena.y, vertices[1]->antena.x, vertices[1]->antena.y);
+    VERIFICAR(contiguo.numArestas() == arestas && contiguo.numVertices() == vertices.size());
+    {
+        pa::GrafoLigado ligado(grafo);
+        VERIFICAR(resultadosErrados(ligado, grafo, vertices) == 0);
+        VERIFICAR(ligado.procurar(-1, 0) == pa::GrafoLigado::NENHUM);
+    }
+    VERIFICAR(contiguo.procurar(-1, 0) == pa::GrafoContiguo::NENHUM);
+
+    // Grafo pequeno e denso para a contagem de caminhos (exponencial)
+    GRAFO* denso = criarGrafo(rede, 'B');
+    preencherGrafo(denso, 8, 16, &estado);
+    std::vector<VERTICE*> poucos = verticesGrafo(denso);
+    {
+        pa::GrafoLigado ligado(denso);
+        VERIFICAR(resultadosErrados(ligado, denso, poucos) == 0);
+        VERIFICAR(contagensErradas(ligado, poucos) == 0);
+    }
+    pa::GrafoContiguo copia(denso);
+    VERIFICAR(resultadosErrados(copia, denso, poucos) == 0);
+    VERIFICAR(contagensErradas(copia, poucos) == 0);
+
+    // Grafo nulo e vértice inexistente
+    pa::GrafoLigado nulo(nullptr);
+    pa::GrafoContiguo vazio(nullptr);
+    std::vector<int> componente;
+    std::vector<double> custo;
+    VERIFICAR(nulo.numVertices() == 0 && vazio.numVertices() == 0);
+    VERIFICAR(componentes(vazio, componente) == 0);
+    VERIFICAR(bfs(vazio, pa::GrafoContiguo::NENHUM, [](int, int) {}) == 0);
+    VERIFICAR(dfs(nulo, pa::GrafoLigado::NENHUM, [](VERTICE*, int) {}) == 0);
+    VERIFICAR(contarCaminhos(copia, pa::GrafoContiguo::NENHUM, copia.vertice(0)) == 0);
+    caminhosMaisCurtos(copia, pa::GrafoContiguo::NENHUM, distanciaEuclidiana(copia), custo);
+    VERIFICAR(custo.size() == poucos.size() && std::isinf(custo[0]));
+
+    destruirRede(rede);
+    TERMINAR_TESTES();
+}
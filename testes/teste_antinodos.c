@@ -0,0 +1,126 @@
+/**
+ * @file teste_antinodos.c
+ * @brief Testes da contagem de antinodos: posições de um par, contagens acumuladas de vários pares
+ *        na mesma célula e contagem mantida nas inserções, remoções e movimentos comparada com a
+ *        recontagem de todos os pares.
+ *
+ * @author Rogério Picas
+ * @date 18-10-2026
+ * @version 1.0
+ */
+#include <stdlib.h>
+#include <string.h>
+#include "testes.h"
+#include "antinodos.h"
+#include "gerador.h"
+
+/**
+ * @brief Recontagem dos antinodos de todos os pares de antenas do grafo, sem a contagem mantida.
+ */
+static void recontar(GRAFO* grafo, int contagens[MAX_DIM][MAX_DIM]) {
+	memset(contagens, 0, sizeof(int) * MAX_DIM * MAX_DIM);
+	for (VERTICE* a = grafo->vertices; a != NULL; a = a->prox) {
+		for (VERTICE* b = grafo->vertices; b != NULL; b = b->prox) {
+			// Cada par ordenado (a, b) dá a posição simétrica de a em relação a b
+			if (a == b || abs(a->antena.x - b->antena.x) < 2) continue;
+			int x = 2 * a->antena.x - b->antena.x, y = 2 * a->antena.y - b->antena.y;
+			if (x >= 0 && x < MAX_DIM && y >= 0 && y < MAX_DIM) contagens[x][y]++;
+		}
+	}
+}
+
+/**
+ * @brief Conta as diferenças entre a contagem mantida no grafo e a recontagem de todos os pares.
+ */
+static int diferencasContagem(GRAFO* grafo) {
+	static int contagens[MAX_DIM][MAX_DIM];
+	long long celulas[MAX_DIM * MAX_DIM];
+	recontar(grafo, contagens);
+
+	int diferencas = 0, numCelulas = 0;
+	for (int x = 0; x < MAX_DIM; x++) {
+		for (int y = 0; y < MAX_DIM; y++) {
+			if (contagemAntinodo(grafo, x, y) != contagens[x][y]) diferencas++;
+			if (existeAntinodo(grafo, x, y) != (contagens[x][y] > 0)) diferencas++;
+			if (contagens[x][y] > 0) celulas[numCelulas++] = (long long)x * MAX_DIM + y;
+		}
+	}
+	if (numeroAntinodos(grafo) != numCelulas) diferencas++;
+
+	// As células são copiadas por ordem crescente, as menores primeiro quando não cabem todas
+	long long copiadas[MAX_DIM * MAX_DIM];
+	if (obterAntinodos(grafo, copiadas, MAX_DIM * MAX_DIM) != numCelulas) diferencas++;
+	else if (memcmp(copiadas, celulas, (size_t)numCelulas * sizeof(long long)) != 0) diferencas++;
+	int metade = numCelulas / 2;
+	if (obterAntinodos(grafo, copiadas, metade) != numCelulas) diferencas++;
+	else if (memcmp(copiadas, celulas, (size_t)metade * sizeof(long long)) != 0) diferencas++;
+	return diferencas;
+}
+
+int main() {
+	INICIAR_TESTES();
+
+	// Posições de um par: simétricas de cada antena, só com pelo menos 2 linhas de distância
+	ANTENAS a = { 3, 3, 'A' }, b = { 5, 4, 'A' }, c = { 4, 0, 'A' }, d = { 0, 0, 'A' };
+	long long celulas[2];
+	VERIFICAR(posicoesAntinodos(&a, &b, celulas) == 2);
+	VERIFICAR(celulas[0] == 1 * MAX_DIM + 2 && celulas[1] == 7 * MAX_DIM + 5);
+	VERIFICAR(posicoesAntinodos(&a, &c, celulas) == 0);
+	VERIFICAR(posicoesAntinodos(&d, &b, celulas) == 1 && celulas[0] == 10 * MAX_DIM + 8);
+	VERIFICAR(posicoesAntinodos(NULL, &b, celulas) == 0);
+
+	// Dois pares com um antinodo na mesma célula: (3, 3)-(5, 5) e (4, 1)-(7, 1) em (1, 1)
+	REDE* rede = criarRede();
+	GRAFO* grafo = criarGrafo(rede, 'A');
+	VERIFICAR(ativarAntinodos(grafo) == 0 && grafo->antinodos != NULL);
+	VERIFICAR(numeroAntinodos(grafo) == 0);
+	VERIFICAR(inserirAntenaGrafo(grafo, 'A', 3, 3) == 0);
+	VERIFICAR(inserirAntenaGrafo(grafo, 'A', 5, 5) == 0);
+	VERIFICAR(contagemAntinodo(grafo, 1, 1) == 1 && contagemAntinodo(grafo, 7, 7) == 1);
+	VERIFICAR(inserirAntenaGrafo(grafo, 'A', 4, 1) == 0);
+	VERIFICAR(inserirAntenaGrafo(grafo, 'A', 7, 1) == 0);
+	VERIFICAR(contagemAntinodo(grafo, 1, 1) == 2);
+	VERIFICAR(diferencasContagem(grafo) == 0);
+
+	// Remover uma antena de um dos pares só baixa a contagem; mover a outra para longe limpa a célula
+	VERIFICAR(removerAntenaGrafo(grafo, 7, 1) == 0);
+	VERIFICAR(contagemAntinodo(grafo, 1, 1) == 1);
+	VERIFICAR(moverAntenaGrafo(grafo, 5, 5, 5, 15) == 0);
+	VERIFICAR(contagemAntinodo(grafo, 1, 1) == 0 && !existeAntinodo(grafo, 1, 1));
+	VERIFICAR(diferencasContagem(grafo) == 0);
+	VERIFICAR(contagemAntinodo(grafo, -1, 0) == 0 && contagemAntinodo(grafo, 0, MAX_DIM) == 0);
+
+	// Alterações aleatórias com a contagem ativa, comparadas com a recontagem
+	uint64_t estado = 13;
+	for (int i = 0; i < 3000; i++) {
+		int x = (int)(proximoAleatorio(&estado) % MAX_DIM), y = (int)(proximoAleatorio(&estado) % MAX_DIM);
+		switch (proximoAleatorio(&estado) % 4) {
+		case 0:
+		case 1:
+			inserirAntenaGrafo(grafo, 'A', x, y);
+			break;
+		case 2:
+			if (grafo->vertices != NULL) removerAntenaGrafo(grafo, grafo->vertices->antena.x, grafo->vertices->antena.y);
+			break;
+		default:
+			if (grafo->vertices != NULL) moverAntenaGrafo(grafo, grafo->vertices->antena.x, grafo->vertices->antena.y, x, y);
+			break;
+		}
+		if (i % 150 == 149) VERIFICAR(diferencasContagem(grafo) == 0);
+	}
+	VERIFICAR(grafo->numVertices > 10);
+
+	// Um grafo sem contagem ativa cria-a no primeiro pedido, igual à mantida
+	GRAFO* outro = criarGrafo(rede, 'B');
+	for (VERTICE* v = grafo->vertices; v != NULL; v = v->prox) {
+		inserirAntenaGrafo(outro, 'B', v->antena.x, v->antena.y);
+	}
+	VERIFICAR(outro->antinodos == NULL);
+	VERIFICAR(numeroAntinodos(outro) == numeroAntinodos(grafo) && outro->antinodos != NULL);
+	VERIFICAR(diferencasContagem(outro) == 0);
+
+	VERIFICAR(ativarAntinodos(NULL) == 1);
+	VERIFICAR(numeroAntinodos(NULL) == -1);
+	destruirRede(rede);
+	TERMINAR_TESTES();
+}
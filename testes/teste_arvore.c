@@ -0,0 +1,167 @@
+/**
+ * @file teste_arvore.c
+ * @brief Testes da árvore de suporte mínima: custo igual ao do algoritmo de Prim em O(V^2) nas duas
+ *        métricas e com qualquer número de threads, ligações válidas e por ordem de custo, e
+ *        materialização das ligações no grafo.
+ *
+ * @author Rogério Picas
+ * @date 18-10-2026
+ * @version 1.0
+ */
+#include <math.h>
+#include <stdlib.h>
+#include "testes.h"
+#include "arvore.h"
+#include "gerador.h"
+
+ /** @def TOLERANCIA_CUSTO
+  *  @brief Diferença máxima aceite entre dois custos totais (somas de raízes quadradas).
+  */
+#define TOLERANCIA_CUSTO 1e-6
+
+/**
+ * @brief Distância entre duas células na métrica indicada.
+ */
+static double distanciaTeste(int x1, int y1, int x2, int y2, METRICA_DISTANCIA metrica) {
+	double dx = x1 - x2, dy = y1 - y2;
+	return metrica == METRICA_MANHATTAN ? fabs(dx) + fabs(dy) : sqrt(dx * dx + dy * dy);
+}
+
+/**
+ * @brief Custo da árvore de suporte mínima pelo algoritmo de Prim sobre o grafo completo, em O(V^2).
+ */
+static double custoPrim(const ANTENAS* antenas, int n, METRICA_DISTANCIA metrica) {
+	if (n < 2) return 0.0;
+	double* melhor = (double*)malloc((size_t)n * sizeof(double));
+	char* naArvore = (char*)calloc((size_t)n, 1);
+	for (int i = 0; i < n; i++) melhor[i] = INFINITY;
+	melhor[0] = 0.0;
+	double total = 0.0;
+	for (int passo = 0; passo < n; passo++) {
+		int u = -1;
+		for (int i = 0; i < n; i++) {
+			if (!naArvore[i] && (u == -1 || melhor[i] < melhor[u])) u = i;
+		}
+		naArvore[u] = 1;
+		total += melhor[u];
+		for (int i = 0; i < n; i++) {
+			double d = distanciaTeste(antenas[u].x, antenas[u].y, antenas[i].x, antenas[i].y, metrica);
+			if (!naArvore[i] && d < melhor[i]) melhor[i] = d;
+		}
+	}
+	free(melhor);
+	free(naArvore);
+	return total;
+}
+
+/**
+ * @brief Constrói a árvore de um conjunto de antenas e compara-a com o algoritmo de Prim; depois materializa-a.
+ */
+static void verificarArvore(const ANTENAS* antenas, int n, METRICA_DISTANCIA metrica) {
+	REDE* rede = criarRede();
+	GRAFO* grafo = criarGrafo(rede, 'M');
+	for (int i = 0; i < n; i++) {
+		inserirAntenaGrafo(grafo, 'M', antenas[i].x, antenas[i].y);
+	}
+	// Uma ligação já existente não é criada de novo pela materialização
+	if (n >= 2) conectarVertices(grafo, antenas[0].x, antenas[0].y, antenas[1].x, antenas[1].y);
+
+	ARVORE_SUPORTE* arvore = construirArvoreSuporte(grafo, metrica, 2);
+	VERIFICAR(arvore != NULL);
+	if (arvore == NULL)
+	{
+		destruirRede(rede);
+		return;
+	}
+	VERIFICAR(arvore->frequencia == 'M' && arvore->metrica == metrica);
+	VERIFICAR(arvore->numLigacoes == (n > 0 ? n - 1 : 0));
+	VERIFICAR(fabs(arvore->custoTotal - custoPrim(antenas, n, metrica)) < TOLERANCIA_CUSTO);
+
+	double soma = 0.0;
+	int invalidas = 0;
+	for (int k = 0; k < arvore->numLigacoes; k++) {
+		const LIGACAO_SUPORTE* l = &arvore->ligacoes[k];
+		double d = distanciaTeste(l->xOrigem, l->yOrigem, l->xDestino, l->yDestino, metrica);
+		if (fabs(d - l->custo) > TOLERANCIA_CUSTO) invalidas++;
+		if (k > 0 && l->custo < arvore->ligacoes[k - 1].custo) invalidas++;
+		if (encontrarVertice(grafo, l->xOrigem, l->yOrigem) == NULL || encontrarVertice(grafo, l->xDestino, l->yDestino) == NULL) invalidas++;
+		soma += l->custo;
+	}
+	VERIFICAR(invalidas == 0);
+	VERIFICAR(fabs(soma - arvore->custoTotal) < TOLERANCIA_CUSTO);
+
+	// Com uma só thread, ou com as do OpenMP, o custo é o mesmo (os empates podem dar outras ligações)
+	int threads[] = { 1, 0 };
+	for (int t = 0; t < 2; t++) {
+		ARVORE_SUPORTE* outra = construirArvoreSuporte(grafo, metrica, threads[t]);
+		VERIFICAR(outra != NULL && outra->numLigacoes == arvore->numLigacoes);
+		if (outra != NULL) VERIFICAR(fabs(outra->custoTotal - arvore->custoTotal) < TOLERANCIA_CUSTO);
+		destruirArvoreSuporte(outra);
+	}
+
+	// As n - 1 ligações ligam todas as antenas; materializar duas vezes não repete ligações
+	int criadas = materializarArvoreSuporte(grafo, arvore);
+	VERIFICAR(criadas >= arvore->numLigacoes - 1 && criadas <= arvore->numLigacoes);
+	if (n > 0) VERIFICAR(alcanceTeste(grafo, antenas[n - 1].x, antenas[n - 1].y) == n);
+	VERIFICAR(materializarArvoreSuporte(grafo, arvore) == 0);
+
+	GRAFO* outro = criarGrafo(rede, 'N');
+	VERIFICAR(materializarArvoreSuporte(outro, arvore) == -1);
+
+	destruirArvoreSuporte(arvore);
+	destruirRede(rede);
+}
+
+int main() {
+	INICIAR_TESTES();
+
+	VERIFICAR(construirArvoreSuporte(NULL, METRICA_EUCLIDIANA, 1) == NULL);
+	VERIFICAR(materializarArvoreSuporte(NULL, NULL) == -1);
+
+	METRICA_DISTANCIA metricas[] = { METRICA_EUCLIDIANA, METRICA_MANHATTAN };
+	ANTENAS antenas[MAX_DIM * MAX_DIM];
+	uint64_t estado = 99;
+	for (int m = 0; m < 2; m++) {
+		// Grafo vazio, uma antena e duas antenas
+		verificarArvore(antenas, 0, metricas[m]);
+		antenas[0].x = 3;
+		antenas[0].y = 4;
+		antenas[1].x = 15;
+		antenas[1].y = 1;
+		verificarArvore(antenas, 1, metricas[m]);
+		verificarArvore(antenas, 2, metricas[m]);
+
+		// Antenas espalhadas pela cidade, de poucas até quase todas as células
+		int tamanhos[] = { 10, 60, 200, 350 };
+		for (int t = 0; t < 4; t++) {
+			static char ocupada[MAX_DIM * MAX_DIM];
+			for (int c = 0; c < MAX_DIM * MAX_DIM; c++) ocupada[c] = 0;
+			int n = 0;
+			while (n < tamanhos[t]) {
+				int c = (int)(proximoAleatorio(&estado) % (MAX_DIM * MAX_DIM));
+				if (ocupada[c]) continue;
+				ocupada[c] = 1;
+				antenas[n].x = c / MAX_DIM;
+				antenas[n].y = c % MAX_DIM;
+				n++;
+			}
+			verificarArvore(antenas, n, metricas[m]);
+		}
+
+		// Dois grupos em cantos opostos da cidade, com muitos empates de custo dentro de cada um
+		int n = 0;
+		for (int x = 0; x < 3; x++) {
+			for (int y = 0; y < 3; y++) {
+				antenas[n].x = x;
+				antenas[n].y = y;
+				n++;
+				antenas[n].x = MAX_DIM - 1 - x;
+				antenas[n].y = MAX_DIM - 1 - y;
+				n++;
+			}
+		}
+		verificarArvore(antenas, n, metricas[m]);
+	}
+
+	TERMINAR_TESTES();
+}
@@ -0,0 +1,205 @@
+/**
+ * @file teste_cache.c
+ * @brief Testes da cache de consultas: acertos e falhas, resultados depois de cada tipo de alteração
+ *        ao grafo, substituição da entrada menos recente, descarte das entradas de um grafo destruído
+ *        e sequências aleatórias de alterações e consultas comparadas com as respostas sem cache.
+ *
+ * @author Rogério Picas
+ * @date 18-10-2026
+ * @version 1.0
+ */
+#include "testes.h"
+#include "cache.h"
+#include "gerador.h"
+
+ /** @def NUM_OPERACOES
+  *  @brief Operações da sequência aleatória.
+  */
+#define NUM_OPERACOES 5000
+
+/**
+ * @brief Alcance com a cache, verificando que a resposta coincide com a de uma BFT sem cache.
+ */
+static int alcanceComCache(REDE* rede, GRAFO* grafo, int x, int y) {
+	int comCache = alcanceTeste(grafo, x, y);
+	CACHE_CONSULTAS* cache = rede->cache;
+	rede->cache = NULL;
+	int semCache = alcanceTeste(grafo, x, y);
+	rede->cache = cache;
+	VERIFICAR(comCache == semCache);
+	return comCache;
+}
+
+/**
+ * @brief Verifica as listas internas da cache: a lista LRU nos dois sentidos, os baldes e as entradas livres.
+ * @return Número de inconsistências.
+ */
+static int estruturaErrada(const CACHE_CONSULTAS* cache) {
+	int erros = 0, n = 0, anterior = -1;
+	for (int e = cache->menosRecente; e != -1 && n <= cache->capacidade; e = cache->entradas[e].maisRecente, n++) {
+		if (cache->entradas[e].menosRecente != anterior) erros++;
+		anterior = e;
+	}
+	if (n != cache->numEntradas || (n > 0 && anterior != cache->maisRecente)) erros++;
+
+	int nosBaldes = 0;
+	for (int b = 0; b < cache->numBaldes; b++) {
+		for (int e = cache->baldes[b]; e != -1 && nosBaldes <= cache->capacidade; e = cache->entradas[e].proxBalde) nosBaldes++;
+	}
+	if (nosBaldes != cache->numEntradas) erros++;
+
+	int livres = 0;
+	for (int e = cache->livres; e != -1 && livres <= cache->capacidade; e = cache->entradas[e].proxBalde) livres++;
+	if (livres != cache->capacidade - cache->numEntradas) erros++;
+	return erros;
+}
+
+/**
+ * @brief Caminhos entre duas antenas com a cache e sem ela (devem coincidir).
+ */
+static int caminhosComCache(REDE* rede, GRAFO* grafo, int x1, int y1, int x2, int y2) {
+	int comCache = countPathsDFS(grafo, x1, y1, x2, y2);
+	CACHE_CONSULTAS* cache = rede->cache;
+	rede->cache = NULL;
+	int semCache = countPathsDFS(grafo, x1, y1, x2, y2);
+	rede->cache = cache;
+	VERIFICAR(comCache == semCache);
+	return comCache;
+}
+
+/**
+ * @brief Ligação direta com a cache e sem ela (devem coincidir).
+ */
+static bool ligacaoComCache(REDE* rede, GRAFO* grafo, int x1, int y1, int x2, int y2) {
+	bool comCache = existeConexaoEntreVertices(grafo, x1, y1, x2, y2);
+	CACHE_CONSULTAS* cache = rede->cache;
+	rede->cache = NULL;
+	bool semCache = existeConexaoEntreVertices(grafo, x1, y1, x2, y2);
+	rede->cache = cache;
+	VERIFICAR(comCache == semCache);
+	return comCache;
+}
+
+int main() {
+	INICIAR_TESTES();
+
+	VERIFICAR(criarCacheConsultas(0) == NULL);
+	VERIFICAR(ativarCacheConsultas(NULL, 8) == 1);
+
+	REDE* rede = criarRede();
+	VERIFICAR(ativarCacheConsultas(rede, -1) == 1);
+	VERIFICAR(ativarCacheConsultas(rede, 16) == 0);
+	CACHE_CONSULTAS* cache = rede->cache;
+	VERIFICAR(cache != NULL && cache->capacidade == 16);
+
+	// Caminho (0, 0) - (0, 1) - (0, 2) - (0, 3) e uma antena isolada em (5, 5)
+	GRAFO* grafo = criarGrafo(rede, 'C');
+	for (int j = 0; j < 4; j++) {
+		VERIFICAR(inserirAntenaGrafo(grafo, 'C', 0, j) == 0);
+		if (j > 0) VERIFICAR(conectarVertices(grafo, 0, j - 1, 0, j) == 0);
+	}
+	VERIFICAR(inserirAntenaGrafo(grafo, 'C', 5, 5) == 0);
+
+	// A primeira consulta é uma falha; a repetição é um acerto com o mesmo resultado
+	long long acertos = cache->acertos, falhas = cache->falhas;
+	int count = 0;
+	VERIFICAR(BFT(grafo, 0, 0, &count) == 0 && count == 4);
+	VERIFICAR(cache->falhas == falhas + 1 && cache->acertos == acertos);
+	VERIFICAR(BFT(grafo, 0, 0, &count) == 0 && count == 4);
+	VERIFICAR(cache->acertos == acertos + 1);
+	VERIFICAR(existeConexaoEntreVertices(grafo, 0, 1, 0, 2));
+	VERIFICAR(existeConexaoEntreVertices(grafo, 0, 1, 0, 2));
+	VERIFICAR(countPathsDFS(grafo, 0, 0, 0, 3) == 1);
+	VERIFICAR(countPathsDFS(grafo, 0, 0, 0, 3) == 1);
+	VERIFICAR(cache->acertos == acertos + 3);
+
+	// Cada alteração muda a época: a entrada antiga é descartada e o resultado novo é calculado
+	long long invalidadas = cache->invalidadas;
+	VERIFICAR(conectarVertices(grafo, 0, 3, 5, 5) == 0);
+	VERIFICAR(alcanceComCache(rede, grafo, 0, 0) == 5);
+	VERIFICAR(cache->invalidadas == invalidadas + 1);
+
+	VERIFICAR(conectarVertices(grafo, 0, 0, 5, 5) == 0);
+	VERIFICAR(countPathsDFS(grafo, 0, 0, 0, 3) == 2);
+
+	VERIFICAR(removerLigacao(grafo, 0, 1, 0, 2) == 0);
+	VERIFICAR(!existeConexaoEntreVertices(grafo, 0, 1, 0, 2));
+	VERIFICAR(countPathsDFS(grafo, 0, 0, 0, 3) == 1);
+	VERIFICAR(alcanceComCache(rede, grafo, 0, 1) == 5);
+
+	VERIFICAR(removerAntenaGrafo(grafo, 5, 5) == 0);
+	VERIFICAR(alcanceComCache(rede, grafo, 0, 0) == 2);
+	VERIFICAR(alcanceComCache(rede, grafo, 0, 3) == 2);
+
+	VERIFICAR(inserirAntenaGrafo(grafo, 'C', 0, 4) == 0);
+	VERIFICAR(conectarVertices(grafo, 0, 3, 0, 4) == 0);
+	VERIFICAR(alcanceComCache(rede, grafo, 0, 3) == 3);
+	VERIFICAR(countPathsDFS(grafo, 0, 2, 0, 4) == 1);
+
+	// Os resultados de outro grafo não são afetados pelas alterações deste
+	GRAFO* outro = criarGrafo(rede, 'D');
+	VERIFICAR(inserirAntenaGrafo(outro, 'D', 9, 9) == 0);
+	VERIFICAR(alcanceTeste(outro, 9, 9) == 1);
+	acertos = cache->acertos;
+	VERIFICAR(conectarVertices(grafo, 0, 0, 0, 4) == 0);
+	VERIFICAR(alcanceTeste(outro, 9, 9) == 1);
+	VERIFICAR(cache->acertos == acertos + 1);
+
+	// Destruir um grafo descarta as suas entradas
+	int entradas = cache->numEntradas;
+	invalidadas = cache->invalidadas;
+	destruirGrafo(outro);
+	VERIFICAR(cache->numEntradas == entradas - 1);
+	VERIFICAR(cache->invalidadas == invalidadas + 1);
+
+	// Com a cache cheia, a entrada usada há mais tempo dá lugar à nova
+	VERIFICAR(ativarCacheConsultas(rede, 2) == 0);
+	cache = rede->cache;
+	VERIFICAR(alcanceTeste(grafo, 0, 0) == 5);
+	VERIFICAR(alcanceTeste(grafo, 0, 2) == 5);
+	VERIFICAR(alcanceTeste(grafo, 0, 0) == 5);
+	VERIFICAR(alcanceTeste(grafo, 0, 3) == 5);
+	VERIFICAR(cache->numEntradas == 2);
+	acertos = cache->acertos;
+	falhas = cache->falhas;
+	VERIFICAR(alcanceTeste(grafo, 0, 0) == 5);
+	VERIFICAR(alcanceTeste(grafo, 0, 2) == 5);
+	VERIFICAR(cache->acertos == acertos + 1 && cache->falhas == falhas + 1);
+
+	// Sequência aleatória de alterações e consultas em dois grafos pequenos, com a cache quase sempre cheia
+	VERIFICAR(ativarCacheConsultas(rede, 8) == 0);
+	cache = rede->cache;
+	GRAFO* grafos[2] = { grafo, criarGrafo(rede, 'E') };
+	uint64_t estado = 2026;
+	int estruturas = 0;
+	for (int i = 0; i < NUM_OPERACOES; i++) {
+		// As antenas ficam em 6 posições, pelo que a contagem de caminhos é sempre pequena
+		GRAFO* g = grafos[proximoAleatorio(&estado) % 2];
+		int x1 = (int)(proximoAleatorio(&estado) % 2), y1 = (int)(proximoAleatorio(&estado) % 3);
+		int x2 = (int)(proximoAleatorio(&estado) % 2), y2 = (int)(proximoAleatorio(&estado) % 3);
+		switch (proximoAleatorio(&estado) % 10) {
+		case 0: inserirAntenaGrafo(g, g->frequencia, x1, y1); break;
+		case 1: removerAntenaGrafo(g, x1, y1); break;
+		case 2: moverAntenaGrafo(g, x1, y1, x2, y2); break;
+		case 3: if (!existeConexaoEntreVertices(g, x1, y1, x2, y2)) conectarVertices(g, x1, y1, x2, y2); break;
+		case 4: removerLigacao(g, x1, y1, x2, y2); break;
+		case 5: case 6: alcanceComCache(rede, g, x1, y1); break;
+		case 7: ligacaoComCache(rede, g, x1, y1, x2, y2); break;
+		default: caminhosComCache(rede, g, x1, y1, x2, y2); break;
+		}
+		estruturas += estruturaErrada(cache);
+	}
+	VERIFICAR(estruturas == 0);
+	VERIFICAR(cache->acertos > 0 && cache->invalidadas > 0);
+	destruirGrafo(grafos[1]);
+	VERIFICAR(estruturaErrada(cache) == 0);
+
+	// Desativar a cache
+	int alcance = alcanceTeste(grafo, 0, 0);
+	VERIFICAR(ativarCacheConsultas(rede, 0) == 0);
+	VERIFICAR(rede->cache == NULL);
+	VERIFICAR(alcanceTeste(grafo, 0, 0) == alcance);
+
+	destruirRede(rede);
+	TERMINAR_TESTES();
+}
@@ -0,0 +1,139 @@
+/**
+ * @file teste_camadas.c
+ * @brief Testes da vista multi-camada: ligações entre camadas pelo raio, custos mínimos e alcances
+ *        com limite de custo comparados com o algoritmo de Floyd-Warshall sobre todas as antenas.
+ *
+ * @author Rogério Picas
+ * @date 18-10-2026
+ * @version 1.0
+ */
+#include <stdlib.h>
+#include "testes.h"
+#include "camadas.h"
+#include "gerador.h"
+
+ /** @def NUM_ANTENAS_TESTE
+  *  @brief Número de antenas da rede de teste (repartidas por três frequências).
+  */
+#define NUM_ANTENAS_TESTE 45
+
+ /** @def INFINITO_TESTE
+  *  @brief Custo dos pares de antenas sem caminho.
+  */
+#define INFINITO_TESTE 1000000
+
+/**
+ * @brief Verifica a vista com um raio e um custo de salto contra os custos calculados por Floyd-Warshall.
+ */
+static void verificarVista(REDE* rede, const ANTENAS* antenas, int n, int raio, int custoSalto) {
+	static int custo[NUM_ANTENAS_TESTE][NUM_ANTENAS_TESTE];
+	int saltos = 0, arestas = 0;
+	for (int i = 0; i < n; i++) {
+		GRAFO* grafo = encontrarGrafoPorFrequencia(rede, antenas[i].frequencia);
+		for (int j = 0; j < n; j++) {
+			custo[i][j] = i == j ? 0 : INFINITO_TESTE;
+			if (i == j) continue;
+			if (antenas[i].frequencia == antenas[j].frequencia)
+			{
+				if (existeConexaoEntreVertices(grafo, antenas[i].x, antenas[i].y, antenas[j].x, antenas[j].y))
+				{
+					custo[i][j] = 1;
+					arestas++;
+				}
+			}
+			else if (abs(antenas[i].x - antenas[j].x) <= raio && abs(antenas[i].y - antenas[j].y) <= raio)
+			{
+				custo[i][j] = custoSalto;
+				saltos++;
+			}
+		}
+	}
+	for (int k = 0; k < n; k++) {
+		for (int i = 0; i < n; i++) {
+			for (int j = 0; j < n; j++) {
+				if (custo[i][k] + custo[k][j] < custo[i][j]) custo[i][j] = custo[i][k] + custo[k][j];
+			}
+		}
+	}
+
+	REDE_CAMADAS* camadas = criarRedeCamadas(rede, raio, custoSalto);
+	VERIFICAR(camadas != NULL);
+	if (camadas == NULL) return;
+	VERIFICAR(camadas->numNos == n && camadas->numCamadas == 3);
+	VERIFICAR(camadas->numLigacoes == arestas + saltos);
+
+	int erradas = 0;
+	for (int i = 0; i < n; i++) {
+		VERIFICAR(encontrarNoCamadas(camadas, antenas[i].frequencia, antenas[i].x, antenas[i].y) >= 0);
+		for (int j = 0; j < n; j++) {
+			int esperado = custo[i][j] >= INFINITO_TESTE ? -1 : custo[i][j];
+			int obtido = custoMinimoCamadas(camadas, antenas[i].frequencia, antenas[i].x, antenas[i].y,
+				antenas[j].frequencia, antenas[j].x, antenas[j].y);
+			if (obtido != esperado) erradas++;
+		}
+	}
+	VERIFICAR(erradas == 0);
+
+	// O alcance conta as antenas com custo mínimo dentro do limite (negativo = sem limite)
+	int limites[] = { -1, 0, 1, 2, 4 };
+	erradas = 0;
+	for (int i = 0; i < n; i += 4) {
+		for (int l = 0; l < 5; l++) {
+			int esperado = 0;
+			for (int j = 0; j < n; j++) {
+				if (custo[i][j] < INFINITO_TESTE && (limites[l] < 0 || custo[i][j] <= limites[l])) esperado++;
+			}
+			int count = -1;
+			if (alcanceCamadas(camadas, antenas[i].frequencia, antenas[i].x, antenas[i].y, limites[l], &count) != 0 || count != esperado) erradas++;
+		}
+	}
+	VERIFICAR(erradas == 0);
+
+	VERIFICAR(custoMinimoCamadas(camadas, 'Z', 0, 0, antenas[0].frequencia, antenas[0].x, antenas[0].y) == -2);
+	int count;
+	VERIFICAR(alcanceCamadas(camadas, 'Z', 0, 0, -1, &count) == 1);
+	destruirRedeCamadas(camadas);
+}
+
+int main() {
+	INICIAR_TESTES();
+
+	// Três frequências com antenas numa zona pequena, para haver muitas antenas próximas de outras camadas
+	REDE* rede = criarRede();
+	ANTENAS antenas[NUM_ANTENAS_TESTE];
+	uint64_t estado = 4242;
+	int n = 0;
+	while (n < NUM_ANTENAS_TESTE) {
+		char frequencia = (char)('A' + n % 3);
+		int x = (int)(proximoAleatorio(&estado) % 10);
+		int y = (int)(proximoAleatorio(&estado) % 10);
+		if (inserirAntenaGrafo(criarGrafo(rede, frequencia), frequencia, x, y) != 0) continue;
+		antenas[n].frequencia = frequencia;
+		antenas[n].x = x;
+		antenas[n].y = y;
+		n++;
+	}
+	for (int l = 0; l < 30; l++) {
+		int i = (int)(proximoAleatorio(&estado) % n);
+		int j = (int)(proximoAleatorio(&estado) % n);
+		if (i == j || antenas[i].frequencia != antenas[j].frequencia) continue;
+		GRAFO* grafo = encontrarGrafoPorFrequencia(rede, antenas[i].frequencia);
+		if (existeConexaoEntreVertices(grafo, antenas[i].x, antenas[i].y, antenas[j].x, antenas[j].y)) continue;
+		conectarVertices(grafo, antenas[i].x, antenas[i].y, antenas[j].x, antenas[j].y);
+	}
+
+	int raios[] = { 0, 1, 2, 4 };
+	int custos[] = { 0, 1, 3 };
+	for (int r = 0; r < 4; r++) {
+		for (int c = 0; c < 3; c++) {
+			verificarVista(rede, antenas, n, raios[r], custos[c]);
+		}
+	}
+
+	VERIFICAR(criarRedeCamadas(NULL, 1, 1) == NULL);
+	VERIFICAR(criarRedeCamadas(rede, -1, 1) == NULL);
+	VERIFICAR(criarRedeCamadas(rede, 1, -1) == NULL);
+
+	destruirRede(rede);
+	TERMINAR_TESTES();
+}
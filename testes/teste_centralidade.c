@@ -0,0 +1,253 @@
+/**
+ * @file teste_centralidade.c
+ * @brief Testes da centralidade: intermediação e proximidade exatas (Brandes) comparadas com a
+ *        definição sobre todos os pares, com ligações repetidas, de uma antena a si própria e várias
+ *        componentes, resultado igual com várias threads, e estimativa por amostragem dentro do erro
+ *        máximo devolvido.
+ *
+ * @author Rogério Picas
+ * @date 18-10-2026
+ * @version 1.0
+ */
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include "testes.h"
+#include "centralidade.h"
+#include "gerador.h"
+
+ /** @def MAX_TESTE
+  *  @brief Número máximo de antenas dos grafos de teste.
+  */
+#define MAX_TESTE 200
+
+ /** @def TOLERANCIA
+  *  @brief Diferença relativa aceite entre valores calculados por ordens de soma diferentes.
+  */
+#define TOLERANCIA 1e-9
+
+/**
+ * @brief Compara dois valores com a tolerância relativa.
+ */
+static bool quaseIgual(double a, double b) {
+	return fabs(a - b) <= TOLERANCIA * (1.0 + fabs(a) + fabs(b));
+}
+
+/**
+ * @brief Distâncias e número de caminhos mais curtos entre todos os pares (uma procura por origem).
+ *
+ * Cada entrada da lista de adjacências é um caminho distinto, pelo que as ligações repetidas
+ * multiplicam os caminhos; as ligações de uma antena a si própria nunca estão num caminho mais curto.
+ */
+static void todosOsPares(VERTICE* vertices[], int n, int distancia[][MAX_TESTE], double caminhos[][MAX_TESTE]) {
+	int fila[MAX_TESTE];
+	for (int s = 0; s < n; s++) {
+		for (int t = 0; t < n; t++) {
+			distancia[s][t] = -1;
+			caminhos[s][t] = 0;
+		}
+		int frente = 0, tras = 0;
+		fila[tras++] = s;
+		distancia[s][s] = 0;
+		caminhos[s][s] = 1;
+		while (frente < tras) {
+			int v = fila[frente++];
+			for (ARESTA* a = vertices[v]->adjacentes; a != NULL; a = a->prox) {
+				int w = 0;
+				while (vertices[w] != a->destino) w++;
+				if (distancia[s][w] < 0)
+				{
+					distancia[s][w] = distancia[s][v] + 1;
+					fila[tras++] = w;
+				}
+				if (distancia[s][w] == distancia[s][v] + 1) caminhos[s][w] += caminhos[s][v];
+			}
+		}
+	}
+}
+
+/**
+ * @brief Compara as centralidades exatas com a definição, sobre todos os pares de outras antenas.
+ * @return Número de antenas com algum valor errado.
+ */
+static int centralidadesErradas(GRAFO* grafo, const CENTRALIDADE* centralidade) {
+	static int distancia[MAX_TESTE][MAX_TESTE];
+	static double caminhos[MAX_TESTE][MAX_TESTE];
+	VERTICE* vertices[MAX_TESTE];
+	int n = 0;
+	for (VERTICE* v = grafo->vertices; v != NULL && n < MAX_TESTE; v = v->prox) vertices[n++] = v;
+	if (centralidade->numAntenas != n) return 1;
+	todosOsPares(vertices, n, distancia, caminhos);
+
+	int erradas = 0;
+	for (int v = 0; v < n; v++) {
+		// Fração dos caminhos mais curtos entre s e t (s < t, ambos diferentes de v) que passam por v
+		double intermediacao = 0;
+		for (int s = 0; s < n; s++) {
+			for (int t = s + 1; t < n; t++) {
+				if (s == v || t == v || distancia[s][t] < 0 || distancia[s][v] < 0 || distancia[v][t] < 0) continue;
+				if (distancia[s][v] + distancia[v][t] == distancia[s][t]) intermediacao += caminhos[s][v] * caminhos[v][t] / caminhos[s][t];
+			}
+		}
+		double pares = n > 2 ? (double)(n - 1) * (n - 2) / 2 : 0;
+
+		// Proximidade de Wasserman-Faust, com as antenas alcançáveis a partir de v
+		int outras = 0, soma = 0;
+		for (int t = 0; t < n; t++) {
+			if (t == v || distancia[v][t] < 0) continue;
+			outras++;
+			soma += distancia[v][t];
+		}
+		double proximidade = soma > 0 ? (double)outras * outras / ((double)(n - 1) * soma) : 0;
+
+		const CENTRALIDADE_ANTENA* c = &centralidade->antenas[v];
+		if (c->x != vertices[v]->antena.x || c->y != vertices[v]->antena.y || c->id != vertices[v]->id) erradas++;
+		else if (!quaseIgual(c->intermediacao, intermediacao) || !quaseIgual(c->proximidade, proximidade)) erradas++;
+		else if (!quaseIgual(c->intermediacaoNormalizada, pares > 0 ? intermediacao / pares : 0)) erradas++;
+	}
+	return erradas;
+}
+
+/**
+ * @brief Cria um grafo com antenas em posições aleatórias e ligações aleatórias, algumas repetidas
+ *        e algumas de uma antena a si própria.
+ */
+static GRAFO* grafoAleatorio(REDE* rede, char frequencia, int numAntenas, int numLigacoes, uint64_t* estado) {
+	GRAFO* grafo = criarGrafo(rede, frequencia);
+	while (grafo->numVertices < numAntenas) {
+		inserirAntenaGrafo(grafo, frequencia, (int)(proximoAleatorio(estado) % MAX_DIM), (int)(proximoAleatorio(estado) % MAX_DIM));
+	}
+	VERTICE* vertices[MAX_TESTE];
+	int n = 0;
+	for (VERTICE* v = grafo->vertices; v != NULL; v = v->prox) vertices[n++] = v;
+	for (int i = 0; i < numLigacoes; i++) {
+		VERTICE* a = vertices[proximoAleatorio(estado) % n];
+		VERTICE* b = i % 13 == 0 ? a : vertices[proximoAleatorio(estado) % n];
+		conectarVertices(grafo, a->antena.x, a->antena.y, b->antena.x, b->antena.y);
+		if (i % 9 == 0) conectarVertices(grafo, a->antena.x, a->antena.y, b->antena.x, b->antena.y);
+	}
+	return grafo;
+}
+
+int main() {
+	INICIAR_TESTES();
+
+	// Caminho 0-1-2 com uma ligação repetida entre 1 e 2: só a antena do meio é intermediária
+	REDE* rede = criarRede();
+	GRAFO* caminho = criarGrafo(rede, 'A');
+	inserirAntenaGrafo(caminho, 'A', 0, 0);
+	inserirAntenaGrafo(caminho, 'A', 0, 1);
+	inserirAntenaGrafo(caminho, 'A', 0, 2);
+	conectarVertices(caminho, 0, 0, 0, 1);
+	conectarVertices(caminho, 0, 1, 0, 2);
+	conectarVertices(caminho, 0, 1, 0, 2);
+	conectarVertices(caminho, 0, 2, 0, 2);
+	CENTRALIDADE* centralidade = calcularCentralidade(caminho, 0, 0, 0, 1);
+	VERIFICAR(centralidade != NULL && centralidade->numAntenas == 3);
+	VERIFICAR(centralidade != NULL && centralidade->numOrigens == 3 && centralidade->erroMaximo == 0);
+	if (centralidade != NULL)
+	{
+		VERIFICAR(centralidadesErradas(caminho, centralidade) == 0);
+		// Ordenar põe a antena do meio (intermediação 1) em primeiro lugar
+		ordenarCentralidade(centralidade, false);
+		VERIFICAR(centralidade->antenas[0].x == 0 && centralidade->antenas[0].y == 1);
+		VERIFICAR(quaseIgual(centralidade->antenas[0].intermediacao, 1) && quaseIgual(centralidade->antenas[0].intermediacaoNormalizada, 1));
+		VERIFICAR(quaseIgual(centralidade->antenas[1].intermediacao, 0) && quaseIgual(centralidade->antenas[2].intermediacao, 0));
+		ordenarCentralidade(centralidade, true);
+		VERIFICAR(centralidade->antenas[0].y == 1 && quaseIgual(centralidade->antenas[0].proximidade, 1));
+		centralidade = destruirCentralidade(centralidade);
+	}
+
+	// Grafos aleatórios, de esparsos (várias componentes) a densos, com 1, 2 e 4 threads
+	uint64_t estado = 4242;
+	int tamanhos[][2] = { { 12, 8 }, { 30, 25 }, { 60, 90 }, { 100, 300 }, { 150, 150 } };
+	int threads[] = { 1, 2, 4 };
+	for (int g = 0; g < 5; g++) {
+		GRAFO* grafo = grafoAleatorio(rede, (char)('B' + g), tamanhos[g][0], tamanhos[g][1], &estado);
+		CENTRALIDADE* primeira = NULL;
+		for (int t = 0; t < 3; t++) {
+			centralidade = calcularCentralidade(grafo, 0, 0, 0, threads[t]);
+			VERIFICAR(centralidade != NULL && centralidade->numOrigens == tamanhos[g][0]);
+			if (centralidade == NULL) continue;
+			VERIFICAR(centralidadesErradas(grafo, centralidade) == 0);
+			if (primeira == NULL)
+			{
+				primeira = centralidade;
+				continue;
+			}
+			int diferentes = 0;
+			for (int i = 0; i < centralidade->numAntenas; i++) {
+				if (!quaseIgual(centralidade->antenas[i].intermediacao, primeira->antenas[i].intermediacao)) diferentes++;
+				if (!quaseIgual(centralidade->antenas[i].proximidade, primeira->antenas[i].proximidade)) diferentes++;
+			}
+			VERIFICAR(diferentes == 0);
+			destruirCentralidade(centralidade);
+		}
+		destruirCentralidade(primeira);
+	}
+
+	// Número de origens: argumentos inválidos, e menos origens para um erro maior
+	VERIFICAR(origensCentralidade(2, 0.1, 0.9) == -1);
+	VERIFICAR(origensCentralidade(100, 0, 0.9) == -1);
+	VERIFICAR(origensCentralidade(100, 0.1, 1) == -1);
+	VERIFICAR(origensCentralidade(100, 0.1, 0) == -1);
+	VERIFICAR(origensCentralidade(100000, 0.05, 0.9) > origensCentralidade(100000, 0.1, 0.9));
+	VERIFICAR(origensCentralidade(100000, 0.1, 0.99) > origensCentralidade(100000, 0.1, 0.9));
+	VERIFICAR(origensCentralidade(50, 0.01, 0.9) == 50);
+
+	// Amostragem: menos origens, erro máximo dentro do pedido e estimativas dentro do erro máximo
+	GRAFO* grande = grafoAleatorio(rede, 'Z', MAX_TESTE, 500, &estado);
+	CENTRALIDADE* exata = calcularCentralidade(grande, 0, 0, 0, 0);
+	VERIFICAR(exata != NULL);
+	if (exata != NULL)
+	{
+		VERIFICAR(centralidadesErradas(grande, exata) == 0);
+		for (unsigned int semente = 1; semente <= 5; semente++) {
+			CENTRALIDADE* amostra = calcularCentralidade(grande, 0.25, 0.9, semente, 4);
+			VERIFICAR(amostra != NULL);
+			if (amostra == NULL) continue;
+			VERIFICAR(amostra->numOrigens == origensCentralidade(MAX_TESTE, 0.25, 0.9) && amostra->numOrigens < MAX_TESTE);
+			VERIFICAR(amostra->erroMaximo > 0 && amostra->erroMaximo <= 0.25 + TOLERANCIA);
+			int foraDoErro = 0;
+			for (int i = 0; i < amostra->numAntenas; i++) {
+				double diferenca = amostra->antenas[i].intermediacaoNormalizada - exata->antenas[i].intermediacaoNormalizada;
+				if (fabs(diferenca) > amostra->erroMaximo) foraDoErro++;
+			}
+			VERIFICAR(foraDoErro == 0);
+
+			// A mesma semente escolhe as mesmas origens, qualquer que seja o número de threads
+			CENTRALIDADE* repetida = calcularCentralidade(grande, 0.25, 0.9, semente, 1);
+			VERIFICAR(repetida != NULL);
+			if (repetida != NULL)
+			{
+				int diferentes = 0;
+				for (int i = 0; i < amostra->numAntenas; i++) {
+					if (!quaseIgual(repetida->antenas[i].intermediacao, amostra->antenas[i].intermediacao)) diferentes++;
+				}
+				VERIFICAR(diferentes == 0);
+				destruirCentralidade(repetida);
+			}
+			destruirCentralidade(amostra);
+		}
+
+		// Um erro tão pequeno que a amostra teria todas as antenas dá o resultado exato
+		CENTRALIDADE* todas = calcularCentralidade(grande, 0.001, 0.9, 7, 2);
+		VERIFICAR(todas != NULL && todas->numOrigens == MAX_TESTE && todas->erroMaximo == 0);
+		if (todas != NULL) VERIFICAR(centralidadesErradas(grande, todas) == 0);
+		destruirCentralidade(todas);
+		destruirCentralidade(exata);
+	}
+
+	// Argumentos inválidos, grafo nulo e grafo vazio
+	VERIFICAR(calcularCentralidade(NULL, 0, 0, 0, 1) == NULL);
+	VERIFICAR(calcularCentralidade(grande, 0.1, 1.5, 0, 1) == NULL);
+	GRAFO* vazio = criarGrafo(rede, 'Y');
+	centralidade = calcularCentralidade(vazio, 0, 0, 0, 1);
+	VERIFICAR(centralidade != NULL && centralidade->numAntenas == 0 && centralidade->antenas == NULL);
+	destruirCentralidade(centralidade);
+	ordenarCentralidade(NULL, false);
+	VERIFICAR(destruirCentralidade(NULL) == NULL);
+
+	destruirRede(rede);
+	TERMINAR_TESTES();
+}
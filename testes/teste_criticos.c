@@ -0,0 +1,286 @@
+/**
+ * @file teste_criticos.c
+ * @brief Testes da análise crítica (Tarjan): pontos de articulação, pontes e componentes biconexas
+ *        num grafo conhecido e em grafos aleatórios (com ligações repetidas e de uma antena a si própria),
+ *        comparados com a remoção de cada antena e ligação, e análise da rede com várias threads.
+ *
+ * @author Rogério Picas
+ * @date 18-10-2026
+ * @version 1.0
+ */
+#include <stdlib.h>
+#include "testes.h"
+#include "criticos.h"
+#include "gerador.h"
+
+ /** @def MAX_TESTE
+  *  @brief Número máximo de antenas e de ligações dos grafos aleatórios.
+  */
+#define MAX_TESTE 64
+
+/**
+ * @brief Componentes conexas do grafo sem a antena @p semVertice e sem a ligação @p semLigacao (-1 para não tirar nada).
+ */
+static int contarComponentes(int numVertices, int ligacoes[][2], int numLigacoes, int semVertice, int semLigacao) {
+	int pai[MAX_TESTE];
+	for (int i = 0; i < numVertices; i++) pai[i] = i;
+	int componentes = numVertices - (semVertice >= 0 ? 1 : 0);
+	for (int l = 0; l < numLigacoes; l++) {
+		int a = ligacoes[l][0], b = ligacoes[l][1];
+		if (l == semLigacao || a == semVertice || b == semVertice) continue;
+		while (pai[a] != a) a = pai[a];
+		while (pai[b] != b) b = pai[b];
+		if (a != b)
+		{
+			pai[a] = b;
+			componentes--;
+		}
+	}
+	return componentes;
+}
+
+/**
+ * @brief Componente de cada antena do grafo sem a antena @p semVertice (-1 para não tirar nenhuma).
+ */
+static void componentesSem(int numVertices, int ligacoes[][2], int numLigacoes, int semVertice, int componente[]) {
+	for (int i = 0; i < numVertices; i++) componente[i] = i;
+	for (int l = 0; l < numLigacoes; l++) {
+		int a = ligacoes[l][0], b = ligacoes[l][1];
+		if (a == semVertice || b == semVertice) continue;
+		while (componente[a] != a) a = componente[a];
+		while (componente[b] != b) b = componente[b];
+		componente[a] = b;
+	}
+	for (int i = 0; i < numVertices; i++) {
+		int r = i;
+		while (componente[r] != r) r = componente[r];
+		componente[i] = r;
+	}
+}
+
+/**
+ * @brief Verifica se duas ligações estão na mesma componente biconexa, pela definição.
+ *
+ * Estão se o grafo as ligar e nenhuma antena as separar: sem essa antena, cada ligação fica do lado
+ * da sua outra ponta. Duas ligações de blocos diferentes são sempre separadas por um ponto de
+ * articulação do caminho entre os blocos.
+ */
+static bool mesmoBloco(int numVertices, int ligacoes[][2], int numLigacoes, int e, int f) {
+	int componente[MAX_TESTE];
+	componentesSem(numVertices, ligacoes, numLigacoes, -1, componente);
+	if (componente[ligacoes[e][0]] != componente[ligacoes[f][0]]) return false;
+	for (int v = 0; v < numVertices; v++) {
+		componentesSem(numVertices, ligacoes, numLigacoes, v, componente);
+		int ladoE = ligacoes[e][0] != v ? ligacoes[e][0] : ligacoes[e][1];
+		int ladoF = ligacoes[f][0] != v ? ligacoes[f][0] : ligacoes[f][1];
+		if (componente[ladoE] != componente[ladoF]) return false;
+	}
+	return true;
+}
+
+/**
+ * @brief Verifica a análise de um grafo aleatório com a remoção exaustiva de cada antena e de cada ligação.
+ */
+static void verificarAleatorio(uint64_t* estado, int numVertices, int numLigacoes) {
+	REDE* rede = criarRede();
+	GRAFO* grafo = criarGrafo(rede, 'T');
+	ANTENAS antenas[MAX_TESTE];
+	for (int i = 0; i < numVertices; i++) {
+		do {
+			antenas[i].x = (int)(proximoAleatorio(estado) % MAX_DIM);
+			antenas[i].y = (int)(proximoAleatorio(estado) % MAX_DIM);
+		} while (inserirAntenaGrafo(grafo, 'T', antenas[i].x, antenas[i].y) != 0);
+	}
+	// Algumas ligações repetidas e de uma antena a si própria (que não entram nas componentes)
+	int ligacoes[MAX_TESTE][2];
+	int n = 0, proprias = 0;
+	for (int tentativas = 0; n < numLigacoes && tentativas < 10 * numLigacoes; tentativas++) {
+		int a = (int)(proximoAleatorio(estado) % numVertices);
+		int b = (int)(proximoAleatorio(estado) % numVertices);
+		if (a == b && tentativas % 6 != 0) continue;
+		if (a != b && tentativas % 5 != 0 && existeConexaoEntreVertices(grafo, antenas[a].x, antenas[a].y, antenas[b].x, antenas[b].y)) continue;
+		conectarVertices(grafo, antenas[a].x, antenas[a].y, antenas[b].x, antenas[b].y);
+		ligacoes[n][0] = a;
+		ligacoes[n][1] = b;
+		proprias += a == b;
+		n++;
+	}
+
+	ANALISE_CRITICA_GRAFO analise;
+	VERIFICAR(analisarGrafoCritico(grafo, &analise) == 0);
+	int base = contarComponentes(numVertices, ligacoes, n, -1, -1);
+
+	int articulacoes = 0;
+	for (int i = 0; i < numVertices; i++) {
+		bool critica = contarComponentes(numVertices, ligacoes, n, i, -1) > base;
+		bool listada = false;
+		for (int k = 0; k < analise.numArticulacoes; k++) {
+			if (analise.articulacoes[k].x == antenas[i].x && analise.articulacoes[k].y == antenas[i].y) listada = true;
+		}
+		VERIFICAR(critica == listada);
+		articulacoes += critica;
+	}
+	VERIFICAR(articulacoes == analise.numArticulacoes);
+
+	int pontes = 0;
+	for (int l = 0; l < n; l++) {
+		bool ponte = contarComponentes(numVertices, ligacoes, n, -1, l) > base;
+		const ANTENAS* a = &antenas[ligacoes[l][0]];
+		const ANTENAS* b = &antenas[ligacoes[l][1]];
+		bool listada = false;
+		for (int k = 0; k < analise.numPontes; k++) {
+			const ArestasFICHEIRO* p = &analise.pontes[k];
+			if ((p->xOrigem == a->x && p->yOrigem == a->y && p->xDestino == b->x && p->yDestino == b->y) ||
+				(p->xOrigem == b->x && p->yOrigem == b->y && p->xDestino == a->x && p->yDestino == a->y))
+			{
+				listada = true;
+			}
+		}
+		VERIFICAR(ponte == listada);
+		pontes += ponte;
+	}
+	VERIFICAR(pontes == analise.numPontes);
+
+	// Cada ligação está numa só componente; as componentes de uma só ligação são exatamente as pontes
+	VERIFICAR(analise.numLigacoes == n - proprias);
+	VERIFICAR(analise.inicioComponentes[0] == 0 && analise.inicioComponentes[analise.numComponentes] == n - proprias);
+	int isoladas = 0;
+	for (int c = 0; c < analise.numComponentes; c++) {
+		int tamanho = analise.inicioComponentes[c + 1] - analise.inicioComponentes[c];
+		VERIFICAR(tamanho >= 1);
+		if (tamanho == 1) isoladas++;
+	}
+	VERIFICAR(isoladas == analise.numPontes);
+
+	// Componente de cada ligação do teste (as repetidas ficam com uma posição do array cada)
+	int componenteLigacao[MAX_TESTE];
+	bool usada[MAX_TESTE] = { false };
+	int naoEncontradas = 0;
+	for (int l = 0; l < n; l++) {
+		componenteLigacao[l] = -1;
+		if (ligacoes[l][0] == ligacoes[l][1]) continue;
+		const ANTENAS* a = &antenas[ligacoes[l][0]];
+		const ANTENAS* b = &antenas[ligacoes[l][1]];
+		for (int c = 0; c < analise.numComponentes && componenteLigacao[l] < 0; c++) {
+			for (int k = analise.inicioComponentes[c]; k < analise.inicioComponentes[c + 1]; k++) {
+				const ArestasFICHEIRO* p = &analise.ligacoes[k];
+				bool igual = (p->xOrigem == a->x && p->yOrigem == a->y && p->xDestino == b->x && p->yDestino == b->y) ||
+					(p->xOrigem == b->x && p->yOrigem == b->y && p->xDestino == a->x && p->yDestino == a->y);
+				if (igual && !usada[k])
+				{
+					usada[k] = true;
+					componenteLigacao[l] = c;
+					break;
+				}
+			}
+		}
+		if (componenteLigacao[l] < 0) naoEncontradas++;
+	}
+	VERIFICAR(naoEncontradas == 0);
+
+	// Duas ligações estão na mesma componente se e só se estiverem no mesmo bloco
+	int blocosErrados = 0;
+	for (int e = 0; e < n; e++) {
+		for (int f = e + 1; f < n; f++) {
+			if (componenteLigacao[e] < 0 || componenteLigacao[f] < 0) continue;
+			if ((componenteLigacao[e] == componenteLigacao[f]) != mesmoBloco(numVertices, ligacoes, n, e, f)) blocosErrados++;
+		}
+	}
+	VERIFICAR(blocosErrados == 0);
+
+	libertarAnaliseCriticaGrafo(&analise);
+	destruirRede(rede);
+}
+
+int main() {
+	INICIAR_TESTES();
+
+	// Triângulo (0, 0) - (0, 1) - (1, 1), caminho (1, 1) - (2, 2) - (3, 3) - (4, 4) e uma antena isolada
+	REDE* rede = criarRede();
+	GRAFO* grafo = criarGrafo(rede, 'K');
+	int antenas[][2] = { { 0, 0 }, { 0, 1 }, { 1, 1 }, { 2, 2 }, { 3, 3 }, { 4, 4 }, { 9, 9 } };
+	for (int i = 0; i < 7; i++) {
+		VERIFICAR(inserirAntenaGrafo(grafo, 'K', antenas[i][0], antenas[i][1]) == 0);
+	}
+	VERIFICAR(conectarVertices(grafo, 0, 0, 0, 1) == 0);
+	VERIFICAR(conectarVertices(grafo, 0, 1, 1, 1) == 0);
+	VERIFICAR(conectarVertices(grafo, 1, 1, 0, 0) == 0);
+	for (int i = 2; i < 5; i++) {
+		VERIFICAR(conectarVertices(grafo, antenas[i][0], antenas[i][1], antenas[i + 1][0], antenas[i + 1][1]) == 0);
+	}
+
+	ANALISE_CRITICA_GRAFO analise;
+	VERIFICAR(analisarGrafoCritico(grafo, &analise) == 0);
+	VERIFICAR(analise.frequencia == 'K');
+	VERIFICAR(analise.numArticulacoes == 3 && analise.numPontes == 3);
+	VERIFICAR(analise.numComponentes == 4 && analise.numLigacoes == 6);
+	int tres = 0;
+	for (int c = 0; c < analise.numComponentes; c++) {
+		if (analise.inicioComponentes[c + 1] - analise.inicioComponentes[c] == 3) tres++;
+	}
+	VERIFICAR(tres == 1);
+	libertarAnaliseCriticaGrafo(&analise);
+
+	// Fechar o ciclo (4, 4) - (0, 0) junta tudo numa só componente, sem articulações nem pontes
+	VERIFICAR(conectarVertices(grafo, 4, 4, 0, 0) == 0);
+	VERIFICAR(analisarGrafoCritico(grafo, &analise) == 0);
+	VERIFICAR(analise.numArticulacoes == 0 && analise.numPontes == 0);
+	VERIFICAR(analise.numComponentes == 1 && analise.numLigacoes == 7);
+	libertarAnaliseCriticaGrafo(&analise);
+
+	// A análise da rede tem uma entrada por grafo, igual à do grafo sozinho
+	GRAFO* outro = criarGrafo(rede, 'L');
+	VERIFICAR(inserirAntenaGrafo(outro, 'L', 5, 0) == 0);
+	VERIFICAR(inserirAntenaGrafo(outro, 'L', 5, 1) == 0);
+	VERIFICAR(conectarVertices(outro, 5, 0, 5, 1) == 0);
+	ANALISE_CRITICA* analiseRede = analisarRedeCritica(rede, 2);
+	VERIFICAR(analiseRede != NULL && analiseRede->numGrafos == 2);
+	if (analiseRede != NULL && analiseRede->numGrafos == 2)
+	{
+		for (int g = 0; g < 2; g++) {
+			const ANALISE_CRITICA_GRAFO* r = &analiseRede->grafos[g];
+			if (r->frequencia == 'L') VERIFICAR(r->numPontes == 1 && r->numArticulacoes == 0 && r->numComponentes == 1);
+			else VERIFICAR(r->frequencia == 'K' && r->numPontes == 0 && r->numComponentes == 1);
+		}
+	}
+	analiseRede = destruirAnaliseCritica(analiseRede);
+	VERIFICAR(analisarGrafoCritico(NULL, &analise) == 1);
+	destruirRede(rede);
+
+	// Grafos aleatórios, de esparsos (muitas pontes) a densos
+	uint64_t estado = 777;
+	for (int i = 0; i < 20; i++) {
+		verificarAleatorio(&estado, 10 + i, 5 + i * 3);
+	}
+
+	// A análise da rede em paralelo dá o mesmo que cada grafo sozinho, qualquer que seja o número de threads
+	rede = criarRede();
+	for (int i = 0; i < 400; i++) {
+		char freq = (char)('A' + proximoAleatorio(&estado) % 12);
+		GRAFO* g = criarGrafo(rede, freq);
+		int x = (int)(proximoAleatorio(&estado) % MAX_DIM), y = (int)(proximoAleatorio(&estado) % MAX_DIM);
+		inserirAntenaGrafo(g, freq, x, y);
+		VERTICE* v = g->vertices;
+		if (v != NULL && proximoAleatorio(&estado) % 3 != 0) conectarVertices(g, x, y, v->antena.x, v->antena.y);
+	}
+	int threads[] = { 1, 4 };
+	for (int t = 0; t < 2; t++) {
+		analiseRede = analisarRedeCritica(rede, threads[t]);
+		VERIFICAR(analiseRede != NULL && analiseRede->numGrafos == 12);
+		if (analiseRede == NULL) continue;
+		int g = 0, diferentes = 0;
+		for (GRAFO* grafoRede = rede->listaGrafos; grafoRede != NULL && g < analiseRede->numGrafos; grafoRede = grafoRede->prox, g++) {
+			const ANALISE_CRITICA_GRAFO* r = &analiseRede->grafos[g];
+			VERIFICAR(analisarGrafoCritico(grafoRede, &analise) == 0);
+			if (r->frequencia != analise.frequencia || r->numArticulacoes != analise.numArticulacoes ||
+				r->numPontes != analise.numPontes || r->numComponentes != analise.numComponentes ||
+				r->numLigacoes != analise.numLigacoes) diferentes++;
+			libertarAnaliseCriticaGrafo(&analise);
+		}
+		VERIFICAR(diferentes == 0);
+		analiseRede = destruirAnaliseCritica(analiseRede);
+	}
+	destruirRede(rede);
+
+	TERMINAR_TESTES();
+}
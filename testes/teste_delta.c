@@ -0,0 +1,213 @@
+/**
+ * @file teste_delta.c
+ * @brief Testes das alterações em lote: interpretação e rejeição de linhas, escrita e releitura,
+ *        contagens de um ficheiro de alterações e lotes comparados com as mesmas alterações aplicadas
+ *        uma a uma (antenas, ligações, antinodos, reservas e época da rede).
+ *
+ * @author Rogério Picas
+ * @date 18-10-2026
+ * @version 1.0
+ */
+#include <stdio.h>
+#include <string.h>
+#include "testes.h"
+#include "delta.h"
+#include "antinodos.h"
+#include "reserva.h"
+#include "gerador.h"
+
+ /** @def NUM_ALTERACOES_TESTE
+  *  @brief Número de alterações aleatórias aplicadas em lote e uma a uma.
+  */
+#define NUM_ALTERACOES_TESTE 3000
+
+/**
+ * @brief Conta as antenas, ligações e contagens de antinodos de uma rede que diferem na outra (percorrendo só a primeira).
+ */
+static int diferencasRede(REDE* a, REDE* b) {
+	int diferencas = 0;
+	for (GRAFO* ga = a->listaGrafos; ga != NULL; ga = ga->prox) {
+		GRAFO* gb = encontrarGrafoPorFrequencia(b, ga->frequencia);
+		if (gb == NULL || gb->numVertices != ga->numVertices)
+		{
+			diferencas++;
+			continue;
+		}
+		for (VERTICE* v = ga->vertices; v != NULL; v = v->prox) {
+			VERTICE* w = encontrarVertice(gb, v->antena.x, v->antena.y);
+			if (w == NULL || w->grau != v->grau)
+			{
+				diferencas++;
+				continue;
+			}
+			for (ARESTA* e = v->adjacentes; e != NULL; e = e->prox) {
+				if (!existeConexao(w->adjacentes, e->destino->antena.x, e->destino->antena.y)) diferencas++;
+			}
+		}
+		for (int x = 0; x < MAX_DIM; x++) {
+			for (int y = 0; y < MAX_DIM; y++) {
+				if (contagemAntinodo(ga, x, y) != contagemAntinodo(gb, x, y)) diferencas++;
+			}
+		}
+	}
+	return diferencas;
+}
+
+/**
+ * @brief Gera uma alteração aleatória numa zona pequena (para haver colisões e rejeições).
+ */
+static DELTA deltaAleatorio(uint64_t* estado) {
+	DELTA d;
+	d.tipo = (TIPO_DELTA)(proximoAleatorio(estado) % 5);
+	d.frequencia = (char)('A' + proximoAleatorio(estado) % 3);
+	d.x1 = (int)(proximoAleatorio(estado) % 10);
+	d.y1 = (int)(proximoAleatorio(estado) % 10);
+	d.x2 = (int)(proximoAleatorio(estado) % 10);
+	d.y2 = (int)(proximoAleatorio(estado) % 10);
+	// Mais inserções e ligações, para a rede crescer
+	if (proximoAleatorio(estado) % 3 == 0) d.tipo = DELTA_INSERIR;
+	else if (proximoAleatorio(estado) % 3 == 0) d.tipo = DELTA_LIGAR;
+	return d;
+}
+
+int main() {
+	INICIAR_TESTES();
+	DELTA d;
+
+	// Linhas válidas, com espaços à volta e '\n' no fim
+	VERIFICAR(interpretarDelta("inserir A 3 4\n", &d) == 0);
+	VERIFICAR(d.tipo == DELTA_INSERIR && d.frequencia == 'A' && d.x1 == 3 && d.y1 == 4 && d.x2 == -1 && d.y2 == -1);
+	VERIFICAR(interpretarDelta("  remover   Z  0 19  ", &d) == 0);
+	VERIFICAR(d.tipo == DELTA_REMOVER && d.frequencia == 'Z' && d.x1 == 0 && d.y1 == 19);
+	VERIFICAR(interpretarDelta("mover B 1 2 3 4", &d) == 0);
+	VERIFICAR(d.tipo == DELTA_MOVER && d.x1 == 1 && d.y1 == 2 && d.x2 == 3 && d.y2 == 4);
+	VERIFICAR(interpretarDelta("ligar C 5 6 7 8\r\n", &d) == 0 && d.tipo == DELTA_LIGAR && d.y2 == 8);
+	VERIFICAR(interpretarDelta("desligar C 5 6 7 8", &d) == 0 && d.tipo == DELTA_DESLIGAR);
+	VERIFICAR(interpretarDelta("inserir A -1 4", &d) == 0 && d.x1 == -1);
+
+	// Vazias, comentários e "aplicar"
+	VERIFICAR(interpretarDelta("", &d) == 1);
+	VERIFICAR(interpretarDelta("   \n", &d) == 1);
+	VERIFICAR(interpretarDelta("# inserir A 1 1", &d) == 1);
+	VERIFICAR(interpretarDelta("aplicar\n", &d) == 3);
+	VERIFICAR(interpretarDelta("  aplicar  ", &d) == 3);
+
+	// Rejeitadas: comando desconhecido, frequência fora de A-Z, argumentos em falta, a mais ou não numéricos
+	const char* invalidas[] = {
+		"inserirr A 1 1", "Inserir A 1 1", "aplicar agora", "inserir a 1 1", "inserir 1 1 1", "inserir A 1",
+		"inserir A 1 1 1", "mover A 1 2 3", "ligar A 1 2 3 4 5", "desligar A x 2 3 4", "remover A 1 1;",
+		"inserir", "mover A 1 2 3 4 #",
+	};
+	int aceites = 0;
+	for (size_t i = 0; i < sizeof(invalidas) / sizeof(invalidas[0]); i++) {
+		if (interpretarDelta(invalidas[i], &d) != 2) aceites++;
+	}
+	VERIFICAR(aceites == 0);
+	VERIFICAR(interpretarDelta(NULL, &d) == 2 && interpretarDelta("inserir A 1 1", NULL) == 2);
+
+	// Cada alteração escrita é lida de volta igual
+	uint64_t estado = 5;
+	FILE* fp = tmpfile();
+	VERIFICAR(fp != NULL);
+	if (fp == NULL) TERMINAR_TESTES();
+	DELTA escritas[50];
+	for (int i = 0; i < 50; i++) {
+		escritas[i] = deltaAleatorio(&estado);
+		if (escritas[i].tipo == DELTA_INSERIR || escritas[i].tipo == DELTA_REMOVER) escritas[i].x2 = escritas[i].y2 = -1;
+		VERIFICAR(escreverDelta(fp, &escritas[i]) == 0);
+	}
+	rewind(fp);
+	char linha[64];
+	int diferentes = 0;
+	for (int i = 0; i < 50; i++) {
+		if (fgets(linha, sizeof(linha), fp) == NULL || interpretarDelta(linha, &d) != 0) diferentes++;
+		else if (d.tipo != escritas[i].tipo || d.frequencia != escritas[i].frequencia || d.x1 != escritas[i].x1 ||
+			d.y1 != escritas[i].y1 || d.x2 != escritas[i].x2 || d.y2 != escritas[i].y2) diferentes++;
+	}
+	VERIFICAR(diferentes == 0);
+	fclose(fp);
+	VERIFICAR(escreverDelta(NULL, &d) == 1 && escreverDelta(stdout, NULL) == 1);
+
+	// Um ficheiro com "aplicar", linhas inválidas e uma linha demasiado longa (que é descartada inteira);
+	// com lotes de 4, o primeiro é fechado pelo "aplicar" e o segundo pelo fim do ficheiro
+	fp = tmpfile();
+	VERIFICAR(fp != NULL);
+	if (fp == NULL) TERMINAR_TESTES();
+	fputs("# mapa\ninserir A 1 1\ninserir A 1 5\nligar A 1 1 1 5\naplicar\n", fp);
+	fputs("inserir A 1 1\nremover B 0 0\nnada A 1 1\n\n", fp);
+	for (int i = 0; i < 300; i++) fputc(' ', fp);
+	fputs("inserir A 3 3\nmover A 1 5 4 5\ninserir B 2 2", fp);
+	rewind(fp);
+	REDE* rede = criarRede();
+	RESULTADO_DELTAS resultado = { 0 };
+	VERIFICAR(processarDeltas(rede, fp, 4, &resultado) == 0);
+	fclose(fp);
+	VERIFICAR(resultado.linhas == 12 && resultado.invalidas == 2);
+	VERIFICAR(resultado.aplicadas == 5 && resultado.rejeitadas == 2);
+	VERIFICAR(resultado.lotes == 2);
+	GRAFO* a = encontrarGrafoPorFrequencia(rede, 'A');
+	VERIFICAR(a != NULL && a->numVertices == 2 && existeConexaoEntreVertices(a, 1, 1, 4, 5));
+	VERIFICAR(encontrarVertice(encontrarGrafoPorFrequencia(rede, 'B'), 2, 2) != NULL);
+	VERIFICAR(processarDeltas(NULL, stdin, 1, NULL) == 1 && processarDeltas(rede, NULL, 1, NULL) == 1);
+	VERIFICAR(carregarDeltas(rede, "teste_delta_inexistente.txt", 0, NULL) == -1);
+	VERIFICAR(aplicarLoteDeltas(NULL, &d, 1, NULL) == 1 && aplicarLoteDeltas(rede, NULL, 1, NULL) == 1);
+	destruirRede(rede);
+
+	// As mesmas alterações aplicadas em lotes e uma a uma dão a mesma rede, com os antinodos ativos
+	REDE* lotes = criarRede();
+	REDE* individual = criarRede();
+	for (char f = 'A'; f <= 'C'; f++) {
+		ativarAntinodos(criarGrafo(lotes, f));
+		ativarAntinodos(criarGrafo(individual, f));
+	}
+	static DELTA alteracoes[NUM_ALTERACOES_TESTE];
+	for (int i = 0; i < NUM_ALTERACOES_TESTE; i++) alteracoes[i] = deltaAleatorio(&estado);
+
+	RESULTADO_DELTAS rLotes = { 0 }, rIndividual = { 0 };
+	int tamanhos[] = { 1, 2, 7, 64, 256, 1000 };
+	int aplicadas = 0, verificacoes = 0;
+	while (aplicadas < NUM_ALTERACOES_TESTE) {
+		int num = tamanhos[verificacoes++ % 6];
+		if (num > NUM_ALTERACOES_TESTE - aplicadas) num = NUM_ALTERACOES_TESTE - aplicadas;
+		unsigned long long epoca = lotes->epoca;
+		VERIFICAR(aplicarLoteDeltas(lotes, &alteracoes[aplicadas], num, &rLotes) == 0);
+		// O lote avança a época uma só vez e todos os grafos alterados ficam com ela
+		VERIFICAR(lotes->epoca == epoca + 1 && !lotes->emLote);
+		for (int i = aplicadas; i < aplicadas + num; i++) {
+			VERIFICAR(aplicarLoteDeltas(individual, &alteracoes[i], 1, &rIndividual) == 0);
+		}
+		aplicadas += num;
+		VERIFICAR(diferencasRede(lotes, individual) == 0 && diferencasRede(individual, lotes) == 0);
+	}
+	VERIFICAR(rLotes.aplicadas == rIndividual.aplicadas && rLotes.rejeitadas == rIndividual.rejeitadas);
+	VERIFICAR(rLotes.aplicadas > 0 && rLotes.rejeitadas > 0);
+	VERIFICAR(rIndividual.lotes == NUM_ALTERACOES_TESTE && rLotes.lotes == verificacoes);
+
+	// Os antinodos continuam ativos depois dos lotes (refeitos no fim nos grafos com muitas alterações)
+	for (GRAFO* g = lotes->listaGrafos; g != NULL; g = g->prox) {
+		VERIFICAR(g->antinodos != NULL);
+	}
+
+	// Só os grafos alterados no lote recebem a nova época
+	GRAFO* b = encontrarGrafoPorFrequencia(lotes, 'B');
+	unsigned long long epocaB = b->epoca;
+	DELTA soA[] = { { DELTA_INSERIR, 'A', 19, 19, -1, -1 }, { DELTA_REMOVER, 'A', 19, 19, -1, -1 } };
+	VERIFICAR(aplicarLoteDeltas(lotes, soA, 2, NULL) == 0);
+	VERIFICAR(encontrarGrafoPorFrequencia(lotes, 'A')->epoca == lotes->epoca && b->epoca == epocaB);
+
+	// As inserções de um lote usam um só bloco reservado no grafo
+	DELTA novas[40];
+	for (int i = 0; i < 40; i++) {
+		DELTA nova = { DELTA_INSERIR, 'D', i / MAX_DIM, i % MAX_DIM, -1, -1 };
+		novas[i] = nova;
+	}
+	VERIFICAR(aplicarLoteDeltas(lotes, novas, 40, NULL) == 0);
+	GRAFO* g = encontrarGrafoPorFrequencia(lotes, 'D');
+	VERIFICAR(g != NULL && g->numVertices == 40);
+	VERIFICAR(g->reserva != NULL && g->reserva->blocos != NULL && g->reserva->blocos->numVertices == 40);
+	VERIFICAR(g->reserva->numVerticesLivres == 0);
+
+	destruirRede(lotes);
+	destruirRede(individual);
+	TERMINAR_TESTES();
+}
@@ -0,0 +1,260 @@
+/**
+ * @file teste_densidade.c
+ * @brief Testes das tabelas de somas: retângulos (incluindo os que saem da cidade) e zonas mais densas
+ *        comparados com a contagem célula a célula, nos dois tipos de densidade, reconstrução depois
+ *        de uma alteração à rede, mapa de calor de regiões (com e sem redução) e escrita em CSV.
+ *
+ * @author Rogério Picas
+ * @date 18-10-2026
+ * @version 1.0
+ */
+#include <stdio.h>
+#include <string.h>
+#include "testes.h"
+#include "densidade.h"
+#include "antinodos.h"
+#include "grelha.h"
+#include "gerador.h"
+
+ /** @def TEXTO_TESTE
+  *  @brief Ficheiro usado para verificar a falha de escrita do mapa de calor.
+  */
+#define TEXTO_TESTE "teste_densidade_tmp.txt"
+
+/**
+ * @brief Contagem de cada célula da cidade para uma frequência (ou todas), sem a tabela.
+ */
+static void contarCelulas(REDE* rede, char frequencia, TIPO_DENSIDADE tipo, long long contagens[MAX_DIM][MAX_DIM]) {
+	memset(contagens, 0, sizeof(long long) * MAX_DIM * MAX_DIM);
+	for (GRAFO* g = rede->listaGrafos; g != NULL; g = g->prox) {
+		if (frequencia != DENSIDADE_TODAS && g->frequencia != frequencia) continue;
+		for (int x = 0; x < MAX_DIM; x++) {
+			for (int y = 0; y < MAX_DIM; y++) {
+				contagens[x][y] += tipo == DENSIDADE_ANTENAS ? encontrarVertice(g, x, y) != NULL : contagemAntinodo(g, x, y);
+			}
+		}
+	}
+}
+
+/**
+ * @brief Soma das contagens de um retângulo, ignorando a parte fora da cidade.
+ */
+static long long somarRetangulo(long long contagens[MAX_DIM][MAX_DIM], int x0, int y0, int x1, int y1) {
+	long long total = 0;
+	for (int x = x0 < 0 ? 0 : x0; x <= x1 && x < MAX_DIM; x++) {
+		for (int y = y0 < 0 ? 0 : y0; y <= y1 && y < MAX_DIM; y++) {
+			total += contagens[x][y];
+		}
+	}
+	return total;
+}
+
+/**
+ * @brief Mapa de calor esperado de uma região, calculado com as contagens célula a célula.
+ * @return Número de caracteres escritos em @p mapa (as linhas terminam em '\n').
+ */
+static size_t mapaCalorEsperado(long long contagens[MAX_DIM][MAX_DIM], int x0, int y0, int linhas, int colunas, int escala, char* mapa) {
+	static const char niveis[] = ":-=+*#%@";
+	// A região começa dentro da cidade e só depois é limitada ao fim
+	if (x0 < 0) x0 = 0;
+	if (y0 < 0) y0 = 0;
+	int x1 = x0 + linhas > MAX_DIM ? MAX_DIM : x0 + linhas;
+	int y1 = y0 + colunas > MAX_DIM ? MAX_DIM : y0 + colunas;
+
+	long long maximo = 0;
+	for (int x = x0; x < x1; x += escala) {
+		for (int y = y0; y < y1; y += escala) {
+			long long total = somarRetangulo(contagens, x, y, (x + escala > x1 ? x1 : x + escala) - 1, (y + escala > y1 ? y1 : y + escala) - 1);
+			if (total > maximo) maximo = total;
+		}
+	}
+	size_t n = 0;
+	for (int x = x0; x < x1; x += escala) {
+		for (int y = y0; y < y1; y += escala) {
+			long long total = somarRetangulo(contagens, x, y, (x + escala > x1 ? x1 : x + escala) - 1, (y + escala > y1 ? y1 : y + escala) - 1);
+			mapa[n++] = total > 0 ? niveis[(total * 8 - 1) / maximo] : CELULA_LIVRE;
+		}
+		mapa[n++] = '\n';
+	}
+	return n;
+}
+
+/**
+ * @brief Compara os retângulos e as zonas mais densas de uma tabela com a contagem célula a célula.
+ */
+static void verificarTabela(const TABELA_SOMAS* tabela, REDE* rede, char frequencia, TIPO_DENSIDADE tipo, uint64_t* estado) {
+	static long long contagens[MAX_DIM][MAX_DIM];
+	contarCelulas(rede, frequencia, tipo, contagens);
+	VERIFICAR(tabela->total == somarRetangulo(contagens, 0, 0, MAX_DIM - 1, MAX_DIM - 1));
+
+	int erradas = 0;
+	for (int q = 0; q < 200; q++) {
+		int x0 = (int)(proximoAleatorio(estado) % (MAX_DIM + 4)) - 2;
+		int y0 = (int)(proximoAleatorio(estado) % (MAX_DIM + 4)) - 2;
+		int x1 = x0 + (int)(proximoAleatorio(estado) % 10);
+		int y1 = y0 + (int)(proximoAleatorio(estado) % 10);
+		if (contarRetangulo(tabela, x0, y0, x1, y1) != somarRetangulo(contagens, x0, y0, x1, y1)) erradas++;
+	}
+	VERIFICAR(erradas == 0);
+
+	// A zona mais densa é a primeira (por linha e depois por coluna) com o maior total
+	erradas = 0;
+	for (int linhas = 1; linhas <= MAX_DIM; linhas += 3) {
+		for (int colunas = 1; colunas <= MAX_DIM; colunas += 4) {
+			long long melhor = -1;
+			int mx = 0, my = 0;
+			for (int i = 0; i + linhas <= MAX_DIM; i++) {
+				for (int j = 0; j + colunas <= MAX_DIM; j++) {
+					long long total = somarRetangulo(contagens, i, j, i + linhas - 1, j + colunas - 1);
+					if (total > melhor)
+					{
+						melhor = total;
+						mx = i;
+						my = j;
+					}
+				}
+			}
+			int x, y;
+			if (zonaMaisDensa(tabela, linhas, colunas, &x, &y, 2) != melhor || x != mx || y != my) erradas++;
+		}
+	}
+	VERIFICAR(erradas == 0);
+}
+
+int main() {
+	INICIAR_TESTES();
+
+	VERIFICAR(criarMapaDensidade(NULL, DENSIDADE_ANTENAS, 1) == NULL);
+	VERIFICAR(contarRetangulo(NULL, 0, 0, 1, 1) == -1);
+
+	// Redes aleatórias com as antenas de cada frequência agrupadas (para haver antinodos e zonas densas)
+	uint64_t estado = 31;
+	for (int iteracao = 0; iteracao < 20; iteracao++) {
+		REDE* rede = criarRede();
+		int numFrequencias = 1 + (int)(proximoAleatorio(&estado) % 3);
+		for (int f = 0; f < numFrequencias; f++) {
+			GRAFO* grafo = criarGrafo(rede, (char)('A' + f));
+			int n = (int)(proximoAleatorio(&estado) % 8);
+			int bx = (int)(proximoAleatorio(&estado) % MAX_DIM), by = (int)(proximoAleatorio(&estado) % MAX_DIM);
+			for (int i = 0; i < n; i++) {
+				inserirAntenaGrafo(grafo, (char)('A' + f), (bx + (int)(proximoAleatorio(&estado) % 6)) % MAX_DIM,
+					(by + (int)(proximoAleatorio(&estado) % 6)) % MAX_DIM);
+			}
+		}
+
+		for (int tipo = DENSIDADE_ANTENAS; tipo <= DENSIDADE_ANTINODOS; tipo++) {
+			MAPA_DENSIDADE* mapa = criarMapaDensidade(rede, (TIPO_DENSIDADE)tipo, 2);
+			VERIFICAR(mapa != NULL && mapa->tabelas[(unsigned char)DENSIDADE_TODAS] != NULL);
+			if (mapa == NULL) continue;
+			VERIFICAR(mapa->tabelas['A'] == NULL);
+			for (int f = -1; f < numFrequencias; f++) {
+				char frequencia = f < 0 ? DENSIDADE_TODAS : (char)('A' + f);
+				TABELA_SOMAS* tabela = procurarTabelaSomas(mapa, frequencia);
+				VERIFICAR(tabela != NULL);
+				if (tabela != NULL) verificarTabela(tabela, rede, frequencia, (TIPO_DENSIDADE)tipo, &estado);
+			}
+			VERIFICAR(procurarTabelaSomas(mapa, 'Z') == NULL);
+			destruirMapaDensidade(mapa);
+		}
+		destruirRede(rede);
+	}
+
+	// Uma tabela pedida depois de uma alteração à rede é reconstruída; sem alterações é reutilizada
+	REDE* rede = criarRede();
+	GRAFO* grafo = criarGrafo(rede, 'D');
+	VERIFICAR(inserirAntenaGrafo(grafo, 'D', 2, 2) == 0);
+	VERIFICAR(inserirAntenaGrafo(grafo, 'D', 6, 6) == 0);
+	MAPA_DENSIDADE* mapa = criarMapaDensidade(rede, DENSIDADE_ANTINODOS, 1);
+	TABELA_SOMAS* tabela = procurarTabelaSomas(mapa, 'D');
+	VERIFICAR(tabela != NULL && tabela->total == 1);
+	VERIFICAR(contarRetangulo(tabela, 10, 10, 10, 10) == 1);
+	VERIFICAR(procurarTabelaSomas(mapa, 'D') == tabela);
+
+	VERIFICAR(inserirAntenaGrafo(grafo, 'D', 4, 4) == 0);
+	tabela = procurarTabelaSomas(mapa, 'D');
+	VERIFICAR(tabela != NULL && tabela->epoca == rede->epoca);
+	if (tabela != NULL) verificarTabela(tabela, rede, 'D', DENSIDADE_ANTINODOS, &estado);
+	TABELA_SOMAS* total = procurarTabelaSomas(mapa, DENSIDADE_TODAS);
+	VERIFICAR(total != NULL && tabela != NULL && total->total == tabela->total);
+
+	// Sem antenas a tabela fica vazia e a zona mais densa é a primeira, com 0
+	VERIFICAR(removerAntenaGrafo(grafo, 2, 2) == 0);
+	VERIFICAR(removerAntenaGrafo(grafo, 4, 4) == 0);
+	VERIFICAR(removerAntenaGrafo(grafo, 6, 6) == 0);
+	tabela = procurarTabelaSomas(mapa, 'D');
+	int x = -1, y = -1;
+	VERIFICAR(tabela != NULL && tabela->total == 0 && tabela->linhas == 0);
+	VERIFICAR(zonaMaisDensa(tabela, 3, 3, &x, &y, 1) == 0 && x == 0 && y == 0);
+	VERIFICAR(zonaMaisDensa(tabela, 0, 3, &x, &y, 1) == -1);
+	destruirMapaDensidade(mapa);
+
+	// O mapa de calor em CSV tem uma linha por cada faixa de escala linhas da cidade e a soma das zonas é o total
+	for (int i = 0; i < 30; i++) {
+		inserirAntenaGrafo(grafo, 'D', (int)(proximoAleatorio(&estado) % MAX_DIM), (int)(proximoAleatorio(&estado) % MAX_DIM));
+	}
+	mapa = criarMapaDensidade(rede, DENSIDADE_ANTENAS, 1);
+	tabela = procurarTabelaSomas(mapa, DENSIDADE_TODAS);
+	FILE* fp = tmpfile();
+	VERIFICAR(fp != NULL && tabela != NULL);
+	if (fp != NULL && tabela != NULL)
+	{
+		VERIFICAR(escreverMapaCalor(tabela, fp, 5) == 0);
+		rewind(fp);
+		long long soma = 0, valor;
+		int linhas = 0, c;
+		while (fscanf(fp, "%lld", &valor) == 1) {
+			soma += valor;
+			c = fgetc(fp);
+			if (c == '\n') linhas++;
+		}
+		VERIFICAR(soma == tabela->total && tabela->total == grafo->numVertices);
+		VERIFICAR(linhas == (MAX_DIM + 4) / 5);
+		VERIFICAR(escreverMapaCalor(tabela, fp, 0) == 1);
+		fclose(fp);
+	}
+
+	// O mapa de calor de cada região é escrito no ficheiro, igual ao calculado célula a célula
+	static long long contagens[MAX_DIM][MAX_DIM];
+	static char esperado[MAX_DIM * (MAX_DIM + 1)];
+	static char escrito[MAX_DIM * (MAX_DIM + 1) + 1];
+	contarCelulas(rede, DENSIDADE_TODAS, DENSIDADE_ANTENAS, contagens);
+	int regioes[][5] = { { 0, 0, MAX_DIM, MAX_DIM, 1 }, { 0, 0, MAX_DIM, MAX_DIM, 3 }, { 3, 5, 7, 9, 2 },
+		{ -4, -2, 10, 10, 4 }, { MAX_DIM - 3, MAX_DIM - 6, 10, 10, 1 }, { 5, 5, 1, 1, 7 } };
+	int mapasErrados = 0;
+	for (int r = 0; r < 6 && tabela != NULL; r++) {
+		fp = tmpfile();
+		if (fp == NULL || mostrarMapaCalor(tabela, fp, regioes[r][0], regioes[r][1], regioes[r][2], regioes[r][3], regioes[r][4]) != 0)
+		{
+			mapasErrados++;
+			if (fp != NULL) fclose(fp);
+			continue;
+		}
+		size_t n = mapaCalorEsperado(contagens, regioes[r][0], regioes[r][1], regioes[r][2], regioes[r][3], regioes[r][4], esperado);
+		rewind(fp);
+		size_t lidos = fread(escrito, 1, sizeof(escrito), fp);
+		if (lidos != n || memcmp(escrito, esperado, n) != 0) mapasErrados++;
+		fclose(fp);
+	}
+	VERIFICAR(mapasErrados == 0);
+
+	// Argumentos inválidos e falha da escrita (ficheiro aberto só para leitura)
+	VERIFICAR(mostrarMapaCalor(tabela, NULL, 0, 0, 5, 5, 1) == 1);
+	VERIFICAR(mostrarMapaCalor(NULL, stdout, 0, 0, 5, 5, 1) == 1);
+	VERIFICAR(mostrarMapaCalor(tabela, stdout, 0, 0, 0, 5, 1) == 1);
+	VERIFICAR(mostrarMapaCalor(tabela, stdout, MAX_DIM, 0, 5, 5, 1) == 1);
+	fp = fopen(TEXTO_TESTE, "w");
+	if (fp != NULL) fclose(fp);
+	fp = fopen(TEXTO_TESTE, "r");
+	VERIFICAR(fp != NULL);
+	if (fp != NULL)
+	{
+		VERIFICAR(mostrarMapaCalor(tabela, fp, 0, 0, 5, 5, 1) == 2);
+		fclose(fp);
+	}
+	remove(TEXTO_TESTE);
+
+	destruirMapaDensidade(mapa);
+	destruirRede(rede);
+
+	TERMINAR_TESTES();
+}
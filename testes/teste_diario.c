@@ -0,0 +1,264 @@
+/**
+ * @file teste_diario.c
+ * @brief Testes do diário de alterações: reprodução numa rede nova, compactação manual e automática,
+ *        última linha interrompida, compactação interrompida antes e depois da troca do estado e
+ *        alterações rejeitadas (que não são registadas).
+ *
+ * Os ficheiros são criados na pasta de trabalho do teste e apagados no fim.
+ *
+ * @author Rogério Picas
+ * @date 18-10-2026
+ * @version 1.0
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include "testes.h"
+#include "diario.h"
+#include "gerador.h"
+
+ /** @def BASE_TESTE
+  *  @brief Nome base dos ficheiros do diário usados no teste.
+  */
+#define BASE_TESTE "teste_diario_tmp"
+
+/**
+ * @brief Apaga os ficheiros do diário do teste.
+ */
+static void apagarFicheiros(void) {
+	remove(BASE_TESTE ".estado");
+	remove(BASE_TESTE ".estado.tmp");
+	remove(BASE_TESTE ".diario");
+}
+
+/**
+ * @brief Conta as antenas e ligações de uma rede que não existem na outra (percorrendo só a primeira).
+ */
+static int diferencasRede(REDE* a, REDE* b) {
+	int diferencas = 0;
+	for (GRAFO* ga = a->listaGrafos; ga != NULL; ga = ga->prox) {
+		if (ga->numVertices == 0) continue;
+		GRAFO* gb = encontrarGrafoPorFrequencia(b, ga->frequencia);
+		if (gb == NULL || gb->numVertices != ga->numVertices)
+		{
+			diferencas++;
+			continue;
+		}
+		for (VERTICE* v = ga->vertices; v != NULL; v = v->prox) {
+			VERTICE* w = encontrarVertice(gb, v->antena.x, v->antena.y);
+			if (w == NULL || w->grau != v->grau)
+			{
+				diferencas++;
+				continue;
+			}
+			for (ARESTA* e = v->adjacentes; e != NULL; e = e->prox) {
+				if (!existeConexao(w->adjacentes, e->destino->antena.x, e->destino->antena.y)) diferencas++;
+			}
+		}
+	}
+	return diferencas;
+}
+
+/**
+ * @brief As duas redes têm as mesmas antenas e ligações.
+ */
+static bool mesmaRede(REDE* a, REDE* b) {
+	return diferencasRede(a, b) == 0 && diferencasRede(b, a) == 0;
+}
+
+/**
+ * @brief Aplica alterações aleatórias numa zona pequena (para haver colisões e rejeições).
+ * @return Número de alterações aceites.
+ */
+static int aplicarAleatorias(DIARIO* diario, REDE* rede, uint64_t* estado, int num) {
+	int aceites = 0;
+	for (int i = 0; i < num; i++) {
+		DELTA d;
+		d.tipo = (TIPO_DELTA)(proximoAleatorio(estado) % 5);
+		d.frequencia = proximoAleatorio(estado) % 2 ? 'A' : 'B';
+		d.x1 = (int)(proximoAleatorio(estado) % 6);
+		d.y1 = (int)(proximoAleatorio(estado) % 6);
+		d.x2 = (int)(proximoAleatorio(estado) % 6);
+		d.y2 = (int)(proximoAleatorio(estado) % 6);
+		// Mais inserções e ligações do que remoções, para a rede crescer
+		if (i % 3 == 0) d.tipo = DELTA_INSERIR;
+		else if (i % 3 == 1 && d.tipo != DELTA_MOVER) d.tipo = DELTA_LIGAR;
+
+		int erro = aplicarDiario(diario, rede, &d);
+		VERIFICAR(erro == 0 || erro == 2);
+		if (erro == 0) aceites++;
+	}
+	return aceites;
+}
+
+/**
+ * @brief Lê um ficheiro inteiro para memória (terminado em '\0').
+ * @return Conteúdo alocado, ou NULL se o ficheiro não puder ser lido.
+ */
+static char* lerFicheiro(const char* nome) {
+	FILE* fp = fopen(nome, "rb");
+	if (fp == NULL) return NULL;
+	size_t capacidade = 4096, tamanho = 0;
+	char* conteudo = (char*)malloc(capacidade);
+	size_t lidos;
+	while (conteudo != NULL && (lidos = fread(conteudo + tamanho, 1, capacidade - tamanho - 1, fp)) > 0) {
+		tamanho += lidos;
+		if (tamanho + 1 == capacidade)
+		{
+			char* maior = (char*)realloc(conteudo, capacidade * 2);
+			if (maior == NULL)
+			{
+				free(conteudo);
+				conteudo = NULL;
+				break;
+			}
+			conteudo = maior;
+			capacidade *= 2;
+		}
+	}
+	if (conteudo != NULL) conteudo[tamanho] = '\0';
+	fclose(fp);
+	return conteudo;
+}
+
+/**
+ * @brief Escreve um texto num ficheiro, substituindo o conteúdo.
+ */
+static void escreverFicheiro(const char* nome, const char* conteudo) {
+	FILE* fp = fopen(nome, "wb");
+	VERIFICAR(fp != NULL);
+	if (fp == NULL) return;
+	fputs(conteudo, fp);
+	fclose(fp);
+}
+
+int main() {
+	INICIAR_TESTES();
+	apagarFicheiros();
+
+	// Diário novo: nada a reproduzir
+	REDE* original = criarRede();
+	RESULTADO_DELTAS resultado = { 0 };
+	DIARIO* diario = abrirDiario(original, BASE_TESTE, 0, &resultado);
+	VERIFICAR(diario != NULL);
+	if (diario == NULL)
+	{
+		destruirRede(original);
+		TERMINAR_TESTES();
+	}
+	VERIFICAR(diario->registos == 0 && resultado.aplicadas == 0);
+	VERIFICAR(abrirDiario(NULL, BASE_TESTE, 0, NULL) == NULL);
+	VERIFICAR(aplicarDiario(NULL, original, NULL) == 1);
+	VERIFICAR(registarDiario(diario, NULL) == 1);
+
+	// Só as alterações aceites são registadas
+	uint64_t estado = 2024;
+	int aceites = aplicarAleatorias(diario, original, &estado, 300);
+	VERIFICAR(aceites > 0 && aceites < 300);
+	VERIFICAR(diario->registos == aceites);
+	DELTA invalida = { DELTA_LIGAR, 'Z', 0, 0, 1, 1 };
+	VERIFICAR(aplicarDiario(diario, original, &invalida) == 2);
+	VERIFICAR(diario->registos == aceites);
+	long long geracao = diario->geracao;
+	diario = fecharDiario(diario);
+
+	// Reproduzir numa rede nova dá a mesma rede
+	REDE* reproduzida = criarRede();
+	RESULTADO_DELTAS reproducao = { 0 };
+	diario = abrirDiario(reproduzida, BASE_TESTE, 0, &reproducao);
+	VERIFICAR(diario != NULL);
+	VERIFICAR(reproducao.aplicadas == aceites && reproducao.rejeitadas == 0 && reproducao.invalidas == 0);
+	VERIFICAR(mesmaRede(original, reproduzida));
+
+	// A compactação escreve o estado numa nova geração e recomeça o diário
+	VERIFICAR(compactarDiario(diario, reproduzida) == 0);
+	VERIFICAR(diario->geracao == geracao + 1 && diario->registos == 0);
+	int mais = aplicarAleatorias(diario, reproduzida, &estado, 60);
+	VERIFICAR(diario->registos == mais);
+	diario = fecharDiario(diario);
+
+	REDE* compactada = criarRede();
+	diario = abrirDiario(compactada, BASE_TESTE, 0, NULL);
+	VERIFICAR(diario != NULL);
+	VERIFICAR(diario->geracao == geracao + 1 && diario->registos == mais);
+	VERIFICAR(mesmaRede(reproduzida, compactada));
+	diario = fecharDiario(diario);
+
+	// Com limite, a compactação é feita automaticamente ao chegar a esse número de alterações
+	REDE* automatica = criarRede();
+	diario = abrirDiario(automatica, BASE_TESTE, 5, NULL);
+	VERIFICAR(diario != NULL);
+	geracao = diario->geracao;
+	int novas = 0;
+	while (novas < 12) novas += aplicarAleatorias(diario, automatica, &estado, 1);
+	VERIFICAR(diario->geracao > geracao);
+	VERIFICAR(diario->registos < 5);
+	diario = fecharDiario(diario);
+
+	REDE* depoisAutomatica = criarRede();
+	diario = abrirDiario(depoisAutomatica, BASE_TESTE, 0, NULL);
+	VERIFICAR(diario != NULL);
+	VERIFICAR(mesmaRede(automatica, depoisAutomatica));
+	if (diario) geracao = diario->geracao;
+	diario = fecharDiario(diario);
+
+	// Uma última linha sem '\n' (escrita interrompida) é ignorada e o estado é compactado no arranque
+	FILE* fp = fopen(BASE_TESTE ".diario", "a");
+	VERIFICAR(fp != NULL);
+	if (fp)
+	{
+		fputs("inserir A 19", fp);
+		fclose(fp);
+	}
+	REDE* cortada = criarRede();
+	diario = abrirDiario(cortada, BASE_TESTE, 0, NULL);
+	VERIFICAR(diario != NULL);
+	if (diario) VERIFICAR(diario->geracao == geracao + 1 && diario->registos == 0);
+	VERIFICAR(mesmaRede(automatica, cortada));
+	diario = fecharDiario(diario);
+
+	// Compactação interrompida depois de trocar o estado e antes de recomeçar o diário: o diário
+	// antigo (de uma geração já incluída no estado) não é reproduzido outra vez
+	REDE* antesTroca = criarRede();
+	diario = abrirDiario(antesTroca, BASE_TESTE, 0, NULL);
+	VERIFICAR(diario != NULL);
+	char* diarioAntigo = NULL;
+	if (diario)
+	{
+		aplicarAleatorias(diario, antesTroca, &estado, 40);
+		diarioAntigo = lerFicheiro(BASE_TESTE ".diario");
+		VERIFICAR(diarioAntigo != NULL && compactarDiario(diario, antesTroca) == 0);
+		geracao = diario->geracao;
+	}
+	diario = fecharDiario(diario);
+	if (diarioAntigo) escreverFicheiro(BASE_TESTE ".diario", diarioAntigo);
+	free(diarioAntigo);
+	REDE* depoisTroca = criarRede();
+	RESULTADO_DELTAS semDiario = { 0 };
+	diario = abrirDiario(depoisTroca, BASE_TESTE, 0, &semDiario);
+	VERIFICAR(diario != NULL);
+	if (diario) VERIFICAR(diario->geracao == geracao + 1 && diario->registos == 0);
+	VERIFICAR(semDiario.rejeitadas == 0 && semDiario.invalidas == 0);
+	VERIFICAR(mesmaRede(antesTroca, depoisTroca));
+	diario = fecharDiario(diario);
+
+	// Compactação interrompida antes de trocar o estado: o temporário que ficou é ignorado
+	escreverFicheiro(BASE_TESTE ".estado.tmp", "# geracao 999\ninserir A 1");
+	REDE* comTemporario = criarRede();
+	diario = abrirDiario(comTemporario, BASE_TESTE, 0, NULL);
+	VERIFICAR(diario != NULL);
+	if (diario) VERIFICAR(diario->geracao == geracao + 1);
+	VERIFICAR(mesmaRede(antesTroca, comTemporario));
+	diario = fecharDiario(diario);
+
+	destruirRede(antesTroca);
+	destruirRede(depoisTroca);
+	destruirRede(comTemporario);
+	destruirRede(original);
+	destruirRede(reproduzida);
+	destruirRede(compactada);
+	destruirRede(automatica);
+	destruirRede(depoisAutomatica);
+	destruirRede(cortada);
+	apagarFicheiros();
+	TERMINAR_TESTES();
+}
@@ -0,0 +1,168 @@
+/**
+ * @file teste_espacial.c
+ * @brief Testes do índice espacial: k vizinhos mais próximos (incluindo k maior do que o número de antenas,
+ *        empates e posições fora da cidade) e consultas de retângulos comparados com uma pesquisa linear,
+ *        para vários tamanhos de balde e depois de remoções.
+ *
+ * @author Rogério Picas
+ * @date 18-10-2026
+ * @version 1.0
+ */
+#include <stdlib.h>
+#include "testes.h"
+#include "espacial.h"
+#include "gerador.h"
+
+ /** @def MAX_ANTENAS_TESTE
+  *  @brief Número máximo de antenas da rede de teste (dois cantos de 6 x 6 células, três frequências).
+  */
+#define MAX_ANTENAS_TESTE (2 * 6 * 6 * 3)
+
+/**
+ * @brief Compara dois valores long long (para qsort).
+ */
+static int compararDistancias(const void* a, const void* b) {
+	long long da = *(const long long*)a, db = *(const long long*)b;
+	return (da > db) - (da < db);
+}
+
+/**
+ * @brief Quadrado da distância euclidiana de um vértice a uma posição.
+ */
+static long long distanciaTeste(const VERTICE* v, int x, int y) {
+	long long dx = v->antena.x - x, dy = v->antena.y - y;
+	return dx * dx + dy * dy;
+}
+
+/**
+ * @brief Verifica uma consulta de k vizinhos contra as distâncias de todas as antenas, ordenadas.
+ *
+ * Com empates a ordem das antenas não é única, por isso compara-se a sequência de distâncias.
+ */
+static int vizinhosErrados(REDE* rede, INDICE_ESPACIAL* indice, int x, int y, char freq, int k) {
+	long long distancias[MAX_ANTENAS_TESTE];
+	VERTICE* resultado[MAX_ANTENAS_TESTE + 10];
+	int total = 0;
+	for (GRAFO* g = rede->listaGrafos; g != NULL; g = g->prox) {
+		for (VERTICE* v = g->vertices; v != NULL; v = v->prox) {
+			if (freq == '\0' || v->antena.frequencia == freq) distancias[total++] = distanciaTeste(v, x, y);
+		}
+	}
+	qsort(distancias, (size_t)total, sizeof(long long), compararDistancias);
+
+	int encontrados = kVizinhosMaisProximos(indice, x, y, freq, k, resultado);
+	if (encontrados != (k < total ? k : total)) return 1;
+	for (int i = 0; i < encontrados; i++) {
+		if (freq != '\0' && resultado[i]->antena.frequencia != freq) return 1;
+		if (distanciaTeste(resultado[i], x, y) != distancias[i]) return 1;
+		for (int j = 0; j < i; j++) {
+			if (resultado[j] == resultado[i]) return 1;
+		}
+	}
+	VERTICE* maisProximo = vizinhoMaisProximo(indice, x, y, freq);
+	if (total == 0) return maisProximo != NULL;
+	return maisProximo == NULL || distanciaTeste(maisProximo, x, y) != distancias[0];
+}
+
+/**
+ * @brief Verifica uma consulta de retângulo contra a pesquisa linear, com e sem resultado truncado.
+ */
+static int retanguloErrado(REDE* rede, INDICE_ESPACIAL* indice, int x0, int y0, int x1, int y1, char freq) {
+	VERTICE* resultado[MAX_ANTENAS_TESTE];
+	int total = 0;
+	for (GRAFO* g = rede->listaGrafos; g != NULL; g = g->prox) {
+		for (VERTICE* v = g->vertices; v != NULL; v = v->prox) {
+			if (freq != '\0' && v->antena.frequencia != freq) continue;
+			if (v->antena.x >= x0 && v->antena.x <= x1 && v->antena.y >= y0 && v->antena.y <= y1) total++;
+		}
+	}
+
+	if (consultarRetangulo(indice, x0, y0, x1, y1, freq, resultado, MAX_ANTENAS_TESTE) != total) return 1;
+	for (int i = 0; i < total; i++) {
+		ANTENAS* a = &resultado[i]->antena;
+		if (freq != '\0' && a->frequencia != freq) return 1;
+		if (a->x < x0 || a->x > x1 || a->y < y0 || a->y > y1) return 1;
+		for (int j = 0; j < i; j++) {
+			if (resultado[j] == resultado[i]) return 1;
+		}
+	}
+	if (consultarRetangulo(indice, x0, y0, x1, y1, freq, NULL, 0) != total) return 1;
+	return consultarRetangulo(indice, x0, y0, x1, y1, freq, resultado, 1) != total;
+}
+
+/**
+ * @brief Faz consultas aleatórias ao índice e conta as que não correspondem à pesquisa linear.
+ */
+static int consultasErradas(REDE* rede, INDICE_ESPACIAL* indice, uint64_t* estado) {
+	int erradas = 0;
+	char frequencias[] = { '\0', 'A', 'B', 'C', 'Z' };
+	for (int q = 0; q < 300; q++) {
+		// Posições até 5 células fora da cidade
+		int x = (int)(proximoAleatorio(estado) % (MAX_DIM + 10)) - 5;
+		int y = (int)(proximoAleatorio(estado) % (MAX_DIM + 10)) - 5;
+		char freq = frequencias[proximoAleatorio(estado) % 5];
+		int k = 1 + (int)(proximoAleatorio(estado) % 12);
+		if (q % 10 == 0) k = MAX_ANTENAS_TESTE + 10;
+		erradas += vizinhosErrados(rede, indice, x, y, freq, k);
+
+		int x1 = x + (int)(proximoAleatorio(estado) % 12);
+		int y1 = y + (int)(proximoAleatorio(estado) % 12);
+		erradas += retanguloErrado(rede, indice, x, y, x1, y1, freq);
+	}
+	return erradas;
+}
+
+int main() {
+	INICIAR_TESTES();
+
+	// Antenas agrupadas em dois cantos, para haver baldes vazios entre elas e muitos empates
+	REDE* rede = criarRede();
+	uint64_t estado = 77;
+	for (int i = 0; i < 300; i++) {
+		char freq = (char)('A' + proximoAleatorio(&estado) % 3);
+		int canto = i % 2 ? MAX_DIM - 6 : 0;
+		int x = canto + (int)(proximoAleatorio(&estado) % 6), y = canto + (int)(proximoAleatorio(&estado) % 6);
+		inserirAntenaGrafo(criarGrafo(rede, freq), freq, x, y);
+	}
+
+	// O índice mantido pela rede e índices construídos com outros tamanhos de balde
+	VERIFICAR(consultasErradas(rede, rede->indice, &estado) == 0);
+	int lados[] = { 1, 3, 7, 0 };
+	for (int i = 0; i < 4; i++) {
+		INDICE_ESPACIAL* indice = construirIndiceEspacial(rede, lados[i]);
+		VERIFICAR(indice != NULL);
+		if (indice == NULL) continue;
+		VERIFICAR(indice->numVertices == rede->indice->numVertices);
+		VERIFICAR(consultasErradas(rede, indice, &estado) == 0);
+		indice = destruirIndiceEspacial(indice);
+	}
+
+	// Depois de remover metade das antenas de um grafo, as consultas continuam a corresponder
+	GRAFO* grafo = encontrarGrafoPorFrequencia(rede, 'B');
+	int remover = grafo->numVertices / 2;
+	for (int i = 0; i < remover; i++) {
+		VERIFICAR(removerAntenaGrafo(grafo, grafo->vertices->antena.x, grafo->vertices->antena.y) == 0);
+	}
+	VERIFICAR(consultasErradas(rede, rede->indice, &estado) == 0);
+
+	// Procura exata por posição e grafo
+	VERTICE* v = grafo->vertices;
+	VERIFICAR(procurarIndiceEspacial(rede->indice, grafo, v->antena.x, v->antena.y, 'B') == v);
+	VERIFICAR(procurarIndiceEspacial(rede->indice, grafo, v->antena.x, v->antena.y, 'A') == NULL);
+	VERIFICAR(procurarIndiceEspacial(rede->indice, grafo, -1, 0, '\0') == NULL);
+
+	// Um índice vazio e argumentos inválidos
+	INDICE_ESPACIAL* vazio = criarIndiceEspacial(4);
+	VERTICE* resultado[4];
+	VERIFICAR(kVizinhosMaisProximos(vazio, 3, 3, '\0', 4, resultado) == 0);
+	VERIFICAR(vizinhoMaisProximo(vazio, 3, 3, '\0') == NULL);
+	VERIFICAR(consultarRetangulo(vazio, 0, 0, MAX_DIM - 1, MAX_DIM - 1, '\0', resultado, 4) == 0);
+	VERIFICAR(kVizinhosMaisProximos(vazio, 3, 3, '\0', 0, resultado) == -1);
+	VERIFICAR(kVizinhosMaisProximos(NULL, 3, 3, '\0', 1, resultado) == -1);
+	VERIFICAR(consultarRetangulo(NULL, 0, 0, 1, 1, '\0', NULL, 0) == -1);
+	VERIFICAR(removerIndiceEspacial(vazio, v) == 1);
+	vazio = destruirIndiceEspacial(vazio);
+
+	destruirRede(rede);
+	TERMINAR_TESTES();
+}
@@ -0,0 +1,102 @@
+/**
+ * @file teste_estatisticas.c
+ * @brief Testes da instrumentação: contagem de chamadas (só as concluídas), contadores das travessias,
+ *        reinício, temporizadores desligados e exportação em JSON e no formato do Prometheus.
+ *
+ * Sem PA_ESTATISTICAS só é verificado o texto escrito pelas exportações.
+ *
+ * @author Rogério Picas
+ * @date 18-10-2026
+ * @version 1.0
+ */
+#include <stdio.h>
+#include <string.h>
+#include "testes.h"
+#include "estatisticas.h"
+
+/**
+ * @brief Escreve uma exportação num ficheiro temporário e copia o texto para @p texto.
+ * @return Valor devolvido pela exportação, ou -1 se o ficheiro temporário falhar.
+ */
+static int exportarTexto(REDE* rede, int (*exportar)(REDE*, FILE*), char* texto, size_t max) {
+	FILE* fp = tmpfile();
+	if (fp == NULL) return -1;
+	int erro = exportar(rede, fp);
+	rewind(fp);
+	size_t lidos = fread(texto, 1, max - 1, fp);
+	texto[lidos] = '\0';
+	fclose(fp);
+	return erro;
+}
+
+int main() {
+	INICIAR_TESTES();
+	static char texto[16384];
+
+	// Caminho (0, 0) - (0, 2) - (0, 4) - (0, 6) - (0, 8) e uma inserção repetida
+	REDE* rede = criarRede();
+	GRAFO* grafo = criarGrafo(rede, 'A');
+	VERIFICAR(criarGrafo(rede, 'A') == grafo);
+	for (int i = 0; i < 5; i++) {
+		VERIFICAR(inserirAntenaGrafo(grafo, 'A', 0, 2 * i) == 0);
+		if (i > 0) VERIFICAR(conectarVertices(grafo, 0, 2 * i - 2, 0, 2 * i) == 0);
+	}
+	VERIFICAR(inserirAntenaGrafo(grafo, 'A', 0, 0) == 1);
+	VERIFICAR(alcanceTeste(grafo, 0, 0) == 5);
+
+#ifdef PA_ESTATISTICAS
+	// Só as chamadas concluídas são contadas; criarGrafo só conta quando cria um grafo novo
+	VERIFICAR(rede->estat.chamadas[EST_CRIAR_GRAFO] == 1);
+	VERIFICAR(grafo->estat.chamadas[EST_INSERIR_ANTENA] == 5);
+	VERIFICAR(grafo->estat.chamadas[EST_CONECTAR] == 4);
+	VERIFICAR(grafo->estat.chamadas[EST_BFT] == 1);
+
+	// A BFT põe e tira cada vértice da fila uma vez e examina cada aresta nos dois sentidos
+	VERIFICAR(grafo->estat.operacoesFila == 10);
+	VERIFICAR(grafo->estat.arestasPercorridas == 8);
+
+	reiniciarEstatisticas(rede);
+	VERIFICAR(rede->estat.chamadas[EST_CRIAR_GRAFO] == 0 && grafo->estat.chamadas[EST_INSERIR_ANTENA] == 0);
+	VERIFICAR(grafo->estat.operacoesFila == 0 && grafo->estat.arestasPercorridas == 0);
+
+	// Com os temporizadores desligados as chamadas continuam a ser contadas, sem tempo
+	ativarTemporizadores(false);
+	VERIFICAR(instanteEstatisticas() == 0);
+	VERIFICAR(removerLigacao(grafo, 0, 6, 0, 8) == 0);
+	VERIFICAR(removerAntenaGrafo(grafo, 0, 8) == 0);
+	VERIFICAR(removerAntenaGrafo(grafo, 0, 8) == 1);
+	VERIFICAR(grafo->estat.chamadas[EST_REMOVER_LIGACAO] == 1 && grafo->estat.chamadas[EST_REMOVER_ANTENA] == 1);
+	VERIFICAR(grafo->estat.tempoNs[EST_REMOVER_LIGACAO] == 0 && grafo->estat.tempoNs[EST_REMOVER_ANTENA] == 0);
+	ativarTemporizadores(true);
+
+	// registarChamada ignora operações inválidas
+	ESTATISTICAS estat;
+	memset(&estat, 0, sizeof(estat));
+	registarChamada(&estat, EST_NUM_OPERACOES, 0);
+	registarChamada(&estat, EST_DFS, 0);
+	VERIFICAR(estat.chamadas[EST_DFS] == 1 && estat.tempoNs[EST_DFS] == 0);
+
+	VERIFICAR(exportarTexto(rede, exportarEstatisticasJSON, texto, sizeof(texto)) == 0);
+	VERIFICAR(strstr(texto, "\"ativo\": true") != NULL);
+	VERIFICAR(strstr(texto, "{\"frequencia\": \"A\", \"vertices\": 4, ") != NULL);
+	VERIFICAR(strstr(texto, "\"remover_antena\": {\"chamadas\": 1, \"tempo_ns\": 0, ") != NULL);
+
+	VERIFICAR(exportarTexto(rede, exportarEstatisticasPrometheus, texto, sizeof(texto)) == 0);
+	VERIFICAR(strstr(texto, "# TYPE pa_chamadas_total counter\n") != NULL);
+	VERIFICAR(strstr(texto, "pa_chamadas_total{nivel=\"grafo\",frequencia=\"A\",operacao=\"remover_ligacao\"} 1\n") != NULL);
+	VERIFICAR(strstr(texto, "operacao=\"inserir_antena\"") == NULL);
+	VERIFICAR(strstr(texto, "pa_nos_percorridos_total{nivel=\"rede\"} 0\n") != NULL);
+#else
+	VERIFICAR(exportarTexto(rede, exportarEstatisticasJSON, texto, sizeof(texto)) == 0);
+	VERIFICAR(strcmp(texto, "{\"ativo\": false}\n") == 0);
+	VERIFICAR(exportarTexto(rede, exportarEstatisticasPrometheus, texto, sizeof(texto)) == 0);
+	VERIFICAR(strncmp(texto, "# estatisticas desativadas", 26) == 0);
+	reiniciarEstatisticas(rede);
+#endif
+
+	VERIFICAR(exportarEstatisticasJSON(NULL, stdout) == 1 && exportarEstatisticasJSON(rede, NULL) == 1);
+	VERIFICAR(exportarEstatisticasPrometheus(NULL, stdout) == 1 && exportarEstatisticasPrometheus(rede, NULL) == 1);
+
+	destruirRede(rede);
+	TERMINAR_TESTES();
+}
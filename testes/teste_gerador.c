@@ -0,0 +1,195 @@
+/**
+ * @file teste_gerador.c
+ * @brief Testes do gerador de mapas e dos ficheiros: mapas reprodutíveis pela semente, posições distintas,
+ *        número e validade das ligações, leitura do mapa em texto com carregaGrafo e conteúdo do ficheiro
+ *        binário escrito por guardarGrafoBin.
+ *
+ * Os ficheiros são criados na pasta de trabalho do teste e apagados no fim.
+ *
+ * @author Rogério Picas
+ * @date 18-10-2026
+ * @version 1.0
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "testes.h"
+#include "gerador.h"
+
+ /** @def TEXTO_TESTE
+  *  @brief Ficheiro de texto usado no teste.
+  */
+#define TEXTO_TESTE "teste_gerador_tmp.txt"
+
+ /** @def BINARIO_TESTE
+  *  @brief Ficheiro binário usado no teste.
+  */
+#define BINARIO_TESTE "teste_gerador_tmp.bin"
+
+/**
+ * @brief Verifica as antenas e as ligações de um mapa gerado.
+ */
+static void verificarMapa(const MAPA_GERADO* mapa, int numAntenas, int numFrequencias, double grauMedio) {
+	static bool ocupada[MAX_DIM][MAX_DIM];
+	int porFrequencia[MAX_FREQUENCIAS] = { 0 };
+	memset(ocupada, 0, sizeof(ocupada));
+
+	VERIFICAR(mapa->numAntenas == numAntenas);
+	int erradas = 0;
+	for (int i = 0; i < mapa->numAntenas; i++) {
+		const ANTENAS* a = &mapa->antenas[i];
+		if (a->x < 0 || a->x >= MAX_DIM || a->y < 0 || a->y >= MAX_DIM || ocupada[a->x][a->y]) erradas++;
+		else ocupada[a->x][a->y] = true;
+		if (a->frequencia < 'A' || a->frequencia >= 'A' + numFrequencias) erradas++;
+		else porFrequencia[a->frequencia - 'A']++;
+	}
+	VERIFICAR(erradas == 0);
+
+	// Cada frequência com pelo menos duas antenas tem grauMedio * k / 2 ligações (arredondado)
+	long long esperadas = 0;
+	for (int f = 0; f < numFrequencias; f++) {
+		if (porFrequencia[f] >= 2) esperadas += (long long)(grauMedio * porFrequencia[f] / 2.0 + 0.5);
+	}
+	VERIFICAR(mapa->numLigacoes == esperadas);
+
+	// As ligações unem duas antenas distintas da frequência da ligação
+	erradas = 0;
+	for (int i = 0; i < mapa->numLigacoes; i++) {
+		const LIGACAO_GERADA* l = &mapa->ligacoes[i];
+		bool origem = false, destino = false;
+		for (int j = 0; j < mapa->numAntenas; j++) {
+			const ANTENAS* a = &mapa->antenas[j];
+			if (a->frequencia != l->frequencia) continue;
+			if (a->x == l->x1 && a->y == l->y1) origem = true;
+			if (a->x == l->x2 && a->y == l->y2) destino = true;
+		}
+		if (!origem || !destino || (l->x1 == l->x2 && l->y1 == l->y2)) erradas++;
+	}
+	VERIFICAR(erradas == 0);
+}
+
+/**
+ * @brief Os dois mapas têm as mesmas antenas e ligações, pela mesma ordem.
+ */
+static bool mesmoMapa(const MAPA_GERADO* a, const MAPA_GERADO* b) {
+	if (a->numAntenas != b->numAntenas || a->numLigacoes != b->numLigacoes) return false;
+	for (int i = 0; i < a->numAntenas; i++) {
+		if (a->antenas[i].x != b->antenas[i].x || a->antenas[i].y != b->antenas[i].y) return false;
+		if (a->antenas[i].frequencia != b->antenas[i].frequencia) return false;
+	}
+	return memcmp(a->ligacoes, b->ligacoes, (size_t)a->numLigacoes * sizeof(LIGACAO_GERADA)) == 0;
+}
+
+/**
+ * @brief Lê o ficheiro binário de um grafo e conta os registos que não correspondem ao grafo.
+ *
+ * Cada vértice é seguido das suas arestas; o número de arestas de cada vértice é o seu grau no grafo.
+ */
+static int registosErrados(GRAFO* grafo, const char* filename) {
+	FILE* fp = fopen(filename, "rb");
+	if (fp == NULL) return 1;
+
+	int errados = 0;
+	for (VERTICE* v = grafo->vertices; v != NULL; v = v->prox) {
+		VerticeFICHEIRO vf;
+		if (fread(&vf, sizeof(vf), 1, fp) != 1)
+		{
+			fclose(fp);
+			return errados + 1;
+		}
+		if (vf.frequencia != v->antena.frequencia || vf.x != v->antena.x || vf.y != v->antena.y) errados++;
+		for (ARESTA* e = v->adjacentes; e != NULL; e = e->prox) {
+			ArestasFICHEIRO af;
+			if (fread(&af, sizeof(af), 1, fp) != 1)
+			{
+				fclose(fp);
+				return errados + 1;
+			}
+			if (af.xOrigem != v->antena.x || af.yOrigem != v->antena.y) errados++;
+			if (af.xDestino != e->destino->antena.x || af.yDestino != e->destino->antena.y) errados++;
+		}
+	}
+	// Não pode sobrar nada no ficheiro
+	if (fgetc(fp) != EOF) errados++;
+	fclose(fp);
+	return errados;
+}
+
+int main() {
+	INICIAR_TESTES();
+
+	// A mesma semente gera o mesmo mapa; sementes diferentes geram mapas diferentes
+	MAPA_GERADO* mapa = gerarMapa(150, 4, 3.0, 7);
+	MAPA_GERADO* igual = gerarMapa(150, 4, 3.0, 7);
+	MAPA_GERADO* outro = gerarMapa(150, 4, 3.0, 8);
+	VERIFICAR(mapa != NULL && igual != NULL && outro != NULL);
+	if (mapa == NULL || igual == NULL || outro == NULL) TERMINAR_TESTES();
+	VERIFICAR(mesmoMapa(mapa, igual));
+	VERIFICAR(!mesmoMapa(mapa, outro));
+	verificarMapa(mapa, 150, 4, 3.0);
+	verificarMapa(outro, 150, 4, 3.0);
+	igual = destruirMapa(igual);
+	outro = destruirMapa(outro);
+
+	// Casos limite: cidade cheia, mapa vazio, uma só frequência e sem ligações
+	MAPA_GERADO* cheio = gerarMapa(MAX_DIM * MAX_DIM, 1, 0.0, 1);
+	VERIFICAR(cheio != NULL);
+	if (cheio != NULL) verificarMapa(cheio, MAX_DIM * MAX_DIM, 1, 0.0);
+	cheio = destruirMapa(cheio);
+	MAPA_GERADO* vazio = gerarMapa(0, 2, 2.0, 1);
+	VERIFICAR(vazio != NULL && vazio->numAntenas == 0 && vazio->numLigacoes == 0);
+	vazio = destruirMapa(vazio);
+	VERIFICAR(gerarMapa(MAX_DIM * MAX_DIM + 1, 1, 1.0, 1) == NULL);
+	VERIFICAR(gerarMapa(10, 0, 1.0, 1) == NULL);
+	VERIFICAR(gerarMapa(10, MAX_FREQUENCIAS + 1, 1.0, 1) == NULL);
+	VERIFICAR(gerarMapa(10, 1, -1.0, 1) == NULL);
+
+	// O mapa em texto é lido por carregaGrafo com as mesmas antenas
+	VERIFICAR(guardarMapaTexto(mapa, TEXTO_TESTE) == 0);
+	REDE* rede = criarRede();
+	VERIFICAR(carregaGrafo(rede, TEXTO_TESTE) == 0);
+	int total = 0, erradas = 0;
+	for (GRAFO* g = rede->listaGrafos; g != NULL; g = g->prox) total += g->numVertices;
+	for (int i = 0; i < mapa->numAntenas; i++) {
+		GRAFO* grafo = encontrarGrafoPorFrequencia(rede, mapa->antenas[i].frequencia);
+		if (encontrarVertice(grafo, mapa->antenas[i].x, mapa->antenas[i].y) == NULL) erradas++;
+	}
+	VERIFICAR(total == mapa->numAntenas && erradas == 0);
+
+	// O ficheiro binário tem todos os vértices e todas as arestas de cada grafo
+	for (int i = 0; i < mapa->numLigacoes; i++) {
+		LIGACAO_GERADA* l = &mapa->ligacoes[i];
+		GRAFO* grafo = encontrarGrafoPorFrequencia(rede, l->frequencia);
+		if (!existeConexaoEntreVertices(grafo, l->x1, l->y1, l->x2, l->y2)) conectarVertices(grafo, l->x1, l->y1, l->x2, l->y2);
+	}
+	for (GRAFO* g = rede->listaGrafos; g != NULL; g = g->prox) {
+		VERIFICAR(guardarGrafoBin(g->vertices, BINARIO_TESTE));
+		VERIFICAR(registosErrados(g, BINARIO_TESTE) == 0);
+	}
+	VERIFICAR(!guardarGrafoBin(NULL, BINARIO_TESTE));
+
+	// O efeito nefasto não altera a lista analisada
+	NEFASTO* lista = NULL;
+	GRAFO* grafo = rede->listaGrafos;
+	for (VERTICE* v = grafo->vertices; v != NULL; v = v->prox) {
+		inserirEfeitoNefasto(rede, &lista, v->antena.frequencia, v->antena.x, v->antena.y);
+	}
+	int nos = 0;
+	for (NEFASTO* n = lista; n != NULL; n = n->prox) nos++;
+	VERIFICAR(nos == grafo->numVertices);
+	VERIFICAR(efeitoNefasto(rede, lista));
+	VERIFICAR(!efeitoNefasto(rede, NULL));
+	for (NEFASTO* n = lista; n != NULL; n = n->prox) nos--;
+	VERIFICAR(nos == 0);
+	while (lista) {
+		NEFASTO* prox = lista->prox;
+		free(lista);
+		lista = prox;
+	}
+
+	destruirRede(rede);
+	mapa = destruirMapa(mapa);
+	remove(TEXTO_TESTE);
+	remove(BINARIO_TESTE);
+	TERMINAR_TESTES();
+}
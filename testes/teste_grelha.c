@@ -0,0 +1,159 @@
+/**
+ * @file teste_grelha.c
+ * @brief Testes da grelha de ocupação: bitset e frequência visível de cada célula comparados com as
+ *        antenas da rede depois de inserções, movimentos, remoções e destruição de grafos, incluindo
+ *        células partilhadas por várias frequências, e mapa escrito por mostrarRegiaoRede com e sem
+ *        redução, comparado com a grelha célula a célula.
+ *
+ * @author Rogério Picas
+ * @date 18-10-2026
+ * @version 1.0
+ */
+#include <stdio.h>
+#include "testes.h"
+#include "grelha.h"
+#include "gerador.h"
+
+/**
+ * @brief Conta as células em que a grelha não corresponde às antenas da rede.
+ *
+ * Uma célula ocupada tem de mostrar a frequência de uma das antenas que lá estão.
+ */
+static int celulasErradas(REDE* rede) {
+	int erradas = 0;
+	for (int x = 0; x < MAX_DIM; x++) {
+		for (int y = 0; y < MAX_DIM; y++) {
+			bool ocupada = false, visivel = false;
+			char freq = rede->grelha->frequencias[x * MAX_DIM + y];
+			for (GRAFO* g = rede->listaGrafos; g != NULL; g = g->prox) {
+				if (encontrarVertice(g, x, y) == NULL) continue;
+				ocupada = true;
+				if (g->frequencia == freq) visivel = true;
+			}
+			if (celulaOcupada(rede->grelha, x, y) != ocupada) erradas++;
+			else if (ocupada && !visivel) erradas++;
+			else if (!ocupada && freq != CELULA_LIVRE) erradas++;
+		}
+	}
+	return erradas;
+}
+
+/**
+ * @brief Caractere esperado para a zona [x0, x1) x [y0, y1): livre, a única frequência visível ou mista.
+ */
+static char zonaEsperada(REDE* rede, int x0, int y0, int x1, int y1) {
+	char resultado = CELULA_LIVRE;
+	for (int x = x0; x < x1; x++) {
+		for (int y = y0; y < y1; y++) {
+			if (!celulaOcupada(rede->grelha, x, y)) continue;
+			char freq = rede->grelha->frequencias[x * MAX_DIM + y];
+			if (resultado == CELULA_LIVRE) resultado = freq;
+			else if (resultado != freq) return CELULA_MISTA;
+		}
+	}
+	return resultado;
+}
+
+/**
+ * @brief Escreve uma região com mostrarRegiaoRede num ficheiro temporário e conta os caracteres errados.
+ *
+ * Um início negativo passa para 0 com o mesmo número de linhas/colunas e o fim é cortado no limite da
+ * cidade; cada linha do texto tem de terminar em '\n'.
+ */
+static int mapaErrado(REDE* rede, int x0, int y0, int linhas, int colunas, int escala) {
+	FILE* fp = tmpfile();
+	if (fp == NULL) return 1;
+	if (mostrarRegiaoRede(rede, fp, x0, y0, linhas, colunas, escala) != 0)
+	{
+		fclose(fp);
+		return 1;
+	}
+	rewind(fp);
+
+	if (x0 < 0) x0 = 0;
+	if (y0 < 0) y0 = 0;
+	int x1 = x0 + linhas > MAX_DIM ? MAX_DIM : x0 + linhas;
+	int y1 = y0 + colunas > MAX_DIM ? MAX_DIM : y0 + colunas;
+
+	int errados = 0;
+	for (int x = x0; x < x1; x += escala) {
+		for (int y = y0; y < y1; y += escala) {
+			int xFim = x + escala > x1 ? x1 : x + escala;
+			int yFim = y + escala > y1 ? y1 : y + escala;
+			if (fgetc(fp) != zonaEsperada(rede, x, y, xFim, yFim)) errados++;
+		}
+		if (fgetc(fp) != '\n') errados++;
+	}
+	// Não pode sobrar nada no ficheiro
+	if (fgetc(fp) != EOF) errados++;
+	fclose(fp);
+	return errados;
+}
+
+int main() {
+	INICIAR_TESTES();
+
+	REDE* rede = criarRede();
+	VERIFICAR(rede != NULL && rede->grelha != NULL);
+	VERIFICAR(celulasErradas(rede) == 0);
+	VERIFICAR(!celulaOcupada(rede->grelha, -1, 0) && !celulaOcupada(rede->grelha, 0, MAX_DIM));
+	VERIFICAR(!celulaOcupada(NULL, 0, 0));
+
+	// Duas frequências na mesma célula: ao remover a visível, a célula passa a mostrar a outra
+	GRAFO* a = criarGrafo(rede, 'A');
+	GRAFO* b = criarGrafo(rede, 'B');
+	VERIFICAR(inserirAntenaGrafo(a, 'A', 3, 4) == 0);
+	VERIFICAR(inserirAntenaGrafo(b, 'B', 3, 4) == 0);
+	VERIFICAR(celulaOcupada(rede->grelha, 3, 4) && rede->grelha->frequencias[3 * MAX_DIM + 4] == 'B');
+	VERIFICAR(removerAntenaGrafo(b, 3, 4) == 0);
+	VERIFICAR(celulaOcupada(rede->grelha, 3, 4) && rede->grelha->frequencias[3 * MAX_DIM + 4] == 'A');
+	VERIFICAR(moverAntenaGrafo(a, 3, 4, MAX_DIM - 1, MAX_DIM - 1) == 0);
+	VERIFICAR(!celulaOcupada(rede->grelha, 3, 4) && celulaOcupada(rede->grelha, MAX_DIM - 1, MAX_DIM - 1));
+	VERIFICAR(celulasErradas(rede) == 0);
+
+	// Alterações aleatórias numa zona pequena, para haver muitas células partilhadas
+	uint64_t estado = 99;
+	for (int i = 0; i < 2000; i++) {
+		char freq = (char)('A' + proximoAleatorio(&estado) % 4);
+		GRAFO* grafo = criarGrafo(rede, freq);
+		int x = (int)(proximoAleatorio(&estado) % 8), y = (int)(proximoAleatorio(&estado) % 8);
+		switch (proximoAleatorio(&estado) % 3) {
+		case 0:
+			inserirAntenaGrafo(grafo, freq, x, y);
+			break;
+		case 1:
+			removerAntenaGrafo(grafo, x, y);
+			break;
+		default:
+			moverAntenaGrafo(grafo, x, y, (int)(proximoAleatorio(&estado) % 8), (int)(proximoAleatorio(&estado) % 8));
+			break;
+		}
+		if (i % 100 == 99) VERIFICAR(celulasErradas(rede) == 0);
+	}
+
+	// Mapa completo, regiões parciais, fora dos limites e reduzidas, incluindo zonas incompletas no fim
+	VERIFICAR(mapaErrado(rede, 0, 0, MAX_DIM, MAX_DIM, 1) == 0);
+	VERIFICAR(mapaErrado(rede, 2, 3, 5, 4, 1) == 0);
+	VERIFICAR(mapaErrado(rede, -3, -2, 6, MAX_DIM + 5, 1) == 0);
+	VERIFICAR(mapaErrado(rede, MAX_DIM - 4, MAX_DIM - 3, 10, 10, 1) == 0);
+	int escalas[] = { 2, 3, 4, 7, MAX_DIM };
+	for (int i = 0; i < 5; i++) {
+		VERIFICAR(mapaErrado(rede, 0, 0, MAX_DIM, MAX_DIM, escalas[i]) == 0);
+		VERIFICAR(mapaErrado(rede, 1, 2, 9, 11, escalas[i]) == 0);
+	}
+
+	// Argumentos inválidos e regiões vazias
+	VERIFICAR(mostrarRegiaoRede(NULL, stdout, 0, 0, 1, 1, 1) == 1);
+	VERIFICAR(mostrarRegiaoRede(rede, NULL, 0, 0, 1, 1, 1) == 1);
+	VERIFICAR(mostrarRegiaoRede(rede, stdout, 0, 0, 0, 1, 1) == 1);
+	VERIFICAR(mostrarRegiaoRede(rede, stdout, 0, 0, 1, 1, 0) == 1);
+	VERIFICAR(mostrarRegiaoRede(rede, stdout, MAX_DIM, 0, 1, 1, 1) == 1);
+
+	// Destruir um grafo liberta as suas células (e mantém as partilhadas com outros grafos)
+	destruirGrafo(encontrarGrafoPorFrequencia(rede, 'C'));
+	VERIFICAR(encontrarGrafoPorFrequencia(rede, 'C') == NULL);
+	VERIFICAR(celulasErradas(rede) == 0);
+
+	destruirRede(rede);
+	TERMINAR_TESTES();
+}
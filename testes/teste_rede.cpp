@@ -0,0 +1,193 @@
+/**
+ * @file teste_rede.cpp
+ * @brief Testes da interface C++ de rede.hpp: posse da rede (só movível, vazia depois de movida,
+ *        libertada uma só vez), handles de grafos e vértices, remoção de grafos da lista da rede,
+ *        inserções e ligações em bloco com reserva e cópias em bloco comparadas com as listas.
+ *
+ * Os ficheiros são criados na pasta de trabalho do teste e apagados no fim.
+ *
+ * @author Rogério Picas
+ * @date 18-10-2026
+ * @version 1.0
+ */
+#include <cstdio>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "testes.h"
+#include "rede.hpp"
+#include "gerador.h"
+
+ /** @def TEXTO_TESTE
+  *  @brief Ficheiro de texto usado no teste.
+  */
+#define TEXTO_TESTE "teste_rede_tmp.txt"
+
+static_assert(!std::is_copy_constructible<pa::Rede>::value, "a rede nao pode ser copiada");
+static_assert(!std::is_copy_assignable<pa::Rede>::value, "a rede nao pode ser copiada");
+static_assert(std::is_nothrow_move_constructible<pa::Rede>::value, "a rede pode ser movida sem excecoes");
+static_assert(std::is_nothrow_move_assignable<pa::Rede>::value, "a rede pode ser movida sem excecoes");
+static_assert(std::is_trivially_copyable<pa::Grafo>::value && sizeof(pa::Grafo) == sizeof(GRAFO*), "handle leve");
+static_assert(std::is_trivially_copyable<pa::Vertice>::value && sizeof(pa::Vertice) == sizeof(VERTICE*), "handle leve");
+
+namespace {
+
+/**
+ * @brief Conta os grafos da rede através do iterador.
+ */
+std::size_t contarGrafos(const pa::Rede& rede) {
+    std::size_t n = 0;
+    for (pa::Grafo g : rede.grafos()) {
+        (void)g;
+        n++;
+    }
+    return n;
+}
+
+/**
+ * @brief Compara as cópias em bloco de um grafo (completas e truncadas) com as listas do grafo em C.
+ * @return Número de diferenças.
+ */
+int copiasErradas(pa::Grafo grafo) {
+    GRAFO* g = grafo.c();
+    int erradas = 0;
+
+    std::vector<pa::Vertice> vertices(grafo.numVertices());
+    std::vector<ANTENAS> antenas(grafo.numVertices());
+    if (grafo.copiarVertices(vertices) != grafo.numVertices()) erradas++;
+    if (grafo.copiarAntenas(antenas) != grafo.numVertices()) erradas++;
+    std::size_t i = 0;
+    for (VERTICE* v = g->vertices; v != nullptr; v = v->prox, i++) {
+        if (vertices[i].c() != v || vertices[i].x() != v->antena.x || vertices[i].id() != v->id) erradas++;
+        if (antenas[i].x != v->antena.x || antenas[i].y != v->antena.y || antenas[i].frequencia != g->frequencia) erradas++;
+    }
+
+    // Cada ligação aparece uma vez, com a origem antes do destino
+    std::size_t arestas = 0;
+    for (VERTICE* v = g->vertices; v != nullptr; v = v->prox) {
+        for (ARESTA* a = v->adjacentes; a != nullptr; a = a->prox) arestas++;
+    }
+    std::vector<ArestasFICHEIRO> ligacoes(arestas);
+    const std::size_t numLigacoes = grafo.copiarLigacoes(ligacoes);
+    if (numLigacoes != grafo.numLigacoes()) erradas++;
+    for (std::size_t k = 0; k < numLigacoes && k < ligacoes.size(); k++) {
+        const ArestasFICHEIRO& l = ligacoes[k];
+        if (l.xOrigem > l.xDestino || (l.xOrigem == l.xDestino && l.yOrigem > l.yDestino)) erradas++;
+        if (!existeConexaoEntreVertices(g, l.xOrigem, l.yOrigem, l.xDestino, l.yDestino)) erradas++;
+    }
+
+    // Um intervalo pequeno recebe só os primeiros, mas o total devolvido é o mesmo
+    pa::Vertice primeiro[1];
+    ANTENAS nenhuma[1] = { { -1, -1, '?' } };
+    if (grafo.copiarVertices(primeiro) != grafo.numVertices()) erradas++;
+    if (g->vertices != nullptr && primeiro[0].c() != g->vertices) erradas++;
+    if (grafo.copiarAntenas(pa::Intervalo<ANTENAS>(nenhuma, 0)) != grafo.numVertices() || nenhuma[0].x != -1) erradas++;
+    if (grafo.copiarLigacoes(pa::Intervalo<ArestasFICHEIRO>()) != numLigacoes) erradas++;
+    return erradas;
+}
+
+} // namespace
+
+int main() {
+    INICIAR_TESTES();
+
+    // Inserção em bloco de antenas de várias frequências, com a reserva feita antes
+    MAPA_GERADO* mapa = gerarMapa(120, 3, 2.0, 11);
+    VERIFICAR(mapa != nullptr);
+    if (mapa == nullptr) TERMINAR_TESTES();
+    pa::Rede rede;
+    VERIFICAR(static_cast<bool>(rede));
+    VERIFICAR(rede.inserir(pa::Intervalo<const ANTENAS>(mapa->antenas, static_cast<std::size_t>(mapa->numAntenas))) == 120);
+    VERIFICAR(contarGrafos(rede) == 3);
+
+    // Ligações em bloco, no grafo da sua frequência
+    std::size_t ligadas = 0;
+    for (pa::Grafo g : rede.grafos()) {
+        std::vector<ArestasFICHEIRO> ligacoes;
+        for (int i = 0; i < mapa->numLigacoes; i++) {
+            const LIGACAO_GERADA& l = mapa->ligacoes[i];
+            if (l.frequencia == g.frequencia()) ligacoes.push_back(ArestasFICHEIRO{ l.x1, l.y1, l.x2, l.y2 });
+        }
+        ligadas += g.ligar(ligacoes);
+        VERIFICAR(g.numLigacoes() == ligacoes.size());
+        VERIFICAR(copiasErradas(g) == 0);
+    }
+    VERIFICAR(ligadas == static_cast<std::size_t>(mapa->numLigacoes));
+
+    // Handles: procura, vizinhos e operações sobre um grafo
+    pa::Grafo a = rede.procurar('A');
+    VERIFICAR(a && a == rede.grafo('A') && !rede.procurar('Z'));
+    pa::Vertice v = *a.vertices().begin();
+    VERIFICAR(a.procurar(v.x(), v.y()) == v && v.frequencia() == 'A');
+    int vizinhos = 0;
+    for (pa::Vertice w : v.vizinhos()) {
+        if (!existeConexaoEntreVertices(a.c(), v.x(), v.y(), w.x(), w.y())) vizinhos = -1000;
+        vizinhos++;
+    }
+    VERIFICAR(vizinhos == v.grau());
+    const std::size_t antes = a.numVertices();
+    VERIFICAR(!a.inserir(v.x(), v.y()));
+    VERIFICAR(a.remover(v.x(), v.y()) && a.numVertices() == antes - 1 && !a.procurar(v.x(), v.y()));
+    VERIFICAR(copiasErradas(a) == 0);
+
+    // Reserva: a capacidade cobre os vértices pedidos e as inserções seguintes cabem nela
+    pa::Grafo novo = rede.grafo('Q');
+    VERIFICAR(novo && novo.numVertices() == 0);
+    VERIFICAR(novo.reservar(10, 5) && novo.capacidade() >= 10);
+    std::vector<ANTENAS> linha;
+    for (int y = 0; y < 10; y++) linha.push_back(ANTENAS{ 0, static_cast<COORDENADA>(y), 'Q' });
+    VERIFICAR(novo.inserir(pa::Intervalo<const ANTENAS>(linha)) == 10);
+    VERIFICAR(novo.mover(0, 0, 1, 0) && novo.procurar(1, 0) && !novo.procurar(0, 0));
+    VERIFICAR(novo.ligar(1, 0, 0, 1) && novo.desligar(1, 0, 0, 1) && !novo.desligar(1, 0, 0, 1));
+
+    // Remover um grafo tira-o da lista da rede e esvazia o handle
+    VERIFICAR(contarGrafos(rede) == 4);
+    rede.remover(novo);
+    VERIFICAR(!novo && !rede.procurar('Q') && contarGrafos(rede) == 3);
+
+    // Mover a rede passa a posse; a origem fica vazia e não liberta nada
+    REDE* c = rede.c();
+    pa::Rede movida(std::move(rede));
+    VERIFICAR(!rede && rede.c() == nullptr && contarGrafos(rede) == 0);
+    VERIFICAR(movida.c() == c && contarGrafos(movida) == 3);
+    pa::Rede outra;
+    outra.grafo('B').inserir(1, 1);
+    outra = std::move(movida);
+    VERIFICAR(outra.c() == c && !movida);
+
+    // Mover a rede para si própria não a liberta
+    pa::Rede& mesma = outra;
+    outra = std::move(mesma);
+    VERIFICAR(outra.c() == c);
+
+    // libertar entrega a rede em C; um objeto criado a partir dela volta a ter a posse
+    REDE* entregue = outra.libertar();
+    VERIFICAR(entregue == c && !outra);
+    pa::Rede devolvida(entregue);
+    VERIFICAR(devolvida.c() == c && devolvida.procurar('A') == a);
+    pa::Rede nula(nullptr);
+    VERIFICAR(!nula && contarGrafos(nula) == 0);
+
+    // Carregar antenas de um ficheiro de texto
+    FILE* fp = std::fopen(TEXTO_TESTE, "w");
+    VERIFICAR(fp != nullptr);
+    if (fp != nullptr)
+    {
+        // Cada linha do ficheiro tem MAX_DIM colunas
+        for (int x = 0; x < 3; x++) {
+            for (int y = 0; y < MAX_DIM; y++) std::fputc(x == y ? (x == 1 ? 'B' : 'A') : '.', fp);
+            std::fputc('\n', fp);
+        }
+        std::fclose(fp);
+        pa::Rede lida;
+        VERIFICAR(lida.carregar(TEXTO_TESTE));
+        VERIFICAR(lida.procurar('A').numVertices() == 2 && lida.procurar('B').numVertices() == 1);
+        VERIFICAR(lida.procurar('A').procurar(2, 2));
+    }
+    pa::Rede semFicheiro;
+    VERIFICAR(!semFicheiro.carregar("teste_rede_inexistente.txt"));
+
+    destruirMapa(mapa);
+    std::remove(TEXTO_TESTE);
+    TERMINAR_TESTES();
+}
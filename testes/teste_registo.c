@@ -0,0 +1,183 @@
+/**
+ * @file teste_registo.c
+ * @brief Testes do registo: filtragem por nível, escrita direta e através do buffer circular com
+ *        várias voltas ao anel (textos de uma e de várias entradas, incluindo os que atravessam o
+ *        fim do anel), vários produtores em simultâneo e truncagem dos textos muito grandes.
+ *
+ * @author Rogério Picas
+ * @date 18-10-2026
+ * @version 1.0
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "testes.h"
+
+ /** @def NUM_MENSAGENS
+  *  @brief Mensagens de cada fase com o anel (várias voltas ao anel de 4096 entradas).
+  */
+#define NUM_MENSAGENS 20000
+
+ /** @def TAM_CORPO
+  *  @brief Caracteres do corpo das mensagens longas (ocupam várias entradas do anel).
+  */
+#define TAM_CORPO 300
+
+/**
+ * @brief Compara o conteúdo de dois ficheiros abertos, desde o início.
+ */
+static bool mesmoConteudo(FILE* a, FILE* b) {
+	rewind(a);
+	rewind(b);
+	int ca, cb;
+	do {
+		ca = fgetc(a);
+		cb = fgetc(b);
+		if (ca != cb) return false;
+	} while (ca != EOF);
+	return true;
+}
+
+/**
+ * @brief Escreve a mensagem i da sequência de teste no registo e, igual, no ficheiro esperado.
+ *
+ * De 7 em 7 mensagens o texto tem TAM_CORPO caracteres, pelo que alguns atravessam o fim do anel.
+ */
+static void escreverMensagem(int i, FILE* esperado) {
+	static char corpo[TAM_CORPO + 1];
+	if (i % 7 == 0)
+	{
+		memset(corpo, 'a' + i % 26, TAM_CORPO);
+		corpo[TAM_CORPO] = '\0';
+		registarMensagem(REGISTO_INFO, "%d %s\n", i, corpo);
+		fprintf(esperado, "%d %s\n", i, corpo);
+	}
+	else
+	{
+		registarMensagem(REGISTO_INFO, "mensagem %d\n", i);
+		fprintf(esperado, "mensagem %d\n", i);
+	}
+}
+
+/**
+ * @brief Verifica as linhas escritas por vários produtores: cada mensagem inteira, uma só vez.
+ * @return Número de linhas erradas, repetidas ou em falta.
+ */
+static int linhasConcorrentesErradas(FILE* fp) {
+	static char linha[TAM_CORPO + 64];
+	static bool vista[NUM_MENSAGENS];
+	memset(vista, 0, sizeof(vista));
+
+	int erradas = 0, lidas = 0;
+	rewind(fp);
+	while (fgets(linha, sizeof(linha), fp) != NULL) {
+		int i = -1, n = 0;
+		if (sscanf(linha, "%d %n", &i, &n) != 1 || i < 0 || i >= NUM_MENSAGENS || vista[i])
+		{
+			erradas++;
+			continue;
+		}
+		vista[i] = true;
+		lidas++;
+		// O corpo tem de estar inteiro: uma mistura com outra mensagem muda as letras ou o tamanho
+		bool inteira = strlen(linha + n) == TAM_CORPO + 1 && linha[n + TAM_CORPO] == '\n';
+		for (int k = 0; inteira && k < TAM_CORPO; k++) {
+			if (linha[n + k] != 'a' + i % 26) inteira = false;
+		}
+		if (!inteira) erradas++;
+	}
+	return erradas + (NUM_MENSAGENS - lidas);
+}
+
+int main() {
+	INICIAR_TESTES();
+
+	// Escrita direta e filtragem por nível
+	FILE* fp = tmpfile();
+	FILE* esperado = tmpfile();
+	VERIFICAR(fp != NULL && esperado != NULL);
+	if (fp == NULL || esperado == NULL) TERMINAR_TESTES();
+	definirDestinoRegisto(fp);
+	definirNivelRegisto(REGISTO_AVISO);
+	registarMensagem(REGISTO_INFO, "descartada %d\n", 1);
+	registarMensagem(REGISTO_AVISO, "aviso %d\n", 2);
+	registarTexto(REGISTO_DEPURACAO, "descartado\n", 11);
+	registarTexto(REGISTO_ERRO, "erro\nignorado", 5);
+	registarTexto(REGISTO_ERRO, NULL, 3);
+	registarMensagem(REGISTO_ERRO, NULL);
+	fputs("aviso 2\nerro\n", esperado);
+	fflush(fp);
+	VERIFICAR(mesmoConteudo(fp, esperado));
+	fclose(fp);
+	fclose(esperado);
+
+	// Um só produtor, várias voltas ao anel: o texto sai inteiro e pela ordem
+	fp = tmpfile();
+	esperado = tmpfile();
+	VERIFICAR(fp != NULL && esperado != NULL);
+	if (fp == NULL || esperado == NULL) TERMINAR_TESTES();
+	definirDestinoRegisto(fp);
+	definirNivelRegisto(REGISTO_DEPURACAO);
+	VERIFICAR(iniciarRegisto() == 0);
+	VERIFICAR(iniciarRegisto() == 1);
+	for (int i = 0; i < NUM_MENSAGENS; i++) {
+		escreverMensagem(i, esperado);
+	}
+	terminarRegisto();
+	terminarRegisto();
+
+	// Depois de terminar, as mensagens voltam a ser escritas diretamente, a seguir às do anel
+	registarMensagem(REGISTO_INFO, "fim\n");
+	fputs("fim\n", esperado);
+	fflush(fp);
+	VERIFICAR(mesmoConteudo(fp, esperado));
+	fclose(fp);
+	fclose(esperado);
+
+	// Vários produtores ao mesmo tempo: cada mensagem aparece uma vez e sem mistura com outras
+	fp = tmpfile();
+	VERIFICAR(fp != NULL);
+	if (fp == NULL) TERMINAR_TESTES();
+	definirDestinoRegisto(fp);
+	VERIFICAR(iniciarRegisto() == 0);
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(4) schedule(dynamic, 64)
+#endif
+	for (int i = 0; i < NUM_MENSAGENS; i++) {
+		char corpo[TAM_CORPO + 1];
+		memset(corpo, 'a' + i % 26, TAM_CORPO);
+		corpo[TAM_CORPO] = '\0';
+		registarMensagem(REGISTO_INFO, "%d %s\n", i, corpo);
+	}
+	terminarRegisto();
+	VERIFICAR(linhasConcorrentesErradas(fp) == 0);
+	fclose(fp);
+
+	// Um texto maior do que metade do anel é truncado, mas o início sai intacto
+	size_t tamanho = 1 << 20;
+	char* grande = (char*)malloc(tamanho);
+	char* lido = (char*)malloc(tamanho);
+	fp = tmpfile();
+	VERIFICAR(grande != NULL && lido != NULL && fp != NULL);
+	if (grande != NULL && lido != NULL && fp != NULL)
+	{
+		for (size_t i = 0; i < tamanho; i++) grande[i] = (char)('a' + i % 26);
+		definirDestinoRegisto(fp);
+		VERIFICAR(iniciarRegisto() == 0);
+		registarTexto(REGISTO_INFO, grande, tamanho);
+		registarTexto(REGISTO_INFO, "depois\n", 7);
+		terminarRegisto();
+		rewind(fp);
+		size_t lidos = fread(lido, 1, tamanho, fp);
+		VERIFICAR(lidos > 7 && lidos < tamanho);
+		VERIFICAR(memcmp(lido, grande, lidos - 7) == 0);
+		VERIFICAR(lidos > 7 && memcmp(lido + lidos - 7, "depois\n", 7) == 0);
+	}
+	if (fp != NULL) fclose(fp);
+	free(grande);
+	free(lido);
+
+	definirDestinoRegisto(NULL);
+	definirNivelRegisto(REGISTO_ERRO);
+	TERMINAR_TESTES();
+}
@@ -0,0 +1,159 @@
+/**
+ * @file teste_relatorio.c
+ * @brief Testes do relatório de interferência: métricas de cada antena comparadas com uma contagem
+ *        direta de todos os pares, com um grafo grande e vários pequenos e vários números de threads,
+ *        e conteúdo dos ficheiros CSV e binário.
+ *
+ * Os ficheiros são criados na pasta de trabalho do teste e apagados no fim.
+ *
+ * @author Rogério Picas
+ * @date 18-10-2026
+ * @version 1.0
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "testes.h"
+#include "relatorio.h"
+#include "gerador.h"
+
+ /** @def BINARIO_TESTE
+  *  @brief Ficheiro binário usado no teste.
+  */
+#define BINARIO_TESTE "teste_relatorio_tmp.bin"
+
+/**
+ * @brief Verifica se a célula (x, y) tem alguma antena e se tem uma de frequência diferente de @p freq.
+ */
+static void antenasCelula(REDE* rede, int x, int y, char freq, bool* ocupada, bool* outra) {
+	*ocupada = *outra = false;
+	for (GRAFO* g = rede->listaGrafos; g != NULL; g = g->prox) {
+		for (VERTICE* v = g->vertices; v != NULL; v = v->prox) {
+			if (v->antena.x != x || v->antena.y != y) continue;
+			*ocupada = true;
+			if (v->antena.frequencia != freq) *outra = true;
+		}
+	}
+}
+
+/**
+ * @brief Conta as linhas do relatório que não correspondem à contagem direta dos pares de cada antena.
+ *
+ * As linhas têm de estar agrupadas por grafo, pela ordem das listas de vértices.
+ */
+static int linhasErradas(REDE* rede, const RELATORIO_INTERFERENCIA* relatorio) {
+	int erradas = 0, n = 0;
+	for (GRAFO* g = rede->listaGrafos; g != NULL; g = g->prox) {
+		for (VERTICE* a = g->vertices; a != NULL; a = a->prox, n++) {
+			if (n >= relatorio->numLinhas) return erradas + 1;
+			int antinodos = 0, ocupados = 0, outras = 0;
+			for (VERTICE* b = g->vertices; b != NULL; b = b->prox) {
+				if (a == b || abs(a->antena.x - b->antena.x) < 2) continue;
+				// Os dois antinodos do par: o simétrico de a em relação a b e o de b em relação a a
+				int xs[2] = { 2 * a->antena.x - b->antena.x, 2 * b->antena.x - a->antena.x };
+				int ys[2] = { 2 * a->antena.y - b->antena.y, 2 * b->antena.y - a->antena.y };
+				for (int k = 0; k < 2; k++) {
+					if (xs[k] < 0 || xs[k] >= MAX_DIM || ys[k] < 0 || ys[k] >= MAX_DIM) continue;
+					bool ocupada, outra;
+					antenasCelula(rede, xs[k], ys[k], a->antena.frequencia, &ocupada, &outra);
+					antinodos++;
+					ocupados += ocupada;
+					outras += outra;
+				}
+			}
+
+			const LINHA_RELATORIO* l = &relatorio->linhas[n];
+			if (l->frequencia != a->antena.frequencia || l->x != a->antena.x || l->y != a->antena.y || l->id != a->id) erradas++;
+			else if (l->antinodos != antinodos || l->ocupados != ocupados || l->outrasFrequencias != outras) erradas++;
+		}
+	}
+	return erradas + (n != relatorio->numLinhas);
+}
+
+/**
+ * @brief Conta as linhas de texto de um ficheiro.
+ */
+static int contarLinhas(FILE* fp) {
+	int linhas = 0, c;
+	while ((c = fgetc(fp)) != EOF) {
+		if (c == '\n') linhas++;
+	}
+	return linhas;
+}
+
+int main() {
+	INICIAR_TESTES();
+
+	// Um grafo com metade das antenas e vários pequenos, para usar as duas formas de repartir
+	REDE* rede = criarRede();
+	uint64_t estado = 41;
+	for (int i = 0; i < 240; i++) {
+		char freq = i % 2 ? 'A' : (char)('B' + proximoAleatorio(&estado) % 6);
+		int x = (int)(proximoAleatorio(&estado) % MAX_DIM), y = (int)(proximoAleatorio(&estado) % MAX_DIM);
+		inserirAntenaGrafo(criarGrafo(rede, freq), freq, x, y);
+	}
+	VERIFICAR(encontrarGrafoPorFrequencia(rede, 'A')->numVertices > 80);
+
+	int threads[] = { 1, 2, 4, 0 };
+	RELATORIO_INTERFERENCIA* primeiro = NULL;
+	for (int t = 0; t < 4; t++) {
+		RELATORIO_INTERFERENCIA* relatorio = gerarRelatorioInterferencia(rede, threads[t]);
+		VERIFICAR(relatorio != NULL);
+		if (relatorio == NULL) continue;
+		VERIFICAR(linhasErradas(rede, relatorio) == 0);
+		if (primeiro == NULL) primeiro = relatorio;
+		else
+		{
+			// O resultado não depende do número de threads
+			VERIFICAR(relatorio->numLinhas == primeiro->numLinhas);
+			VERIFICAR(memcmp(relatorio->linhas, primeiro->linhas, (size_t)primeiro->numLinhas * sizeof(LINHA_RELATORIO)) == 0);
+			destruirRelatorioInterferencia(relatorio);
+		}
+	}
+	if (primeiro == NULL) TERMINAR_TESTES();
+
+	// CSV: cabeçalho e uma linha por antena
+	FILE* fp = tmpfile();
+	VERIFICAR(fp != NULL);
+	if (fp != NULL)
+	{
+		VERIFICAR(exportarRelatorioCSV(primeiro, fp) == 0);
+		rewind(fp);
+		char cabecalho[128] = "";
+		VERIFICAR(fgets(cabecalho, sizeof(cabecalho), fp) != NULL);
+		VERIFICAR(strcmp(cabecalho, "frequencia,x,y,id,antinodos,ocupados,outras_frequencias\n") == 0);
+		VERIFICAR(contarLinhas(fp) == primeiro->numLinhas);
+		fclose(fp);
+	}
+	VERIFICAR(exportarRelatorioCSV(NULL, stdout) == 1 && exportarRelatorioCSV(primeiro, NULL) == 1);
+
+	// Binário: uma estrutura LINHA_RELATORIO por antena, pela ordem das linhas
+	VERIFICAR(guardarRelatorioBin(primeiro, BINARIO_TESTE));
+	fp = fopen(BINARIO_TESTE, "rb");
+	VERIFICAR(fp != NULL);
+	if (fp != NULL)
+	{
+		int lidas = 0, erradas = 0;
+		LINHA_RELATORIO linha;
+		while (fread(&linha, sizeof(linha), 1, fp) == 1) {
+			if (lidas >= primeiro->numLinhas || memcmp(&linha, &primeiro->linhas[lidas], sizeof(linha)) != 0) erradas++;
+			lidas++;
+		}
+		VERIFICAR(lidas == primeiro->numLinhas && erradas == 0);
+		fclose(fp);
+	}
+	VERIFICAR(!guardarRelatorioBin(NULL, BINARIO_TESTE));
+	primeiro = destruirRelatorioInterferencia(primeiro);
+
+	// Uma rede vazia dá um relatório sem linhas
+	REDE* vazia = criarRede();
+	RELATORIO_INTERFERENCIA* relatorio = gerarRelatorioInterferencia(vazia, 2);
+	VERIFICAR(relatorio != NULL && relatorio->numLinhas == 0 && relatorio->linhas == NULL);
+	relatorio = destruirRelatorioInterferencia(relatorio);
+	destruirRede(vazia);
+	VERIFICAR(gerarRelatorioInterferencia(NULL, 1) == NULL);
+
+	destruirRede(rede);
+	remove(BINARIO_TESTE);
+	TERMINAR_TESTES();
+}
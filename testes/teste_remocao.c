@@ -0,0 +1,100 @@
+/**
+ * @file teste_remocao.c
+ * @brief Testes da remoção de antenas e ligações: listas de adjacências nos dois sentidos,
+ *        contagens do grafo, índice espacial, grelha e reinserção na mesma posição.
+ *
+ * @author Rogério Picas
+ * @date 18-10-2026
+ * @version 1.0
+ */
+#include "testes.h"
+#include "espacial.h"
+#include "grelha.h"
+
+/**
+ * @brief Soma dos graus de todos os vértices, contada pelas listas de adjacências.
+ */
+static int contarArestas(GRAFO* grafo) {
+	int total = 0;
+	for (VERTICE* v = grafo->vertices; v != NULL; v = v->prox) {
+		int grau = 0;
+		for (ARESTA* a = v->adjacentes; a != NULL; a = a->prox) grau++;
+		VERIFICAR(grau == v->grau);
+		total += grau;
+	}
+	return total;
+}
+
+int main() {
+	INICIAR_TESTES();
+
+	REDE* rede = criarRede();
+	GRAFO* grafo = criarGrafo(rede, 'A');
+	VERIFICAR(rede != NULL && grafo != NULL);
+
+	// Estrela com centro em (5, 5) e um ciclo (1, 1) - (1, 2) - (2, 2)
+	int pontas[4][2] = { { 5, 1 }, { 5, 9 }, { 1, 5 }, { 9, 5 } };
+	VERIFICAR(inserirAntenaGrafo(grafo, 'A', 5, 5) == 0);
+	for (int i = 0; i < 4; i++) {
+		VERIFICAR(inserirAntenaGrafo(grafo, 'A', pontas[i][0], pontas[i][1]) == 0);
+		VERIFICAR(conectarVertices(grafo, 5, 5, pontas[i][0], pontas[i][1]) == 0);
+	}
+	VERIFICAR(inserirAntenaGrafo(grafo, 'A', 1, 1) == 0);
+	VERIFICAR(inserirAntenaGrafo(grafo, 'A', 1, 2) == 0);
+	VERIFICAR(inserirAntenaGrafo(grafo, 'A', 2, 2) == 0);
+	VERIFICAR(conectarVertices(grafo, 1, 1, 1, 2) == 0);
+	VERIFICAR(conectarVertices(grafo, 1, 2, 2, 2) == 0);
+	VERIFICAR(conectarVertices(grafo, 2, 2, 1, 1) == 0);
+	VERIFICAR(grafo->numVertices == 8);
+	VERIFICAR(contarArestas(grafo) == 14);
+	VERIFICAR(alcanceTeste(grafo, 5, 1) == 5);
+
+	// Remover uma ligação retira as duas arestas; uma ligação inexistente é recusada
+	VERIFICAR(removerLigacao(grafo, 1, 2, 2, 2) == 0);
+	VERIFICAR(!existeConexaoEntreVertices(grafo, 1, 2, 2, 2));
+	VERIFICAR(!existeConexaoEntreVertices(grafo, 2, 2, 1, 2));
+	VERIFICAR(removerLigacao(grafo, 1, 2, 2, 2) == 1);
+	VERIFICAR(removerLigacao(grafo, 5, 1, 5, 9) == 1);
+	VERIFICAR(contarArestas(grafo) == 12);
+	VERIFICAR(alcanceTeste(grafo, 2, 2) == 3);
+
+	// removerAresta a partir do handle da lista de adjacências
+	VERTICE* canto = encontrarVertice(grafo, 1, 1);
+	VERIFICAR(canto != NULL && canto->adjacentes != NULL);
+	if (canto != NULL && canto->adjacentes != NULL)
+	{
+		VERTICE* vizinho = canto->adjacentes->destino;
+		VERIFICAR(removerAresta(grafo, canto->adjacentes) == 0);
+		VERIFICAR(!existeConexaoEntreVertices(grafo, vizinho->antena.x, vizinho->antena.y, 1, 1));
+	}
+	VERIFICAR(contarArestas(grafo) == 10);
+
+	// Remover o centro da estrela desliga as pontas e tira a antena do índice e da grelha
+	VERIFICAR(removerAntenaGrafo(grafo, 5, 5) == 0);
+	VERIFICAR(grafo->numVertices == 7);
+	VERIFICAR(encontrarVertice(grafo, 5, 5) == NULL);
+	VERIFICAR(procurarIndiceEspacial(rede->indice, grafo, 5, 5, 'A') == NULL);
+	VERIFICAR(!celulaOcupada(rede->grelha, 5, 5));
+	VERIFICAR(contarArestas(grafo) == 2);
+	for (int i = 0; i < 4; i++) {
+		VERIFICAR(alcanceTeste(grafo, pontas[i][0], pontas[i][1]) == 1);
+	}
+	VERIFICAR(removerAntenaGrafo(grafo, 5, 5) == 1);
+
+	// A posição fica livre: a antena pode voltar e ser ligada de novo
+	VERIFICAR(inserirAntenaGrafo(grafo, 'A', 5, 5) == 0);
+	VERIFICAR(procurarIndiceEspacial(rede->indice, grafo, 5, 5, 'A') != NULL);
+	VERIFICAR(celulaOcupada(rede->grelha, 5, 5));
+	VERIFICAR(conectarVertices(grafo, 5, 5, 9, 5) == 0);
+	VERIFICAR(alcanceTeste(grafo, 9, 5) == 2);
+
+	// Remover todas as antenas deixa o grafo vazio
+	while (grafo->vertices != NULL) {
+		VERIFICAR(removerAntenaGrafo(grafo, grafo->vertices->antena.x, grafo->vertices->antena.y) == 0);
+	}
+	VERIFICAR(grafo->numVertices == 0);
+	VERIFICAR(consultarRetangulo(rede->indice, 0, 0, MAX_DIM - 1, MAX_DIM - 1, '\0', NULL, 0) == 0);
+
+	destruirRede(rede);
+	TERMINAR_TESTES();
+}
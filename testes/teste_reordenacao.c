@@ -0,0 +1,152 @@
+/**
+ * @file teste_reordenacao.c
+ * @brief Testes da reordenação dos grafos em blocos contíguos: as quatro ordens, reordenações
+ *        seguidas, remoções e inserções num grafo reordenado e as consultas depois de cada passo.
+ *
+ * @author Rogério Picas
+ * @date 18-10-2026
+ * @version 1.0
+ */
+#include <stdlib.h>
+#include <string.h>
+#include "testes.h"
+#include "reordenacao.h"
+#include "gerador.h"
+
+ /** @def NUM_CELULAS
+  *  @brief Número de células da cidade.
+  */
+#define NUM_CELULAS (MAX_DIM * MAX_DIM)
+
+/**
+ * @struct Assinatura
+ * @brief Resumo de uma antena que não depende da disposição em memória: grau, vizinhos e alcance.
+ */
+typedef struct Assinatura {
+    int existe;           /**< 1 se houver uma antena na célula */
+    int grau;             /**< Número de ligações */
+    long long vizinhos;   /**< Soma das células dos vizinhos */
+    long long quadrados;  /**< Soma dos quadrados das células dos vizinhos */
+    int alcance;          /**< Antenas alcançáveis (BFT) */
+} ASSINATURA;
+
+/**
+ * @brief Calcula a assinatura de cada célula do grafo.
+ */
+static void assinar(GRAFO* grafo, ASSINATURA* assinaturas) {
+	memset(assinaturas, 0, NUM_CELULAS * sizeof(ASSINATURA));
+	for (VERTICE* v = grafo->vertices; v != NULL; v = v->prox) {
+		ASSINATURA* a = &assinaturas[v->antena.x * MAX_DIM + v->antena.y];
+		a->existe = 1;
+		for (ARESTA* e = v->adjacentes; e != NULL; e = e->prox) {
+			long long celula = e->destino->antena.x * MAX_DIM + e->destino->antena.y;
+			a->grau++;
+			a->vizinhos += celula;
+			a->quadrados += celula * celula;
+		}
+	}
+	for (int c = 0; c < NUM_CELULAS; c++) {
+		if (assinaturas[c].existe) assinaturas[c].alcance = alcanceTeste(grafo, c / MAX_DIM, c % MAX_DIM);
+	}
+}
+
+/**
+ * @brief Verifica que o grafo reordenado tem as mesmas antenas, ligações e alcances, e que a lista está no bloco.
+ */
+static void verificarReordenado(GRAFO* grafo, const ASSINATURA* antes) {
+	static ASSINATURA depois[NUM_CELULAS];
+	assinar(grafo, depois);
+	VERIFICAR(memcmp(antes, depois, sizeof(depois)) == 0);
+
+	const BLOCO_GRAFO* bloco = grafo->bloco;
+	VERIFICAR(bloco != NULL && bloco->numVertices == grafo->numVertices);
+	int n = 0;
+	VERTICE* anterior = NULL;
+	for (VERTICE* v = grafo->vertices; v != NULL; v = v->prox, n++) {
+		VERIFICAR(v->ant == anterior);
+		VERIFICAR(bloco != NULL && dentroBloco(v, bloco->vertices, bloco->numVertices, sizeof(VERTICE)));
+		VERIFICAR(encontrarVertice(grafo, v->antena.x, v->antena.y) == v);
+		for (ARESTA* e = v->adjacentes; e != NULL; e = e->prox) {
+			VERIFICAR(e->inversa != NULL && e->inversa->inversa == e && e->inversa->destino == v);
+		}
+		anterior = v;
+	}
+	VERIFICAR(n == grafo->numVertices);
+}
+
+int main() {
+	INICIAR_TESTES();
+
+	REDE* rede = criarRede();
+	GRAFO* grafo = criarGrafo(rede, 'R');
+	uint64_t estado = 12345;
+	while (grafo->numVertices < 120) {
+		inserirAntenaGrafo(grafo, 'R', (int)(proximoAleatorio(&estado) % MAX_DIM), (int)(proximoAleatorio(&estado) % MAX_DIM));
+	}
+	int numIds = grafo->numVertices;
+	VERTICE** porId = (VERTICE**)malloc((size_t)numIds * sizeof(VERTICE*));
+	int k = 0;
+	for (VERTICE* v = grafo->vertices; v != NULL; v = v->prox) porId[k++] = v;
+	for (int i = 0; i < 200; i++) {
+		VERTICE* a = porId[proximoAleatorio(&estado) % numIds];
+		VERTICE* b = porId[proximoAleatorio(&estado) % numIds];
+		if (a != b && !existeConexaoEntreVertices(grafo, a->antena.x, a->antena.y, b->antena.x, b->antena.y))
+		{
+			conectarVertices(grafo, a->antena.x, a->antena.y, b->antena.x, b->antena.y);
+		}
+	}
+	free(porId);
+
+	static ASSINATURA antes[NUM_CELULAS];
+	assinar(grafo, antes);
+
+	// Cada ordem, aplicada sobre o bloco da ordem anterior, mantém o grafo e devolve uma permutação dos ids
+	ORDEM_VERTICES ordens[] = { ORDEM_MORTON, ORDEM_HILBERT, ORDEM_BFS, ORDEM_RCM, ORDEM_MORTON };
+	int* ids = (int*)malloc((size_t)grafo->numVertices * sizeof(int));
+	char* vistos = (char*)malloc((size_t)grafo->proximoId);
+	for (int o = 0; o < (int)(sizeof(ordens) / sizeof(ordens[0])); o++) {
+		VERIFICAR(reordenarGrafo(grafo, ordens[o], ids) == 0);
+		verificarReordenado(grafo, antes);
+
+		memset(vistos, 0, (size_t)grafo->proximoId);
+		int repetidos = 0;
+		for (int i = 0; i < grafo->numVertices; i++) {
+			if (ids[i] < 0 || ids[i] >= grafo->proximoId || vistos[ids[i]]++) repetidos++;
+		}
+		VERIFICAR(repetidos == 0);
+	}
+
+	// Na ordem de Morton as chaves das antenas ficam por ordem crescente
+	int fora = 0;
+	for (VERTICE* v = grafo->vertices; v != NULL && v->prox != NULL; v = v->prox) {
+		if (chaveMorton(v->antena.x, v->antena.y) > chaveMorton(v->prox->antena.x, v->prox->antena.y)) fora++;
+	}
+	VERIFICAR(fora == 0);
+
+	// Remoções e inserções num grafo reordenado misturam nós do bloco e nós alocados à parte
+	VERTICE* primeiro = grafo->vertices;
+	int x = primeiro->antena.x, y = primeiro->antena.y;
+	VERIFICAR(removerAntenaGrafo(grafo, x, y) == 0);
+	VERIFICAR(encontrarVertice(grafo, x, y) == NULL);
+	VERTICE* comLigacao = grafo->vertices;
+	while (comLigacao != NULL && comLigacao->adjacentes == NULL) comLigacao = comLigacao->prox;
+	VERIFICAR(comLigacao != NULL);
+	if (comLigacao != NULL)
+	{
+		VERTICE* vizinho = comLigacao->adjacentes->destino;
+		VERIFICAR(removerLigacao(grafo, comLigacao->antena.x, comLigacao->antena.y, vizinho->antena.x, vizinho->antena.y) == 0);
+	}
+	VERIFICAR(inserirAntenaGrafo(grafo, 'R', x, y) == 0);
+	VERIFICAR(conectarVertices(grafo, x, y, grafo->vertices->antena.x, grafo->vertices->antena.y) == 0);
+
+	assinar(grafo, antes);
+	VERIFICAR(reordenarGrafo(grafo, ORDEM_HILBERT, NULL) == 0);
+	verificarReordenado(grafo, antes);
+
+	VERIFICAR(reordenarGrafo(NULL, ORDEM_BFS, NULL) == 1);
+
+	free(ids);
+	free(vistos);
+	destruirRede(rede);
+	TERMINAR_TESTES();
+}
@@ -0,0 +1,119 @@
+/**
+ * @file teste_reserva.c
+ * @brief Testes da reserva de vértices e arestas: uso dos blocos pela ordem de inserção,
+ *        devolução nas remoções, reservas acumuladas, reserva da rede (grafos e baldes do índice espacial),
+ *        validação do grafo pela capacidade e reordenação de um grafo com reserva.
+ *
+ * @author Rogério Picas
+ * @date 18-10-2026
+ * @version 1.0
+ */
+#include "testes.h"
+#include "reserva.h"
+#include "reordenacao.h"
+#include "espacial.h"
+
+int main() {
+	INICIAR_TESTES();
+
+	REDE* rede = criarRede();
+	GRAFO* grafo = criarGrafo(rede, 'B');
+
+	VERIFICAR(reservarGrafo(NULL, 1, 1) == 1);
+	VERIFICAR(reservarGrafo(grafo, -1, 0) == 1);
+	VERIFICAR(!validarGrafo(grafo));
+	VERIFICAR(reservarGrafo(grafo, 10, 6) == 0);
+	VERIFICAR(grafo->maxVertices == 10);
+	VERIFICAR(ligacoesReservadas(grafo) == 6);
+	BLOCO_RESERVA* bloco = grafo->reserva->blocos;
+
+	// As inserções seguidas usam posições seguidas do bloco
+	for (int i = 0; i < 10; i++) {
+		VERIFICAR(inserirAntenaGrafo(grafo, 'B', i, i) == 0);
+		VERIFICAR(encontrarVertice(grafo, i, i) == &bloco->vertices[i]);
+	}
+	VERIFICAR(grafo->reserva->numVerticesLivres == 0);
+	VERIFICAR(grafo->numVertices == 10 && grafo->maxVertices == 10);
+	VERIFICAR(validarGrafo(grafo));
+
+	for (int i = 0; i < 6; i++) {
+		VERIFICAR(conectarVertices(grafo, i, i, i + 1, i + 1) == 0);
+	}
+	VERIFICAR(ligacoesReservadas(grafo) == 0);
+	VERTICE* v0 = encontrarVertice(grafo, 0, 0);
+	VERIFICAR(v0->adjacentes != NULL && dentroBloco(v0->adjacentes, bloco->arestas, bloco->numArestas, sizeof(ARESTA)));
+
+	// Sem arestas livres, a ligação seguinte é alocada à parte
+	VERIFICAR(conectarVertices(grafo, 8, 8, 9, 9) == 0);
+	VERTICE* v9 = encontrarVertice(grafo, 9, 9);
+	VERIFICAR(!dentroBloco(v9->adjacentes, bloco->arestas, bloco->numArestas, sizeof(ARESTA)));
+	VERIFICAR(alcanceTeste(grafo, 0, 0) == 7);
+
+	// As remoções devolvem os nós do bloco, e a inserção seguinte volta a usá-los
+	VERIFICAR(removerLigacao(grafo, 2, 2, 3, 3) == 0);
+	VERIFICAR(ligacoesReservadas(grafo) == 1);
+	VERIFICAR(removerLigacao(grafo, 8, 8, 9, 9) == 0);
+	VERIFICAR(ligacoesReservadas(grafo) == 1);
+	VERIFICAR(conectarVertices(grafo, 2, 2, 3, 3) == 0);
+	VERIFICAR(ligacoesReservadas(grafo) == 0);
+
+	VERIFICAR(removerAntenaGrafo(grafo, 4, 4) == 0);
+	VERIFICAR(grafo->reserva->numVerticesLivres == 1);
+	VERIFICAR(grafo->maxVertices == 10);
+	VERIFICAR(ligacoesReservadas(grafo) == 2);
+	VERIFICAR(inserirAntenaGrafo(grafo, 'B', 15, 4) == 0);
+	VERIFICAR(encontrarVertice(grafo, 15, 4) == &bloco->vertices[4]);
+
+	// Uma nova reserva só acrescenta o que falta
+	VERIFICAR(removerAntenaGrafo(grafo, 9, 9) == 0);
+	VERIFICAR(reservarGrafo(grafo, 5, 0) == 0);
+	VERIFICAR(grafo->reserva->numVerticesLivres == 5);
+	VERIFICAR(grafo->reserva->blocos != bloco && grafo->reserva->blocos->numVertices == 4);
+	VERIFICAR(grafo->maxVertices == grafo->numVertices + 5);
+	VERIFICAR(reservarGrafo(grafo, 3, 1) == 0);
+	VERIFICAR(grafo->reserva->numVerticesLivres == 5);
+
+	// reservarRede cria os grafos em falta com os vértices de cada frequência
+	ANTENAS antenas[] = { { 1, 2, 'C' }, { 3, 4, 'D' }, { 5, 6, 'C' }, { 7, 8, 'C' } };
+	VERIFICAR(reservarRede(rede, antenas, 4) == 0);
+	GRAFO* c = encontrarGrafoPorFrequencia(rede, 'C');
+	GRAFO* d = encontrarGrafoPorFrequencia(rede, 'D');
+	VERIFICAR(c != NULL && c->maxVertices == 3);
+	VERIFICAR(d != NULL && d->maxVertices == 1);
+	VERIFICAR(reservarRede(NULL, antenas, 4) == 1);
+
+	// Os baldes das antenas já comportam as inserções; guardar o array mostra que não voltam a crescer
+	ENTRADA_INDICE* entradas[4];
+	for (int i = 0; i < 4; i++) {
+		BALDE* balde = obterBalde(rede->indice, antenas[i].x, antenas[i].y);
+		VERIFICAR(balde != NULL && balde->capacidade > balde->numEntradas);
+		entradas[i] = balde != NULL ? balde->entradas : NULL;
+	}
+	for (int i = 0; i < 4; i++) {
+		VERIFICAR(inserirAntenaGrafo(encontrarGrafoPorFrequencia(rede, antenas[i].frequencia),
+			antenas[i].frequencia, antenas[i].x, antenas[i].y) == 0);
+	}
+	VERIFICAR(c->reserva->numVerticesLivres == 0 && c->numVertices == 3);
+	VERIFICAR(validarGrafo(c) && validarGrafo(d));
+	for (int i = 0; i < 4; i++) {
+		VERIFICAR(obterBalde(rede->indice, antenas[i].x, antenas[i].y)->entradas == entradas[i]);
+	}
+
+	// A reordenação copia os vértices para o seu bloco e devolve à reserva os que estavam nela;
+	// depois disso, as remoções não tocam na reserva e as inserções voltam a usá-la
+	int alcance = alcanceTeste(grafo, 0, 0);
+	int livres = grafo->reserva->numVerticesLivres;
+	VERIFICAR(reordenarGrafo(grafo, ORDEM_BFS, NULL) == 0);
+	VERIFICAR(alcanceTeste(grafo, 0, 0) == alcance);
+	VERIFICAR(grafo->reserva->numVerticesLivres == livres + grafo->numVertices);
+	VERIFICAR(grafo->maxVertices == grafo->numVertices + grafo->reserva->numVerticesLivres);
+	livres = grafo->reserva->numVerticesLivres;
+	VERIFICAR(removerAntenaGrafo(grafo, 0, 0) == 0);
+	VERIFICAR(grafo->reserva->numVerticesLivres == livres);
+	VERIFICAR(inserirAntenaGrafo(grafo, 'B', 0, 0) == 0);
+	VERIFICAR(grafo->reserva->numVerticesLivres == livres - 1);
+	VERIFICAR(validarGrafo(grafo));
+
+	destruirRede(rede);
+	TERMINAR_TESTES();
+}
@@ -0,0 +1,333 @@
+/**
+ * @file teste_servidor.c
+ * @brief Teste do servidor de consultas (só Linux): arranca o executável do servidor com um mapa
+ *        gerado, envia pedidos de todos os tipos por duas ligações em simultâneo, sem esperar pelas
+ *        respostas, e compara cada resposta com a biblioteca sobre a mesma rede; verifica também que
+ *        um pedido incompleto não afeta o servidor e que o SIGTERM o termina sem erros.
+ *
+ * O caminho do executável do servidor é o primeiro argumento. O teste usa a biblioteca com a
+ * dimensão do benchmark (a do servidor), para que as contagens de antinodos sejam as mesmas.
+ * Os ficheiros são criados na pasta de trabalho do teste e apagados no fim.
+ *
+ * @author Rogério Picas
+ * @date 18-10-2026
+ * @version 1.0
+ */
+#define _POSIX_C_SOURCE 200809L
+#include <errno.h>
+#include <signal.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/wait.h>
+#include "testes.h"
+#include "protocolo.h"
+#include "delta.h"
+#include "antinodos.h"
+#include "gerador.h"
+
+ /** @def ALTERACOES_TESTE
+  *  @brief Ficheiro de alterações com o mapa carregado pelo servidor.
+  */
+#define ALTERACOES_TESTE "teste_servidor_tmp.txt"
+
+ /** @def SOCKET_TESTE
+  *  @brief Caminho do socket do servidor.
+  */
+#define SOCKET_TESTE "teste_servidor_tmp.sock"
+
+ /** @def NUM_PEDIDOS
+  *  @brief Pedidos enviados por cada ligação (cabem, com as respostas, nos buffers do socket).
+  */
+#define NUM_PEDIDOS 3000
+
+ /** @def NUM_LIGACOES
+  *  @brief Ligações abertas em simultâneo.
+  */
+#define NUM_LIGACOES 2
+
+/**
+ * @brief Escreve o mapa gerado como alterações (inserir as antenas e depois ligá-las).
+ * @return 0 se o ficheiro foi escrito, 1 caso contrário.
+ */
+static int escreverAlteracoes(const MAPA_GERADO* mapa) {
+	FILE* fp = fopen(ALTERACOES_TESTE, "w");
+	if (fp == NULL) return 1;
+	int erro = 0;
+	for (int i = 0; i < mapa->numAntenas && !erro; i++) {
+		DELTA d = { DELTA_INSERIR, mapa->antenas[i].frequencia, mapa->antenas[i].x, mapa->antenas[i].y, 0, 0 };
+		erro = escreverDelta(fp, &d);
+	}
+	for (int i = 0; i < mapa->numLigacoes && !erro; i++) {
+		const LIGACAO_GERADA* l = &mapa->ligacoes[i];
+		DELTA d = { DELTA_LIGAR, l->frequencia, l->x1, l->y1, l->x2, l->y2 };
+		erro = escreverDelta(fp, &d);
+	}
+	if (fclose(fp) != 0) erro = 1;
+	return erro;
+}
+
+/**
+ * @brief Liga ao socket do servidor, tentando de novo enquanto o servidor arranca (até 10 segundos).
+ * @return Descritor da ligação, ou -1 se o servidor terminou ou não ficou disponível.
+ */
+static int ligarServidor(pid_t servidor) {
+	struct sockaddr_un endereco = { 0 };
+	endereco.sun_family = AF_UNIX;
+	strcpy(endereco.sun_path, SOCKET_TESTE);
+	struct timespec espera = { 0, 10 * 1000 * 1000 };
+
+	for (int tentativa = 0; tentativa < 1000; tentativa++) {
+		int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+		if (fd < 0) return -1;
+		if (connect(fd, (struct sockaddr*)&endereco, sizeof(endereco)) == 0) return fd;
+		close(fd);
+		if (waitpid(servidor, NULL, WNOHANG) != 0) return -1;
+		nanosleep(&espera, NULL);
+	}
+	return -1;
+}
+
+/**
+ * @brief Escreve todos os bytes no socket.
+ * @return true se foram todos escritos.
+ */
+static bool escreverTudo(int fd, const void* dados, size_t tamanho) {
+	const char* p = (const char*)dados;
+	while (tamanho > 0) {
+		ssize_t n = write(fd, p, tamanho);
+		if (n < 0 && errno == EINTR) continue;
+		if (n <= 0) return false;
+		p += n;
+		tamanho -= (size_t)n;
+	}
+	return true;
+}
+
+/**
+ * @brief Lê do socket até o servidor fechar a ligação.
+ * @return Número de bytes lidos (no máximo @p max), ou -1 em caso de erro.
+ */
+static long lerAteFim(int fd, void* dados, size_t max) {
+	char* p = (char*)dados;
+	size_t lidos = 0;
+	while (lidos < max) {
+		ssize_t n = read(fd, p + lidos, max - lidos);
+		if (n < 0 && errno == EINTR) continue;
+		if (n < 0) return -1;
+		if (n == 0) break;
+		lidos += (size_t)n;
+	}
+	return (long)lidos;
+}
+
+/**
+ * @brief Menor número de ligações entre duas antenas, por uma procura em largura sobre as listas.
+ * @return Distância, ou -1 se não houver caminho.
+ */
+static int distanciaTeste(GRAFO* grafo, VERTICE* origem, VERTICE* destino) {
+	int n = 0;
+	for (VERTICE* v = grafo->vertices; v != NULL; v = v->prox) v->indice = n++;
+	VERTICE** fila = (VERTICE**)malloc((size_t)n * sizeof(VERTICE*));
+	int* distancia = (int*)malloc((size_t)n * sizeof(int));
+	int resultado = -1;
+	if (fila != NULL && distancia != NULL)
+	{
+		for (int i = 0; i < n; i++) distancia[i] = -1;
+		int inicio = 0, fim = 0;
+		fila[fim++] = origem;
+		distancia[origem->indice] = 0;
+		while (inicio < fim) {
+			VERTICE* v = fila[inicio++];
+			for (ARESTA* a = v->adjacentes; a != NULL; a = a->prox) {
+				if (distancia[a->destino->indice] >= 0) continue;
+				distancia[a->destino->indice] = distancia[v->indice] + 1;
+				fila[fim++] = a->destino;
+			}
+		}
+		resultado = distancia[destino->indice];
+	}
+	free(fila);
+	free(distancia);
+	return resultado;
+}
+
+/**
+ * @brief Cria um pedido aleatório: quase sempre sobre antenas e células do mapa, às vezes com uma
+ *        frequência ou antena inexistente ou um tipo desconhecido.
+ */
+static PEDIDO_SERVIDOR pedidoAleatorio(const MAPA_GERADO* mapa, uint32_t id, uint64_t* estado) {
+	PEDIDO_SERVIDOR p = { 0 };
+	const ANTENAS* a = &mapa->antenas[proximoAleatorio(estado) % (uint32_t)mapa->numAntenas];
+	const ANTENAS* b = &mapa->antenas[proximoAleatorio(estado) % (uint32_t)mapa->numAntenas];
+	p.id = id;
+	p.tipo = (uint8_t)(PEDIDO_PROCURAR + proximoAleatorio(estado) % 5);
+	p.frequencia = a->frequencia;
+	p.x1 = a->x;
+	p.y1 = a->y;
+	p.x2 = b->x;
+	p.y2 = b->y;
+
+	// Metade das ligações pedidas existem no mapa
+	if (p.tipo == PEDIDO_LIGACAO && proximoAleatorio(estado) % 2)
+	{
+		const LIGACAO_GERADA* l = &mapa->ligacoes[proximoAleatorio(estado) % (uint32_t)mapa->numLigacoes];
+		p.frequencia = l->frequencia;
+		p.x1 = l->x1;
+		p.y1 = l->y1;
+		p.x2 = l->x2;
+		p.y2 = l->y2;
+	}
+
+	// Interferência na posição simétrica de a em relação a b, onde há efeito nefasto se tiverem a mesma frequência
+	if (p.tipo == PEDIDO_INTERFERENCIA)
+	{
+		int x = 2 * a->x - b->x, y = 2 * a->y - b->y;
+		if (x >= 0 && x < MAX_DIM && y >= 0 && y < MAX_DIM)
+		{
+			p.x1 = x;
+			p.y1 = y;
+		}
+		if (proximoAleatorio(estado) % 2) p.frequencia = FREQUENCIA_TODAS;
+	}
+
+	switch (proximoAleatorio(estado) % 20) {
+	case 0: p.frequencia = '~'; break;
+	case 1: p.tipo = 9; break;
+	case 2: p.tipo = 0; break;
+	case 3: if (p.tipo != PEDIDO_INTERFERENCIA) p.x1 = -1; break;
+	default: break;
+	}
+	return p;
+}
+
+/**
+ * @brief Resposta esperada para um pedido, calculada com a biblioteca sobre a rede local.
+ */
+static RESPOSTA_SERVIDOR respostaEsperada(REDE* rede, const PEDIDO_SERVIDOR* p) {
+	RESPOSTA_SERVIDOR r = { p->id, p->tipo, RESPOSTA_OK, 0, 0 };
+	if (p->tipo == PEDIDO_INTERFERENCIA)
+	{
+		r.estado = RESPOSTA_NAO_ENCONTRADO;
+		for (GRAFO* g = rede->listaGrafos; g != NULL; g = g->prox) {
+			if (p->frequencia != FREQUENCIA_TODAS && g->frequencia != p->frequencia) continue;
+			r.valor += contagemAntinodo(g, p->x1, p->y1);
+			r.estado = RESPOSTA_OK;
+		}
+		return r;
+	}
+	if (p->tipo < PEDIDO_PROCURAR || p->tipo > PEDIDO_DISTANCIA)
+	{
+		r.estado = RESPOSTA_INVALIDO;
+		return r;
+	}
+
+	GRAFO* grafo = encontrarGrafoPorFrequencia(rede, p->frequencia);
+	VERTICE* origem = grafo ? encontrarVertice(grafo, p->x1, p->y1) : NULL;
+	VERTICE* destino = grafo ? encontrarVertice(grafo, p->x2, p->y2) : NULL;
+	if (grafo == NULL) r.estado = RESPOSTA_NAO_ENCONTRADO;
+	else if (p->tipo == PEDIDO_PROCURAR) r.valor = origem != NULL;
+	else if (origem == NULL || (p->tipo != PEDIDO_ALCANCE && destino == NULL)) r.estado = RESPOSTA_NAO_ENCONTRADO;
+	else if (p->tipo == PEDIDO_LIGACAO) r.valor = existeConexaoEntreVertices(grafo, p->x1, p->y1, p->x2, p->y2);
+	else if (p->tipo == PEDIDO_ALCANCE) r.valor = alcanceTeste(grafo, p->x1, p->y1);
+	else r.valor = distanciaTeste(grafo, origem, destino);
+	return r;
+}
+
+int main(int argc, char* argv[]) {
+	INICIAR_TESTES();
+	VERIFICAR(argc == 2);
+	if (argc != 2) TERMINAR_TESTES();
+
+	// Mapa com poucas frequências, para haver caminhos longos e efeito nefasto
+	MAPA_GERADO* mapa = gerarMapa(400, 3, 3.0, 49);
+	VERIFICAR(mapa != NULL && mapa->numLigacoes > 0);
+	if (mapa == NULL || mapa->numLigacoes == 0) TERMINAR_TESTES();
+	VERIFICAR(escreverAlteracoes(mapa) == 0);
+
+	REDE* rede = criarRede();
+	VERIFICAR(carregarDeltas(rede, ALTERACOES_TESTE, 0, NULL) == 0);
+	for (GRAFO* g = rede->listaGrafos; g != NULL; g = g->prox) {
+		VERIFICAR(ativarAntinodos(g) == 0);
+	}
+
+	pid_t servidor = fork();
+	VERIFICAR(servidor >= 0);
+	if (servidor == 0)
+	{
+		execl(argv[1], argv[1], "--socket", SOCKET_TESTE, "--alteracoes", ALTERACOES_TESTE,
+			"--threads", "3", "--lote", "16", (char*)NULL);
+		_exit(127);
+	}
+	if (servidor < 0) TERMINAR_TESTES();
+
+	// Um cliente que envia meio pedido e fecha não afeta os seguintes
+	int incompleto = ligarServidor(servidor);
+	VERIFICAR(incompleto >= 0);
+	if (incompleto >= 0)
+	{
+		PEDIDO_SERVIDOR p = { 0 };
+		VERIFICAR(escreverTudo(incompleto, &p, sizeof(p) / 2));
+		close(incompleto);
+	}
+
+	// Todos os pedidos das ligações são enviados antes de ler qualquer resposta
+	static PEDIDO_SERVIDOR pedidos[NUM_LIGACOES][NUM_PEDIDOS];
+	static RESPOSTA_SERVIDOR respostas[NUM_PEDIDOS + 1];
+	int ligacoes[NUM_LIGACOES];
+	uint64_t estado = 2049;
+	for (int c = 0; c < NUM_LIGACOES; c++) {
+		for (int i = 0; i < NUM_PEDIDOS; i++) {
+			pedidos[c][i] = pedidoAleatorio(mapa, (uint32_t)(c * 100000 + i), &estado);
+		}
+		ligacoes[c] = ligarServidor(servidor);
+		VERIFICAR(ligacoes[c] >= 0);
+		if (ligacoes[c] < 0) continue;
+		VERIFICAR(escreverTudo(ligacoes[c], pedidos[c], sizeof(pedidos[c])));
+		shutdown(ligacoes[c], SHUT_WR);
+	}
+
+	// Cada pedido tem uma resposta, por qualquer ordem, igual à da biblioteca
+	for (int c = 0; c < NUM_LIGACOES; c++) {
+		if (ligacoes[c] < 0) continue;
+		long lidos = lerAteFim(ligacoes[c], respostas, sizeof(respostas));
+		close(ligacoes[c]);
+		VERIFICAR(lidos == (long)(NUM_PEDIDOS * sizeof(RESPOSTA_SERVIDOR)));
+		if (lidos != (long)(NUM_PEDIDOS * sizeof(RESPOSTA_SERVIDOR))) continue;
+
+		static bool respondido[NUM_PEDIDOS];
+		memset(respondido, 0, sizeof(respondido));
+		int erradas = 0, ok = 0;
+		for (int k = 0; k < NUM_PEDIDOS; k++) {
+			const RESPOSTA_SERVIDOR* r = &respostas[k];
+			int i = (int)r->id - c * 100000;
+			if (i < 0 || i >= NUM_PEDIDOS || respondido[i])
+			{
+				erradas++;
+				continue;
+			}
+			respondido[i] = true;
+			RESPOSTA_SERVIDOR esperada = respostaEsperada(rede, &pedidos[c][i]);
+			if (r->tipo != esperada.tipo || r->estado != esperada.estado || r->reservado != 0) erradas++;
+			else if (r->estado == RESPOSTA_OK && r->valor != esperada.valor) erradas++;
+			if (esperada.estado == RESPOSTA_OK) ok++;
+		}
+		VERIFICAR(erradas == 0);
+		VERIFICAR(ok > NUM_PEDIDOS / 2);
+	}
+
+	// O SIGTERM termina o servidor, que apaga o socket
+	int estadoServidor = -1;
+	kill(servidor, SIGTERM);
+	VERIFICAR(waitpid(servidor, &estadoServidor, 0) == servidor);
+	VERIFICAR(WIFEXITED(estadoServidor) && WEXITSTATUS(estadoServidor) == 0);
+	VERIFICAR(access(SOCKET_TESTE, F_OK) != 0);
+
+	destruirRede(rede);
+	destruirMapa(mapa);
+	remove(ALTERACOES_TESTE);
+	TERMINAR_TESTES();
+}
@@ -0,0 +1,198 @@
+/**
+ * @file teste_versoes.c
+ * @brief Testes das versões da rede: conteúdo das vistas (comparado com as listas de um grafo
+ *        aleatório, sem escrever nos vértices), reutilização das vistas de grafos sem alterações e
+ *        recolha das versões substituídas só depois de os leitores saírem (EBR).
+ *
+ * As leituras são intercaladas numa só thread, pela ordem que se quer verificar; com
+ * AddressSanitizer, uma versão libertada cedo demais aparece como uso de memória libertada.
+ *
+ * @author Rogério Picas
+ * @date 18-10-2026
+ * @version 1.0
+ */
+#include "testes.h"
+#include "versoes.h"
+#include "antinodos.h"
+#include "gerador.h"
+
+ /** @def INDICE_TESTE
+  *  @brief Valor posto no campo indice dos vértices, que a publicação não pode alterar.
+  */
+#define INDICE_TESTE -12345
+
+/**
+ * @brief Compara uma vista com as listas do grafo: as mesmas antenas e, para cada uma, os mesmos destinos.
+ * @return Número de diferenças.
+ */
+static int vistaErrada(GRAFO* grafo, const VISTA_GRAFO* vista) {
+	if (vista == NULL || vista->numVertices != grafo->numVertices) return 1;
+	int erradas = 0;
+	for (VERTICE* v = grafo->vertices; v != NULL; v = v->prox) {
+		int i = procurarAntenaVista(vista, v->antena.x, v->antena.y);
+		if (i < 0)
+		{
+			erradas++;
+			continue;
+		}
+		// Os destinos são os das listas, pela mesma ordem (as ligações repetidas também)
+		int k = vista->inicio[i];
+		for (ARESTA* adj = v->adjacentes; adj != NULL; adj = adj->prox, k++) {
+			if (k >= vista->inicio[i + 1]) erradas++;
+			else if (procurarAntenaVista(vista, adj->destino->antena.x, adj->destino->antena.y) != vista->destinos[k]) erradas++;
+		}
+		if (k != vista->inicio[i + 1]) erradas++;
+	}
+	return erradas;
+}
+
+/**
+ * @brief Conta os vértices do grafo cujo campo indice já não tem o valor posto pelo teste.
+ */
+static int indicesAlterados(GRAFO* grafo) {
+	int alterados = 0;
+	for (VERTICE* v = grafo->vertices; v != NULL; v = v->prox) {
+		if (v->indice != INDICE_TESTE) alterados++;
+	}
+	return alterados;
+}
+
+int main() {
+	INICIAR_TESTES();
+
+	// Grafo A: caminho (2, 2) - (2, 5) - (7, 1); grafo B: duas antenas ligadas, com antinodos
+	REDE* rede = criarRede();
+	GRAFO* a = criarGrafo(rede, 'A');
+	GRAFO* b = criarGrafo(rede, 'B');
+	VERIFICAR(inserirAntenaGrafo(a, 'A', 7, 1) == 0);
+	VERIFICAR(inserirAntenaGrafo(a, 'A', 2, 5) == 0);
+	VERIFICAR(inserirAntenaGrafo(a, 'A', 2, 2) == 0);
+	VERIFICAR(conectarVertices(a, 2, 2, 2, 5) == 0);
+	VERIFICAR(conectarVertices(a, 2, 5, 7, 1) == 0);
+	VERIFICAR(inserirAntenaGrafo(b, 'B', 4, 4) == 0);
+	VERIFICAR(inserirAntenaGrafo(b, 'B', 6, 5) == 0);
+	VERIFICAR(conectarVertices(b, 4, 4, 6, 5) == 0);
+	VERIFICAR(ativarAntinodos(b) == 0);
+
+	GESTOR_VERSOES* gestor = criarGestorVersoes(rede);
+	VERIFICAR(gestor != NULL);
+	if (gestor == NULL)
+	{
+		destruirRede(rede);
+		TERMINAR_TESTES();
+	}
+	int leitor = registarLeitor(gestor);
+	VERIFICAR(leitor >= 0);
+
+	// A primeira versão tem uma cópia de cada grafo
+	const VERSAO_REDE* v1 = entrarLeitura(gestor, leitor);
+	VERIFICAR(v1 != NULL && v1->numero == 1 && v1->numGrafos == 2);
+	const VISTA_GRAFO* vistaA = procurarVistaGrafo(v1, 'A');
+	const VISTA_GRAFO* vistaB = procurarVistaGrafo(v1, 'B');
+	VERIFICAR(vistaA != NULL && vistaB != NULL && procurarVistaGrafo(v1, 'C') == NULL);
+	VERIFICAR(vistaA->numVertices == 3 && vistaA->numArestas == 4);
+	for (int i = 1; i < vistaA->numVertices; i++) {
+		const ANTENAS* p = &vistaA->antenas[i - 1];
+		const ANTENAS* q = &vistaA->antenas[i];
+		VERIFICAR(p->x < q->x || (p->x == q->x && p->y < q->y));
+	}
+	VERIFICAR(procurarAntenaVista(vistaA, 2, 5) >= 0 && procurarAntenaVista(vistaA, 5, 2) == -1);
+	VERIFICAR(ligadasVista(vistaA, 2, 2, 2, 5) && ligadasVista(vistaA, 7, 1, 2, 5));
+	VERIFICAR(!ligadasVista(vistaA, 2, 2, 7, 1));
+	VERIFICAR(contarAlcancaveisVista(vistaA, 7, 1) == 3);
+	VERIFICAR(contarAlcancaveisVista(vistaA, 0, 0) == -1);
+
+	// Os antinodos só são copiados se estiverem ativos no grafo
+	VERIFICAR(contagemAntinodoVista(vistaA, 2, 2) == -1);
+	int diferentes = 0;
+	for (int x = 0; x < MAX_DIM; x++) {
+		for (int y = 0; y < MAX_DIM; y++) {
+			if (contagemAntinodoVista(vistaB, x, y) != contagemAntinodo(b, x, y)) diferentes++;
+		}
+	}
+	VERIFICAR(diferentes == 0);
+	VERIFICAR(contagemAntinodoVista(vistaB, 2, 3) == 1 && contagemAntinodoVista(vistaB, 8, 6) == 1);
+
+	// Alterar A e publicar: o leitor que entrou antes continua a ver a versão 1, que não pode ser libertada
+	VERIFICAR(inserirAntenaGrafo(a, 'A', 9, 9) == 0);
+	VERIFICAR(conectarVertices(a, 9, 9, 7, 1) == 0);
+	const VERSAO_REDE* v2 = publicarVersao(gestor);
+	VERIFICAR(v2 != NULL && v2->numero == 2);
+	VERIFICAR(recolherVersoes(gestor) == 0);
+	VERIFICAR(contarAlcancaveisVista(vistaA, 2, 2) == 3);
+	VERIFICAR(procurarAntenaVista(vistaA, 9, 9) == -1);
+
+	// Só a vista do grafo alterado é copiada de novo
+	VERIFICAR(procurarVistaGrafo(v2, 'B') == vistaB && vistaB->referencias == 2);
+	VERIFICAR(procurarVistaGrafo(v2, 'A') != vistaA);
+	VERIFICAR(contarAlcancaveisVista(procurarVistaGrafo(v2, 'A'), 2, 2) == 4);
+
+	// Um segundo leitor entra na versão 2; a versão 3 é publicada com os dois leitores dentro
+	int outro = registarLeitor(gestor);
+	VERIFICAR(outro >= 0 && outro != leitor);
+	VERIFICAR(entrarLeitura(gestor, outro) == v2);
+	VERIFICAR(removerLigacao(a, 2, 2, 2, 5) == 0);
+	const VERSAO_REDE* v3 = publicarVersao(gestor);
+	VERIFICAR(v3 != NULL && v3->numero == 3);
+	VERIFICAR(recolherVersoes(gestor) == 0);
+
+	// À saída do primeiro leitor só a versão 1 é libertada; a 2 espera pelo segundo
+	sairLeitura(gestor, leitor);
+	VERIFICAR(recolherVersoes(gestor) == 1);
+	VERIFICAR(contarAlcancaveisVista(procurarVistaGrafo(v2, 'A'), 9, 9) == 4);
+	VERIFICAR(contarAlcancaveisVista(procurarVistaGrafo(v2, 'B'), 4, 4) == 2);
+	sairLeitura(gestor, outro);
+	VERIFICAR(recolherVersoes(gestor) == 1);
+	VERIFICAR(recolherVersoes(gestor) == 0);
+
+	// Sem leitores dentro, a versão substituída é libertada pela própria publicação
+	VERIFICAR(entrarLeitura(gestor, leitor) == v3);
+	VERIFICAR(contarAlcancaveisVista(procurarVistaGrafo(v3, 'A'), 2, 2) == 1);
+	sairLeitura(gestor, leitor);
+	VERIFICAR(inserirAntenaGrafo(b, 'B', 0, 0) == 0);
+	const VERSAO_REDE* v4 = publicarVersao(gestor);
+	VERIFICAR(v4 != NULL && v4->numero == 4);
+	VERIFICAR(recolherVersoes(gestor) == 0);
+
+	// Um leitor que entra depois da publicação só segura a versão nova
+	VERIFICAR(entrarLeitura(gestor, leitor) == v4);
+	VERIFICAR(publicarVersao(gestor) != NULL);
+	VERIFICAR(recolherVersoes(gestor) == 0);
+	VERIFICAR(contarAlcancaveisVista(procurarVistaGrafo(v4, 'B'), 0, 0) == 1);
+	sairLeitura(gestor, leitor);
+	VERIFICAR(recolherVersoes(gestor) == 1);
+
+	// Grafo aleatório com ligações repetidas: a vista tem os destinos das listas e os vértices não são alterados
+	GRAFO* c = criarGrafo(rede, 'C');
+	uint64_t estado = 47;
+	while (c->numVertices < 150) {
+		inserirAntenaGrafo(c, 'C', (int)(proximoAleatorio(&estado) % MAX_DIM), (int)(proximoAleatorio(&estado) % MAX_DIM));
+	}
+	VERTICE* verticesC[150];
+	int n = 0;
+	for (VERTICE* v = c->vertices; v != NULL; v = v->prox) verticesC[n++] = v;
+	for (int i = 0; i < 400; i++) {
+		VERTICE* p = verticesC[proximoAleatorio(&estado) % n];
+		VERTICE* q = verticesC[proximoAleatorio(&estado) % n];
+		if (p != q) conectarVertices(c, p->antena.x, p->antena.y, q->antena.x, q->antena.y);
+	}
+	for (VERTICE* v = c->vertices; v != NULL; v = v->prox) v->indice = INDICE_TESTE;
+	const VERSAO_REDE* v6 = publicarVersao(gestor);
+	VERIFICAR(v6 != NULL && vistaErrada(c, procurarVistaGrafo(v6, 'C')) == 0);
+	VERIFICAR(vistaErrada(a, procurarVistaGrafo(v6, 'A')) == 0 && vistaErrada(b, procurarVistaGrafo(v6, 'B')) == 0);
+	VERIFICAR(indicesAlterados(c) == 0);
+
+	// As posições de leitor esgotam-se e podem ser reutilizadas
+	libertarLeitor(gestor, outro);
+	int registados = 1;
+	while (registarLeitor(gestor) >= 0) registados++;
+	VERIFICAR(registados == MAX_LEITORES_VERSOES);
+	libertarLeitor(gestor, leitor);
+	VERIFICAR(registarLeitor(gestor) == leitor);
+
+	VERIFICAR(entrarLeitura(NULL, 0) == NULL && entrarLeitura(gestor, MAX_LEITORES_VERSOES) == NULL);
+
+	gestor = destruirGestorVersoes(gestor);
+	destruirRede(rede);
+	TERMINAR_TESTES();
+}
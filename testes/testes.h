@@ -0,0 +1,63 @@
+#pragma once
+
+/**
+ * @file testes.h
+ * @brief Verificações partilhadas pelos testes (um executável por módulo, registado no CTest)
+ *
+ * Cada teste é um main que chama VERIFICAR para cada propriedade e termina com
+ * TERMINAR_TESTES: o código de saída é 0 só se nenhuma verificação falhar. Os testes usam a
+ * biblioteca com a cidade do enunciado (MAX_DIM = 20), pelo que as redes são pequenas e os
+ * resultados podem ser comparados com uma procura exaustiva; só o teste do servidor usa a
+ * dimensão do benchmark, a mesma do executável que arranca.
+ *
+ * @author Rogério Picas
+ * @date 18-10-2026
+ * @version 1.0
+ *
+ */
+#include <stdio.h>
+#include "funcoes.h"
+#include "registo.h"
+
+/** Número de verificações falhadas no teste em curso. */
+static int falhasTeste = 0;
+
+ /** @def VERIFICAR
+  *  @brief Verifica uma condição; se falhar, escreve o ficheiro, a linha e a condição e conta a falha.
+  */
+#define VERIFICAR(condicao) \
+    do { \
+        if (!(condicao)) \
+        { \
+            fprintf(stderr, "%s:%d: falhou: %s\n", __FILE__, __LINE__, #condicao); \
+            falhasTeste++; \
+        } \
+    } while (0)
+
+ /** @def INICIAR_TESTES
+  *  @brief Silencia o registo da biblioteca (só os erros aparecem) antes das verificações.
+  */
+#define INICIAR_TESTES() definirNivelRegisto(REGISTO_ERRO)
+
+ /** @def TERMINAR_TESTES
+  *  @brief Escreve o resumo e devolve o código de saída do teste (0 se tudo passou).
+  */
+#define TERMINAR_TESTES() \
+    do { \
+        if (falhasTeste > 0) fprintf(stderr, "%d verificacoes falharam.\n", falhasTeste); \
+        return falhasTeste > 0 ? 1 : 0; \
+    } while (0)
+
+/**
+ * @brief Número de antenas alcançáveis a partir de uma antena, com a BFT da biblioteca.
+ * @param grafo Apontador para o grafo.
+ * @param x Coordenada X da antena.
+ * @param y Coordenada Y da antena.
+ * @return Número de antenas alcançadas (incluindo a de partida), ou -1 se a antena não existir.
+ */
+static inline int alcanceTeste(GRAFO* grafo, int x, int y) {
+	int count = 0;
+	int erro = BFT(grafo, x, y, &count);
+	resetarVisitados(grafo->vertices);
+	return erro == 0 ? count : -1;
+}
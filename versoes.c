@@ -0,0 +1,601 @@
+/**
+ * @file versoes.c
+ * @brief Implementação das versões imutáveis da rede, com publicação atómica e libertação por épocas.
+ *
+ * O gestor guarda a versão publicada, um contador global de épocas e a época anunciada por cada
+ * leitor (0 fora de uma leitura). Ao publicar, a thread de escrita troca a versão publicada,
+ * incrementa a época global e marca a versão substituída com a nova época; essa versão é
+ * libertada quando a menor época anunciada pelos leitores ativos for igual ou superior à marca.
+ * Todas as operações atómicas são sequencialmente consistentes: o leitor anuncia a época antes
+ * de ler a versão, e a thread de escrita troca a versão antes de ler as épocas dos leitores.
+ *
+ * @author Rogério Picas
+ * @date 18-10-2026
+ * @version 1.0
+ */
+#define _CRT_SECURE_NO_WARNINGS
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include "versoes.h"
+#include "antinodos.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <stdatomic.h>
+#endif
+
+#pragma region Operações Atómicas
+
+#ifdef _WIN32
+
+typedef volatile LONG64 ATOMICO;
+
+static long long carregarAtomico(ATOMICO* p) {
+	return InterlockedCompareExchange64(p, 0, 0);
+}
+
+static void guardarAtomico(ATOMICO* p, long long valor) {
+	InterlockedExchange64(p, valor);
+}
+
+static long long trocarValorAtomico(ATOMICO* p, long long valor) {
+	return InterlockedExchange64(p, valor);
+}
+
+static long long incrementarAtomico(ATOMICO* p) {
+	return InterlockedIncrement64(p);
+}
+
+static bool trocarAtomico(ATOMICO* p, long long esperado, long long novo) {
+	return InterlockedCompareExchange64(p, novo, esperado) == esperado;
+}
+
+#else
+
+typedef _Atomic long long ATOMICO;
+
+static long long carregarAtomico(ATOMICO* p) {
+	return atomic_load(p);
+}
+
+static void guardarAtomico(ATOMICO* p, long long valor) {
+	atomic_store(p, valor);
+}
+
+static long long trocarValorAtomico(ATOMICO* p, long long valor) {
+	return atomic_exchange(p, valor);
+}
+
+static long long incrementarAtomico(ATOMICO* p) {
+	return atomic_fetch_add(p, 1) + 1;
+}
+
+static bool trocarAtomico(ATOMICO* p, long long esperado, long long novo) {
+	return atomic_compare_exchange_strong(p, &esperado, novo);
+}
+
+#endif
+
+#pragma endregion
+
+#pragma region Estruturas Internas
+
+/**
+ * @struct LeitorVersoes
+ * @brief Posição de um leitor, numa linha de cache própria para que os leitores não se atrasem uns aos outros.
+ */
+typedef struct LeitorVersoes {
+    ATOMICO epoca;       /**< Época anunciada na entrada da leitura (0 fora de uma leitura) */
+    ATOMICO ocupado;     /**< 1 se a posição pertencer a uma thread */
+    char preenchimento[64 - 2 * sizeof(long long)];
+} LEITOR_VERSOES;
+
+/**
+ * @struct GestorVersoes
+ * @brief Estado partilhado entre a thread de escrita e os leitores.
+ */
+struct GestorVersoes {
+    REDE* rede;                     /**< Rede de onde as versões são copiadas */
+    ATOMICO publicada;              /**< Versão publicada (apontador guardado como inteiro) */
+    ATOMICO epocaGlobal;            /**< Época atual (começa em 1) */
+    VERSAO_REDE* ultima;            /**< Última versão publicada (só usada pela thread de escrita) */
+    VERSAO_REDE* retiradas;         /**< Versões substituídas, por ordem de substituição */
+    VERSAO_REDE* fimRetiradas;      /**< Última versão da lista das substituídas */
+    LEITOR_VERSOES leitores[MAX_LEITORES_VERSOES]; /**< Posições dos leitores */
+};
+
+#pragma endregion
+
+#pragma region Funções Auxiliares
+
+/**
+ * @brief Compara dois vértices pelas coordenadas da antena (x e depois y), para o qsort.
+ */
+static int compararVerticesPosicao(const void* a, const void* b) {
+	const ANTENAS* pa = &(*(VERTICE* const*)a)->antena;
+	const ANTENAS* pb = &(*(VERTICE* const*)b)->antena;
+	if (pa->x != pb->x) return pa->x < pb->x ? -1 : 1;
+	if (pa->y != pb->y) return pa->y < pb->y ? -1 : 1;
+	return 0;
+}
+
+/**
+ * @brief Posição de um vértice no array ordenado por posição (pesquisa binária pelas coordenadas).
+ */
+static int posicaoOrdenada(VERTICE* const* ordem, int n, const VERTICE* vertice) {
+	VERTICE* const* p = (VERTICE* const*)bsearch(&vertice, ordem, (size_t)n, sizeof(VERTICE*), compararVerticesPosicao);
+	return p != NULL ? (int)(p - ordem) : -1;
+}
+
+/**
+ * @brief Liberta uma vista (as referências não são verificadas).
+ */
+static void libertarVista(VISTA_GRAFO* vista) {
+	if (vista == NULL) return;
+	free(vista->antenas);
+	free(vista->inicio);
+	free(vista->destinos);
+	free(vista->antinodos);
+	free(vista->contagensAntinodos);
+	free(vista);
+}
+
+/**
+ * @brief Copia um grafo para uma vista nova, com as antenas ordenadas por posição.
+ *
+ * A posição do destino de cada ligação é procurada no array ordenado (não há duas antenas na
+ * mesma célula), sem escrever nos vértices: o grafo só é lido, como se espera de uma cópia.
+ *
+ * @param[in] grafo - apontador para o grafo a copiar.
+ *
+ * @return apontador para a vista criada (com uma referência), ou NULL se a alocação falhar.
+ */
+static VISTA_GRAFO* construirVista(GRAFO* grafo) {
+	int n = grafo->numVertices;
+	VISTA_GRAFO* vista = (VISTA_GRAFO*)calloc(1, sizeof(VISTA_GRAFO));
+	VERTICE** ordem = (VERTICE**)malloc((size_t)(n > 0 ? n : 1) * sizeof(VERTICE*));
+	if (vista == NULL || ordem == NULL)
+	{
+		free(ordem);
+		free(vista);
+		return NULL;
+	}
+	vista->frequencia = grafo->frequencia;
+	vista->numVertices = n;
+	vista->epoca = grafo->epoca;
+	vista->referencias = 1;
+
+	int i = 0;
+	long long numArestas = 0;
+	for (VERTICE* v = grafo->vertices; v != NULL && i < n; v = v->prox) {
+		ordem[i++] = v;
+		numArestas += v->grau;
+	}
+	qsort(ordem, (size_t)n, sizeof(VERTICE*), compararVerticesPosicao);
+
+	vista->antenas = (ANTENAS*)malloc((size_t)(n > 0 ? n : 1) * sizeof(ANTENAS));
+	vista->inicio = (int*)malloc((size_t)(n + 1) * sizeof(int));
+	vista->destinos = (int*)malloc((size_t)(numArestas > 0 ? numArestas : 1) * sizeof(int));
+	if (vista->antenas == NULL || vista->inicio == NULL || vista->destinos == NULL)
+	{
+		free(ordem);
+		libertarVista(vista);
+		return NULL;
+	}
+
+	for (i = 0; i < n; i++) {
+		vista->antenas[i] = ordem[i]->antena;
+	}
+	int k = 0;
+	for (i = 0; i < n; i++) {
+		vista->inicio[i] = k;
+		for (ARESTA* adj = ordem[i]->adjacentes; adj != NULL; adj = adj->prox) {
+			vista->destinos[k++] = posicaoOrdenada(ordem, n, adj->destino);
+		}
+	}
+	vista->inicio[n] = k;
+	vista->numArestas = k;
+	free(ordem);
+
+	// As células vêm ordenadas de obterAntinodos; as contagens são lidas da tabela do grafo
+	vista->numAntinodos = -1;
+	if (grafo->antinodos != NULL)
+	{
+		int m = numeroAntinodos(grafo);
+		if (m >= 0)
+		{
+			vista->antinodos = (long long*)malloc((size_t)(m > 0 ? m : 1) * sizeof(long long));
+			vista->contagensAntinodos = (int*)malloc((size_t)(m > 0 ? m : 1) * sizeof(int));
+		}
+		if (vista->antinodos == NULL || vista->contagensAntinodos == NULL || obterAntinodos(grafo, vista->antinodos, m) != m)
+		{
+			libertarVista(vista);
+			return NULL;
+		}
+		for (i = 0; i < m; i++) {
+			long long celula = vista->antinodos[i];
+			vista->contagensAntinodos[i] = contagemAntinodo(grafo, (int)(celula / MAX_DIM), (int)(celula % MAX_DIM));
+		}
+		vista->numAntinodos = m;
+	}
+	return vista;
+}
+
+/**
+ * @brief Liberta uma versão e as vistas que deixaram de ser usadas por outras versões.
+ */
+static void libertarVersao(VERSAO_REDE* versao) {
+	if (versao == NULL) return;
+	for (int i = 0; i < versao->numGrafos; i++) {
+		if (--versao->grafos[i]->referencias == 0)
+		{
+			libertarVista(versao->grafos[i]);
+		}
+	}
+	free(versao->grafos);
+	free(versao);
+}
+
+/**
+ * @brief Procura, na versão anterior, a vista de um grafo que não foi alterado desde então.
+ *
+ * As épocas dos grafos vêm de um contador único da rede, pelo que uma vista com a mesma época
+ * é uma cópia do grafo no seu estado atual. A ativação dos antinodos não muda a época, pelo que
+ * uma vista copiada antes da ativação não é reutilizada.
+ */
+static VISTA_GRAFO* vistaReutilizavel(const VERSAO_REDE* anterior, const GRAFO* grafo) {
+	if (anterior == NULL) return NULL;
+	for (int i = 0; i < anterior->numGrafos; i++) {
+		VISTA_GRAFO* vista = anterior->grafos[i];
+		if (vista->frequencia == grafo->frequencia && vista->epoca == grafo->epoca
+			&& (vista->numAntinodos >= 0) == (grafo->antinodos != NULL))
+		{
+			return vista;
+		}
+	}
+	return NULL;
+}
+
+#pragma endregion
+
+#pragma region Funções de Escrita
+
+/**
+ * @brief Cria o gestor de versões de uma rede e publica a primeira versão.
+ *
+ * @param[in] rede - apontador para a rede.
+ *
+ * @return apontador para o gestor criado, ou NULL se a rede for nula ou a alocação falhar.
+ */
+GESTOR_VERSOES* criarGestorVersoes(REDE* rede) {
+	if (rede == NULL) return NULL;
+
+	GESTOR_VERSOES* gestor = (GESTOR_VERSOES*)calloc(1, sizeof(GESTOR_VERSOES));
+	if (gestor == NULL) return NULL;
+
+	gestor->rede = rede;
+	guardarAtomico(&gestor->publicada, 0);
+	guardarAtomico(&gestor->epocaGlobal, 1);
+	for (int i = 0; i < MAX_LEITORES_VERSOES; i++) {
+		guardarAtomico(&gestor->leitores[i].epoca, 0);
+		guardarAtomico(&gestor->leitores[i].ocupado, 0);
+	}
+	if (publicarVersao(gestor) == NULL)
+	{
+		free(gestor);
+		return NULL;
+	}
+	return gestor;
+}
+
+/**
+ * @brief Publica uma nova versão com o estado atual da rede.
+ *
+ * Só os grafos alterados desde a versão anterior são copiados; os restantes partilham a vista
+ * da versão anterior. A versão substituída fica à espera de ser libertada por @c recolherVersoes,
+ * que é chamada no fim.
+ *
+ * @param[in,out] gestor - apontador para o gestor.
+ *
+ * @return apontador para a versão publicada, ou NULL se o gestor for nulo ou a alocação falhar.
+ */
+const VERSAO_REDE* publicarVersao(GESTOR_VERSOES* gestor) {
+	if (gestor == NULL) return NULL;
+
+	int numGrafos = 0;
+	for (GRAFO* g = gestor->rede->listaGrafos; g != NULL; g = g->prox) {
+		numGrafos++;
+	}
+
+	VERSAO_REDE* nova = (VERSAO_REDE*)calloc(1, sizeof(VERSAO_REDE));
+	if (nova == NULL) return NULL;
+	nova->grafos = (VISTA_GRAFO**)malloc((size_t)(numGrafos > 0 ? numGrafos : 1) * sizeof(VISTA_GRAFO*));
+	if (nova->grafos == NULL)
+	{
+		free(nova);
+		return NULL;
+	}
+
+	VERSAO_REDE* anterior = gestor->ultima;
+	for (GRAFO* g = gestor->rede->listaGrafos; g != NULL; g = g->prox) {
+		VISTA_GRAFO* vista = vistaReutilizavel(anterior, g);
+		if (vista)
+		{
+			vista->referencias++;
+		}
+		else
+		{
+			vista = construirVista(g);
+			if (vista == NULL)
+			{
+				libertarVersao(nova);
+				return NULL;
+			}
+		}
+		nova->grafos[nova->numGrafos++] = vista;
+	}
+	nova->numero = anterior ? anterior->numero + 1 : 1;
+
+	trocarValorAtomico(&gestor->publicada, (long long)(intptr_t)nova);
+	gestor->ultima = nova;
+	if (anterior)
+	{
+		anterior->epocaRetirada = (unsigned long long)incrementarAtomico(&gestor->epocaGlobal);
+		anterior->prox = NULL;
+		if (gestor->fimRetiradas) gestor->fimRetiradas->prox = anterior;
+		else gestor->retiradas = anterior;
+		gestor->fimRetiradas = anterior;
+	}
+	recolherVersoes(gestor);
+	return nova;
+}
+
+/**
+ * @brief Liberta as versões substituídas que já nenhum leitor pode estar a usar.
+ *
+ * As versões estão por ordem de substituição, com épocas crescentes: são libertadas do início
+ * da lista enquanto a marca for menor ou igual à menor época anunciada por um leitor ativo.
+ *
+ * @param[in,out] gestor - apontador para o gestor.
+ *
+ * @return número de versões libertadas.
+ */
+int recolherVersoes(GESTOR_VERSOES* gestor) {
+	if (gestor == NULL || gestor->retiradas == NULL) return 0;
+
+	unsigned long long minima = (unsigned long long)carregarAtomico(&gestor->epocaGlobal);
+	for (int i = 0; i < MAX_LEITORES_VERSOES; i++) {
+		unsigned long long epoca = (unsigned long long)carregarAtomico(&gestor->leitores[i].epoca);
+		if (epoca != 0 && epoca < minima) minima = epoca;
+	}
+
+	int libertadas = 0;
+	while (gestor->retiradas && gestor->retiradas->epocaRetirada <= minima) {
+		VERSAO_REDE* versao = gestor->retiradas;
+		gestor->retiradas = versao->prox;
+		libertarVersao(versao);
+		libertadas++;
+	}
+	if (gestor->retiradas == NULL) gestor->fimRetiradas = NULL;
+	return libertadas;
+}
+
+/**
+ * @brief Liberta o gestor, a versão publicada e as versões substituídas.
+ *
+ * @param[in] gestor - apontador para o gestor a destruir (pode ser NULL).
+ *
+ * @return NULL, indicando que o gestor foi destruído.
+ */
+GESTOR_VERSOES* destruirGestorVersoes(GESTOR_VERSOES* gestor) {
+	if (gestor == NULL) return NULL;
+
+	while (gestor->retiradas) {
+		VERSAO_REDE* versao = gestor->retiradas;
+		gestor->retiradas = versao->prox;
+		libertarVersao(versao);
+	}
+	libertarVersao(gestor->ultima);
+	free(gestor);
+	return NULL;
+}
+
+#pragma endregion
+
+#pragma region Funções de Leitura
+
+/**
+ * @brief Reserva a primeira posição de leitor livre.
+ *
+ * @param[in,out] gestor - apontador para o gestor.
+ *
+ * @return número do leitor, ou -1 se o gestor for nulo ou não houver posições livres.
+ */
+int registarLeitor(GESTOR_VERSOES* gestor) {
+	if (gestor == NULL) return -1;
+
+	for (int i = 0; i < MAX_LEITORES_VERSOES; i++) {
+		if (trocarAtomico(&gestor->leitores[i].ocupado, 0, 1)) return i;
+	}
+	return -1;
+}
+
+/**
+ * @brief Liberta a posição de um leitor.
+ *
+ * @param[in,out] gestor - apontador para o gestor.
+ * @param[in] leitor - número do leitor.
+ */
+void libertarLeitor(GESTOR_VERSOES* gestor, int leitor) {
+	if (gestor == NULL || leitor < 0 || leitor >= MAX_LEITORES_VERSOES) return;
+
+	guardarAtomico(&gestor->leitores[leitor].epoca, 0);
+	guardarAtomico(&gestor->leitores[leitor].ocupado, 0);
+}
+
+/**
+ * @brief Anuncia a época atual e devolve a versão publicada.
+ *
+ * Nenhuma versão publicada depois do anúncio desta época pode ser libertada até @c sairLeitura.
+ *
+ * @param[in,out] gestor - apontador para o gestor.
+ * @param[in] leitor - número do leitor.
+ *
+ * @return apontador para a versão publicada, ou NULL se os argumentos forem inválidos.
+ */
+const VERSAO_REDE* entrarLeitura(GESTOR_VERSOES* gestor, int leitor) {
+	if (gestor == NULL || leitor < 0 || leitor >= MAX_LEITORES_VERSOES) return NULL;
+
+	guardarAtomico(&gestor->leitores[leitor].epoca, carregarAtomico(&gestor->epocaGlobal));
+	return (const VERSAO_REDE*)(intptr_t)carregarAtomico(&gestor->publicada);
+}
+
+/**
+ * @brief Termina a leitura do leitor.
+ *
+ * @param[in,out] gestor - apontador para o gestor.
+ * @param[in] leitor - número do leitor.
+ */
+void sairLeitura(GESTOR_VERSOES* gestor, int leitor) {
+	if (gestor == NULL || leitor < 0 || leitor >= MAX_LEITORES_VERSOES) return;
+
+	guardarAtomico(&gestor->leitores[leitor].epoca, 0);
+}
+
+/**
+ * @brief Procura a vista do grafo de uma frequência numa versão.
+ *
+ * @param[in] versao - apontador para a versão.
+ * @param[in] frequencia - frequência do grafo.
+ *
+ * @return apontador para a vista, ou NULL se não existir.
+ */
+const VISTA_GRAFO* procurarVistaGrafo(const VERSAO_REDE* versao, char frequencia) {
+	if (versao == NULL) return NULL;
+
+	for (int i = 0; i < versao->numGrafos; i++) {
+		if (versao->grafos[i]->frequencia == frequencia) return versao->grafos[i];
+	}
+	return NULL;
+}
+
+/**
+ * @brief Procura uma antena na vista por pesquisa binária sobre as antenas ordenadas.
+ *
+ * @param[in] vista - apontador para a vista.
+ * @param[in] x - coordenada X da antena.
+ * @param[in] y - coordenada Y da antena.
+ *
+ * @return posição da antena, ou -1 se não existir.
+ */
+int procurarAntenaVista(const VISTA_GRAFO* vista, int x, int y) {
+	if (vista == NULL) return -1;
+
+	int inicio = 0;
+	int fim = vista->numVertices - 1;
+	while (inicio <= fim) {
+		int meio = inicio + (fim - inicio) / 2;
+		const ANTENAS* a = &vista->antenas[meio];
+		if (a->x == x && a->y == y) return meio;
+		if (a->x < x || (a->x == x && a->y < y)) inicio = meio + 1;
+		else fim = meio - 1;
+	}
+	return -1;
+}
+
+/**
+ * @brief Verifica se duas antenas da vista estão ligadas, percorrendo as ligações da primeira.
+ *
+ * @param[in] vista - apontador para a vista.
+ * @param[in] xOrigem - coordenada X da primeira antena.
+ * @param[in] yOrigem - coordenada Y da primeira antena.
+ * @param[in] xDestino - coordenada X da segunda antena.
+ * @param[in] yDestino - coordenada Y da segunda antena.
+ *
+ * @return @c true se existir uma ligação, @c false caso contrário ou se alguma antena não existir.
+ */
+bool ligadasVista(const VISTA_GRAFO* vista, int xOrigem, int yOrigem, int xDestino, int yDestino) {
+	int origem = procurarAntenaVista(vista, xOrigem, yOrigem);
+	int destino = procurarAntenaVista(vista, xDestino, yDestino);
+	if (origem < 0 || destino < 0) return false;
+
+	for (int k = vista->inicio[origem]; k < vista->inicio[origem + 1]; k++) {
+		if (vista->destinos[k] == destino) return true;
+	}
+	return false;
+}
+
+/**
+ * @brief Número de pares de antenas da vista com efeito nefasto numa célula (pesquisa binária nas células copiadas).
+ *
+ * @param[in] vista - apontador para a vista.
+ * @param[in] x - coordenada X da célula.
+ * @param[in] y - coordenada Y da célula.
+ *
+ * @return número de pares (0 fora da cidade), ou -1 se a vista for nula ou não tiver os antinodos.
+ */
+int contagemAntinodoVista(const VISTA_GRAFO* vista, int x, int y) {
+	if (vista == NULL || vista->numAntinodos < 0) return -1;
+	if (x < 0 || x >= MAX_DIM || y < 0 || y >= MAX_DIM) return 0;
+
+	long long celula = (long long)x * MAX_DIM + y;
+	int inicio = 0;
+	int fim = vista->numAntinodos - 1;
+	while (inicio <= fim) {
+		int meio = inicio + (fim - inicio) / 2;
+		if (vista->antinodos[meio] == celula) return vista->contagensAntinodos[meio];
+		if (vista->antinodos[meio] < celula) inicio = meio + 1;
+		else fim = meio - 1;
+	}
+	return 0;
+}
+
+/**
+ * @brief Conta as antenas alcançáveis a partir de uma antena, com uma procura em largura sobre o CSR.
+ *
+ * A fila e as marcas de visita são alocadas pela própria chamada, pelo que várias threads
+ * podem percorrer a mesma vista ao mesmo tempo.
+ *
+ * @param[in] vista - apontador para a vista.
+ * @param[in] x - coordenada X da antena de origem.
+ * @param[in] y - coordenada Y da antena de origem.
+ *
+ * @return número de antenas alcançadas (incluindo a origem), ou -1 se a antena não existir ou a alocação falhar.
+ */
+int contarAlcancaveisVista(const VISTA_GRAFO* vista, int x, int y) {
+	int origem = procurarAntenaVista(vista, x, y);
+	if (origem < 0) return -1;
+
+	int* fila = (int*)malloc((size_t)vista->numVertices * sizeof(int));
+	unsigned char* visitado = (unsigned char*)calloc((size_t)vista->numVertices, 1);
+	if (fila == NULL || visitado == NULL)
+	{
+		free(fila);
+		free(visitado);
+		return -1;
+	}
+
+	int frente = 0;
+	int tras = 0;
+	fila[tras++] = origem;
+	visitado[origem] = 1;
+	while (frente < tras) {
+		int atual = fila[frente++];
+		for (int k = vista->inicio[atual]; k < vista->inicio[atual + 1]; k++) {
+			int vizinho = vista->destinos[k];
+			if (!visitado[vizinho])
+			{
+				visitado[vizinho] = 1;
+				fila[tras++] = vizinho;
+			}
+		}
+	}
+
+	free(fila);
+	free(visitado);
+	return tras;
+}
+
+#pragma endregion
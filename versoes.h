@@ -0,0 +1,192 @@
+#pragma once
+
+/**
+ * @file versoes.h
+ * @brief Versões imutáveis da rede, publicadas por uma thread de escrita e lidas por várias
+ *        threads de análise sem locks, com libertação das versões antigas por épocas
+ *
+ * A rede continua a ser alterada só pela thread de escrita, com as funções habituais; essa thread
+ * publica, quando quiser, uma nova versão com @c publicarVersao. Cada versão tem uma vista
+ * compacta (CSR) de cada grafo; os grafos que não foram alterados desde a versão anterior (mesma
+ * época, ver funcoes.h) partilham a vista dessa versão em vez de serem copiados de novo.
+ *
+ * As threads de leitura registam-se uma vez (@c registarLeitor) e rodeiam cada utilização de uma
+ * versão com @c entrarLeitura / @c sairLeitura: a entrada anuncia a época global atual e lê a
+ * versão publicada com duas operações atómicas, sem esperar pela thread de escrita. Uma versão
+ * substituída só é libertada quando todos os leitores ativos tiverem anunciado uma época posterior
+ * à substituição, o que garante que nenhum deles ainda a pode estar a usar.
+ *
+ * @author Rogério Picas
+ * @date 18-10-2026
+ * @version 1.0
+ *
+ */
+#include "funcoes.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+ /** @def MAX_LEITORES_VERSOES
+  *  @brief Número máximo de threads de leitura registadas ao mesmo tempo.
+  */
+#define MAX_LEITORES_VERSOES 64
+
+#pragma region Estruturas
+
+/**
+ * @struct VistaGrafo
+ * @brief Cópia imutável de um grafo: antenas ordenadas por (x, y) e ligações em CSR.
+ *
+ * As ligações da antena i são destinos[inicio[i]] a destinos[inicio[i + 1] - 1] (posições no
+ * array de antenas); cada ligação aparece uma vez em cada sentido, como nas listas do grafo.
+ * Se os antinodos do grafo estiverem ativos (antinodos.h), a vista copia também as contagens
+ * do efeito nefasto; a ativação fica a cargo da thread de escrita.
+ */
+typedef struct VistaGrafo {
+    char frequencia;           /**< Frequência do grafo */
+    int numVertices;           /**< Número de antenas */
+    int numArestas;            /**< Número de entradas do array de destinos */
+    ANTENAS* antenas;          /**< Antenas, por ordem crescente de x e depois de y */
+    int* inicio;               /**< Início das ligações de cada antena (numVertices + 1 posições) */
+    int* destinos;             /**< Antena de destino de cada ligação */
+    long long* antinodos;      /**< Células com efeito nefasto (x * MAX_DIM + y), por ordem crescente */
+    int* contagensAntinodos;   /**< Pares de antenas com efeito nefasto em cada uma dessas células */
+    int numAntinodos;          /**< Número de células com efeito nefasto (-1 se os antinodos do grafo não estavam ativos) */
+    unsigned long long epoca;  /**< Época do grafo copiado */
+    int referencias;           /**< Versões que usam a vista (só alterado pela thread de escrita) */
+} VISTA_GRAFO;
+
+/**
+ * @struct VersaoRede
+ * @brief Versão publicada da rede: uma vista por grafo, pela ordem da lista de grafos.
+ */
+typedef struct VersaoRede {
+    unsigned long long numero;        /**< Número da versão (1 para a primeira publicada) */
+    VISTA_GRAFO** grafos;             /**< Vistas dos grafos */
+    int numGrafos;                    /**< Número de grafos */
+    unsigned long long epocaRetirada; /**< Época global a partir da qual a versão deixou de ser publicada (uso interno) */
+    struct VersaoRede* prox;          /**< Próxima versão à espera de ser libertada (uso interno) */
+} VERSAO_REDE;
+
+/**
+ * @brief Gestor das versões de uma rede (estrutura interna, com campos atómicos).
+ */
+typedef struct GestorVersoes GESTOR_VERSOES;
+
+#pragma endregion
+
+#pragma region Funções de Escrita
+
+/**
+ * @brief Cria o gestor de versões de uma rede e publica a primeira versão.
+ * @param rede Apontador para a rede (alterada daqui em diante só pela thread de escrita).
+ * @return Apontador para o gestor criado ou NULL em caso de erro.
+ */
+GESTOR_VERSOES* criarGestorVersoes(REDE* rede);
+
+/**
+ * @brief Publica uma nova versão com o estado atual da rede (só a thread de escrita).
+ * @param gestor Apontador para o gestor.
+ * @return Apontador para a versão publicada ou NULL em caso de erro (a versão anterior continua publicada).
+ */
+const VERSAO_REDE* publicarVersao(GESTOR_VERSOES* gestor);
+
+/**
+ * @brief Liberta as versões substituídas que já nenhum leitor pode estar a usar (só a thread de escrita).
+ * @param gestor Apontador para o gestor.
+ * @return Número de versões libertadas.
+ */
+int recolherVersoes(GESTOR_VERSOES* gestor);
+
+/**
+ * @brief Liberta o gestor e todas as versões (nenhum leitor pode estar dentro de uma leitura).
+ * @param gestor Apontador para o gestor a destruir.
+ * @return NULL, indicando que o gestor foi destruído.
+ */
+GESTOR_VERSOES* destruirGestorVersoes(GESTOR_VERSOES* gestor);
+
+#pragma endregion
+
+#pragma region Funções de Leitura
+
+/**
+ * @brief Reserva uma posição de leitor para a thread que chama.
+ * @param gestor Apontador para o gestor.
+ * @return Número do leitor, ou -1 se já houver MAX_LEITORES_VERSOES leitores registados.
+ */
+int registarLeitor(GESTOR_VERSOES* gestor);
+
+/**
+ * @brief Liberta a posição de um leitor (fora de uma leitura).
+ * @param gestor Apontador para o gestor.
+ * @param leitor Número devolvido por registarLeitor.
+ */
+void libertarLeitor(GESTOR_VERSOES* gestor, int leitor);
+
+/**
+ * @brief Começa uma leitura e devolve a versão publicada, válida até sairLeitura.
+ * @param gestor Apontador para o gestor.
+ * @param leitor Número do leitor da thread que chama.
+ * @return Apontador para a versão atual (NULL se os argumentos forem inválidos).
+ */
+const VERSAO_REDE* entrarLeitura(GESTOR_VERSOES* gestor, int leitor);
+
+/**
+ * @brief Termina a leitura do leitor (a versão obtida deixa de poder ser usada).
+ * @param gestor Apontador para o gestor.
+ * @param leitor Número do leitor da thread que chama.
+ */
+void sairLeitura(GESTOR_VERSOES* gestor, int leitor);
+
+/**
+ * @brief Procura a vista do grafo de uma frequência numa versão.
+ * @param versao Apontador para a versão.
+ * @param frequencia Frequência do grafo.
+ * @return Apontador para a vista, ou NULL se a versão não tiver esse grafo.
+ */
+const VISTA_GRAFO* procurarVistaGrafo(const VERSAO_REDE* versao, char frequencia);
+
+/**
+ * @brief Procura uma antena numa vista (pesquisa binária).
+ * @param vista Apontador para a vista.
+ * @param x Coordenada X da antena.
+ * @param y Coordenada Y da antena.
+ * @return Posição da antena na vista, ou -1 se não existir.
+ */
+int procurarAntenaVista(const VISTA_GRAFO* vista, int x, int y);
+
+/**
+ * @brief Verifica se duas antenas de uma vista estão ligadas diretamente.
+ * @param vista Apontador para a vista.
+ * @param xOrigem Coordenada X da primeira antena.
+ * @param yOrigem Coordenada Y da primeira antena.
+ * @param xDestino Coordenada X da segunda antena.
+ * @param yDestino Coordenada Y da segunda antena.
+ * @return true se existir uma ligação entre as duas antenas.
+ */
+bool ligadasVista(const VISTA_GRAFO* vista, int xOrigem, int yOrigem, int xDestino, int yDestino);
+
+/**
+ * @brief Número de pares de antenas da vista com efeito nefasto na célula (x, y), como contagemAntinodo.
+ * @param vista Apontador para a vista.
+ * @param x Coordenada X da célula.
+ * @param y Coordenada Y da célula.
+ * @return Número de pares, ou -1 se a vista for nula ou os antinodos do grafo não estivessem ativos quando foi copiada.
+ */
+int contagemAntinodoVista(const VISTA_GRAFO* vista, int x, int y);
+
+/**
+ * @brief Conta as antenas alcançáveis a partir de uma antena de uma vista (procura em largura), como a BFT.
+ * @param vista Apontador para a vista.
+ * @param x Coordenada X da antena de origem.
+ * @param y Coordenada Y da antena de origem.
+ * @return Número de antenas alcançadas, incluindo a origem, ou -1 se a antena não existir ou a alocação falhar.
+ */
+int contarAlcancaveisVista(const VISTA_GRAFO* vista, int x, int y);
+
+#pragma endregion
+
+#ifdef __cplusplus
+}
+#endif